@@ -0,0 +1,250 @@
+#include "anim_bake.h"
+#include "gl_utils.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+/* floats per bone per frame: 3 rows of 4 */
+#define BAKED_FLOATS_PER_BONE 12
+
+void init_baked_anims( Baked_Anims *anims, int bone_count ) {
+    anims->bone_count = bone_count;
+    anims->clip_count = 0;
+    anims->row_count = 0;
+    anims->texels = NULL;
+    anims->texture = 0;
+}
+
+int bake_clip( Baked_Anims *anims, double duration, float frame_rate, Pose_Sampler sample,
+               void *user ) {
+    if ( anims->clip_count >= MAX_BAKED_CLIPS ) {
+        gl_log_err( "ERROR: can't bake more than %i clips\n", MAX_BAKED_CLIPS );
+        return -1;
+    }
+    int frame_count = (int)ceil( duration * frame_rate ) + 1;
+    size_t row_floats = (size_t)anims->bone_count * BAKED_FLOATS_PER_BONE;
+    float *texels = (float *)realloc( anims->texels, ( anims->row_count + frame_count ) * row_floats * sizeof( float ) );
+    glm::mat4 *mats = (glm::mat4 *)malloc( anims->bone_count * sizeof( glm::mat4 ) );
+    if ( !texels || !mats ) {
+        gl_log_err( "ERROR: out of memory baking a %i frame clip\n", frame_count );
+        free( mats );
+        anims->texels = texels ? texels : anims->texels;
+        return -1;
+    }
+    anims->texels = texels;
+
+    for ( int f = 0; f < frame_count; f++ ) {
+        double t = f / (double)frame_rate;
+        for ( int b = 0; b < anims->bone_count; b++ ) {
+            mats[b] = glm::mat4( 1.f );
+        }
+        sample( t < duration ? t : duration, mats, user );
+        float *row = texels + ( anims->row_count + f ) * row_floats;
+        for ( int b = 0; b < anims->bone_count; b++ ) {
+            // the bottom row of a bone matrix is always 0 0 0 1, so leave it out
+            for ( int r = 0; r < 3; r++ ) {
+                for ( int c = 0; c < 4; c++ ) {
+                    row[b * BAKED_FLOATS_PER_BONE + r * 4 + c] = mats[b][c][r];
+                }
+            }
+        }
+    }
+    free( mats );
+
+    int id = anims->clip_count++;
+    Baked_Clip *clip = &anims->clips[id];
+    clip->first_row = anims->row_count;
+    clip->frame_count = frame_count;
+    clip->frame_rate = frame_rate;
+    clip->duration = (float)duration;
+    anims->row_count += frame_count;
+
+    gl_log( "baked clip %i: %i bones, %i frames at %.1f/unit, %u bytes of texture\n", id,
+            anims->bone_count, frame_count, frame_rate, (unsigned int)baked_clip_bytes( anims, id ) );
+    return id;
+}
+
+size_t baked_clip_bytes( const Baked_Anims *anims, int clip ) {
+    return (size_t)anims->clips[clip].frame_count * anims->bone_count * BAKED_FLOATS_PER_BONE *
+           sizeof( float );
+}
+
+bool upload_baked_anims( Baked_Anims *anims ) {
+    GLint max_size = 0;
+    glGetIntegerv( GL_MAX_TEXTURE_SIZE, &max_size );
+    int width = anims->bone_count * 3;
+    if ( width > max_size || anims->row_count > max_size ) {
+        gl_log_err( "ERROR: baked animations need a %ix%i texture, max is %i\n", width,
+                    anims->row_count, max_size );
+        return false;
+    }
+
+    glGenTextures( 1, &anims->texture );
+    glActiveTexture( GL_TEXTURE0 + BAKED_ANIM_TEXTURE_UNIT );
+    glBindTexture( GL_TEXTURE_2D, anims->texture );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA32F, width, anims->row_count, 0, GL_RGBA, GL_FLOAT,
+                  anims->texels );
+    // the shader only uses texelFetch, and interpolates frames itself
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+    glActiveTexture( GL_TEXTURE0 );
+
+    size_t total = 0;
+    for ( int i = 0; i < anims->clip_count; i++ ) {
+        total += baked_clip_bytes( anims, i );
+    }
+    printf( "baked animation texture %ix%i: %i clips, %.1f KB\n", width, anims->row_count,
+            anims->clip_count, total / 1024.0 );
+    return true;
+}
+
+void setup_baked_programme( const Baked_Anims *anims, GLuint programme ) {
+    glUseProgram( programme );
+    glUniform1i( glGetUniformLocation( programme, "baked_anims" ), BAKED_ANIM_TEXTURE_UNIT );
+    float table[MAX_BAKED_CLIPS * 4];
+    for ( int i = 0; i < anims->clip_count; i++ ) {
+        table[i * 4] = (float)anims->clips[i].first_row;
+        table[i * 4 + 1] = (float)anims->clips[i].frame_count;
+        table[i * 4 + 2] = anims->clips[i].frame_rate;
+        table[i * 4 + 3] = anims->clips[i].duration;
+    }
+    glUniform4fv( glGetUniformLocation( programme, "clips[0]" ), anims->clip_count, table );
+}
+
+void bind_baked_anims( const Baked_Anims *anims ) {
+    glActiveTexture( GL_TEXTURE0 + BAKED_ANIM_TEXTURE_UNIT );
+    glBindTexture( GL_TEXTURE_2D, anims->texture );
+    glActiveTexture( GL_TEXTURE0 );
+}
+
+void free_baked_anims( Baked_Anims *anims ) {
+    glDeleteTextures( 1, &anims->texture );
+    free( anims->texels );
+    anims->texels = NULL;
+    anims->texture = 0;
+    anims->row_count = 0;
+    anims->clip_count = 0;
+}
+
+void make_crowd_grid( const Baked_Anims *anims, Crowd_Instance *instances, int count, float spacing ) {
+    int side = (int)ceil( sqrt( (double)count ) );
+    float duration = anims->clip_count > 0 ? anims->clips[0].duration : 1.0f;
+    for ( int i = 0; i < count; i++ ) {
+        int x = i % side;
+        int z = i / side;
+        instances[i].offset = glm::vec3( ( x - ( side - 1 ) * 0.5f ) * spacing, 0.0f, -z * spacing );
+        instances[i].phase = duration * ( ( i * 7 ) % 16 ) / 16.0f;
+        instances[i].clip = anims->clip_count > 0 ? i % anims->clip_count : 0;
+    }
+}
+
+GLuint create_crowd_instance_buffer( GLuint vao, const Crowd_Instance *instances, int count ) {
+    GLuint vbo;
+    glBindVertexArray( vao );
+    glGenBuffers( 1, &vbo );
+    glBindBuffer( GL_ARRAY_BUFFER, vbo );
+    glBufferData( GL_ARRAY_BUFFER, count * sizeof( Crowd_Instance ), instances, GL_STATIC_DRAW );
+    GLsizei stride = sizeof( Crowd_Instance );
+    glVertexAttribPointer( 4, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offsetof( Crowd_Instance, offset ) );
+    glVertexAttribPointer( 5, 1, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offsetof( Crowd_Instance, phase ) );
+    glVertexAttribIPointer( 6, 1, GL_INT, stride, (GLvoid *)offsetof( Crowd_Instance, clip ) );
+    for ( int i = 4; i <= 6; i++ ) {
+        glVertexAttribDivisor( i, 1 );
+        glEnableVertexAttribArray( i );
+    }
+    return vbo;
+}
+
+void benchmark_baked_crowd( Baked_Anims *anims, GLuint vao, int point_count, GLuint baked_programme,
+                            Pose_Sampler sample, void *user, const Bone_Palette *palette,
+                            GLuint skinned_programme ) {
+    const int counts[] = { 1, 16, 64, 256, 1024 };
+    const int num_counts = sizeof( counts ) / sizeof( counts[0] );
+    const int max_count = counts[num_counts - 1];
+    const int frames = 5;
+    typedef std::chrono::steady_clock Clock;
+
+    Crowd_Instance *instances = (Crowd_Instance *)malloc( max_count * sizeof( Crowd_Instance ) );
+    glm::mat4 *mats = (glm::mat4 *)malloc( anims->bone_count * sizeof( glm::mat4 ) );
+    make_crowd_grid( anims, instances, max_count, 2.5f );
+    GLuint instance_vbo = create_crowd_instance_buffer( vao, instances, max_count );
+    int time_loc = glGetUniformLocation( baked_programme, "anim_time" );
+    int model_loc = glGetUniformLocation( skinned_programme, "mat_model" );
+
+    size_t bytes = 0;
+    for ( int i = 0; i < anims->clip_count; i++ ) {
+        bytes += baked_clip_bytes( anims, i );
+    }
+    printf( "crowd of %i-vertex, %i-bone instances, %i clips baked into %.1f KB, %i frames per row:\n",
+            point_count, anims->bone_count, anims->clip_count, bytes / 1024.0, frames );
+    printf( "  %9s | %10s %10s | %10s %10s %13s\n", "instances", "baked ms", "inst/ms",
+            "cpu-skin ms", "inst/ms", "anim us/inst" );
+
+    for ( int c = 0; c < num_counts; c++ ) {
+        int count = counts[c];
+
+        /* baked: the CPU sets a time and makes one draw call. frame 0 is a
+         warm-up and isn't timed */
+        glUseProgram( baked_programme );
+        bind_baked_anims( anims );
+        glBindVertexArray( vao );
+        Clock::time_point start;
+        for ( int f = 0; f <= frames; f++ ) {
+            if ( f == 1 ) {
+                glFinish();
+                start = Clock::now();
+            }
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            glUniform1f( time_loc, f * 0.1f );
+            glDrawArraysInstanced( GL_TRIANGLES, 0, point_count, count );
+        }
+        glFinish();
+        double baked_ms = std::chrono::duration<double, std::milli>( Clock::now() - start ).count() / frames;
+
+        /* CPU path: sample the skeleton and upload a palette per instance */
+        glUseProgram( skinned_programme );
+        bind_bone_palette( palette );
+        double anim_us = 0.0;
+        for ( int f = 0; f <= frames; f++ ) {
+            if ( f == 1 ) {
+                glFinish();
+                start = Clock::now();
+                anim_us = 0.0;
+            }
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            for ( int i = 0; i < count; i++ ) {
+                Clock::time_point anim_start = Clock::now();
+                for ( int b = 0; b < anims->bone_count; b++ ) {
+                    mats[b] = glm::mat4( 1.f );
+                }
+                sample( fmod( f * 0.1 + instances[i].phase, anims->clips[0].duration ), mats, user );
+                anim_us += std::chrono::duration<double, std::micro>( Clock::now() - anim_start ).count();
+                upload_bone_palette( palette, mats, anims->bone_count );
+                glm::mat4 model = glm::translate( glm::mat4( 1.f ), instances[i].offset );
+                glUniformMatrix4fv( model_loc, 1, GL_FALSE, glm::value_ptr( model ) );
+                glDrawArrays( GL_TRIANGLES, 0, point_count );
+            }
+        }
+        glFinish();
+        double cpu_ms = std::chrono::duration<double, std::milli>( Clock::now() - start ).count() / frames;
+
+        printf( "  %9i | %10.3f %10.2f | %10.3f %10.2f %13.3f\n", count, baked_ms, count / baked_ms,
+                cpu_ms, count / cpu_ms, anim_us / frames / count );
+        gl_log( "crowd %i instances: baked %.3f ms/frame, cpu-skinned %.3f ms/frame\n", count,
+                baked_ms, cpu_ms );
+    }
+
+    glm::mat4 identity( 1.f );
+    glUniformMatrix4fv( model_loc, 1, GL_FALSE, glm::value_ptr( identity ) );
+    glBindVertexArray( vao );
+    for ( int i = 4; i <= 6; i++ ) {
+        glDisableVertexAttribArray( i );
+    }
+    glDeleteBuffers( 1, &instance_vbo );
+    free( mats );
+    free( instances );
+}
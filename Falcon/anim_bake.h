@@ -0,0 +1,83 @@
+#ifndef _ANIM_BAKE_H_
+#define _ANIM_BAKE_H_
+
+#include <GL/glew.h> // include GLEW and new version of GL on Windows
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include "bone_palette.h"
+
+/* animation clips can be "baked" at import time: every bone's matrix is
+ sampled at a fixed rate and stored in a float texture, one row per frame and
+ 3 RGBA32F texels (the top 3 rows of the matrix) per bone. the vertex shader
+ (baked_vs.glsl) then finds and interpolates its own palette from the instance's
+ clip and time, so drawing any number of animated instances costs the CPU one
+ instanced draw call. good for crowds that don't need per-instance control */
+
+/* the shader's clip table is a uniform array of this size */
+#define MAX_BAKED_CLIPS 16
+/* texture unit the baked animation texture is bound to */
+#define BAKED_ANIM_TEXTURE_UNIT 2
+
+struct Baked_Clip {
+    int first_row;
+    int frame_count; // includes a frame at exactly the end of the clip
+    float frame_rate; // frames per unit of animation time
+    float duration;
+};
+
+struct Baked_Anims {
+    int bone_count;
+    int clip_count;
+    int row_count;
+    Baked_Clip clips[MAX_BAKED_CLIPS];
+    float *texels; // row_count * bone_count * 12 floats
+    GLuint texture;
+};
+
+/* writes the pose at time into bone_mats. bones the sampler doesn't touch stay
+ identity */
+typedef void ( *Pose_Sampler )( double time, glm::mat4 *bone_mats, void *user );
+
+void init_baked_anims( Baked_Anims *anims, int bone_count );
+
+/* sample a clip of the given duration at frame_rate and append it. returns
+ the clip's ID, or -1 if the table is full */
+int bake_clip( Baked_Anims *anims, double duration, float frame_rate, Pose_Sampler sample,
+               void *user );
+
+/* texture memory one clip takes up */
+size_t baked_clip_bytes( const Baked_Anims *anims, int clip );
+
+/* create the texture. the CPU copy is kept, e.g. for writing to disk */
+bool upload_baked_anims( Baked_Anims *anims );
+
+/* call once on each programme built from baked_vs.glsl, after linking */
+void setup_baked_programme( const Baked_Anims *anims, GLuint programme );
+
+void bind_baked_anims( const Baked_Anims *anims );
+
+void free_baked_anims( Baked_Anims *anims );
+
+/* per-instance vertex attributes for baked_vs.glsl */
+struct Crowd_Instance {
+    glm::vec3 offset; // added to the world position
+    float phase;      // added to the time
+    int clip;
+};
+
+/* a square grid of instances spaced spacing apart, cycling through the clips
+ with their phases spread over clip 0's duration */
+void make_crowd_grid( const Baked_Anims *anims, Crowd_Instance *instances, int count, float spacing );
+
+/* put the instances in a buffer and attach them to vao as attributes 4
+ (offset), 5 (phase) and 6 (clip), one per instance */
+GLuint create_crowd_instance_buffer( GLuint vao, const Crowd_Instance *instances, int count );
+
+/* time drawing crowds of 1 to 1024 instances two ways: baked (one instanced
+ draw) and the per-instance CPU path (sample + palette upload + draw each).
+ draws into whatever framebuffer is bound */
+void benchmark_baked_crowd( Baked_Anims *anims, GLuint vao, int point_count, GLuint baked_programme,
+                            Pose_Sampler sample, void *user, const Bone_Palette *palette,
+                            GLuint skinned_programme );
+
+#endif
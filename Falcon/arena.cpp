@@ -0,0 +1,44 @@
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool arena_create( Arena *arena, size_t capacity ) {
+    arena->base = (unsigned char *)malloc( capacity );
+    arena->capacity = arena->base ? capacity : 0;
+    arena->used = 0;
+    return arena->base != NULL;
+}
+
+void *arena_alloc( Arena *arena, size_t size, size_t alignment ) {
+    assert( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+    /* align the address, not the offset - malloc only promises so much */
+    uintptr_t start = (uintptr_t)( arena->base + arena->used );
+    size_t padding = ( alignment - ( start & ( alignment - 1 ) ) ) & ( alignment - 1 );
+    if ( arena->used + padding + size > arena->capacity ) {
+        assert( !"arena out of memory" );
+        return NULL;
+    }
+    void *p = arena->base + arena->used + padding;
+    arena->used += padding + size;
+    memset( p, 0, size );
+    return p;
+}
+
+void *arena_release( Arena *arena ) {
+    void *block = arena->base;
+    if ( block && arena->used > 0 && arena->used < arena->capacity ) {
+        void *trimmed = realloc( block, arena->used );
+        block = trimmed ? trimmed : block;
+    }
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+    return block;
+}
+
+void arena_destroy( Arena *arena ) {
+    free( arena->base );
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+}
@@ -0,0 +1,70 @@
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* linear ("bump") allocator over a single malloc'd block. allocations are
+ never freed one at a time - the whole block goes at once - which is exactly
+ how asset data lives and dies. */
+struct Arena {
+    unsigned char *base;
+    size_t capacity;
+    size_t used;
+};
+
+/* one malloc of capacity bytes. returns false if that fails */
+bool arena_create( Arena *arena, size_t capacity );
+
+/* returns NULL (and asserts in debug builds) if the arena is full. memory is
+ zeroed */
+void *arena_alloc( Arena *arena, size_t size, size_t alignment = 16 );
+
+/* everything allocated after taking a mark can be thrown away by rolling back
+ to it */
+inline size_t arena_mark( const Arena *arena ) { return arena->used; }
+inline void arena_rollback( Arena *arena, size_t mark ) {
+    assert( mark <= arena->used );
+    arena->used = mark;
+}
+
+/* worst-case bytes an allocation can take, alignment padding included. use to
+ size an arena up front */
+inline size_t arena_bytes_for( size_t size, size_t alignment = 16 ) {
+    return size + alignment - 1;
+}
+
+/* hand over the block, trimmed to what was used. the arena is left empty and
+ the caller owns the memory (free() it). the block may move, so anything in it
+ must refer to the rest of the block with Rel_Ptr, not raw pointers */
+void *arena_release( Arena *arena );
+
+void arena_destroy( Arena *arena );
+
+/* a pointer stored as the distance from its own address to its target.
+ a block whose internal links are all Rel_Ptrs can be memcpy'd, realloc'd or
+ written to disk and read back at a different address and still be valid.
+ for the same reason it can't be copied on its own - that would point the copy
+ somewhere else */
+template <typename T> struct Rel_Ptr {
+    Rel_Ptr() : offset( 0 ) {}
+
+    Rel_Ptr &operator=( T *p ) {
+        offset = p ? (int32_t)( (const char *)p - (const char *)this ) : 0;
+        return *this;
+    }
+
+    T *get() const {
+        return offset ? (T *)( (char *)this + offset ) : NULL;
+    }
+    operator T *() const { return get(); }
+    T *operator->() const { return get(); }
+
+    int32_t offset; // 0 is NULL
+  private:
+    Rel_Ptr( const Rel_Ptr & );
+    Rel_Ptr &operator=( const Rel_Ptr & );
+};
+
+#endif
@@ -0,0 +1,253 @@
+#include "bone_palette.h"
+#include "gl_utils.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+/* uniform components the skinning shader needs for things other than the
+ palette (model, view and projection matrices plus some slack) */
+#define RESERVED_UNIFORM_COMPONENTS 64
+
+const char *palette_backend_name( Palette_Backend backend ) {
+    switch ( backend ) {
+    case PALETTE_UNIFORM_ARRAY:
+        return "uniform array";
+    case PALETTE_TEXTURE_BUFFER:
+        return "texture buffer";
+    case PALETTE_STORAGE_BUFFER:
+        return "storage buffer";
+    default:
+        return "unknown";
+    }
+}
+
+int palette_backend_capacity( Palette_Backend backend ) {
+    GLint value = 0;
+    switch ( backend ) {
+    case PALETTE_UNIFORM_ARRAY:
+        glGetIntegerv( GL_MAX_VERTEX_UNIFORM_COMPONENTS, &value );
+        return value > RESERVED_UNIFORM_COMPONENTS ? ( value - RESERVED_UNIFORM_COMPONENTS ) / 16 : 0;
+    case PALETTE_TEXTURE_BUFFER:
+        if ( !GLEW_VERSION_3_1 ) {
+            return 0;
+        }
+        glGetIntegerv( GL_MAX_TEXTURE_BUFFER_SIZE, &value );
+        return value / 4;
+    case PALETTE_STORAGE_BUFFER:
+        /* needs GLSL 4.30 as well as the extension, so go by the version */
+        if ( !GLEW_VERSION_4_3 ) {
+            return 0;
+        }
+        glGetIntegerv( GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &value );
+        if ( value < 1 ) {
+            return 0;
+        }
+        glGetIntegerv( GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &value );
+        return value / (int)sizeof( glm::mat4 );
+    default:
+        return 0;
+    }
+}
+
+Palette_Backend choose_palette_backend( int bone_count ) {
+    Palette_Backend backend = PALETTE_TEXTURE_BUFFER;
+    if ( bone_count <= palette_backend_capacity( PALETTE_UNIFORM_ARRAY ) ) {
+        backend = PALETTE_UNIFORM_ARRAY;
+    } else if ( bone_count <= palette_backend_capacity( PALETTE_STORAGE_BUFFER ) ) {
+        backend = PALETTE_STORAGE_BUFFER;
+    }
+    gl_log( "bone palette: %i bones, capacity uniform %i texture buffer %i storage buffer %i. using %s\n",
+            bone_count, palette_backend_capacity( PALETTE_UNIFORM_ARRAY ),
+            palette_backend_capacity( PALETTE_TEXTURE_BUFFER ),
+            palette_backend_capacity( PALETTE_STORAGE_BUFFER ), palette_backend_name( backend ) );
+    return backend;
+}
+
+void palette_shader_header( const Bone_Palette *palette, char *header, int max_len ) {
+    switch ( palette->backend ) {
+    case PALETTE_UNIFORM_ARRAY:
+        snprintf( header, max_len,
+                  "#version 410\n"
+                  "uniform mat4 bone_matrices[%i];\n"
+                  "mat4 bone_matrix( int i ) { return bone_matrices[i]; }\n",
+                  palette->max_bones );
+        break;
+    case PALETTE_TEXTURE_BUFFER:
+        /* one bone = 4 RGBA32F texels, a column each */
+        snprintf( header, max_len,
+                  "#version 410\n"
+                  "uniform samplerBuffer bone_palette;\n"
+                  "mat4 bone_matrix( int i ) {\n"
+                  "    return mat4( texelFetch( bone_palette, i * 4 ),\n"
+                  "                 texelFetch( bone_palette, i * 4 + 1 ),\n"
+                  "                 texelFetch( bone_palette, i * 4 + 2 ),\n"
+                  "                 texelFetch( bone_palette, i * 4 + 3 ) );\n"
+                  "}\n" );
+        break;
+    case PALETTE_STORAGE_BUFFER:
+        snprintf( header, max_len,
+                  "#version 430\n"
+                  "layout(std430, binding = %i) readonly buffer Bone_Palette {\n"
+                  "    mat4 bone_matrices[];\n"
+                  "};\n"
+                  "mat4 bone_matrix( int i ) { return bone_matrices[i]; }\n",
+                  PALETTE_STORAGE_BINDING );
+        break;
+    default:
+        header[0] = '\0';
+        break;
+    }
+}
+
+static GLenum palette_buffer_target( Palette_Backend backend ) {
+    return backend == PALETTE_STORAGE_BUFFER ? GL_SHADER_STORAGE_BUFFER : GL_TEXTURE_BUFFER;
+}
+
+/* every bone starts out as identity */
+static void upload_identity( const Bone_Palette *palette ) {
+    glm::mat4 *mats = (glm::mat4 *)malloc( palette->max_bones * sizeof( glm::mat4 ) );
+    for ( int i = 0; i < palette->max_bones; i++ ) {
+        mats[i] = glm::mat4( 1.f );
+    }
+    upload_bone_palette( palette, mats, palette->max_bones );
+    free( mats );
+}
+
+bool create_bone_palette( Bone_Palette *palette, Palette_Backend backend, int max_bones ) {
+    palette->backend = backend;
+    palette->max_bones = max_bones;
+    palette->buffer = 0;
+    palette->texture = 0;
+    palette->location = -1;
+
+    int capacity = palette_backend_capacity( backend );
+    if ( max_bones > capacity ) {
+        gl_log_err( "ERROR: %s bone palette holds at most %i bones, %i asked for\n",
+                    palette_backend_name( backend ), capacity, max_bones );
+        return false;
+    }
+    if ( backend == PALETTE_UNIFORM_ARRAY ) {
+        // storage comes with the programme. see setup_palette_programme()
+        return true;
+    }
+
+    GLenum target = palette_buffer_target( backend );
+    glGenBuffers( 1, &palette->buffer );
+    glBindBuffer( target, palette->buffer );
+    glBufferData( target, max_bones * sizeof( glm::mat4 ), NULL, GL_STREAM_DRAW );
+    if ( backend == PALETTE_TEXTURE_BUFFER ) {
+        glGenTextures( 1, &palette->texture );
+        glActiveTexture( GL_TEXTURE0 + PALETTE_TEXTURE_UNIT );
+        glBindTexture( GL_TEXTURE_BUFFER, palette->texture );
+        glTexBuffer( GL_TEXTURE_BUFFER, GL_RGBA32F, palette->buffer );
+        glActiveTexture( GL_TEXTURE0 );
+    } else {
+        glBindBufferBase( GL_SHADER_STORAGE_BUFFER, PALETTE_STORAGE_BINDING, palette->buffer );
+    }
+    upload_identity( palette );
+    return true;
+}
+
+void setup_palette_programme( Bone_Palette *palette, GLuint programme ) {
+    glUseProgram( programme );
+    if ( palette->backend == PALETTE_UNIFORM_ARRAY ) {
+        palette->location = glGetUniformLocation( programme, "bone_matrices[0]" );
+        if ( palette->location < 0 ) {
+            fprintf( stderr, "Error: could not find location of bone_matrices\n" );
+        }
+        upload_identity( palette );
+    } else if ( palette->backend == PALETTE_TEXTURE_BUFFER ) {
+        glUniform1i( glGetUniformLocation( programme, "bone_palette" ), PALETTE_TEXTURE_UNIT );
+    }
+}
+
+void bind_bone_palette( const Bone_Palette *palette ) {
+    if ( palette->backend == PALETTE_TEXTURE_BUFFER ) {
+        glActiveTexture( GL_TEXTURE0 + PALETTE_TEXTURE_UNIT );
+        glBindTexture( GL_TEXTURE_BUFFER, palette->texture );
+        glActiveTexture( GL_TEXTURE0 );
+    } else if ( palette->backend == PALETTE_STORAGE_BUFFER ) {
+        glBindBufferBase( GL_SHADER_STORAGE_BUFFER, PALETTE_STORAGE_BINDING, palette->buffer );
+    }
+}
+
+void upload_bone_palette( const Bone_Palette *palette, const glm::mat4 *mats, int count ) {
+    assert( count <= palette->max_bones );
+    if ( palette->backend == PALETTE_UNIFORM_ARRAY ) {
+        glUniformMatrix4fv( palette->location, count, GL_FALSE, glm::value_ptr( mats[0] ) );
+        return;
+    }
+    /* orphan the old storage first so we don't wait on draws still reading it */
+    GLenum target = palette_buffer_target( palette->backend );
+    glBindBuffer( target, palette->buffer );
+    glBufferData( target, palette->max_bones * sizeof( glm::mat4 ), NULL, GL_STREAM_DRAW );
+    glBufferSubData( target, 0, count * sizeof( glm::mat4 ), mats );
+}
+
+void destroy_bone_palette( Bone_Palette *palette ) {
+    glDeleteTextures( 1, &palette->texture );
+    glDeleteBuffers( 1, &palette->buffer );
+    palette->texture = 0;
+    palette->buffer = 0;
+}
+
+void benchmark_palette_upload( const char *vert_file_name, const char *frag_file_name ) {
+    const int max_bones = 1024;
+    const int reps = 500;
+
+    glm::mat4 *mats = (glm::mat4 *)malloc( max_bones * sizeof( glm::mat4 ) );
+    for ( int i = 0; i < max_bones; i++ ) {
+        mats[i] = glm::translate( glm::mat4( 1.f ), glm::vec3( 0.f, i * 0.001f, 0.f ) );
+    }
+    /* the draws have no attributes bound; they are only there so the GPU reads
+     each upload before the next one replaces it */
+    GLuint vao;
+    glGenVertexArrays( 1, &vao );
+    glBindVertexArray( vao );
+
+    printf( "bone palette upload, %i uploads + 1-point draws per row:\n", reps );
+    printf( "  %-15s %5s %12s %10s\n", "backend", "bones", "us/upload", "ns/bone" );
+    for ( int b = 0; b < PALETTE_BACKEND_COUNT; b++ ) {
+        Palette_Backend backend = (Palette_Backend)b;
+        int capacity = palette_backend_capacity( backend );
+        if ( capacity < 32 ) {
+            printf( "  %-15s not supported by this context\n", palette_backend_name( backend ) );
+            continue;
+        }
+        for ( int count = 32; count <= max_bones && count <= capacity; count *= 2 ) {
+            Bone_Palette palette;
+            if ( !create_bone_palette( &palette, backend, count ) ) {
+                continue;
+            }
+            char header[1024];
+            palette_shader_header( &palette, header, sizeof( header ) );
+            GLuint programme = create_programme_from_files( vert_file_name, frag_file_name, header );
+            setup_palette_programme( &palette, programme );
+            bind_bone_palette( &palette );
+
+            for ( int i = 0; i < 10; i++ ) {
+                upload_bone_palette( &palette, mats, count );
+                glDrawArrays( GL_POINTS, 0, 1 );
+            }
+            glFinish();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for ( int i = 0; i < reps; i++ ) {
+                upload_bone_palette( &palette, mats, count );
+                glDrawArrays( GL_POINTS, 0, 1 );
+            }
+            glFinish();
+            double us = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now() - start ).count() / reps;
+            printf( "  %-15s %5i %12.2f %10.2f\n", palette_backend_name( backend ), count, us,
+                    us * 1000.0 / count );
+            gl_log( "palette upload %s %i bones: %.2f us/upload\n", palette_backend_name( backend ), count, us );
+
+            glDeleteProgram( programme );
+            destroy_bone_palette( &palette );
+        }
+    }
+    glDeleteVertexArrays( 1, &vao );
+    free( mats );
+}
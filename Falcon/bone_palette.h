@@ -0,0 +1,62 @@
+#ifndef _BONE_PALETTE_H_
+#define _BONE_PALETTE_H_
+
+#include <GL/glew.h> // include GLEW and new version of GL on Windows
+#include <glm/mat4x4.hpp>
+
+/* where the skinning shader reads its bone matrices from */
+enum Palette_Backend {
+    PALETTE_UNIFORM_ARRAY,	// uniform mat4 bone_matrices[n] - cheap, but only a few hundred fit
+    PALETTE_TEXTURE_BUFFER, // samplerBuffer of RGBA32F texels, 4 per bone (GL 3.1)
+    PALETTE_STORAGE_BUFFER, // shader storage buffer of mat4 (GL 4.3)
+    PALETTE_BACKEND_COUNT
+};
+
+/* texture unit the texture-buffer backend binds its palette to. unit 0 is
+ left for the colour texture */
+#define PALETTE_TEXTURE_UNIT 1
+/* shader storage buffer binding point of the storage-buffer backend */
+#define PALETTE_STORAGE_BINDING 0
+
+struct Bone_Palette {
+    Palette_Backend backend;
+    int max_bones;
+    GLuint buffer;	// texture/storage buffer backends
+    GLuint texture; // texture buffer backend
+    GLint location; // uniform array backend: location of bone_matrices[0]
+};
+
+const char *palette_backend_name( Palette_Backend backend );
+
+/* how many bones the current GL context can hold with a backend. 0 if the
+ context doesn't support it at all */
+int palette_backend_capacity( Palette_Backend backend );
+
+/* pick a backend for a skeleton from the limits of the current context:
+ uniforms while the palette fits in them, otherwise a storage buffer if the
+ context has them, otherwise a texture buffer */
+Palette_Backend choose_palette_backend( int bone_count );
+
+/* the start of the skinning vertex shader for a palette: #version line plus
+ a mat4 bone_matrix( int i ) function the shader body calls */
+void palette_shader_header( const Bone_Palette *palette, char *header, int max_len );
+
+bool create_bone_palette( Bone_Palette *palette, Palette_Backend backend, int max_bones );
+
+/* call once on each programme that reads the palette, after linking */
+void setup_palette_programme( Bone_Palette *palette, GLuint programme );
+
+/* bind the palette's buffers for drawing */
+void bind_bone_palette( const Bone_Palette *palette );
+
+/* replace the first count matrices. for the uniform array backend the
+ programme set up with setup_palette_programme() must be in use */
+void upload_bone_palette( const Bone_Palette *palette, const glm::mat4 *mats, int count );
+
+void destroy_bone_palette( Bone_Palette *palette );
+
+/* time palette uploads on every backend the context supports, from 32 to 1024
+ bones, and print the cost per upload and per bone */
+void benchmark_palette_upload( const char *vert_file_name, const char *frag_file_name );
+
+#endif
@@ -14,9 +14,15 @@
  \******************************************************************************/
 #include "gl_utils.h"
 #include <assert.h>
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include <stdlib.h>
+#ifdef __linux__
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
 #define GL_LOG_FILE "gl.log"
 #define MAX_SHADER_LENGTH 262144
 
@@ -118,6 +124,172 @@ bool start_gl() {
     return true;
 }
 
+/*-----------------------------HEADLESS (NO WINDOW)---------------------------*/
+bool g_headless = false;
+static GLuint g_headless_fbo;
+static GLuint g_headless_renderbuffers[2];
+
+#ifdef __linux__
+static EGLDisplay g_egl_display = EGL_NO_DISPLAY;
+static EGLContext g_egl_context = EGL_NO_CONTEXT;
+static EGLSurface g_egl_surface = EGL_NO_SURFACE;
+
+static bool start_egl() {
+    /* Mesa's surfaceless platform needs nothing but the driver. anywhere else
+     use the default display */
+    const char *client_extensions = eglQueryString( EGL_NO_DISPLAY, EGL_EXTENSIONS );
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress( "eglGetPlatformDisplayEXT" );
+    bool surfaceless = get_platform_display && client_extensions &&
+                       strstr( client_extensions, "EGL_MESA_platform_surfaceless" );
+    g_egl_display = surfaceless ?
+        get_platform_display( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL ) :
+        eglGetDisplay( EGL_DEFAULT_DISPLAY );
+    EGLint major = 0, minor = 0;
+    if ( g_egl_display == EGL_NO_DISPLAY || !eglInitialize( g_egl_display, &major, &minor ) ) {
+        fprintf( stderr, "ERROR: could not start EGL\n" );
+        return false;
+    }
+    gl_log( "starting EGL %i.%i, %s platform\n", major, minor, surfaceless ? "surfaceless" : "default" );
+    if ( !eglBindAPI( EGL_OPENGL_API ) ) {
+        fprintf( stderr, "ERROR: EGL has no desktop OpenGL\n" );
+        return false;
+    }
+
+    EGLint config_attribs[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                                EGL_NONE };
+    EGLConfig config;
+    EGLint num_configs = 0;
+    if ( !eglChooseConfig( g_egl_display, config_attribs, &config, 1, &num_configs ) || num_configs < 1 ) {
+        fprintf( stderr, "ERROR: no EGL config for an OpenGL pbuffer\n" );
+        return false;
+    }
+    /* the shaders are #version 410, and the storage buffer palette wants 4.3.
+     ask for 4.3 core first and settle for 4.1 */
+    const EGLint versions[][2] = { { 4, 3 }, { 4, 1 } };
+    for ( int i = 0; i < 2 && g_egl_context == EGL_NO_CONTEXT; i++ ) {
+        EGLint context_attribs[] = { EGL_CONTEXT_MAJOR_VERSION, versions[i][0],
+                                     EGL_CONTEXT_MINOR_VERSION, versions[i][1],
+                                     EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                                     EGL_NONE };
+        g_egl_context = eglCreateContext( g_egl_display, config, EGL_NO_CONTEXT, context_attribs );
+        if ( g_egl_context != EGL_NO_CONTEXT ) {
+            gl_log( "EGL context: OpenGL %i.%i core\n", versions[i][0], versions[i][1] );
+        }
+    }
+    if ( g_egl_context == EGL_NO_CONTEXT ) {
+        fprintf( stderr, "ERROR: could not create an OpenGL 4.1 core context with EGL (0x%x)\n",
+                 eglGetError() );
+        return false;
+    }
+    /* we never draw to it - it's only there because not every EGL can make a
+     context current without a surface */
+    EGLint pbuffer_attribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    g_egl_surface = eglCreatePbufferSurface( g_egl_display, config, pbuffer_attribs );
+    if ( !eglMakeCurrent( g_egl_display, g_egl_surface, g_egl_surface, g_egl_context ) ) {
+        fprintf( stderr, "ERROR: could not make the EGL context current\n" );
+        return false;
+    }
+    return true;
+}
+
+static void stop_egl() {
+    eglMakeCurrent( g_egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+    if ( g_egl_surface != EGL_NO_SURFACE ) {
+        eglDestroySurface( g_egl_display, g_egl_surface );
+    }
+    eglDestroyContext( g_egl_display, g_egl_context );
+    eglTerminate( g_egl_display );
+    g_egl_display = EGL_NO_DISPLAY;
+}
+#endif
+
+bool start_gl_headless() {
+#ifdef __linux__
+    if ( !start_egl() ) {
+        return false;
+    }
+    glewExperimental = GL_TRUE;
+    /* a GLX build of GLEW loads the GL functions and then fails to find a
+     GLX display, which doesn't matter here */
+    GLenum glew_err = glewInit();
+    if ( glew_err != GLEW_OK ) {
+        gl_log( "glewInit: %s (ignored)\n", glewGetErrorString( glew_err ) );
+    }
+    const GLubyte *renderer = glGetString( GL_RENDERER );
+    const GLubyte *version = glGetString( GL_VERSION );
+    printf( "Renderer: %s\n", renderer );
+    printf( "OpenGL version supported %s\n", version );
+    gl_log( "renderer: %s\nversion: %s\n", renderer, version );
+#else
+    if ( !glfwInit() ) {
+        fprintf( stderr, "ERROR: could not start GLFW3\n" );
+        return false;
+    }
+    glfwWindowHint( GLFW_VISIBLE, GL_FALSE );
+    if ( !start_gl() ) {
+        return false;
+    }
+#endif
+    g_headless = true;
+
+    glGenFramebuffers( 1, &g_headless_fbo );
+    glBindFramebuffer( GL_FRAMEBUFFER, g_headless_fbo );
+    glGenRenderbuffers( 2, g_headless_renderbuffers );
+    glBindRenderbuffer( GL_RENDERBUFFER, g_headless_renderbuffers[0] );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, g_gl_width, g_gl_height );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                               g_headless_renderbuffers[0] );
+    glBindRenderbuffer( GL_RENDERBUFFER, g_headless_renderbuffers[1] );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, g_gl_width, g_gl_height );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER,
+                               g_headless_renderbuffers[1] );
+    GLenum status = glCheckFramebufferStatus( GL_FRAMEBUFFER );
+    if ( status != GL_FRAMEBUFFER_COMPLETE ) {
+        gl_log_err( "ERROR: offscreen framebuffer incomplete (0x%x)\n", status );
+        return false;
+    }
+    gl_log( "drawing offscreen at %ix%i\n", g_gl_width, g_gl_height );
+    return true;
+}
+
+void stop_gl() {
+    if ( !g_headless ) {
+        glfwTerminate();
+        return;
+    }
+    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+    glDeleteRenderbuffers( 2, g_headless_renderbuffers );
+    glDeleteFramebuffers( 1, &g_headless_fbo );
+    g_headless = false;
+#ifdef __linux__
+    stop_egl();
+#else
+    glfwTerminate();
+#endif
+}
+
+bool write_frame_ppm( const char *file_name ) {
+    int row_bytes = g_gl_width * 3;
+    unsigned char *pixels = (unsigned char *)malloc( row_bytes * g_gl_height );
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glReadPixels( 0, 0, g_gl_width, g_gl_height, GL_RGB, GL_UNSIGNED_BYTE, pixels );
+    FILE *file = fopen( file_name, "wb" );
+    if ( !file ) {
+        gl_log_err( "ERROR: could not open %s for writing\n", file_name );
+        free( pixels );
+        return false;
+    }
+    fprintf( file, "P6\n%i %i\n255\n", g_gl_width, g_gl_height );
+    // GL's first row is the bottom one
+    for ( int y = g_gl_height - 1; y >= 0; y-- ) {
+        fwrite( pixels + y * row_bytes, 1, row_bytes, file );
+    }
+    fclose( file );
+    free( pixels );
+    return true;
+}
+
 void glfw_error_callback( int error, const char *description ) {
     fputs( description, stderr );
     gl_log_err( "%s\n", description );
@@ -146,6 +318,29 @@ void _update_fps_counter( GLFWwindow *window ) {
     frame_count++;
 }
 
+void _update_frame_time_stats() {
+    static double previous_seconds = glfwGetTime();
+    static double report_seconds = previous_seconds;
+    static double sum, sum_sq, worst;
+    static int frame_count;
+    double current_seconds = glfwGetTime();
+    double frame_ms = ( current_seconds - previous_seconds ) * 1000.0;
+    previous_seconds = current_seconds;
+    sum += frame_ms;
+    sum_sq += frame_ms * frame_ms;
+    worst = frame_ms > worst ? frame_ms : worst;
+    frame_count++;
+    if ( current_seconds - report_seconds > 5.0 ) {
+        double mean = sum / frame_count;
+        double variance = sum_sq / frame_count - mean * mean;
+        gl_log( "frame time over %i frames: mean %.3f ms, std dev %.3f ms, worst %.3f ms\n",
+                frame_count, mean, sqrt( variance > 0.0 ? variance : 0.0 ), worst );
+        report_seconds = current_seconds;
+        sum = sum_sq = worst = 0.0;
+        frame_count = 0;
+    }
+}
+
 /*-----------------------------------SHADERS----------------------------------*/
 bool parse_file_into_str( const char *file_name, char *shader_str, int max_len ) {
     shader_str[0] = '\0'; // reset string
@@ -183,13 +378,16 @@ void print_shader_info_log( GLuint shader_index ) {
     gl_log( "shader info log for GL index %i:\n%s\n", shader_index, log );
 }
 
-bool create_shader( const char *file_name, GLuint *shader, GLenum type ) {
+bool create_shader( const char *file_name, GLuint *shader, GLenum type,
+                    const char *header ) {
     gl_log( "creating shader from %s...\n", file_name );
     char shader_string[MAX_SHADER_LENGTH];
     parse_file_into_str( file_name, shader_string, MAX_SHADER_LENGTH );
     *shader = glCreateShader( type );
-    const GLchar *p = (const GLchar *)shader_string;
-    glShaderSource( *shader, 1, &p, NULL );
+    /* the header (if any) goes in front of the file as a separate string */
+    const GLchar *p[2] = { (const GLchar *)( header ? header : "" ),
+                           (const GLchar *)shader_string };
+    glShaderSource( *shader, 2, p, NULL );
     glCompileShader( *shader );
     // check for compile errors
     int params = -1;
@@ -249,10 +447,10 @@ bool create_programme( GLuint vert, GLuint frag, GLuint *programme ) {
 }
 
 GLuint create_programme_from_files( const char *vert_file_name,
-                                   const char *frag_file_name ) {
+                                   const char *frag_file_name, const char *vert_header ) {
     GLuint vert, frag, programme;
-    ( create_shader( vert_file_name, &vert, GL_VERTEX_SHADER ) );
-    ( create_shader( frag_file_name, &frag, GL_FRAGMENT_SHADER ) );
+    ( create_shader( vert_file_name, &vert, GL_VERTEX_SHADER, vert_header ) );
+    ( create_shader( frag_file_name, &frag, GL_FRAGMENT_SHADER, NULL ) );
     ( create_programme( vert, frag, &programme ) );
     return programme;
 }
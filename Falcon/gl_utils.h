@@ -22,6 +22,21 @@ extern GLFWwindow *g_window;
 
 bool start_gl();
 
+/* set once start_gl_headless() has run */
+extern bool g_headless;
+
+/* start GL with no window, for automated runs: an EGL context on Linux
+ (surfaceless on Mesa, so it needs no display server or GPU), a hidden GLFW
+ window elsewhere. drawing goes to an offscreen g_gl_width x g_gl_height
+ framebuffer, which is left bound */
+bool start_gl_headless();
+
+/* shut down whichever of start_gl() and start_gl_headless() ran */
+void stop_gl();
+
+/* write the current frame to a binary PPM file */
+bool write_frame_ppm( const char *file_name );
+
 bool restart_gl_log();
 
 bool gl_log( const char *message, ... );
@@ -38,6 +53,10 @@ void log_gl_params();
 
 void _update_fps_counter( GLFWwindow *window );
 
+/* call once per frame. every few seconds logs the mean, standard deviation and
+ worst of the frame times since the last report */
+void _update_frame_time_stats();
+
 void print_shader_info_log( GLuint shader_index );
 
 void print_programme_info_log( GLuint sp );
@@ -50,8 +69,14 @@ bool is_valid( GLuint sp );
 
 bool parse_file_into_str( const char *file_name, char *shader_str, int max_len );
 
-/* just use this func to create most shaders; give it vertex and frag files */
+bool create_shader( const char *file_name, GLuint *shader, GLenum type,
+                    const char *header = NULL );
+
+/* just use this func to create most shaders; give it vertex and frag files.
+ vert_header is source put in front of the vertex shader file (for shaders
+ that are generated per-backend and leave out their own #version line) */
 GLuint create_programme_from_files( const char *vert_file_name,
-                                  const char *frag_file_name );
+                                  const char *frag_file_name,
+                                  const char *vert_header = NULL );
 
 #endif
@@ -10,7 +10,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #include <glm/vec3.hpp> // glm::vec3
 #include <glm/vec4.hpp> // glm::vec4
@@ -21,6 +26,13 @@
 #include <glm/gtx/quaternion.hpp>
 
 #include "stb_image.h"
+#include "texture_compress.h"
+#include "triple_buffer.h"
+#include "arena.h"
+#include "name_table.h"
+#include "bone_palette.h"
+#include "anim_bake.h"
+#include "skin_cache.h"
 
 #include <assimp/cimport.h>
 #include <assimp/scene.h>
@@ -29,11 +41,21 @@
 //#define MESH_FILE "mesh/cube.dae"
 //#define MESH_FILE "mesh/monkey2.obj"
 #define MESH_FILE "mesh/monkey_11.dae"
+#define TEXTURE_FILE "textures/skulluvmap.png"
 
 #define GL_LOG_FILE "gl.log"
 
-/* max bones allowed in a mesh */
-#define MAX_BONES 32
+/* bump the version whenever Model or Skeleton_Node change, so old model files
+ get imported again */
+#define MODEL_FILE_MAGIC 0x4c444d46 // "FMDL"
+#define MODEL_FILE_VERSION 1
+
+/* max bones allowed in a mesh. the palette itself can go higher - this just
+ sizes the per-tick animation state */
+#define MAX_BONES 1024
+
+/* print every node and bone as the skeleton is imported */
+bool g_verbose_import = true;
 
 // keep track of window size for things like the viewport and the mouse cursor
 int g_gl_width = 640;
@@ -47,28 +69,48 @@ GLFWwindow *g_window = NULL;
  */
 struct Skeleton_Node;
 struct Skeleton_Node {
-    Skeleton_Node *children[MAX_BONES];
+    /* num_children links, allocated right after the node */
+    Rel_Ptr<Rel_Ptr<Skeleton_Node> > children;
     
    	/* key frames */
-    glm::vec3 *pos_keys;
-    glm::quat *rot_keys;
-    glm::vec3 *sca_keys;
-    double *pos_key_times;
-    double *rot_key_times;
-    double *sca_key_times;
+    Rel_Ptr<glm::vec3> pos_keys;
+    Rel_Ptr<glm::quat> rot_keys;
+    Rel_Ptr<glm::vec3> sca_keys;
+    Rel_Ptr<double> pos_key_times;
+    Rel_Ptr<double> rot_key_times;
+    Rel_Ptr<double> sca_key_times;
     int num_pos_keys;
     int num_rot_keys;
     int num_sca_keys;
     
     /* name of the bone - might be useful to remember for doing interesting stuff
-     in your programme */
-    char name[64];
+     in your programme. name_string() turns it back into text */
+    Name_ID name_id;
     int num_children;
     /* if this node corresponds to one of our weight-painted bones then we give
      the index of that (the bone_ID) here, otherwrise it is set to -1 */
     int bone_index;
 };
 
+/* everything we keep on the CPU for a loaded model - skeleton, animation keys,
+ bone offsets and vertex data - in one block of memory. it is allocated once,
+ sized up front from the assimp scene, and freed with a single free(). all the
+ links inside are Rel_Ptrs, so the block can also be written to disk as-is */
+struct Model {
+    uint32_t magic;   // MODEL_FILE_MAGIC, so a saved model can be recognised
+    uint32_t version; // MODEL_FILE_VERSION of the layout it was saved with
+    uint32_t size;    // bytes in the whole block, this header included
+    int point_count;
+    int bone_count;
+    double anim_duration;
+    Rel_Ptr<Skeleton_Node> root_node;
+    Rel_Ptr<glm::mat4> bone_offset_mats;
+    Rel_Ptr<GLfloat> points;
+    Rel_Ptr<GLfloat> normals;
+    Rel_Ptr<GLfloat> texcoords;
+    Rel_Ptr<GLint> bone_ids;
+};
+
 glm::mat4 convert_assimp_matrix( aiMatrix4x4 m ) {
     float srcmat[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
                 0.0f, m.a4, m.b4, m.c4, m.d4 };
@@ -77,14 +119,15 @@ glm::mat4 convert_assimp_matrix( aiMatrix4x4 m ) {
 }
 
 /* traverse a skeleton starting at root, and a get a pointer to a node with the
- given name */
-Skeleton_Node *find_node_in_skeleton( Skeleton_Node *root, const char *node_name ) {
+ given name. this visits the whole tree - to look up many names build a map
+ with map_skeleton_nodes() instead */
+Skeleton_Node *find_node_in_skeleton( Skeleton_Node *root, Name_ID node_name ) {
     
     // validate self
     assert( root );
     
     // look for match
-    if ( strcmp( node_name, root->name ) == 0 ) {
+    if ( node_name == root->name_id ) {
         return root;
     }
     
@@ -100,61 +143,70 @@ Skeleton_Node *find_node_in_skeleton( Skeleton_Node *root, const char *node_name
     return NULL;
 }
 
+int count_skeleton_nodes( const Skeleton_Node *root ) {
+    int count = 1;
+    for ( int i = 0; i < root->num_children; i++ ) {
+        count += count_skeleton_nodes( root->children[i] );
+    }
+    return count;
+}
+
+/* add every node in the skeleton to a name -> node map. if two nodes share a
+ name the first one found depth-first wins, same as find_node_in_skeleton() */
+void map_skeleton_nodes( Skeleton_Node *root, Name_Map<Skeleton_Node *> *map ) {
+    if ( !name_map_find<Skeleton_Node *>( map, root->name_id, NULL ) ) {
+        name_map_insert( map, root->name_id, root );
+    }
+    for ( int i = 0; i < root->num_children; i++ ) {
+        map_skeleton_nodes( root->children[i], map );
+    }
+}
+
 /* recursive function to pull all of AssImps 'node' hierarchy out. AssImp's
  tree will include everything in the scene; cameras, lights, the mesh, but also
  our "Armature" which further breaks into our skeleton hierarchy. When we find a
  node, we check if its name matches one of our bones' names. if so we record the
  index of that bone. */
 
-bool import_skeleton_node( aiNode *assimp_node, Skeleton_Node **skeleton_node,
-                          int bone_count, char bone_names[][64] ) {
-    // allocate memory for node
-    Skeleton_Node *temp = (Skeleton_Node *)malloc( sizeof( Skeleton_Node ) );
+bool import_skeleton_node( aiNode *assimp_node, Rel_Ptr<Skeleton_Node> *skeleton_node,
+                          const Name_Map<int> *bone_of_name, Arena *arena ) {
+    // allocate memory for node. if it gets culled, so does everything after it
+    size_t mark = arena_mark( arena );
+    Skeleton_Node *temp = (Skeleton_Node *)arena_alloc( arena, sizeof( Skeleton_Node ) );
     
     // get node properties out of AssImp
-    strcpy( temp->name, assimp_node->mName.C_Str() );
-    printf( "-node name = %s\n", temp->name );
+    temp->name_id = intern_name( assimp_node->mName.C_Str() );
+    if ( g_verbose_import ) {
+        printf( "-node name = %s\n", assimp_node->mName.C_Str() );
+        printf( "node has %i children\n", (int)assimp_node->mNumChildren );
+    }
     temp->num_children = 0;
-    
-   	/* initialise key-frame info */
-    temp->pos_keys = NULL;
-    temp->rot_keys = NULL;
-    temp->sca_keys = NULL;
-    temp->pos_key_times = NULL;
-    temp->rot_key_times = NULL;
-    temp->sca_key_times = NULL;
-    temp->num_pos_keys = 0;
-    temp->num_rot_keys = 0;
-    temp->num_sca_keys = 0;
-    
-    printf( "node has %i children\n", (int)assimp_node->mNumChildren );
-    temp->bone_index = -1;
-    for ( int i = 0; i < MAX_BONES; i++ ) {
-        temp->children[i] = NULL;
+    if ( assimp_node->mNumChildren > 0 ) {
+        temp->children = (Rel_Ptr<Skeleton_Node> *)arena_alloc(
+            arena, assimp_node->mNumChildren * sizeof( Rel_Ptr<Skeleton_Node> ), 4 );
     }
     
+   	/* key-frame info and children start out zeroed (NULL) by the arena */
+    
     // look for matching bone name
-    bool has_bone = false;
-    for ( int i = 0; i < bone_count; i++ ) {
-        if ( strcmp( bone_names[i], temp->name ) == 0 ) {
-            printf( "node uses bone %i\n", i );
-            temp->bone_index = i;
-            has_bone = true;
-            break;
+    temp->bone_index = name_map_find( bone_of_name, temp->name_id, -1 );
+    bool has_bone = temp->bone_index > -1;
+    if ( g_verbose_import ) {
+        if ( has_bone ) {
+            printf( "node uses bone %i\n", temp->bone_index );
+        } else {
+            printf( "no bone found for node\n" );
         }
     }
-    if ( !has_bone ) {
-        printf( "no bone found for node\n" );
-    }
     
     bool has_useful_child = false;
     for ( int i = 0; i < (int)assimp_node->mNumChildren; i++ ) {
         if ( import_skeleton_node( assimp_node->mChildren[i],
-                                  &temp->children[temp->num_children], bone_count,
-                                  bone_names ) ) {
+                                  &temp->children[temp->num_children],
+                                  bone_of_name, arena ) ) {
             has_useful_child = true;
             temp->num_children++;
-        } else {
+        } else if ( g_verbose_import ) {
             printf( "useless child culled\n" );
         }
     }
@@ -164,8 +216,7 @@ bool import_skeleton_node( aiNode *assimp_node, Skeleton_Node **skeleton_node,
         return true;
     }
     // no bone or good children - cull self
-    free( temp );
-    temp = NULL;
+    arena_rollback( arena, mark );
     return false;
 }
 
@@ -239,12 +290,153 @@ void skeleton_animate( Skeleton_Node *node, double anim_time, glm::mat4 parent_m
     }
 }
 
-/* load a mesh using the assimp library */
-bool load_mesh( const char *file_name, GLuint *vao, int *point_count, glm::mat4 *bone_offset_mats, int *bone_count, Skeleton_Node** root_node, double* anim_duration ) {
+/* count every node in assimp's tree - an upper bound on our skeleton's size */
+int count_assimp_nodes( const aiNode *node ) {
+    int count = 1;
+    for ( int i = 0; i < (int)node->mNumChildren; i++ ) {
+        count += count_assimp_nodes( node->mChildren[i] );
+    }
+    return count;
+}
+
+bool intern_node_names( const aiNode *node ) {
+    if ( NAME_ID_NONE == intern_name( node->mName.C_Str() ) ) {
+        return false;
+    }
+    for ( int i = 0; i < (int)node->mNumChildren; i++ ) {
+        if ( !intern_node_names( node->mChildren[i] ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* give every node name, bone name and channel name that import looks up an ID.
+ false if two different names get the same ID - they would bind each other's
+ bones and channels, so the mesh can't be imported */
+bool intern_scene_names( const aiScene *scene ) {
+    if ( !intern_node_names( scene->mRootNode ) ) {
+        return false;
+    }
+    const aiMesh *mesh = scene->mMeshes[0];
+    for ( int i = 0; i < (int)mesh->mNumBones; i++ ) {
+        if ( NAME_ID_NONE == intern_name( mesh->mBones[i]->mName.C_Str() ) ) {
+            return false;
+        }
+    }
+    if ( scene->mNumAnimations > 0 ) {
+        const aiAnimation *anim = scene->mAnimations[0];
+        for ( int i = 0; i < (int)anim->mNumChannels; i++ ) {
+            if ( NAME_ID_NONE == intern_name( anim->mChannels[i]->mNodeName.C_Str() ) ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* worst-case size of the Model block for the first mesh and animation in a
+ scene, so it can be allocated in one go before importing anything */
+size_t model_size_upper_bound( const aiScene *scene ) {
+    const aiMesh *mesh = scene->mMeshes[0];
+    size_t n = mesh->mNumVertices;
+    size_t size = arena_bytes_for( sizeof( Model ) );
+    size += arena_bytes_for( n * 3 * sizeof( GLfloat ) ) * 2; // points, normals
+    size += arena_bytes_for( n * 2 * sizeof( GLfloat ) );			// texcoords
+    size += arena_bytes_for( n * sizeof( GLint ) );						// bone ids
+    size += arena_bytes_for( mesh->mNumBones * sizeof( glm::mat4 ) );
+    /* every node is someone's child at most once, so the child link arrays add
+     up to one link per node plus alignment */
+    size += count_assimp_nodes( scene->mRootNode ) *
+            ( arena_bytes_for( sizeof( Skeleton_Node ) ) + arena_bytes_for( sizeof( Rel_Ptr<Skeleton_Node> ), 4 ) );
+    if ( scene->mNumAnimations > 0 ) {
+        const aiAnimation *anim = scene->mAnimations[0];
+        for ( int i = 0; i < (int)anim->mNumChannels; i++ ) {
+            const aiNodeAnim *chan = anim->mChannels[i];
+            size += arena_bytes_for( chan->mNumPositionKeys * ( sizeof( glm::vec3 ) + sizeof( double ) ) ) * 2;
+            size += arena_bytes_for( chan->mNumRotationKeys * ( sizeof( glm::quat ) + sizeof( double ) ) ) * 2;
+            size += arena_bytes_for( chan->mNumScalingKeys * ( sizeof( glm::vec3 ) + sizeof( double ) ) ) * 2;
+        }
+    }
+    return size;
+}
+
+/* how many separate mallocs the old importer made for this scene: one per
+ skeleton node visited, six per animation channel and one per vertex attribute.
+ kept for the import report */
+int count_legacy_allocations( const aiScene *scene ) {
+    int count = count_assimp_nodes( scene->mRootNode ) + 4;
+    if ( scene->mNumAnimations > 0 ) {
+        count += 6 * (int)scene->mAnimations[0]->mNumChannels;
+    }
+    return count;
+}
+
+/* peak resident set size of the process in megabytes */
+double peak_rss_mb() {
+    struct rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+#ifdef __APPLE__
+    return usage.ru_maxrss / ( 1024.0 * 1024.0 ); // bytes
+#else
+    return usage.ru_maxrss / 1024.0; // kilobytes
+#endif
+}
+
+/* a Model holds no pointers, so this is all it takes to save one */
+bool write_model_file( const char *file_name, const Model *model ) {
+    FILE *file = fopen( file_name, "wb" );
+    if ( !file ) {
+        fprintf( stderr, "ERROR: could not open %s for writing\n", file_name );
+        return false;
+    }
+    bool ok = 1 == fwrite( model, model->size, 1, file );
+    if ( EOF == fclose( file ) ) {
+        ok = false;
+    }
+    return ok;
+}
+
+/* read a model saved with write_model_file. returns NULL if there is no such
+ file, or it is not a whole model of this version. free() it when done */
+Model *read_model_file( const char *file_name ) {
+    FILE *file = fopen( file_name, "rb" );
+    if ( !file ) {
+        return NULL;
+    }
+    uint32_t header[3]; // magic, version, size
+    long file_size = -1;
+    if ( 1 == fread( header, sizeof( header ), 1, file ) && 0 == fseek( file, 0, SEEK_END ) ) {
+        file_size = ftell( file );
+    }
+    if ( file_size < 0 || MODEL_FILE_MAGIC != header[0] || MODEL_FILE_VERSION != header[1] ||
+         header[2] < sizeof( Model ) || (long)header[2] != file_size ) {
+        gl_log_err( "WARNING: %s is not a version %i model file, ignoring it\n", file_name,
+                    MODEL_FILE_VERSION );
+        fclose( file );
+        return NULL;
+    }
+    Model *model = (Model *)malloc( header[2] );
+    if ( model ) {
+        rewind( file );
+        if ( 1 != fread( model, header[2], 1, file ) ) {
+            free( model );
+            model = NULL;
+        }
+    }
+    fclose( file );
+    return model;
+}
+
+/* import a mesh using the assimp library. the skeleton, the first animation
+ and a CPU-side copy of the vertex data go into one Model block; the caller
+ frees it with free(). returns NULL on failure */
+Model *import_model( const char *file_name ) {
+    double rss_before = peak_rss_mb();
     const aiScene *scene = aiImportFile( file_name, aiProcess_Triangulate );
     if ( !scene ) {
         fprintf( stderr, "ERROR: reading mesh %s\n", file_name );
-        return false;
+        return NULL;
     }
     printf( "  %i animations\n", scene->mNumAnimations );
     printf( "  %i cameras\n", scene->mNumCameras );
@@ -257,68 +449,112 @@ bool load_mesh( const char *file_name, GLuint *vao, int *point_count, glm::mat4
     const aiMesh *mesh = scene->mMeshes[0];
     printf( "    %i vertices in mesh[0]\n", mesh->mNumVertices );
     
-    /* pass back number of vertex points in mesh */
-    *point_count = mesh->mNumVertices;
+    /* the one and only allocation for this model */
+    Arena arena;
+    if ( !arena_create( &arena, model_size_upper_bound( scene ) ) ) {
+        fprintf( stderr, "ERROR: out of memory loading mesh %s\n", file_name );
+        aiReleaseImport( scene );
+        return NULL;
+    }
+    Model *model = (Model *)arena_alloc( &arena, sizeof( Model ) );
+    model->magic = MODEL_FILE_MAGIC;
+    model->version = MODEL_FILE_VERSION;
     
-    /* generate a VAO, using the pass-by-reference parameter that we give to the
-     function */
-    glGenVertexArrays( 1, vao );
-    glBindVertexArray( *vao );
+    /* pass back number of vertex points in mesh */
+    model->point_count = mesh->mNumVertices;
+    int point_count = model->point_count;
     
     /* we really need to copy out all the data from AssImp's funny little data
      structures into pure contiguous arrays before we copy it into data buffers
      because assimp's texture coordinates are not really contiguous in memory.
-     i allocate some dynamic memory to do this. */
-    GLfloat *points = NULL;		 // array of vertex points
-    GLfloat *normals = NULL;	 // array of vertex normals
-    GLfloat *texcoords = NULL; // array of texture coordinates
-    GLint *bone_ids = NULL;		 // array of bone IDs
+     the arrays live in the model, so we also keep a CPU-side copy */
     if ( mesh->HasPositions() ) {
-        points = (GLfloat *)malloc( *point_count * 3 * sizeof( GLfloat ) );
-        for ( int i = 0; i < *point_count; i++ ) {
+        GLfloat *points = (GLfloat *)arena_alloc( &arena, point_count * 3 * sizeof( GLfloat ) );
+        for ( int i = 0; i < point_count; i++ ) {
             const aiVector3D *vp = &( mesh->mVertices[i] );
             points[i * 3] = (GLfloat)vp->x;
             points[i * 3 + 1] = (GLfloat)vp->y;
             points[i * 3 + 2] = (GLfloat)vp->z;
         }
+        model->points = points;
     }
     if ( mesh->HasNormals() ) {
-        normals = (GLfloat *)malloc( *point_count * 3 * sizeof( GLfloat ) );
-        for ( int i = 0; i < *point_count; i++ ) {
+        GLfloat *normals = (GLfloat *)arena_alloc( &arena, point_count * 3 * sizeof( GLfloat ) );
+        for ( int i = 0; i < point_count; i++ ) {
             const aiVector3D *vn = &( mesh->mNormals[i] );
             normals[i * 3] = (GLfloat)vn->x;
             normals[i * 3 + 1] = (GLfloat)vn->y;
             normals[i * 3 + 2] = (GLfloat)vn->z;
         }
+        model->normals = normals;
     }
     if ( mesh->HasTextureCoords( 0 ) ) {
-        texcoords = (GLfloat *)malloc( *point_count * 2 * sizeof( GLfloat ) );
-        for ( int i = 0; i < *point_count; i++ ) {
+        GLfloat *texcoords = (GLfloat *)arena_alloc( &arena, point_count * 2 * sizeof( GLfloat ) );
+        for ( int i = 0; i < point_count; i++ ) {
             const aiVector3D *vt = &( mesh->mTextureCoords[0][i] );
             texcoords[i * 2] = (GLfloat)vt->x;
             texcoords[i * 2 + 1] = (GLfloat)vt->y;
         }
+        model->texcoords = texcoords;
     }
     
     /* extract bone weights */
     if ( mesh->HasBones() ) {
-        *bone_count = (int)mesh->mNumBones;
-        /* an array of bones names. max 256 bones, max name length 64 */
-        char bone_names[256][64];
+        model->bone_count = (int)mesh->mNumBones;
+        if ( model->bone_count > MAX_BONES ) {
+            fprintf( stderr, "ERROR: mesh %s has %i bones, max is %i\n", file_name, model->bone_count, MAX_BONES );
+            arena_destroy( &arena );
+            aiReleaseImport( scene );
+            return NULL;
+        }
+        
+        if ( !intern_scene_names( scene ) ) {
+            fprintf( stderr, "ERROR: mesh %s has two names with the same ID\n", file_name );
+            arena_destroy( &arena );
+            aiReleaseImport( scene );
+            return NULL;
+        }
+        
+        /* scratch space for the name lookups, thrown away after import */
+        Arena scratch;
+        if ( !arena_create( &scratch, name_map_bytes_for<int>( model->bone_count ) +
+                                      name_map_bytes_for<Skeleton_Node *>( count_assimp_nodes( scene->mRootNode ) ) ) ) {
+            fprintf( stderr, "ERROR: out of memory loading mesh %s\n", file_name );
+            arena_destroy( &arena );
+            aiReleaseImport( scene );
+            return NULL;
+        }
+        /* bone name -> bone index, and skeleton node name -> node so binding
+         the animation channels below is one lookup per channel */
+        Name_Map<int> bone_of_name;
+        Name_Map<Skeleton_Node *> node_of_name;
+        if ( !name_map_create( &bone_of_name, model->bone_count, &scratch ) ||
+             !name_map_create( &node_of_name, count_assimp_nodes( scene->mRootNode ), &scratch ) ) {
+            fprintf( stderr, "ERROR: out of memory loading mesh %s\n", file_name );
+            arena_destroy( &scratch );
+            arena_destroy( &arena );
+            aiReleaseImport( scene );
+            return NULL;
+        }
         
         /* here I allocate an array of per-vertex bone IDs.
          each vertex must know which bone(s) affect it
          here I simplify, and assume that only one bone can affect each vertex,
          so my array is only one-dimensional
          */
-        bone_ids = (int *)calloc( *point_count, sizeof( int ) );
+        GLint *bone_ids = (GLint *)arena_alloc( &arena, point_count * sizeof( GLint ) );
+        model->bone_ids = bone_ids;
+        glm::mat4 *bone_offset_mats = (glm::mat4 *)arena_alloc( &arena, model->bone_count * sizeof( glm::mat4 ) );
+        model->bone_offset_mats = bone_offset_mats;
         
-        for ( int b_i = 0; b_i < *bone_count; b_i++ ) {
+        for ( int b_i = 0; b_i < model->bone_count; b_i++ ) {
             const aiBone *bone = mesh->mBones[b_i];
             
             /* get bone names */
-            strcpy( bone_names[b_i], bone->mName.data );
-            printf( "bone_names[%i]=%s\n", b_i, bone_names[b_i] );
+            name_map_insert( &bone_of_name, intern_name( bone->mName.data ), b_i );
+            if ( g_verbose_import ) {
+                printf( "bone_names[%i]=%s\n", b_i, bone->mName.data );
+            }
             
             /* get [inverse] offset matrix for each bone */
             bone_offset_mats[b_i] = convert_assimp_matrix( bone->mOffsetMatrix );
@@ -342,9 +578,11 @@ bool load_mesh( const char *file_name, GLuint *vao, int *point_count, glm::mat4
         // there should always be a 'root node', even if no skeleton exists
         aiNode *assimp_node = scene->mRootNode;
         
-        if ( !import_skeleton_node( assimp_node, root_node, *bone_count,
-                                   bone_names ) ) {
+        if ( !import_skeleton_node( assimp_node, &model->root_node, &bone_of_name,
+                                   &arena ) ) {
             fprintf( stderr, "ERROR: could not import node tree from mesh\n" );
+        } else {
+            map_skeleton_nodes( model->root_node, &node_of_name );
         } // endif
         
         /* get the first animation out and into keys */
@@ -357,14 +595,14 @@ bool load_mesh( const char *file_name, GLuint *vao, int *point_count, glm::mat4
             printf( "animation duration %f\n", anim->mDuration );
             printf( "ticks per second %f\n", anim->mTicksPerSecond );
             
-            *anim_duration = anim->mDuration;
+            model->anim_duration = anim->mDuration;
             printf( "anim duration is %f\n", anim->mDuration );
             
             //  get the node channels
             for ( int i = 0; i < (int)anim->mNumChannels; i++ ) {
                 aiNodeAnim *chan = anim->mChannels[i];
                 // find the matching node in our skeleton by name
-                Skeleton_Node *sn = find_node_in_skeleton( *root_node, chan->mNodeName.C_Str() );
+                Skeleton_Node *sn = name_map_find<Skeleton_Node *>( &node_of_name, intern_name( chan->mNodeName.C_Str() ), NULL );
                 if ( !sn ) {
                     fprintf( stderr, "WARNING: did not find node named %s in skeleton."
                             "animation broken.\n",
@@ -377,93 +615,618 @@ bool load_mesh( const char *file_name, GLuint *vao, int *point_count, glm::mat4
                 sn->num_sca_keys = chan->mNumScalingKeys;
                 
                 // allocate memory
-                sn->pos_keys = (glm::vec3 *)malloc( sizeof( glm::vec3 ) * sn->num_pos_keys );
-                sn->rot_keys = (glm::quat *)malloc( sizeof( glm::quat ) * sn->num_rot_keys );
-                sn->sca_keys = (glm::vec3 *)malloc( sizeof( glm::vec3 ) * sn->num_sca_keys );
-                sn->pos_key_times = (double *)malloc( sizeof( double ) * sn->num_pos_keys );
-                sn->rot_key_times = (double *)malloc( sizeof( double ) * sn->num_rot_keys );
-                sn->sca_key_times = (double *)malloc( sizeof( double ) * sn->num_sca_keys );
+                glm::vec3 *pos_keys = (glm::vec3 *)arena_alloc( &arena, sizeof( glm::vec3 ) * sn->num_pos_keys );
+                glm::quat *rot_keys = (glm::quat *)arena_alloc( &arena, sizeof( glm::quat ) * sn->num_rot_keys );
+                glm::vec3 *sca_keys = (glm::vec3 *)arena_alloc( &arena, sizeof( glm::vec3 ) * sn->num_sca_keys );
+                double *pos_key_times = (double *)arena_alloc( &arena, sizeof( double ) * sn->num_pos_keys );
+                double *rot_key_times = (double *)arena_alloc( &arena, sizeof( double ) * sn->num_rot_keys );
+                double *sca_key_times = (double *)arena_alloc( &arena, sizeof( double ) * sn->num_sca_keys );
                 
                 // add position keys to node
                 for ( int i = 0; i < sn->num_pos_keys; i++ ) {
                     aiVectorKey key = chan->mPositionKeys[i];
-                    sn->pos_keys[i] = glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z);
-                    sn->pos_key_times[i] = key.mTime;
+                    pos_keys[i] = glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z);
+                    pos_key_times[i] = key.mTime;
                 }
                 // add rotation keys to node
                 for ( int i = 0; i < sn->num_rot_keys; i++ ) {
                     aiQuatKey key = chan->mRotationKeys[i];
-                    sn->rot_keys[i] = glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z);
-                    sn->rot_key_times[i] = key.mTime;
+                    rot_keys[i] = glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z);
+                    rot_key_times[i] = key.mTime;
                 }
                 // add scaling keys to node
                 for ( int i = 0; i < sn->num_sca_keys; i++ ) {
                     aiVectorKey key = chan->mScalingKeys[i];
-                    sn->sca_keys[i] = glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z);
-                    sn->sca_key_times[i] = key.mTime;
+                    sca_keys[i] = glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z);
+                    sca_key_times[i] = key.mTime;
                 } // endfor
+                
+                sn->pos_keys = pos_keys;
+                sn->rot_keys = rot_keys;
+                sn->sca_keys = sca_keys;
+                sn->pos_key_times = pos_key_times;
+                sn->rot_key_times = rot_key_times;
+                sn->sca_key_times = sca_key_times;
             }		// endfor mNumChannels
         } else {
             fprintf( stderr, "WARNING: no animations found in mesh file\n" );
         } // endif mNumAnimations > 0
         
-        
+        arena_destroy( &scratch );
     }		// endif
     
-    /* copy mesh data into VBOs */
-    if ( mesh->HasPositions() ) {
+    int legacy_allocations = count_legacy_allocations( scene );
+    size_t reserved = arena.capacity;
+    aiReleaseImport( scene );
+    
+    /* trim the block down to what we used. it may move, which is fine */
+    model->size = (uint32_t)arena.used;
+    model = (Model *)arena_release( &arena );
+    
+    gl_log( "model %s: 1 allocation of %u bytes (%u reserved), previously %i allocations. "
+            "peak RSS %.1f MB before import, %.1f MB after\n",
+            file_name, model->size, (unsigned int)reserved, legacy_allocations,
+            rss_before, peak_rss_mb() );
+    
+    return model;
+}
+
+/* copy a model's vertex data into VBOs of a new VAO */
+void upload_model_vertices( const Model *model, GLuint *vao ) {
+    int point_count = model->point_count;
+    glGenVertexArrays( 1, vao );
+    glBindVertexArray( *vao );
+    
+    if ( model->points ) {
         GLuint vbo;
         glGenBuffers( 1, &vbo );
         glBindBuffer( GL_ARRAY_BUFFER, vbo );
-        glBufferData( GL_ARRAY_BUFFER, 3 * *point_count * sizeof( GLfloat ), points,
+        glBufferData( GL_ARRAY_BUFFER, 3 * point_count * sizeof( GLfloat ), model->points,
                      GL_STATIC_DRAW );
         glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, 0, NULL );
         glEnableVertexAttribArray( 0 );
-        free( points );
     }
-    if ( mesh->HasNormals() ) {
+    if ( model->normals ) {
         GLuint vbo;
         glGenBuffers( 1, &vbo );
         glBindBuffer( GL_ARRAY_BUFFER, vbo );
-        glBufferData( GL_ARRAY_BUFFER, 3 * *point_count * sizeof( GLfloat ), normals,
+        glBufferData( GL_ARRAY_BUFFER, 3 * point_count * sizeof( GLfloat ), model->normals,
                      GL_STATIC_DRAW );
         glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, 0, NULL );
         glEnableVertexAttribArray( 1 );
-        free( normals );
     }
-    if ( mesh->HasTextureCoords( 0 ) ) {
+    if ( model->texcoords ) {
         GLuint vbo;
         glGenBuffers( 1, &vbo );
         glBindBuffer( GL_ARRAY_BUFFER, vbo );
-        glBufferData( GL_ARRAY_BUFFER, 2 * *point_count * sizeof( GLfloat ), texcoords,
+        glBufferData( GL_ARRAY_BUFFER, 2 * point_count * sizeof( GLfloat ), model->texcoords,
                      GL_STATIC_DRAW );
         glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, 0, NULL );
         glEnableVertexAttribArray( 2 );
-        free( texcoords );
     }
-    if ( mesh->HasTangentsAndBitangents() ) {
-        // NB: could store/print tangents here
-    }
-    if ( mesh->HasBones() ) {
+    if ( model->bone_ids ) {
         GLuint vbo;
         glGenBuffers( 1, &vbo );
         glBindBuffer( GL_ARRAY_BUFFER, vbo );
-        glBufferData( GL_ARRAY_BUFFER, *point_count * sizeof( GLint ), bone_ids,
+        glBufferData( GL_ARRAY_BUFFER, point_count * sizeof( GLint ), model->bone_ids,
                      GL_STATIC_DRAW );
         glVertexAttribIPointer( 3, 1, GL_INT, 0, NULL );
         glEnableVertexAttribArray( 3 );
-        free( bone_ids );
     }
+}
+
+/* load a mesh. the Model block is saved next to the mesh file as <file>.model
+ and read back from there, without assimp, until the mesh file changes */
+bool load_mesh( const char *file_name, GLuint *vao, Model **model_out ) {
+    char model_file[1024];
+    snprintf( model_file, sizeof( model_file ), "%s.model", file_name );
     
-    aiReleaseImport( scene );
+    Model *model = NULL;
+    struct stat src_stat, model_stat;
+    if ( 0 == stat( model_file, &model_stat ) &&
+         ( 0 != stat( file_name, &src_stat ) || src_stat.st_mtime <= model_stat.st_mtime ) ) {
+        model = read_model_file( model_file );
+    }
+    if ( model ) {
+        gl_log( "model %s: using saved model %s\n", file_name, model_file );
+    } else {
+        model = import_model( file_name );
+        if ( !model ) {
+            return false;
+        }
+        if ( !write_model_file( model_file, model ) ) {
+            gl_log_err( "WARNING: could not save model %s\n", model_file );
+        }
+    }
+    upload_model_vertices( model, vao );
+    *model_out = model;
     printf( "mesh loaded\n" );
+    return true;
+}
+
+/* time skeleton import and animation channel binding on a made-up rig of
+ num_bones bones (each with 4 children) with one channel per bone. the old
+ approaches - strcmp against every bone name per node, and a tree search per
+ channel - are timed alongside for comparison */
+void benchmark_skeleton_import( int num_bones ) {
+    const int reps = 20;
+    char name[64];
+    
+    aiNode *root = new aiNode();
+    root->mName.Set( "Scene" );
+    root->mNumChildren = 1;
+    root->mChildren = new aiNode *[1];
+    aiNode **bones = new aiNode *[num_bones];
+    for ( int i = 0; i < num_bones; i++ ) {
+        bones[i] = new aiNode();
+        sprintf( name, "rig_bone_%04i", i );
+        bones[i]->mName.Set( name );
+        bones[i]->mChildren = new aiNode *[4];
+    }
+    root->mChildren[0] = bones[0];
+    bones[0]->mParent = root;
+    for ( int i = 1; i < num_bones; i++ ) {
+        aiNode *parent = bones[( i - 1 ) / 4];
+        parent->mChildren[parent->mNumChildren++] = bones[i];
+        bones[i]->mParent = parent;
+    }
+    
+    Arena scratch, arena;
+    if ( !arena_create( &scratch, name_map_bytes_for<int>( num_bones ) +
+                                  name_map_bytes_for<Skeleton_Node *>( num_bones + 1 ) ) ) {
+        fprintf( stderr, "ERROR: out of memory\n" );
+        return;
+    }
+    if ( !arena_create( &arena, ( num_bones + 1 ) * ( arena_bytes_for( sizeof( Skeleton_Node ) ) +
+                                                      arena_bytes_for( sizeof( Rel_Ptr<Skeleton_Node> ), 4 ) ) ) ) {
+        fprintf( stderr, "ERROR: out of memory\n" );
+        arena_destroy( &scratch );
+        return;
+    }
+    bool verbose = g_verbose_import;
+    g_verbose_import = false;
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for ( int r = 0; r < reps; r++ ) {
+        arena_rollback( &scratch, 0 );
+        arena_rollback( &arena, 0 );
+        Name_Map<int> bone_of_name;
+        if ( !name_map_create( &bone_of_name, num_bones, &scratch ) ) {
+            break; // can't happen - scratch is sized for it
+        }
+        for ( int i = 0; i < num_bones; i++ ) {
+            name_map_insert( &bone_of_name, intern_name( bones[i]->mName.C_Str() ), i );
+        }
+        Rel_Ptr<Skeleton_Node> *skeleton = (Rel_Ptr<Skeleton_Node> *)arena_alloc( &arena, sizeof( Rel_Ptr<Skeleton_Node> ) );
+        import_skeleton_node( root, skeleton, &bone_of_name, &arena );
+    }
+    double import_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count() / reps;
+    
+    /* what import used to do per node: strcmp against every bone name */
+    int found = 0;
+    start = std::chrono::steady_clock::now();
+    for ( int r = 0; r < reps; r++ ) {
+        for ( int n = 0; n < num_bones; n++ ) {
+            for ( int b = 0; b < num_bones; b++ ) {
+                if ( strcmp( bones[b]->mName.C_Str(), bones[n]->mName.C_Str() ) == 0 ) {
+                    found++;
+                    break;
+                }
+            }
+        }
+    }
+    double strcmp_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count() / reps;
+    
+    Skeleton_Node *skeleton_root = *(Rel_Ptr<Skeleton_Node> *)arena.base;
+    start = std::chrono::steady_clock::now();
+    for ( int r = 0; r < reps; r++ ) {
+        for ( int i = 0; i < num_bones; i++ ) {
+            found += find_node_in_skeleton( skeleton_root, intern_name( bones[i]->mName.C_Str() ) ) != NULL;
+        }
+    }
+    double search_bind_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count() / reps;
+    
+    start = std::chrono::steady_clock::now();
+    for ( int r = 0; r < reps; r++ ) {
+        Name_Map<Skeleton_Node *> node_of_name;
+        if ( !name_map_create( &node_of_name, num_bones + 1, &scratch ) ) {
+            break;
+        }
+        map_skeleton_nodes( skeleton_root, &node_of_name );
+        for ( int i = 0; i < num_bones; i++ ) {
+            found += name_map_find<Skeleton_Node *>( &node_of_name, intern_name( bones[i]->mName.C_Str() ), NULL ) != NULL;
+        }
+        arena_rollback( &scratch, name_map_bytes_for<int>( num_bones ) );
+    }
+    double map_bind_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count() / reps;
+    
+    printf( "skeleton import, %i bones, %i channels (found %i):\n", num_bones, num_bones, found );
+    printf( "  import (hashed bone lookup)      %8.3f ms\n", import_ms );
+    printf( "  old per-node strcmp bone lookup  %8.3f ms\n", strcmp_ms );
+    printf( "  bind channels, map lookup        %8.3f ms\n", map_bind_ms );
+    printf( "  bind channels, tree search       %8.3f ms\n", search_bind_ms );
     
+    arena_destroy( &scratch );
+    arena_destroy( &arena );
+    g_verbose_import = verbose;
+    delete root; // deletes its children too
+    delete[] bones;
+}
+
+/* fixed simulation step, in seconds. animation and camera always advance by
+ exactly this much per tick, no matter how fast or unevenly frames are drawn */
+#define SIM_TIMESTEP ( 1.0 / 60.0 )
+
+/* units of animation time per second */
+#define ANIM_SPEED 2.5
+
+/* baked animation frames per unit of animation time - 60 a second at
+ ANIM_SPEED */
+#define ANIM_BAKE_RATE 24.0f
+
+/* seconds on the clock the simulation ticks against. steady_clock rather than
+ glfwGetTime() so headless runs, which never start GLFW, can use it too */
+double sim_clock() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+/* keys the simulation reacts to. bit i of Simulation::input_keys is set while
+ g_input_glfw_keys[i] is held down */
+enum Input_Key {
+    INPUT_KEY_FORWARD,
+    INPUT_KEY_LEFT,
+    INPUT_KEY_BACK,
+    INPUT_KEY_RIGHT,
+    INPUT_KEY_DOWN,
+    INPUT_KEY_UP,
+    INPUT_KEY_YAW_LEFT,
+    INPUT_KEY_YAW_RIGHT,
+    INPUT_KEY_COUNT
+};
+static const int g_input_glfw_keys[INPUT_KEY_COUNT] = {
+    GLFW_KEY_W, GLFW_KEY_A, GLFW_KEY_S, GLFW_KEY_D,
+    GLFW_KEY_DOWN, GLFW_KEY_UP, GLFW_KEY_LEFT, GLFW_KEY_RIGHT
+};
+
+/* everything the renderer needs from one simulation tick. the bone matrices
+ live in a block from alloc_sim_poses(), so a tick copies the model's bones and
+ not MAX_BONES of them */
+struct Sim_State {
+    glm::mat4 *bone_animation_mats; // Simulation::bone_count of them
+    glm::vec3 cam_pos;
+    float cam_yaw;
+    /* the sim_clock() this state belongs to */
+    double time;
+};
+
+/* published once per tick. carries the previous state as well so the renderer
+ can interpolate between the two even if it missed some ticks */
+struct Sim_Snapshot {
+    Sim_State prev;
+    Sim_State curr;
+};
+
+/* shared between the render (main) thread and the simulation thread. the
+ skeleton and offset matrices are read-only once loaded */
+struct Simulation {
+    Skeleton_Node *root_node;
+    glm::mat4 *bone_offset_mats;
+    int bone_count;
+    double anim_duration;
+    glm::vec3 cam_pos;
+    
+    Triple_Buffer<Sim_Snapshot> snapshots;
+    glm::mat4 *snapshot_poses; // the bone matrices of the snapshots' states
+    std::atomic<unsigned int> input_keys;
+    std::atomic<bool> quit;
+};
+
+/* num_states poses of bone_count identity matrices, in one block. free() it */
+glm::mat4 *alloc_sim_poses( int num_states, int bone_count ) {
+    int count = num_states * ( bone_count > 0 ? bone_count : 1 );
+    glm::mat4 *mats = (glm::mat4 *)malloc( count * sizeof( glm::mat4 ) );
+    if ( !mats ) {
+        fprintf( stderr, "ERROR: out of memory for %i animation poses\n", num_states );
+        return NULL;
+    }
+    for ( int i = 0; i < count; i++ ) {
+        mats[i] = glm::mat4(1.f);
+    }
+    return mats;
+}
+
+/* *dst = *src, for states of bone_count bones */
+void copy_sim_state( Sim_State *dst, const Sim_State *src, int bone_count ) {
+    memcpy( dst->bone_animation_mats, src->bone_animation_mats, bone_count * sizeof( glm::mat4 ) );
+    dst->cam_pos = src->cam_pos;
+    dst->cam_yaw = src->cam_yaw;
+    dst->time = src->time;
+}
+
+/* give the states of every snapshot slot their bone matrices. call before
+ the simulation thread starts */
+bool init_simulation_poses( Simulation *sim ) {
+    int stride = sim->bone_count > 0 ? sim->bone_count : 1;
+    sim->snapshot_poses = alloc_sim_poses( 6, sim->bone_count );
+    if ( !sim->snapshot_poses ) {
+        return false;
+    }
+    for ( int i = 0; i < 3; i++ ) {
+        Sim_Snapshot *snapshot = sim->snapshots.slot( i );
+        snapshot->prev.bone_animation_mats = sim->snapshot_poses + ( 2 * i ) * stride;
+        snapshot->curr.bone_animation_mats = sim->snapshot_poses + ( 2 * i + 1 ) * stride;
+    }
     return true;
 }
 
-int main() {
+/* advance camera and animation by one fixed step */
+void simulation_step( Simulation *sim, unsigned int keys, double *anim_time, Sim_State *state ) {
+    float cam_speed = 1.0f;
+    float cam_yaw_speed = 100.0f;
+    float dt = (float)SIM_TIMESTEP;
+    
+    if ( keys & ( 1u << INPUT_KEY_FORWARD ) ) {
+        state->cam_pos[2] -= cam_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_LEFT ) ) {
+        state->cam_pos[0] -= cam_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_BACK ) ) {
+        state->cam_pos[2] += cam_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_RIGHT ) ) {
+        state->cam_pos[0] += cam_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_DOWN ) ) {
+        state->cam_pos[1] -= cam_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_UP ) ) {
+        state->cam_pos[1] += cam_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_YAW_LEFT ) ) {
+        state->cam_yaw += cam_yaw_speed * dt;
+    }
+    if ( keys & ( 1u << INPUT_KEY_YAW_RIGHT ) ) {
+        state->cam_yaw -= cam_yaw_speed * dt;
+    }
+    
+    *anim_time += SIM_TIMESTEP * ANIM_SPEED;
+    if ( *anim_time >= sim->anim_duration ) {
+        *anim_time = sim->anim_duration - *anim_time;
+    }
+    if ( sim->root_node ) {
+        skeleton_animate( sim->root_node, *anim_time, glm::mat4(1.f), sim->bone_offset_mats, state->bone_animation_mats );
+    }
+    state->time += SIM_TIMESTEP;
+}
+
+/* scripted camera for headless runs. the camera moves linearly between keys
+ and holds still after the last one */
+struct Camera_Key {
+    int frame;
+    glm::vec3 pos;
+    float yaw;
+};
+#define MAX_CAMERA_KEYS 256
+
+/* a slow pan and dolly around the monkey, for when no script is given */
+static const Camera_Key g_default_camera_script[] = {
+    { 0, glm::vec3( 0.0f, 0.0f, 2.0f ), 0.0f },
+    { 60, glm::vec3( 0.6f, 0.2f, 2.5f ), 20.0f },
+    { 120, glm::vec3( -0.6f, -0.2f, 1.6f ), -20.0f },
+    { 180, glm::vec3( 0.0f, 0.0f, 2.0f ), 0.0f },
+};
+
+/* one key per line: frame x y z yaw. lines starting with # are comments.
+ keys must be in frame order. returns the number of keys, or -1 */
+int load_camera_script( const char *file_name, Camera_Key *keys, int max_keys ) {
+    FILE *file = fopen( file_name, "r" );
+    if ( !file ) {
+        fprintf( stderr, "ERROR: could not open camera script %s\n", file_name );
+        return -1;
+    }
+    char line[256];
+    int num_keys = 0;
+    while ( fgets( line, sizeof( line ), file ) && num_keys < max_keys ) {
+        Camera_Key *key = &keys[num_keys];
+        if ( line[0] == '#' ) {
+            continue;
+        }
+        if ( sscanf( line, "%i %f %f %f %f", &key->frame, &key->pos.x, &key->pos.y, &key->pos.z, &key->yaw ) == 5 ) {
+            num_keys++;
+        }
+    }
+    fclose( file );
+    return num_keys;
+}
+
+void camera_at_frame( const Camera_Key *keys, int num_keys, int frame, glm::vec3 *pos, float *yaw ) {
+    int k = 0;
+    while ( k < num_keys - 1 && keys[k + 1].frame <= frame ) {
+        k++;
+    }
+    if ( k == num_keys - 1 || frame <= keys[k].frame ) {
+        *pos = keys[k].pos;
+        *yaw = keys[k].yaw;
+        return;
+    }
+    float t = (float)( frame - keys[k].frame ) / (float)( keys[k + 1].frame - keys[k].frame );
+    *pos = glm::mix( keys[k].pos, keys[k + 1].pos, t );
+    *yaw = glm::mix( keys[k].yaw, keys[k + 1].yaw, t );
+}
+
+/* Pose_Sampler for baking a model's animation */
+void sample_model_pose( double time, glm::mat4 *bone_mats, void *user ) {
+    Model *model = (Model *)user;
+    if ( model->root_node ) {
+        skeleton_animate( model->root_node, time, glm::mat4(1.f), model->bone_offset_mats, bone_mats );
+    }
+}
+
+/* simulation thread. ticks at SIM_TIMESTEP and publishes a snapshot per tick
+ as soon as it is computed, then sleeps until the clock reaches it. so the
+ newest snapshot's prev and curr are the ticks either side of the present, and
+ the renderer can draw at the current time with no delay of its own */
+void run_simulation( Simulation *sim ) {
+    Sim_State state;
+    state.bone_animation_mats = alloc_sim_poses( 1, sim->bone_count );
+    if ( !state.bone_animation_mats ) {
+        return;
+    }
+    state.cam_pos = sim->cam_pos;
+    state.cam_yaw = 0.0f;
+    state.time = sim_clock();
+    double anim_time = 0.0;
+    
+    while ( !sim->quit ) {
+        Sim_Snapshot *snapshot = sim->snapshots.write_slot();
+        copy_sim_state( &snapshot->prev, &state, sim->bone_count );
+        simulation_step( sim, sim->input_keys.load( std::memory_order_relaxed ), &anim_time, &state );
+        copy_sim_state( &snapshot->curr, &state, sim->bone_count );
+        sim->snapshots.publish();
+        
+        double wait = state.time - sim_clock();
+        if ( wait > 0.0 ) {
+            std::this_thread::sleep_for( std::chrono::duration<double>( wait ) );
+        } else if ( wait < -0.25 ) {
+            // fell far behind (e.g. stopped in a debugger) - don't try to catch up
+            state.time = sim_clock();
+        }
+    }
+    free( state.bone_animation_mats );
+}
+
+static int compare_doubles( const void *a, const void *b ) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return x < y ? -1 : ( x > y ? 1 : 0 );
+}
+
+/* summary of a headless run on stdout, and every frame's time as CSV if
+ file_name isn't NULL */
+void report_frame_times( const double *frame_ms, int count, const char *file_name ) {
+    if ( count < 1 ) {
+        return;
+    }
+    if ( file_name ) {
+        FILE *file = fopen( file_name, "w" );
+        if ( file ) {
+            fprintf( file, "frame,ms\n" );
+            for ( int i = 0; i < count; i++ ) {
+                fprintf( file, "%i,%.4f\n", i, frame_ms[i] );
+            }
+            fclose( file );
+        } else {
+            fprintf( stderr, "ERROR: could not open %s for writing\n", file_name );
+        }
+    }
+    double *sorted = (double *)malloc( count * sizeof( double ) );
+    memcpy( sorted, frame_ms, count * sizeof( double ) );
+    qsort( sorted, count, sizeof( double ), compare_doubles );
+    double sum = 0.0, sum_sq = 0.0;
+    for ( int i = 0; i < count; i++ ) {
+        sum += sorted[i];
+        sum_sq += sorted[i] * sorted[i];
+    }
+    double mean = sum / count;
+    double variance = sum_sq / count - mean * mean;
+    double std_dev = sqrt( variance > 0.0 ? variance : 0.0 );
+    printf( "%i frames: mean %.3f ms, std dev %.3f ms, median %.3f ms, 95th percentile %.3f ms, worst %.3f ms\n",
+            count, mean, std_dev, sorted[count / 2],
+            sorted[( count * 95 ) / 100 < count ? ( count * 95 ) / 100 : count - 1], sorted[count - 1] );
+    gl_log( "headless run: %i frames, mean %.3f ms, std dev %.3f ms, median %.3f ms, worst %.3f ms\n", count,
+            mean, std_dev, sorted[count / 2], sorted[count - 1] );
+    free( sorted );
+}
+
+int main( int argc, char **argv ) {
+    if ( argc > 1 && strcmp( argv[1], "--bench-import" ) == 0 ) {
+        benchmark_skeleton_import( argc > 2 ? atoi( argv[2] ) : 500 );
+        return 0;
+    }
+    /* --bench-texture [FILE] prints PSNR, size and speed of every compression
+     tier, to pick the one an asset should be imported with */
+    if ( argc > 1 && strcmp( argv[1], "--bench-texture" ) == 0 ) {
+        return log_texture_file_tiers( argc > 2 ? argv[2] : TEXTURE_FILE ) ? 0 : 1;
+    }
+    /* --palette uniform|tbo|ssbo overrides the backend picked from GL limits.
+     --crowd N draws N more monkeys animated from a baked texture.
+     --bench-crowd times baked crowds against per-instance CPU skinning.
+     --skin-cache skins the monkey once a frame into a buffer and draws from that.
+     --bench-skin-cache times that against skinning in every pass.
+     --bench-palette times bone palette uploads.
+     --headless draws offscreen with no window, for automated runs. it renders
+     --frames N frames (default 300), one simulation step per frame, with the
+     camera following --script FILE (or a built-in path). --timings FILE writes
+     each frame's time as CSV and --dump DIR writes each frame as a PPM.
+     --threaded runs a headless simulation on its own thread against the clock,
+     as a window does, so its frame times can be compared; its frames are not
+     reproducible and the camera stays put */
+    int forced_palette_backend = -1;
+    int crowd_count = 0;
+    bool bench_crowd = false;
+    bool skin_cache = false;
+    bool bench_skin_cache = false;
+    bool bench_palette = false;
+    bool headless = false;
+    bool headless_threaded = false;
+    int headless_frames = 300;
+    const char *camera_script_file = NULL;
+    const char *timings_file = NULL;
+    const char *dump_dir = NULL;
+    for ( int i = 1; i < argc; i++ ) {
+        if ( strcmp( argv[i], "--palette" ) == 0 && i + 1 < argc ) {
+            const char *names[PALETTE_BACKEND_COUNT] = { "uniform", "tbo", "ssbo" };
+            for ( int b = 0; b < PALETTE_BACKEND_COUNT; b++ ) {
+                if ( strcmp( argv[i + 1], names[b] ) == 0 ) {
+                    forced_palette_backend = b;
+                }
+            }
+        } else if ( strcmp( argv[i], "--crowd" ) == 0 && i + 1 < argc ) {
+            crowd_count = atoi( argv[i + 1] );
+        } else if ( strcmp( argv[i], "--bench-crowd" ) == 0 ) {
+            bench_crowd = true;
+        } else if ( strcmp( argv[i], "--skin-cache" ) == 0 ) {
+            skin_cache = true;
+        } else if ( strcmp( argv[i], "--bench-skin-cache" ) == 0 ) {
+            bench_skin_cache = true;
+        } else if ( strcmp( argv[i], "--bench-palette" ) == 0 ) {
+            bench_palette = true;
+        } else if ( strcmp( argv[i], "--headless" ) == 0 ) {
+            headless = true;
+        } else if ( strcmp( argv[i], "--threaded" ) == 0 ) {
+            headless_threaded = true;
+        } else if ( strcmp( argv[i], "--frames" ) == 0 && i + 1 < argc ) {
+            headless_frames = atoi( argv[i + 1] );
+        } else if ( strcmp( argv[i], "--script" ) == 0 && i + 1 < argc ) {
+            camera_script_file = argv[i + 1];
+        } else if ( strcmp( argv[i], "--timings" ) == 0 && i + 1 < argc ) {
+            timings_file = argv[i + 1];
+        } else if ( strcmp( argv[i], "--dump" ) == 0 && i + 1 < argc ) {
+            dump_dir = argv[i + 1];
+        }
+    }
+    
+    Camera_Key camera_keys[MAX_CAMERA_KEYS];
+    int num_camera_keys = sizeof( g_default_camera_script ) / sizeof( g_default_camera_script[0] );
+    memcpy( camera_keys, g_default_camera_script, sizeof( g_default_camera_script ) );
+    if ( camera_script_file ) {
+        num_camera_keys = load_camera_script( camera_script_file, camera_keys, MAX_CAMERA_KEYS );
+        if ( num_camera_keys < 1 ) {
+            return 1;
+        }
+    }
+    
     restart_gl_log();
-    start_gl();
+    if ( !( headless ? start_gl_headless() : start_gl() ) ) {
+        return 1;
+    }
+    if ( bench_palette ) {
+        benchmark_palette_upload( "shaders/test_vs.glsl", "shaders/test_fs.glsl" );
+        stop_gl();
+        return 0;
+    }
     glEnable( GL_DEPTH_TEST ); // enable depth-testing
     glDepthFunc( GL_LESS );		 // depth-testing interprets a smaller value as "closer"
     glEnable( GL_CULL_FACE );	// cull face
@@ -474,24 +1237,30 @@ int main() {
     
     /* load the mesh using assimp */
     GLuint monkey_vao;
-    glm::mat4 monkey_bone_offset_matrices[MAX_BONES];
     glm::mat4 monkey_bone_animation_mats[MAX_BONES];
     for ( int i = 0; i < MAX_BONES; i++ ) {
         monkey_bone_animation_mats[i] = glm::mat4(1.f);
-        monkey_bone_offset_matrices[i] = glm::mat4(1.f);
-        monkey_bone_animation_mats[i] = glm::mat4(1.f);
 //        g_local_anims[i] = glm::mat4(1.f);
     }
-    int monkey_point_count = 0;
-    int monkey_bone_count = 0;
-    Skeleton_Node *monkey_root_node = NULL;
-    double monkey_anim_duration = 0.0;
-    load_mesh( MESH_FILE, &monkey_vao, &monkey_point_count, monkey_bone_offset_matrices, &monkey_bone_count, &monkey_root_node, &monkey_anim_duration );
+    Model *monkey_model = NULL;
+    if ( !load_mesh( MESH_FILE, &monkey_vao, &monkey_model ) ) {
+        return 1;
+    }
+    int monkey_point_count = monkey_model->point_count;
+    int monkey_bone_count = monkey_model->bone_count;
+    glm::mat4 *monkey_bone_offset_matrices = monkey_model->bone_offset_mats;
     
     printf( "monkey bone count %i\n", monkey_bone_count );
     
+    /* load the texture. it is block-compressed on first run and the blocks are
+     cached next to the image after that */
+    GLuint monkey_tex;
+    if ( !load_texture( TEXTURE_FILE, BLOCK_FORMAT_BC1, COMPRESS_QUALITY_HIGH, &monkey_tex ) ) {
+        return 1;
+    }
+    
     /********** BONES ***********/
-    float bone_positions[3 * 256];
+    float bone_positions[3 * MAX_BONES];
     int c = 0;
     for ( int i = 0; i < monkey_bone_count; i++ ) {
 //        printf( monkey_bone_offset_matrices[i] );
@@ -517,14 +1286,22 @@ int main() {
     
    	/*-------------------------------CREATE
      * SHADERS-------------------------------*/
-    GLuint shader_programme = create_programme_from_files( "shaders/test_vs.glsl", "shaders/test_fs.glsl" );
+    /* the bone palette's storage depends on what the context can do, and the
+     skinning shader is built to match */
+    Bone_Palette palette;
+    int palette_bones = monkey_bone_count > 0 ? monkey_bone_count : 1;
+    Palette_Backend palette_backend = forced_palette_backend >= 0 ?
+        (Palette_Backend)forced_palette_backend : choose_palette_backend( palette_bones );
+    if ( !create_bone_palette( &palette, palette_backend, palette_bones ) ) {
+        return 1;
+    }
+    char palette_header[1024];
+    palette_shader_header( &palette, palette_header, sizeof( palette_header ) );
+    GLuint shader_programme = create_programme_from_files( "shaders/test_vs.glsl", "shaders/test_fs.glsl", palette_header );
     GLuint bones_shader_programme = create_programme_from_files( "shaders/bones_vs.glsl", "shaders/bones_fs.glsl" );
     
     
     // setup matrices / uniforms
-    float cam_speed = 1.0f;
-    float cam_yaw_speed = 100.0f;
-    float cam_yaw = 0.0f;
     glm::vec3 cam_pos(0.0f, 0.0f, 2.0f);
     glm::mat4 mat_model = glm::rotate(glm::mat4(1.f), glm::radians(45.f), glm::vec3(0.f, 1.f, 0.f));
     mat_model = glm::mat4(1.f);
@@ -546,20 +1323,78 @@ int main() {
     glUniformMatrix4fv( mat_loc_view, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
     glUniformMatrix4fv( mat_loc_projection, 1, GL_FALSE, (const float*)glm::value_ptr(mat_projection) );
     
-    // bone matrices uniforms
-    int bone_matrices_locations[MAX_BONES];
-    char name[64];
-    glm::mat4 mat_identity(1.f);
-    for ( int i = 0; i < MAX_BONES; i++ ) {
-        sprintf( name, "bone_matrices[%i]", i );
-        bone_matrices_locations[i] = glGetUniformLocation( shader_programme, name );
+    /* the skinned-vertex cache skins with its own programme, so that is the
+     one the palette goes to */
+    GLuint skinning_programme = 0;
+    GLuint cached_shader_programme = 0;
+    int cached_view_mat_location = -1;
+    GLuint cached_vao = 0;
+    Skin_Cache_Pool skin_cache_pool;
+    if ( skin_cache || bench_skin_cache ) {
+        skinning_programme = create_skinning_programme( "shaders/skin_vs.glsl", palette_header );
+        if ( !skinning_programme ) {
+            return 1;
+        }
+        cached_shader_programme = create_programme_from_files( "shaders/cached_vs.glsl", "shaders/test_fs.glsl" );
+        glUseProgram( cached_shader_programme );
+        glUniformMatrix4fv( glGetUniformLocation( cached_shader_programme, "mat_model" ), 1, GL_FALSE, (const float*)glm::value_ptr(mat_model) );
+        glUniformMatrix4fv( glGetUniformLocation( cached_shader_programme, "mat_projection" ), 1, GL_FALSE, (const float*)glm::value_ptr(mat_projection) );
+        cached_view_mat_location = glGetUniformLocation( cached_shader_programme, "mat_view" );
+        glUniformMatrix4fv( cached_view_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
         
-        if(bone_matrices_locations[i] < 0) {
-            fprintf(stderr, "Error: could not find locations for all uniforms!\n");
-//            return 0;
+        if ( bench_skin_cache ) {
+            benchmark_skin_cache( monkey_vao, monkey_point_count, &palette, shader_programme,
+                                 skinning_programme, cached_shader_programme, 64 );
+            stop_gl();
+            return 0;
         }
+        create_skin_cache_pool( &skin_cache_pool, monkey_point_count * SKINNED_VERTEX_BYTES );
+        glGenVertexArrays( 1, &cached_vao );
+    }
+    GLuint palette_programme = skin_cache ? skinning_programme : shader_programme;
+    
+    // bone matrices start out as identity
+    if ( skin_cache ) {
+        /* a frame the cache has no room for falls back on skinning in the
+         pass, so this one reads the palette too */
+        setup_palette_programme( &palette, shader_programme );
+    }
+    setup_palette_programme( &palette, palette_programme );
+    
+    /* bake the clip for crowds - each instance then costs the CPU nothing */
+    Baked_Anims baked_anims;
+    init_baked_anims( &baked_anims, palette_bones );
+    GLuint baked_shader_programme = 0;
+    int baked_view_mat_location = -1;
+    int baked_time_location = -1;
+    if ( ( crowd_count > 0 || bench_crowd ) && monkey_bone_count > 0 ) {
+        bake_clip( &baked_anims, monkey_model->anim_duration, ANIM_BAKE_RATE, sample_model_pose, monkey_model );
+        if ( !upload_baked_anims( &baked_anims ) ) {
+            return 1;
+        }
+        baked_shader_programme = create_programme_from_files( "shaders/baked_vs.glsl", "shaders/test_fs.glsl" );
+        setup_baked_programme( &baked_anims, baked_shader_programme );
+        glUniformMatrix4fv( glGetUniformLocation( baked_shader_programme, "mat_model" ), 1, GL_FALSE, (const float*)glm::value_ptr(mat_model) );
+        glUniformMatrix4fv( glGetUniformLocation( baked_shader_programme, "mat_projection" ), 1, GL_FALSE, (const float*)glm::value_ptr(mat_projection) );
+        baked_view_mat_location = glGetUniformLocation( baked_shader_programme, "mat_view" );
+        baked_time_location = glGetUniformLocation( baked_shader_programme, "anim_time" );
+        glUniformMatrix4fv( baked_view_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
         
-        glUniformMatrix4fv( bone_matrices_locations[i], 1, GL_FALSE, (const float*)glm::value_ptr(mat_identity) );
+        if ( bench_crowd ) {
+            benchmark_baked_crowd( &baked_anims, monkey_vao, monkey_point_count, baked_shader_programme,
+                                  sample_model_pose, monkey_model, &palette, shader_programme );
+            stop_gl();
+            return 0;
+        }
+        Crowd_Instance *instances = (Crowd_Instance *)malloc( crowd_count * sizeof( Crowd_Instance ) );
+        make_crowd_grid( &baked_anims, instances, crowd_count, 2.5f );
+        for ( int i = 0; i < crowd_count; i++ ) {
+            instances[i].offset.z -= 3.0f; // behind the animated monkey
+        }
+        create_crowd_instance_buffer( monkey_vao, instances, crowd_count );
+        free( instances );
+    } else {
+        crowd_count = 0;
     }
     
     // bones shader uniforms
@@ -571,33 +1406,154 @@ int main() {
     int bones_proj_mat_location = glGetUniformLocation( bones_shader_programme, "proj" );
     glUniformMatrix4fv( bones_proj_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_projection));
     
-    float theta = 0.0f;
-    float rot_speed = 50.0f; // 50 radians per second
-    float y = 0.f; // position of head;
-    double anim_time = 0.0;
+    /* animation and camera run on their own thread at a fixed timestep. this
+     thread just draws whatever the simulation published most recently */
+    Simulation simulation;
+    simulation.root_node = monkey_model->root_node;
+    simulation.bone_offset_mats = monkey_bone_offset_matrices;
+    simulation.bone_count = monkey_bone_count;
+    simulation.anim_duration = monkey_model->anim_duration;
+    simulation.cam_pos = cam_pos;
+    simulation.input_keys = 0;
+    simulation.quit = false;
+    if ( !init_simulation_poses( &simulation ) ) {
+        return 1;
+    }
+    /* headless runs step the simulation here instead, once per frame, so
+     every run draws exactly the same frames however long they take */
+    bool step_inline = headless && !headless_threaded;
+    std::thread simulation_thread;
+    if ( !step_inline ) {
+        simulation_thread = std::thread( run_simulation, &simulation );
+    }
+    
+    const Sim_Snapshot *snapshot = NULL;
+    
+    Sim_Snapshot *headless_snapshot = NULL;
+    Sim_State *headless_state = NULL;
+    glm::mat4 *headless_poses = NULL;
+    double headless_anim_time = 0.0;
+    double *frame_ms = NULL;
+    if ( headless ) {
+        frame_ms = (double *)calloc( headless_frames > 0 ? headless_frames : 1, sizeof( double ) );
+    }
+    if ( step_inline ) {
+        int stride = monkey_bone_count > 0 ? monkey_bone_count : 1;
+        headless_poses = alloc_sim_poses( 3, monkey_bone_count );
+        if ( !headless_poses ) {
+            return 1;
+        }
+        headless_snapshot = new Sim_Snapshot;
+        headless_state = new Sim_State();
+        headless_snapshot->prev.bone_animation_mats = headless_poses;
+        headless_snapshot->curr.bone_animation_mats = headless_poses + stride;
+        headless_state->bone_animation_mats = headless_poses + 2 * stride;
+        headless_state->time = 0.0;
+        /* frame 0's prev state is this one, so it has to start on the script */
+        camera_at_frame( camera_keys, num_camera_keys, 0, &headless_state->cam_pos, &headless_state->cam_yaw );
+    }
+    int frame = 0;
     
     // render loop
-    while ( !glfwWindowShouldClose( g_window ) ) {
-        // add a timer for doing animation
-        static double previous_seconds = glfwGetTime();
-        double current_seconds = glfwGetTime();
-        double elapsed_seconds = current_seconds - previous_seconds;
-        previous_seconds = current_seconds;
-        
-        anim_time += elapsed_seconds * 2.5;
-        if ( anim_time >= monkey_anim_duration ) {
-            anim_time = monkey_anim_duration - anim_time;
+    while ( headless ? frame < headless_frames : !glfwWindowShouldClose( g_window ) ) {
+        std::chrono::steady_clock::time_point frame_start = std::chrono::steady_clock::now();
+        if ( step_inline ) {
+            copy_sim_state( &headless_snapshot->prev, headless_state, monkey_bone_count );
+            simulation_step( &simulation, 0, &headless_anim_time, headless_state );
+            camera_at_frame( camera_keys, num_camera_keys, frame, &headless_state->cam_pos, &headless_state->cam_yaw );
+            copy_sim_state( &headless_snapshot->curr, headless_state, monkey_bone_count );
+            snapshot = headless_snapshot;
+        } else {
+            if ( simulation.snapshots.acquire() ) {
+                snapshot = simulation.snapshots.read_slot();
+            }
+            if ( !headless ) {
+                _update_fps_counter( g_window );
+                _update_frame_time_stats();
+            }
         }
-        
-        _update_fps_counter( g_window );
         // wipe the drawing surface clear
         glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
         glViewport( 0, 0, g_gl_width, g_gl_height );
         
+        if ( snapshot ) {
+            /* the simulation runs a tick ahead, so the present lies between
+             the snapshot's two states. stepping inline, draw the newest */
+            double render_time = step_inline ? snapshot->curr.time : sim_clock();
+            float alpha = (float)( ( render_time - snapshot->prev.time ) / SIM_TIMESTEP );
+            alpha = alpha < 0.0f ? 0.0f : ( alpha > 1.0f ? 1.0f : alpha );
+            
+            /* update view matrix */
+            glm::vec3 pos = glm::mix( snapshot->prev.cam_pos, snapshot->curr.cam_pos, alpha );
+            float yaw = glm::mix( snapshot->prev.cam_yaw, snapshot->curr.cam_yaw, alpha );
+            glm::mat4 T = glm::translate(glm::mat4(1.0f), glm::vec3(-pos.x, -pos.y, -pos.z));
+            mat_view = glm::rotate(T, -glm::radians(yaw), glm::vec3(0.0f, 1.0f, 0.0f));
+            
+            glUseProgram(bones_shader_programme);
+            glUniformMatrix4fv( bones_view_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
+            
+            /* a step is short enough that blending the matrices element-wise
+             is indistinguishable from interpolating the bone transforms */
+            for ( int i = 0; i < monkey_bone_count; i++ ) {
+                monkey_bone_animation_mats[i] = snapshot->prev.bone_animation_mats[i] * ( 1.0f - alpha ) +
+                    snapshot->curr.bone_animation_mats[i] * alpha;
+            }
+            glUseProgram(shader_programme);
+            glUniformMatrix4fv( mat_loc_view, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
+            if ( crowd_count > 0 ) {
+                glUseProgram( baked_shader_programme );
+                glUniformMatrix4fv( baked_view_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
+                glUniform1f( baked_time_location, (float)( render_time * ANIM_SPEED ) );
+            }
+            if ( skin_cache ) {
+                glUseProgram( cached_shader_programme );
+                glUniformMatrix4fv( cached_view_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
+            }
+            glUseProgram( palette_programme );
+            if ( monkey_bone_count > 0 ) {
+                upload_bone_palette( &palette, monkey_bone_animation_mats, monkey_bone_count );
+            }
+        }
+        
         glEnable( GL_DEPTH_TEST );
-        glUseProgram( shader_programme );
-        glBindVertexArray( monkey_vao );
-        glDrawArrays( GL_TRIANGLES, 0, monkey_point_count );
+        bind_bone_palette( &palette );
+        glActiveTexture( GL_TEXTURE0 );
+        glBindTexture( GL_TEXTURE_2D, monkey_tex );
+        Skinned_Vertices skinned_monkey;
+        if ( skin_cache ) {
+            begin_skin_cache_frame( &skin_cache_pool );
+        }
+        if ( skin_cache && skin_cache_alloc( &skin_cache_pool, monkey_point_count, &skinned_monkey ) ) {
+            /* every pass that draws the monkey this frame can use this */
+            skin_vertices( skinning_programme, monkey_vao, &skinned_monkey );
+            glUseProgram( cached_shader_programme );
+            bind_skinned_vertices( cached_vao, &skinned_monkey );
+            glDrawArrays( GL_TRIANGLES, 0, monkey_point_count );
+        } else if ( skin_cache ) {
+            /* no room in the cache this frame - skin in the pass instead. a
+             uniform array palette lives in the programme, so it has to go up
+             again, and then back to the skinning programme for next frame */
+            setup_palette_programme( &palette, shader_programme );
+            if ( monkey_bone_count > 0 ) {
+                upload_bone_palette( &palette, monkey_bone_animation_mats, monkey_bone_count );
+            }
+            glBindVertexArray( monkey_vao );
+            glDrawArrays( GL_TRIANGLES, 0, monkey_point_count );
+            setup_palette_programme( &palette, skinning_programme );
+        } else {
+            glUseProgram( shader_programme );
+            glBindVertexArray( monkey_vao );
+            glDrawArrays( GL_TRIANGLES, 0, monkey_point_count );
+        }
+        if ( crowd_count > 0 ) {
+            glUseProgram( baked_shader_programme );
+            bind_baked_anims( &baked_anims );
+            glBindVertexArray( monkey_vao );
+            glDrawArraysInstanced( GL_TRIANGLES, 0, monkey_point_count, crowd_count );
+        }
+        if ( skin_cache ) {
+            end_skin_cache_frame( &skin_cache_pool );
+        }
         
         glDisable( GL_DEPTH_TEST );
         glEnable( GL_PROGRAM_POINT_SIZE );
@@ -606,96 +1562,31 @@ int main() {
         glDrawArrays( GL_POINTS, 0, monkey_bone_count );
         glDisable( GL_PROGRAM_POINT_SIZE );
         
+        if ( headless ) {
+            /* wait for the GPU so the time is the whole frame's */
+            glFinish();
+            frame_ms[frame] = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - frame_start ).count();
+            if ( dump_dir ) {
+                char dump_file[1024];
+                snprintf( dump_file, sizeof( dump_file ), "%s/frame_%05i.ppm", dump_dir, frame );
+                write_frame_ppm( dump_file );
+            }
+            frame++;
+            continue;
+        }
+        
         // update other events like input handling
         glfwPollEvents();
         
-        /*-----------------------------move camera
-         * here-------------------------------*/
-        // control keys
-        bool cam_moved = false;
-        
-        if ( glfwGetKey( g_window, GLFW_KEY_W ) ) {
-            cam_pos[2] -= cam_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_A ) ) {
-            cam_pos[0] -= cam_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_S ) ) {
-            cam_pos[2] += cam_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_D ) ) {
-            cam_pos[0] += cam_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_DOWN ) ) {
-            cam_pos[1] -= cam_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_UP ) ) {
-            cam_pos[1] += cam_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_LEFT ) ) {
-            cam_yaw += cam_yaw_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        if ( glfwGetKey( g_window, GLFW_KEY_RIGHT ) ) {
-            cam_yaw -= cam_yaw_speed * elapsed_seconds;
-            cam_moved = true;
-        }
-        /* update view matrix */
-        if ( cam_moved ) {
-            glm::mat4 T = glm::translate(glm::mat4(1.0f), glm::vec3(-cam_pos.x, -cam_pos.y, -cam_pos.z));
-            mat_view = glm::rotate(T, -glm::radians(cam_yaw), glm::vec3(0.0f, 1.0f, 0.0f));
-
-            glUseProgram(shader_programme);
-            glUniformMatrix4fv( mat_loc_view, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
-            
-            glUseProgram(bones_shader_programme);
-            glUniformMatrix4fv( bones_view_mat_location, 1, GL_FALSE, (const float*)glm::value_ptr(mat_view) );
+        /* GLFW input can only be read on this thread, so hand the simulation
+         the set of keys held down */
+        unsigned int keys = 0;
+        for ( int i = 0; i < INPUT_KEY_COUNT; i++ ) {
+            if ( glfwGetKey( g_window, g_input_glfw_keys[i] ) ) {
+                keys |= 1u << i;
+            }
         }
-        
-        skeleton_animate( monkey_root_node, anim_time, glm::mat4(1.f), monkey_bone_offset_matrices, monkey_bone_animation_mats );
-        glUseProgram(shader_programme);
-        
-        glUniformMatrix4fv( bone_matrices_locations[0], 1, GL_FALSE, (const float*)glm::value_ptr(monkey_bone_animation_mats[0]) );
-        glUniformMatrix4fv( bone_matrices_locations[1], 1, GL_FALSE, (const float*)glm::value_ptr(monkey_bone_animation_mats[1]) );
-        glUniformMatrix4fv( bone_matrices_locations[2], 1, GL_FALSE, (const float*)glm::value_ptr(monkey_bone_animation_mats[2]) );
-        
-//        bool monkey_moved = false;
-//        
-//        if ( glfwGetKey( g_window, 'Z' ) ) {
-//            theta += rot_speed * elapsed_seconds;
-//            g_local_anims[1] = glm::rotate( glm::mat4(1.f), glm::radians(theta), glm::vec3(0, 0, 1) );
-//            g_local_anims[2] = glm::rotate( glm::mat4(1.f), glm::radians(-theta), glm::vec3(0, 0, 1) );
-//            monkey_moved = true;
-//        }
-//        if ( glfwGetKey( g_window, 'X' ) ) {
-//            theta -= rot_speed * elapsed_seconds;
-//            g_local_anims[1] = glm::rotate( glm::mat4(1.f), glm::radians(theta), glm::vec3(0, 0, 1) );
-//            g_local_anims[2] = glm::rotate( glm::mat4(1.f), glm::radians(-theta), glm::vec3(0, 0, 1) );
-//            monkey_moved = true;
-//        }
-//        if ( glfwGetKey( g_window, 'C' ) ) {
-//            y -= 0.5f * elapsed_seconds;
-//            g_local_anims[0] = glm::translate( glm::mat4(1.f), glm::vec3( 0.0f, y, 0.0f ) );
-//            monkey_moved = true;
-//        }
-//        if ( glfwGetKey( g_window, 'V' ) ) {
-//            y += 0.5f * elapsed_seconds;
-//            g_local_anims[0] = glm::translate( glm::mat4(1.f), glm::vec3( 0.0f, y, 0.0f ) );
-//            monkey_moved = true;
-//        }
-//        if ( monkey_moved ) {
-//            skeleton_animate( monkey_root_node, anim_time, glm::mat4(1.f), monkey_bone_offset_matrices, monkey_bone_animation_mats );
-//            glUseProgram( shader_programme );
-//            glUniformMatrix4fv( bone_matrices_locations[0], monkey_bone_count, GL_FALSE, (const float*)glm::value_ptr(monkey_bone_animation_mats[0]) );
-//            glUniformMatrix4fv( bone_matrices_locations[1], monkey_bone_count, GL_FALSE, (const float*)glm::value_ptr(monkey_bone_animation_mats[1]) );
-//            glUniformMatrix4fv( bone_matrices_locations[2], monkey_bone_count, GL_FALSE, (const float*)glm::value_ptr(monkey_bone_animation_mats[2]) );
-//        }
+        simulation.input_keys.store( keys, std::memory_order_relaxed );
         
         if ( GLFW_PRESS == glfwGetKey( g_window, GLFW_KEY_ESCAPE ) ) {
             glfwSetWindowShouldClose( g_window, 1 );
@@ -704,7 +1595,28 @@ int main() {
         glfwSwapBuffers( g_window );
     }
     
+    simulation.quit = true;
+    if ( simulation_thread.joinable() ) {
+        simulation_thread.join();
+    }
+    if ( headless ) {
+        report_frame_times( frame_ms, headless_frames, timings_file );
+        free( frame_ms );
+        delete headless_snapshot;
+        delete headless_state;
+        free( headless_poses );
+    }
+    free( monkey_model );
+    free( simulation.snapshot_poses );
+    glDeleteTextures( 1, &monkey_tex );
+    destroy_bone_palette( &palette );
+    if ( skin_cache ) {
+        destroy_skin_cache_pool( &skin_cache_pool );
+        glDeleteVertexArrays( 1, &cached_vao );
+    }
+    free_baked_anims( &baked_anims );
+    
     // close GL context and any other GLFW resources
-    glfwTerminate();
+    stop_gl();
     return 0;
 }
@@ -0,0 +1,106 @@
+#include "name_table.h"
+#include "gl_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* the interned strings. an open-addressing table of offsets into one growing
+ character buffer, keyed by Name_ID like Name_Map but able to grow */
+static Name_ID *g_name_ids;
+static uint32_t *g_name_offsets;
+static uint32_t g_name_mask;
+static uint32_t g_name_count;
+static char *g_name_chars;
+static uint32_t g_name_chars_used;
+static uint32_t g_name_chars_capacity;
+
+Name_ID hash_name( const char *name ) {
+    uint32_t hash = 2166136261u;
+    for ( const unsigned char *c = (const unsigned char *)name; *c; c++ ) {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+    return NAME_ID_NONE == hash ? 1 : hash;
+}
+
+static uint32_t find_slot( Name_ID id ) {
+    uint32_t i = id & g_name_mask;
+    while ( g_name_ids[i] != NAME_ID_NONE && g_name_ids[i] != id ) {
+        i = ( i + 1 ) & g_name_mask;
+    }
+    return i;
+}
+
+static bool grow_name_table() {
+    uint32_t old_capacity = g_name_ids ? g_name_mask + 1 : 0;
+    Name_ID *old_ids = g_name_ids;
+    uint32_t *old_offsets = g_name_offsets;
+
+    uint32_t capacity = old_capacity ? old_capacity * 2 : 256;
+    g_name_ids = (Name_ID *)calloc( capacity, sizeof( Name_ID ) );
+    g_name_offsets = (uint32_t *)calloc( capacity, sizeof( uint32_t ) );
+    if ( !g_name_ids || !g_name_offsets ) {
+        free( g_name_ids );
+        free( g_name_offsets );
+        g_name_ids = old_ids;
+        g_name_offsets = old_offsets;
+        return false;
+    }
+    g_name_mask = capacity - 1;
+    for ( uint32_t i = 0; i < old_capacity; i++ ) {
+        if ( old_ids[i] != NAME_ID_NONE ) {
+            uint32_t slot = find_slot( old_ids[i] );
+            g_name_ids[slot] = old_ids[i];
+            g_name_offsets[slot] = old_offsets[i];
+        }
+    }
+    free( old_ids );
+    free( old_offsets );
+    return true;
+}
+
+Name_ID intern_name( const char *name ) {
+    Name_ID id = hash_name( name );
+    if ( ( g_name_count + 1 ) * 2 > ( g_name_ids ? g_name_mask + 1 : 0 ) &&
+         !grow_name_table() ) {
+        gl_log_err( "ERROR: out of memory interning name \"%s\"\n", name );
+        return NAME_ID_NONE;
+    }
+    uint32_t slot = find_slot( id );
+    if ( g_name_ids[slot] == id ) {
+        if ( 0 != strcmp( g_name_chars + g_name_offsets[slot], name ) ) {
+            gl_log_err( "ERROR: names \"%s\" and \"%s\" have the same ID %08x\n",
+                        g_name_chars + g_name_offsets[slot], name, id );
+            return NAME_ID_NONE;
+        }
+        return id;
+    }
+
+    uint32_t len = (uint32_t)strlen( name ) + 1;
+    if ( g_name_chars_used + len > g_name_chars_capacity ) {
+        uint32_t capacity = g_name_chars_capacity ? g_name_chars_capacity * 2 : 4096;
+        while ( capacity < g_name_chars_used + len ) {
+            capacity *= 2;
+        }
+        char *chars = (char *)realloc( g_name_chars, capacity );
+        if ( !chars ) {
+            gl_log_err( "ERROR: out of memory interning name \"%s\"\n", name );
+            return NAME_ID_NONE;
+        }
+        g_name_chars = chars;
+        g_name_chars_capacity = capacity;
+    }
+    memcpy( g_name_chars + g_name_chars_used, name, len );
+    g_name_ids[slot] = id;
+    g_name_offsets[slot] = g_name_chars_used;
+    g_name_chars_used += len;
+    g_name_count++;
+    return id;
+}
+
+const char *name_string( Name_ID id ) {
+    if ( NAME_ID_NONE == id || !g_name_ids ) {
+        return "<unknown>";
+    }
+    uint32_t slot = find_slot( id );
+    return g_name_ids[slot] == id ? g_name_chars + g_name_offsets[slot] : "<unknown>";
+}
@@ -0,0 +1,84 @@
+#ifndef _NAME_TABLE_H_
+#define _NAME_TABLE_H_
+
+#include "arena.h"
+#include <stdint.h>
+
+/* names (bones, nodes, animation channels) are referred to by a 32-bit ID
+ instead of a string. the ID is a hash of the name, so it is the same in every
+ run and can be stored in files; the name table just remembers the strings so
+ they can be printed, and catches the (unlikely) case of two names hashing to
+ the same ID. */
+typedef uint32_t Name_ID;
+#define NAME_ID_NONE 0
+
+/* FNV-1a. never returns NAME_ID_NONE */
+Name_ID hash_name( const char *name );
+
+/* hash_name() + remember the string for name_string(). returns NAME_ID_NONE if
+ a different name already has that ID (or the table is out of memory): the
+ name can't be told apart from the other one, so whatever looks it up must
+ fail instead */
+Name_ID intern_name( const char *name );
+
+/* the string a name ID was interned from, or "<unknown>" */
+const char *name_string( Name_ID id );
+
+/* fixed-size open-addressing hash map from Name_ID to T, allocated out of an
+ arena. it never grows - create it with room for every name it will hold */
+template <typename T> struct Name_Map {
+    Name_ID *keys;
+    T *values;
+    uint32_t mask; // capacity - 1; capacity is a power of two
+};
+
+/* keep tables at most half full so probe chains stay short */
+inline uint32_t name_map_capacity( int max_entries ) {
+    uint32_t capacity = 16;
+    while ( capacity < (uint32_t)max_entries * 2 ) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <typename T>
+bool name_map_create( Name_Map<T> *map, int max_entries, Arena *arena ) {
+    uint32_t capacity = name_map_capacity( max_entries );
+    map->keys = (Name_ID *)arena_alloc( arena, capacity * sizeof( Name_ID ) );
+    map->values = (T *)arena_alloc( arena, capacity * sizeof( T ) );
+    map->mask = capacity - 1;
+    return map->keys && map->values;
+}
+
+/* arena space name_map_create() needs */
+template <typename T> size_t name_map_bytes_for( int max_entries ) {
+    uint32_t capacity = name_map_capacity( max_entries );
+    return arena_bytes_for( capacity * sizeof( Name_ID ) ) +
+           arena_bytes_for( capacity * sizeof( T ) );
+}
+
+/* insert or overwrite */
+template <typename T> void name_map_insert( Name_Map<T> *map, Name_ID key, T value ) {
+    assert( key != NAME_ID_NONE );
+    uint32_t i = key & map->mask;
+    while ( map->keys[i] != NAME_ID_NONE && map->keys[i] != key ) {
+        i = ( i + 1 ) & map->mask;
+    }
+    map->keys[i] = key;
+    map->values[i] = value;
+}
+
+/* returns not_found if the key isn't in the map */
+template <typename T>
+T name_map_find( const Name_Map<T> *map, Name_ID key, T not_found ) {
+    uint32_t i = key & map->mask;
+    while ( map->keys[i] != NAME_ID_NONE ) {
+        if ( map->keys[i] == key ) {
+            return map->values[i];
+        }
+        i = ( i + 1 ) & map->mask;
+    }
+    return not_found;
+}
+
+#endif
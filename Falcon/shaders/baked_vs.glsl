@@ -0,0 +1,48 @@
+#version 410
+
+/* skinning for crowds: instead of a palette uploaded per draw, each vertex
+ looks up and interpolates its bone matrix in the baked animation texture from
+ its instance's clip and time (see anim_bake.h) */
+
+layout(location = 0) in vec3 vertex_position;
+layout(location = 1) in vec3 vertex_normal;
+layout(location = 2) in vec2 texture_coord;
+layout(location = 3) in int bone_id;
+layout(location = 4) in vec3 instance_offset;
+layout(location = 5) in float instance_phase;
+layout(location = 6) in int instance_clip;
+
+uniform mat4 mat_model, mat_view, mat_projection;
+uniform sampler2D baked_anims;
+/* per clip: first row, frame count, frames per unit time, duration */
+uniform vec4 clips[16];
+uniform float anim_time;
+
+out vec3 normal;
+out vec2 st;
+out vec3 color;
+
+/* a frame is a row, a bone is 3 texels holding the top 3 rows of its matrix */
+mat4 baked_bone_matrix (int row) {
+    vec4 r0 = texelFetch (baked_anims, ivec2 (bone_id * 3, row), 0);
+    vec4 r1 = texelFetch (baked_anims, ivec2 (bone_id * 3 + 1, row), 0);
+    vec4 r2 = texelFetch (baked_anims, ivec2 (bone_id * 3 + 2, row), 0);
+    return transpose (mat4 (r0, r1, r2, vec4 (0.0, 0.0, 0.0, 1.0)));
+}
+
+void main() {
+    vec4 clip = clips[instance_clip];
+    float frame = mod (anim_time + instance_phase, clip.w) * clip.z;
+    int last = int (clip.y) - 1;
+    int f0 = min (int (frame), last);
+    int f1 = min (f0 + 1, last);
+    float t = frame - float (f0);
+    mat4 bone = baked_bone_matrix (int (clip.x) + f0) * (1.0 - t) +
+        baked_bone_matrix (int (clip.x) + f1) * t;
+
+    color = vec3 (0.0, 0.0, 0.0);
+    st = texture_coord;
+    normal = mat3 (bone) * vertex_normal;
+    vec4 world = mat_model * bone * vec4 (vertex_position, 1.0) + vec4 (instance_offset, 0.0);
+    gl_Position = mat_projection * mat_view * world;
+}
@@ -0,0 +1,20 @@
+#version 410
+
+/* draws vertices that skin_vs.glsl already skinned this frame */
+
+layout(location = 0) in vec3 vertex_position;
+layout(location = 1) in vec3 vertex_normal;
+layout(location = 2) in vec2 texture_coord;
+
+uniform mat4 mat_model, mat_view, mat_projection;
+
+out vec3 normal;
+out vec2 st;
+out vec3 color;
+
+void main() {
+    color = vec3 (0.0, 0.0, 0.0);
+    st = texture_coord;
+    normal = vertex_normal;
+    gl_Position = mat_projection * mat_view * mat_model * vec4 (vertex_position, 1.0);
+}
@@ -0,0 +1,19 @@
+/* skinning pass for the skinned-vertex cache (see skin_cache.h). runs with the
+ rasterizer off; its outputs are captured with transform feedback. like
+ test_vs.glsl it has no #version - the bone palette header goes first */
+
+layout(location = 0) in vec3 vertex_position;
+layout(location = 1) in vec3 vertex_normal;
+layout(location = 2) in vec2 texture_coord;
+layout(location = 3) in int bone_id;
+
+out vec3 skinned_position;
+out vec3 skinned_normal;
+out vec2 skinned_st;
+
+void main() {
+    mat4 bone = bone_matrix (bone_id);
+    skinned_position = (bone * vec4 (vertex_position, 1.0)).xyz;
+    skinned_normal = mat3 (bone) * vertex_normal;
+    skinned_st = texture_coord;
+}
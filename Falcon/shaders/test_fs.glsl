@@ -3,8 +3,10 @@
 in vec3 normal;
 in vec2 st;
 in vec3 color;
+uniform sampler2D tex; // texture unit 0
 out vec4 frag_colour;
 
 void main() {
-    frag_colour = vec4 (normal, 1.0);
+    vec4 texel = texture (tex, st);
+    frag_colour = vec4 (texel.rgb * (0.5 + 0.5 * abs (normalize (normal).z)), 1.0);
 }
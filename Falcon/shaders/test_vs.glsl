@@ -1,4 +1,6 @@
-#version 410
+/* no #version here - the program prepends a header for the bone palette
+ backend it picked (see palette_shader_header()), which starts with the
+ #version line and defines mat4 bone_matrix( int i ) */
 
 layout(location = 0) in vec3 vertex_position;
 layout(location = 1) in vec3 vertex_normal;
@@ -6,7 +8,6 @@ layout(location = 2) in vec2 texture_coord;
 layout(location = 3) in int bone_id;
 
 uniform mat4 mat_model, mat_view, mat_projection;
-uniform mat4 bone_matrices[32];
 
 out vec3 normal;
 out vec2 st;
@@ -22,7 +23,8 @@ void main() {
         color.b = 1.0;
     } 
     
+    mat4 bone = bone_matrix (bone_id);
     st = texture_coord;
-    normal = vertex_normal;
-    gl_Position = mat_projection * mat_view * mat_model * bone_matrices[bone_id] * vec4 (vertex_position, 1.0);
+    normal = mat3 (bone) * vertex_normal;
+    gl_Position = mat_projection * mat_view * mat_model * (bone * vec4 (vertex_position, 1.0));
 }
@@ -0,0 +1,211 @@
+#include "skin_cache.h"
+#include "gl_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+bool create_skin_cache_pool( Skin_Cache_Pool *pool, GLsizeiptr bytes_per_frame ) {
+    glGenBuffers( SKIN_CACHE_FRAMES, pool->buffers );
+    for ( int i = 0; i < SKIN_CACHE_FRAMES; i++ ) {
+        /* bind somewhere that doesn't disturb vertex array state */
+        glBindBuffer( GL_COPY_WRITE_BUFFER, pool->buffers[i] );
+        glBufferData( GL_COPY_WRITE_BUFFER, bytes_per_frame, NULL, GL_DYNAMIC_COPY );
+        pool->capacities[i] = bytes_per_frame;
+        pool->fences[i] = 0;
+    }
+    pool->frame = 0;
+    pool->used = 0;
+    pool->high_water = bytes_per_frame;
+    return glGetError() == GL_NO_ERROR;
+}
+
+void destroy_skin_cache_pool( Skin_Cache_Pool *pool ) {
+    for ( int i = 0; i < SKIN_CACHE_FRAMES; i++ ) {
+        if ( pool->fences[i] ) {
+            glDeleteSync( pool->fences[i] );
+            pool->fences[i] = 0;
+        }
+    }
+    glDeleteBuffers( SKIN_CACHE_FRAMES, pool->buffers );
+}
+
+void begin_skin_cache_frame( Skin_Cache_Pool *pool ) {
+    pool->frame = ( pool->frame + 1 ) % SKIN_CACHE_FRAMES;
+    int f = pool->frame;
+    if ( pool->fences[f] ) {
+        while ( glClientWaitSync( pool->fences[f], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 ) ==
+                GL_TIMEOUT_EXPIRED ) {
+        }
+        glDeleteSync( pool->fences[f] );
+        pool->fences[f] = 0;
+    }
+    if ( pool->capacities[f] < pool->high_water ) {
+        glBindBuffer( GL_COPY_WRITE_BUFFER, pool->buffers[f] );
+        glBufferData( GL_COPY_WRITE_BUFFER, pool->high_water, NULL, GL_DYNAMIC_COPY );
+        gl_log( "skin cache buffer %i grown from %i to %i bytes\n", f, (int)pool->capacities[f],
+                (int)pool->high_water );
+        pool->capacities[f] = pool->high_water;
+    }
+    pool->used = 0;
+}
+
+void end_skin_cache_frame( Skin_Cache_Pool *pool ) {
+    pool->fences[pool->frame] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
+
+bool skin_cache_alloc( Skin_Cache_Pool *pool, int point_count, Skinned_Vertices *out ) {
+    GLsizeiptr bytes = point_count * SKINNED_VERTEX_BYTES;
+    GLsizeiptr needed = pool->used + bytes;
+    if ( needed > pool->high_water ) {
+        pool->high_water = needed;
+    }
+    if ( needed > pool->capacities[pool->frame] ) {
+        return false;
+    }
+    out->buffer = pool->buffers[pool->frame];
+    out->offset = pool->used;
+    out->point_count = point_count;
+    pool->used = needed;
+    return true;
+}
+
+GLuint create_skinning_programme( const char *vert_file_name, const char *header ) {
+    GLuint vert;
+    if ( !create_shader( vert_file_name, &vert, GL_VERTEX_SHADER, header ) ) {
+        return 0;
+    }
+    GLuint programme = glCreateProgram();
+    glAttachShader( programme, vert );
+    /* has to be set before linking */
+    const char *varyings[] = { "skinned_position", "skinned_normal", "skinned_st" };
+    glTransformFeedbackVaryings( programme, 3, varyings, GL_INTERLEAVED_ATTRIBS );
+    glLinkProgram( programme );
+    glDeleteShader( vert );
+    GLint params = -1;
+    glGetProgramiv( programme, GL_LINK_STATUS, &params );
+    if ( GL_TRUE != params ) {
+        gl_log_err( "ERROR: could not link skinning programme GL index %u\n", programme );
+        print_programme_info_log( programme );
+        glDeleteProgram( programme );
+        return 0;
+    }
+    return programme;
+}
+
+void skin_vertices( GLuint skinning_programme, GLuint vao, const Skinned_Vertices *out ) {
+    glUseProgram( skinning_programme );
+    glBindVertexArray( vao );
+    glBindBufferRange( GL_TRANSFORM_FEEDBACK_BUFFER, 0, out->buffer, out->offset,
+                       out->point_count * SKINNED_VERTEX_BYTES );
+    /* one point in, one vertex out - nothing needs rasterizing */
+    glEnable( GL_RASTERIZER_DISCARD );
+    glBeginTransformFeedback( GL_POINTS );
+    glDrawArrays( GL_POINTS, 0, out->point_count );
+    glEndTransformFeedback();
+    glDisable( GL_RASTERIZER_DISCARD );
+}
+
+void bind_skinned_vertices( GLuint vao, const Skinned_Vertices *vertices ) {
+    glBindVertexArray( vao );
+    glBindBuffer( GL_ARRAY_BUFFER, vertices->buffer );
+    const char *base = (const char *)0 + vertices->offset;
+    glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, SKINNED_VERTEX_BYTES, base );
+    glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, SKINNED_VERTEX_BYTES, base + 3 * sizeof( GLfloat ) );
+    glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, SKINNED_VERTEX_BYTES, base + 6 * sizeof( GLfloat ) );
+    glEnableVertexAttribArray( 0 );
+    glEnableVertexAttribArray( 1 );
+    glEnableVertexAttribArray( 2 );
+}
+
+void benchmark_skin_cache( GLuint vao, int point_count, Bone_Palette *palette,
+                           GLuint skinned_programme, GLuint skinning_programme,
+                           GLuint cached_programme, int instances_per_pass ) {
+    const int frames = 10;
+    const int pass_counts[] = { 1, 2, 4 };
+    typedef std::chrono::steady_clock Clock;
+
+    glm::mat4 *mats = (glm::mat4 *)malloc( palette->max_bones * sizeof( glm::mat4 ) );
+    for ( int i = 0; i < palette->max_bones; i++ ) {
+        mats[i] = glm::rotate( glm::mat4( 1.f ), i * 0.1f, glm::vec3( 0.f, 1.f, 0.f ) );
+    }
+    Skinned_Vertices *skinned = (Skinned_Vertices *)malloc( instances_per_pass * sizeof( Skinned_Vertices ) );
+    Skin_Cache_Pool pool;
+    create_skin_cache_pool( &pool, instances_per_pass * point_count * SKINNED_VERTEX_BYTES );
+    GLuint cached_vao;
+    glGenVertexArrays( 1, &cached_vao );
+    int skinned_model_loc = glGetUniformLocation( skinned_programme, "mat_model" );
+    int cached_model_loc = glGetUniformLocation( cached_programme, "mat_model" );
+
+    /* a 1x1 viewport: every vertex is still shaded, but there are next to no
+     fragments */
+    GLint viewport[4];
+    glGetIntegerv( GL_VIEWPORT, viewport );
+    glViewport( 0, 0, 1, 1 );
+
+    printf( "skinned-vertex cache, %i instances of %i vertices per pass, vertex stage only:\n",
+            instances_per_pass, point_count );
+    printf( "  %6s %14s %14s %9s\n", "passes", "re-skin ms", "cached ms", "speedup" );
+    for ( int p = 0; p < 3; p++ ) {
+        int passes = pass_counts[p];
+
+        /* skin in every pass. frame 0 is a warm-up */
+        setup_palette_programme( palette, skinned_programme );
+        glBindVertexArray( vao );
+        Clock::time_point start;
+        for ( int f = 0; f <= frames; f++ ) {
+            if ( f == 1 ) {
+                glFinish();
+                start = Clock::now();
+            }
+            upload_bone_palette( palette, mats, palette->max_bones );
+            for ( int pass = 0; pass < passes; pass++ ) {
+                for ( int i = 0; i < instances_per_pass; i++ ) {
+                    glm::mat4 model = glm::translate( glm::mat4( 1.f ), glm::vec3( i * 0.01f, 0.f, 0.f ) );
+                    glUniformMatrix4fv( skinned_model_loc, 1, GL_FALSE, glm::value_ptr( model ) );
+                    glDrawArrays( GL_TRIANGLES, 0, point_count );
+                }
+            }
+        }
+        glFinish();
+        double reskin_ms = std::chrono::duration<double, std::milli>( Clock::now() - start ).count() / frames;
+
+        /* skin once into the cache, then draw every pass from it */
+        setup_palette_programme( palette, skinning_programme );
+        for ( int f = 0; f <= frames; f++ ) {
+            if ( f == 1 ) {
+                glFinish();
+                start = Clock::now();
+            }
+            begin_skin_cache_frame( &pool );
+            glUseProgram( skinning_programme );
+            upload_bone_palette( palette, mats, palette->max_bones );
+            for ( int i = 0; i < instances_per_pass; i++ ) {
+                skin_cache_alloc( &pool, point_count, &skinned[i] );
+                skin_vertices( skinning_programme, vao, &skinned[i] );
+            }
+            glUseProgram( cached_programme );
+            for ( int pass = 0; pass < passes; pass++ ) {
+                for ( int i = 0; i < instances_per_pass; i++ ) {
+                    bind_skinned_vertices( cached_vao, &skinned[i] );
+                    glm::mat4 model = glm::translate( glm::mat4( 1.f ), glm::vec3( i * 0.01f, 0.f, 0.f ) );
+                    glUniformMatrix4fv( cached_model_loc, 1, GL_FALSE, glm::value_ptr( model ) );
+                    glDrawArrays( GL_TRIANGLES, 0, point_count );
+                }
+            }
+            end_skin_cache_frame( &pool );
+        }
+        glFinish();
+        double cached_ms = std::chrono::duration<double, std::milli>( Clock::now() - start ).count() / frames;
+
+        printf( "  %6i %14.3f %14.3f %8.2fx\n", passes, reskin_ms, cached_ms, reskin_ms / cached_ms );
+        gl_log( "skin cache %i passes: re-skin %.3f ms, cached %.3f ms\n", passes, reskin_ms, cached_ms );
+    }
+
+    glViewport( viewport[0], viewport[1], viewport[2], viewport[3] );
+    glDeleteVertexArrays( 1, &cached_vao );
+    destroy_skin_cache_pool( &pool );
+    free( skinned );
+    free( mats );
+}
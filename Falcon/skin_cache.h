@@ -0,0 +1,75 @@
+#ifndef _SKIN_CACHE_H_
+#define _SKIN_CACHE_H_
+
+#include <GL/glew.h> // include GLEW and new version of GL on Windows
+#include "bone_palette.h"
+
+/* skinning each instance once a frame instead of once per pass: a transform
+ feedback pass runs the skinning shader (skin_vs.glsl) with the rasterizer off
+ and captures the skinned vertices into a buffer, and every pass after that
+ draws from the buffer with a shader that doesn't skin (cached_vs.glsl).
+
+ the buffers come from a pool with one big buffer per frame in flight. a
+ frame's buffer is bump-allocated, and isn't reused until the GPU has finished
+ the frame that last used it */
+
+/* frames the GPU may be behind the CPU */
+#define SKIN_CACHE_FRAMES 3
+
+/* what the skinning pass writes per vertex: position, normal, texcoord */
+#define SKINNED_VERTEX_FLOATS 8
+#define SKINNED_VERTEX_BYTES ( SKINNED_VERTEX_FLOATS * sizeof( GLfloat ) )
+
+struct Skin_Cache_Pool {
+    GLuint buffers[SKIN_CACHE_FRAMES];
+    GLsizeiptr capacities[SKIN_CACHE_FRAMES];
+    GLsync fences[SKIN_CACHE_FRAMES];
+    int frame;
+    GLsizeiptr used;
+    /* biggest frame so far. a buffer that turns out too small is grown to
+     this the next time its frame comes around */
+    GLsizeiptr high_water;
+};
+
+/* a range of a pool buffer holding one instance's skinned vertices */
+struct Skinned_Vertices {
+    GLuint buffer;
+    GLintptr offset;
+    int point_count;
+};
+
+bool create_skin_cache_pool( Skin_Cache_Pool *pool, GLsizeiptr bytes_per_frame );
+
+void destroy_skin_cache_pool( Skin_Cache_Pool *pool );
+
+/* move on to the next frame's buffer, waiting for the GPU if it is still
+ drawing from it */
+void begin_skin_cache_frame( Skin_Cache_Pool *pool );
+
+/* call after the frame's last draw from the cache */
+void end_skin_cache_frame( Skin_Cache_Pool *pool );
+
+/* room for point_count skinned vertices in this frame's buffer. returns false
+ if it is full - draw that instance the old way (skin in every pass) */
+bool skin_cache_alloc( Skin_Cache_Pool *pool, int point_count, Skinned_Vertices *out );
+
+/* link a skinning programme that captures its output with transform feedback.
+ header is the bone palette's shader header */
+GLuint create_skinning_programme( const char *vert_file_name, const char *header );
+
+/* run the skinning programme over point_count vertices of vao into out. the
+ palette must already be uploaded */
+void skin_vertices( GLuint skinning_programme, GLuint vao, const Skinned_Vertices *out );
+
+/* point attributes 0 (position), 1 (normal) and 2 (texcoord) of vao at some
+ skinned vertices, for drawing with cached_vs.glsl */
+void bind_skinned_vertices( GLuint vao, const Skinned_Vertices *vertices );
+
+/* time the vertex stage of drawing instances_per_pass instances in 1, 2 and
+ 4 passes, re-skinning in every pass vs skinning once into the cache. it draws
+ into a 1x1 viewport, so next to no fragments get shaded */
+void benchmark_skin_cache( GLuint vao, int point_count, Bone_Palette *palette,
+                           GLuint skinned_programme, GLuint skinning_programme,
+                           GLuint cached_programme, int instances_per_pass );
+
+#endif
@@ -0,0 +1,842 @@
+/* CPU block-compression (BC1/BC3/BC5) for textures at import time.
+ every 4x4 block is unpacked into per-channel float planes so that index
+ fitting - the inner loop of every encoder - runs over 8 texels per instruction
+ with AVX, 4 with SSE2, with a plain C fallback for anything else. block rows
+ are handed out to all hardware threads. */
+#include "texture_compress.h"
+#include "gl_utils.h"
+#include "stb_image.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if defined( __AVX__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+/* bump the version whenever the encoder output changes so old caches get
+ rebuilt */
+#define COMPRESSED_CACHE_MAGIC 0x43434246 // "FBCC"
+#define COMPRESSED_CACHE_VERSION 1
+/* larger than any texture GL will take, so a cache claiming more is damaged */
+#define MAX_CACHED_TEXTURE_SIZE 65536
+
+/* one 4x4 block of texels as r, g, b, a planes */
+struct Block_Texels {
+    float c[4][16];
+};
+
+static const char *g_quality_names[COMPRESS_QUALITY_COUNT] = { "fast", "normal",
+                                                               "high" };
+
+static int block_format_number( Block_Format format ) {
+    switch ( format ) {
+    case BLOCK_FORMAT_BC1: return 1;
+    case BLOCK_FORMAT_BC3: return 3;
+    case BLOCK_FORMAT_BC5: return 5;
+    }
+    return 0;
+}
+
+static size_t block_format_size( Block_Format format ) {
+    return BLOCK_FORMAT_BC1 == format ? 8 : 16;
+}
+
+/* bytes of blocks for a width x height image */
+static size_t compressed_image_size( int width, int height, Block_Format format ) {
+    return (size_t)( ( width + 3 ) / 4 ) * ( ( height + 3 ) / 4 ) * block_format_size( format );
+}
+
+static GLenum block_format_gl( Block_Format format ) {
+    switch ( format ) {
+    case BLOCK_FORMAT_BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case BLOCK_FORMAT_BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BLOCK_FORMAT_BC5: return GL_COMPRESSED_RG_RGTC2;
+    }
+    return GL_NONE;
+}
+
+static double seconds_now() {
+    return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+/*------------------------------------ENCODER---------------------------------*/
+/* copy one block out of the image. blocks that hang over the right or bottom
+ edge repeat the last column/row so they don't waste precision on texels that
+ will never be seen */
+static void gather_block( const unsigned char *rgba, int width, int height, int bx,
+                          int by, Block_Texels *bt ) {
+    for ( int y = 0; y < 4; y++ ) {
+        int sy = by * 4 + y < height ? by * 4 + y : height - 1;
+        for ( int x = 0; x < 4; x++ ) {
+            int sx = bx * 4 + x < width ? bx * 4 + x : width - 1;
+            const unsigned char *p = rgba + ( (size_t)sy * width + sx ) * 4;
+            int i = y * 4 + x;
+            bt->c[0][i] = p[0];
+            bt->c[1][i] = p[1];
+            bt->c[2][i] = p[2];
+            bt->c[3][i] = p[3];
+        }
+    }
+}
+
+static void plane_min_max( const float *plane, float *lo, float *hi ) {
+#if defined( __SSE2__ ) || defined( __AVX__ )
+    __m128 a = _mm_loadu_ps( plane );
+    __m128 b = _mm_loadu_ps( plane + 4 );
+    __m128 c = _mm_loadu_ps( plane + 8 );
+    __m128 d = _mm_loadu_ps( plane + 12 );
+    __m128 mn = _mm_min_ps( _mm_min_ps( a, b ), _mm_min_ps( c, d ) );
+    __m128 mx = _mm_max_ps( _mm_max_ps( a, b ), _mm_max_ps( c, d ) );
+    mn = _mm_min_ps( mn, _mm_shuffle_ps( mn, mn, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    mx = _mm_max_ps( mx, _mm_shuffle_ps( mx, mx, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    mn = _mm_min_ps( mn, _mm_shuffle_ps( mn, mn, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    mx = _mm_max_ps( mx, _mm_shuffle_ps( mx, mx, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    *lo = _mm_cvtss_f32( mn );
+    *hi = _mm_cvtss_f32( mx );
+#else
+    *lo = *hi = plane[0];
+    for ( int i = 1; i < 16; i++ ) {
+        *lo = plane[i] < *lo ? plane[i] : *lo;
+        *hi = plane[i] > *hi ? plane[i] : *hi;
+    }
+#endif
+}
+
+/* for each of the 16 texels pick the nearest palette entry, comparing
+ num_channels planes starting at first_channel. returns the summed squared
+ error of the block */
+static float fit_indices( const Block_Texels *bt, int first_channel, int num_channels,
+                          const float palette[][4], int palette_size,
+                          unsigned char indices[16] ) {
+    float total_err = 0.0f;
+#if defined( __AVX__ )
+    for ( int i = 0; i < 16; i += 8 ) {
+        __m256 best_err = _mm256_set1_ps( 1e30f );
+        __m256 best_idx = _mm256_setzero_ps();
+        for ( int p = 0; p < palette_size; p++ ) {
+            __m256 err = _mm256_setzero_ps();
+            for ( int c = 0; c < num_channels; c++ ) {
+                __m256 d = _mm256_sub_ps( _mm256_loadu_ps( &bt->c[first_channel + c][i] ),
+                                          _mm256_set1_ps( palette[p][c] ) );
+                err = _mm256_add_ps( err, _mm256_mul_ps( d, d ) );
+            }
+            __m256 closer = _mm256_cmp_ps( err, best_err, _CMP_LT_OQ );
+            best_err = _mm256_min_ps( err, best_err );
+            best_idx = _mm256_blendv_ps( best_idx, _mm256_set1_ps( (float)p ), closer );
+        }
+        float idx[8], err[8];
+        _mm256_storeu_ps( idx, best_idx );
+        _mm256_storeu_ps( err, best_err );
+        for ( int j = 0; j < 8; j++ ) {
+            indices[i + j] = (unsigned char)idx[j];
+            total_err += err[j];
+        }
+    }
+#elif defined( __SSE2__ )
+    for ( int i = 0; i < 16; i += 4 ) {
+        __m128 best_err = _mm_set1_ps( 1e30f );
+        __m128 best_idx = _mm_setzero_ps();
+        for ( int p = 0; p < palette_size; p++ ) {
+            __m128 err = _mm_setzero_ps();
+            for ( int c = 0; c < num_channels; c++ ) {
+                __m128 d = _mm_sub_ps( _mm_loadu_ps( &bt->c[first_channel + c][i] ),
+                                       _mm_set1_ps( palette[p][c] ) );
+                err = _mm_add_ps( err, _mm_mul_ps( d, d ) );
+            }
+            __m128 closer = _mm_cmplt_ps( err, best_err );
+            best_err = _mm_min_ps( err, best_err );
+            best_idx = _mm_or_ps( _mm_and_ps( closer, _mm_set1_ps( (float)p ) ),
+                                  _mm_andnot_ps( closer, best_idx ) );
+        }
+        float idx[4], err[4];
+        _mm_storeu_ps( idx, best_idx );
+        _mm_storeu_ps( err, best_err );
+        for ( int j = 0; j < 4; j++ ) {
+            indices[i + j] = (unsigned char)idx[j];
+            total_err += err[j];
+        }
+    }
+#else
+    for ( int i = 0; i < 16; i++ ) {
+        float best_err = 1e30f;
+        int best_idx = 0;
+        for ( int p = 0; p < palette_size; p++ ) {
+            float err = 0.0f;
+            for ( int c = 0; c < num_channels; c++ ) {
+                float d = bt->c[first_channel + c][i] - palette[p][c];
+                err += d * d;
+            }
+            if ( err < best_err ) {
+                best_err = err;
+                best_idx = p;
+            }
+        }
+        indices[i] = (unsigned char)best_idx;
+        total_err += best_err;
+    }
+#endif
+    return total_err;
+}
+
+static float clamp_255( float v ) { return v < 0.0f ? 0.0f : ( v > 255.0f ? 255.0f : v ); }
+
+static unsigned short pack_565( const float c[3] ) {
+    int r = (int)( clamp_255( c[0] ) * ( 31.0f / 255.0f ) + 0.5f );
+    int g = (int)( clamp_255( c[1] ) * ( 63.0f / 255.0f ) + 0.5f );
+    int b = (int)( clamp_255( c[2] ) * ( 31.0f / 255.0f ) + 0.5f );
+    return (unsigned short)( ( r << 11 ) | ( g << 5 ) | b );
+}
+
+static void unpack_565( unsigned short v, int c[3] ) {
+    int r = ( v >> 11 ) & 31;
+    int g = ( v >> 5 ) & 63;
+    int b = v & 31;
+    c[0] = ( r << 3 ) | ( r >> 2 );
+    c[1] = ( g << 2 ) | ( g >> 4 );
+    c[2] = ( b << 3 ) | ( b >> 2 );
+}
+
+/* pull both endpoints 1/16th of the way towards each other. the extreme texels
+ are rarely worth hitting exactly, the ones in between are */
+static void inset_endpoints( float *e0, float *e1, int num_channels ) {
+    for ( int c = 0; c < num_channels; c++ ) {
+        float inset = ( e0[c] - e1[c] ) / 16.0f;
+        e0[c] = clamp_255( e0[c] - inset );
+        e1[c] = clamp_255( e1[c] + inset );
+    }
+}
+
+static void bounding_box_endpoints( const Block_Texels *bt, float e0[3], float e1[3] ) {
+    for ( int c = 0; c < 3; c++ ) {
+        plane_min_max( bt->c[c], &e1[c], &e0[c] );
+    }
+    inset_endpoints( e0, e1, 3 );
+}
+
+/* endpoints at the extremes of the texels projected onto the principal axis of
+ their covariance (found with a few rounds of power iteration) */
+static void principal_axis_endpoints( const Block_Texels *bt, float e0[3],
+                                      float e1[3] ) {
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    for ( int i = 0; i < 16; i++ ) {
+        mean[0] += bt->c[0][i];
+        mean[1] += bt->c[1][i];
+        mean[2] += bt->c[2][i];
+    }
+    mean[0] /= 16.0f;
+    mean[1] /= 16.0f;
+    mean[2] /= 16.0f;
+
+    /* upper triangle of the covariance matrix: rr rg rb gg gb bb */
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for ( int i = 0; i < 16; i++ ) {
+        float r = bt->c[0][i] - mean[0];
+        float g = bt->c[1][i] - mean[1];
+        float b = bt->c[2][i] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    float lo[3], hi[3];
+    for ( int c = 0; c < 3; c++ ) {
+        plane_min_max( bt->c[c], &lo[c], &hi[c] );
+    }
+    float axis[3] = { hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2] };
+    for ( int iter = 0; iter < 8; iter++ ) {
+        float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        float m = fmaxf( fabsf( x ), fmaxf( fabsf( y ), fabsf( z ) ) );
+        if ( m < 1e-6f ) {
+            break;
+        }
+        axis[0] = x / m;
+        axis[1] = y / m;
+        axis[2] = z / m;
+    }
+    float len_sq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    if ( len_sq < 1e-6f ) {
+        // flat block - every texel is the same colour
+        bounding_box_endpoints( bt, e0, e1 );
+        return;
+    }
+
+    float min_t = 1e30f, max_t = -1e30f;
+    for ( int i = 0; i < 16; i++ ) {
+        float t = ( bt->c[0][i] - mean[0] ) * axis[0] +
+                  ( bt->c[1][i] - mean[1] ) * axis[1] +
+                  ( bt->c[2][i] - mean[2] ) * axis[2];
+        min_t = t < min_t ? t : min_t;
+        max_t = t > max_t ? t : max_t;
+    }
+    for ( int c = 0; c < 3; c++ ) {
+        e0[c] = clamp_255( mean[c] + axis[c] * max_t / len_sq );
+        e1[c] = clamp_255( mean[c] + axis[c] * min_t / len_sq );
+    }
+    inset_endpoints( e0, e1, 3 );
+}
+
+/* build the 4-colour palette for a pair of 565 endpoints (swapping them so
+ c0 > c1, which selects 4-colour mode) and fit the block to it */
+static float fit_colour_endpoints( const Block_Texels *bt, unsigned short *c0,
+                                   unsigned short *c1, unsigned char indices[16] ) {
+    if ( *c0 < *c1 ) {
+        unsigned short tmp = *c0;
+        *c0 = *c1;
+        *c1 = tmp;
+    }
+    int p0[3], p1[3];
+    unpack_565( *c0, p0 );
+    unpack_565( *c1, p1 );
+    float palette[4][4];
+    for ( int c = 0; c < 3; c++ ) {
+        palette[0][c] = (float)p0[c];
+        palette[1][c] = (float)p1[c];
+        palette[2][c] = (float)( ( 2 * p0[c] + p1[c] ) / 3 );
+        palette[3][c] = (float)( ( p0[c] + 2 * p1[c] ) / 3 );
+    }
+    // equal endpoints: a single colour, and indices 2,3 would mean 3-colour mode
+    return fit_indices( bt, 0, 3, palette, *c0 == *c1 ? 1 : 4, indices );
+}
+
+/* least-squares endpoints for a fixed set of indices. returns false if the
+ indices don't pin the endpoints down (all texels use the same weight) */
+static bool refine_colour_endpoints( const Block_Texels *bt,
+                                     const unsigned char indices[16], float e0[3],
+                                     float e1[3] ) {
+    static const float w0_of_index[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[3] = { 0.0f, 0.0f, 0.0f }, bx[3] = { 0.0f, 0.0f, 0.0f };
+    for ( int i = 0; i < 16; i++ ) {
+        float w0 = w0_of_index[indices[i]];
+        float w1 = 1.0f - w0;
+        aa += w0 * w0;
+        ab += w0 * w1;
+        bb += w1 * w1;
+        for ( int c = 0; c < 3; c++ ) {
+            ax[c] += w0 * bt->c[c][i];
+            bx[c] += w1 * bt->c[c][i];
+        }
+    }
+    float det = aa * bb - ab * ab;
+    if ( fabsf( det ) < 1e-6f ) {
+        return false;
+    }
+    for ( int c = 0; c < 3; c++ ) {
+        e0[c] = clamp_255( ( bb * ax[c] - ab * bx[c] ) / det );
+        e1[c] = clamp_255( ( aa * bx[c] - ab * ax[c] ) / det );
+    }
+    return true;
+}
+
+static void write_colour_block( unsigned short c0, unsigned short c1,
+                                const unsigned char indices[16], unsigned char *out ) {
+    out[0] = (unsigned char)( c0 & 0xFF );
+    out[1] = (unsigned char)( c0 >> 8 );
+    out[2] = (unsigned char)( c1 & 0xFF );
+    out[3] = (unsigned char)( c1 >> 8 );
+    for ( int row = 0; row < 4; row++ ) {
+        const unsigned char *idx = indices + row * 4;
+        out[4 + row] =
+          (unsigned char)( idx[0] | ( idx[1] << 2 ) | ( idx[2] << 4 ) | ( idx[3] << 6 ) );
+    }
+}
+
+/* BC1 colour block. also the second half of a BC3 block */
+static void encode_colour_block( const Block_Texels *bt, Compress_Quality quality,
+                                 unsigned char *out ) {
+    float e0[3], e1[3];
+    if ( COMPRESS_QUALITY_FAST == quality ) {
+        bounding_box_endpoints( bt, e0, e1 );
+    } else {
+        principal_axis_endpoints( bt, e0, e1 );
+    }
+    unsigned short c0 = pack_565( e0 );
+    unsigned short c1 = pack_565( e1 );
+    unsigned char indices[16];
+    float err = fit_colour_endpoints( bt, &c0, &c1, indices );
+
+    if ( COMPRESS_QUALITY_HIGH == quality ) {
+        for ( int iter = 0; iter < 2 && err > 0.0f; iter++ ) {
+            if ( !refine_colour_endpoints( bt, indices, e0, e1 ) ) {
+                break;
+            }
+            unsigned short n0 = pack_565( e0 );
+            unsigned short n1 = pack_565( e1 );
+            unsigned char n_indices[16];
+            float n_err = fit_colour_endpoints( bt, &n0, &n1, n_indices );
+            if ( n_err >= err ) {
+                break;
+            }
+            err = n_err;
+            c0 = n0;
+            c1 = n1;
+            memcpy( indices, n_indices, sizeof( indices ) );
+        }
+    }
+    write_colour_block( c0, c1, indices, out );
+}
+
+static float fit_channel_endpoints( const Block_Texels *bt, int channel, int a0, int a1,
+                                    unsigned char indices[16] ) {
+    float palette[8][4];
+    palette[0][0] = (float)a0;
+    palette[1][0] = (float)a1;
+    for ( int i = 2; i < 8; i++ ) {
+        palette[i][0] = (float)( ( ( 8 - i ) * a0 + ( i - 1 ) * a1 ) / 7 );
+    }
+    return fit_indices( bt, channel, 1, palette, a0 == a1 ? 1 : 8, indices );
+}
+
+/* BC4-style single interpolated channel: BC3 alpha, and each half of BC5.
+ we always use the 8-value mode (a0 > a1) */
+static void encode_channel_block( const Block_Texels *bt, int channel,
+                                  Compress_Quality quality, unsigned char *out ) {
+    float lo, hi;
+    plane_min_max( bt->c[channel], &lo, &hi );
+    int a0 = (int)( hi + 0.5f );
+    int a1 = (int)( lo + 0.5f );
+    unsigned char indices[16];
+    float err = fit_channel_endpoints( bt, channel, a0, a1, indices );
+
+    /* the same inset trick as colour, but cheap enough to search for */
+    if ( COMPRESS_QUALITY_HIGH == quality ) {
+        int best_a0 = a0, best_a1 = a1;
+        for ( int d = 1; d <= 4 && a0 - 2 * d > a1 && err > 0.0f; d++ ) {
+            unsigned char n_indices[16];
+            float n_err = fit_channel_endpoints( bt, channel, a0 - d, a1 + d, n_indices );
+            if ( n_err < err ) {
+                err = n_err;
+                best_a0 = a0 - d;
+                best_a1 = a1 + d;
+                memcpy( indices, n_indices, sizeof( indices ) );
+            }
+        }
+        a0 = best_a0;
+        a1 = best_a1;
+    }
+    out[0] = (unsigned char)a0;
+    out[1] = (unsigned char)a1;
+
+    /* 16 3-bit indices packed little-endian into the remaining 6 bytes */
+    unsigned long long bits = 0;
+    for ( int i = 15; i >= 0; i-- ) {
+        bits = ( bits << 3 ) | indices[i];
+    }
+    for ( int i = 0; i < 6; i++ ) {
+        out[2 + i] = (unsigned char)( bits >> ( 8 * i ) );
+    }
+}
+
+static void encode_block( const Block_Texels *bt, Block_Format format,
+                          Compress_Quality quality, unsigned char *out ) {
+    switch ( format ) {
+    case BLOCK_FORMAT_BC1:
+        encode_colour_block( bt, quality, out );
+        break;
+    case BLOCK_FORMAT_BC3:
+        encode_channel_block( bt, 3, quality, out );
+        encode_colour_block( bt, quality, out + 8 );
+        break;
+    case BLOCK_FORMAT_BC5:
+        encode_channel_block( bt, 0, quality, out );
+        encode_channel_block( bt, 1, quality, out + 8 );
+        break;
+    }
+}
+
+struct Compress_Job {
+    const unsigned char *rgba;
+    int width;
+    int height;
+    int blocks_x;
+    int blocks_y;
+    Block_Format format;
+    Compress_Quality quality;
+    unsigned char *out;
+    std::atomic<int> next_row;
+};
+
+/* worker loop - each thread grabs the next unclaimed row of blocks */
+static void compress_block_rows( Compress_Job *job ) {
+    size_t block_size = block_format_size( job->format );
+    Block_Texels bt;
+    for ( ;; ) {
+        int by = job->next_row++;
+        if ( by >= job->blocks_y ) {
+            break;
+        }
+        unsigned char *out = job->out + (size_t)by * job->blocks_x * block_size;
+        for ( int bx = 0; bx < job->blocks_x; bx++ ) {
+            gather_block( job->rgba, job->width, job->height, bx, by, &bt );
+            encode_block( &bt, job->format, job->quality, out );
+            out += block_size;
+        }
+    }
+}
+
+bool compress_image( const unsigned char *rgba, int width, int height,
+                     Block_Format format, Compress_Quality quality,
+                     Compressed_Image *image ) {
+    assert( rgba && image );
+    assert( width > 0 && height > 0 );
+
+    Compress_Job job;
+    job.rgba = rgba;
+    job.width = width;
+    job.height = height;
+    job.blocks_x = ( width + 3 ) / 4;
+    job.blocks_y = ( height + 3 ) / 4;
+    job.format = format;
+    job.quality = quality;
+    job.next_row = 0;
+
+    image->width = width;
+    image->height = height;
+    image->format = format;
+    image->size = compressed_image_size( width, height, format );
+    image->data = (unsigned char *)malloc( image->size );
+    if ( !image->data ) {
+        gl_log_err( "ERROR: could not allocate %u bytes for compressed image\n",
+                    (unsigned int)image->size );
+        return false;
+    }
+    job.out = image->data;
+
+    int num_threads = (int)std::thread::hardware_concurrency();
+    if ( num_threads > job.blocks_y ) {
+        num_threads = job.blocks_y;
+    }
+    std::vector<std::thread> workers;
+    for ( int i = 1; i < num_threads; i++ ) {
+        workers.push_back( std::thread( compress_block_rows, &job ) );
+    }
+    compress_block_rows( &job );
+    for ( size_t i = 0; i < workers.size(); i++ ) {
+        workers[i].join();
+    }
+    return true;
+}
+
+void free_compressed_image( Compressed_Image *image ) {
+    free( image->data );
+    image->data = NULL;
+    image->size = 0;
+}
+
+/*------------------------------------DECODER---------------------------------*/
+static void decode_colour_block( const unsigned char *in, bool allow_3_colour,
+                                 unsigned char texels[16][4] ) {
+    unsigned short c0 = (unsigned short)( in[0] | ( in[1] << 8 ) );
+    unsigned short c1 = (unsigned short)( in[2] | ( in[3] << 8 ) );
+    int palette[4][3];
+    unpack_565( c0, palette[0] );
+    unpack_565( c1, palette[1] );
+    for ( int c = 0; c < 3; c++ ) {
+        if ( c0 > c1 || !allow_3_colour ) {
+            palette[2][c] = ( 2 * palette[0][c] + palette[1][c] ) / 3;
+            palette[3][c] = ( palette[0][c] + 2 * palette[1][c] ) / 3;
+        } else {
+            palette[2][c] = ( palette[0][c] + palette[1][c] ) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    for ( int i = 0; i < 16; i++ ) {
+        int idx = ( in[4 + i / 4] >> ( 2 * ( i % 4 ) ) ) & 3;
+        texels[i][0] = (unsigned char)palette[idx][0];
+        texels[i][1] = (unsigned char)palette[idx][1];
+        texels[i][2] = (unsigned char)palette[idx][2];
+    }
+}
+
+static void decode_channel_block( const unsigned char *in, unsigned char texels[16][4],
+                                  int channel ) {
+    int a0 = in[0];
+    int a1 = in[1];
+    int palette[8];
+    palette[0] = a0;
+    palette[1] = a1;
+    for ( int i = 2; i < 8; i++ ) {
+        if ( a0 > a1 ) {
+            palette[i] = ( ( 8 - i ) * a0 + ( i - 1 ) * a1 ) / 7;
+        } else if ( i < 6 ) {
+            palette[i] = ( ( 6 - i ) * a0 + ( i - 1 ) * a1 ) / 5;
+        } else {
+            palette[i] = 6 == i ? 0 : 255;
+        }
+    }
+    unsigned long long bits = 0;
+    for ( int i = 5; i >= 0; i-- ) {
+        bits = ( bits << 8 ) | in[2 + i];
+    }
+    for ( int i = 0; i < 16; i++ ) {
+        texels[i][channel] = (unsigned char)palette[( bits >> ( 3 * i ) ) & 7];
+    }
+}
+
+void decompress_image( const Compressed_Image *image, unsigned char *rgba ) {
+    assert( image && rgba );
+    int blocks_x = ( image->width + 3 ) / 4;
+    int blocks_y = ( image->height + 3 ) / 4;
+    size_t block_size = block_format_size( image->format );
+    const unsigned char *in = image->data;
+    unsigned char texels[16][4];
+
+    for ( int by = 0; by < blocks_y; by++ ) {
+        for ( int bx = 0; bx < blocks_x; bx++ ) {
+            memset( texels, 0, sizeof( texels ) );
+            switch ( image->format ) {
+            case BLOCK_FORMAT_BC1:
+                decode_colour_block( in, true, texels );
+                for ( int i = 0; i < 16; i++ ) {
+                    texels[i][3] = 255;
+                }
+                break;
+            case BLOCK_FORMAT_BC3:
+                decode_channel_block( in, texels, 3 );
+                decode_colour_block( in + 8, false, texels );
+                break;
+            case BLOCK_FORMAT_BC5:
+                decode_channel_block( in, texels, 0 );
+                decode_channel_block( in + 8, texels, 1 );
+                for ( int i = 0; i < 16; i++ ) {
+                    texels[i][3] = 255;
+                }
+                break;
+            }
+            in += block_size;
+
+            for ( int y = 0; y < 4 && by * 4 + y < image->height; y++ ) {
+                for ( int x = 0; x < 4 && bx * 4 + x < image->width; x++ ) {
+                    size_t offs = ( (size_t)( by * 4 + y ) * image->width + bx * 4 + x ) * 4;
+                    memcpy( rgba + offs, texels[y * 4 + x], 4 );
+                }
+            }
+        }
+    }
+}
+
+double compressed_image_psnr( const unsigned char *rgba,
+                              const Compressed_Image *image ) {
+    size_t num_texels = (size_t)image->width * image->height;
+    unsigned char *decoded = (unsigned char *)malloc( num_texels * 4 );
+    if ( !decoded ) {
+        return 0.0;
+    }
+    decompress_image( image, decoded );
+
+    int num_channels = 3;
+    if ( BLOCK_FORMAT_BC3 == image->format ) {
+        num_channels = 4;
+    } else if ( BLOCK_FORMAT_BC5 == image->format ) {
+        num_channels = 2;
+    }
+    double sum_sq = 0.0;
+    for ( size_t i = 0; i < num_texels; i++ ) {
+        for ( int c = 0; c < num_channels; c++ ) {
+            double d = (double)rgba[i * 4 + c] - (double)decoded[i * 4 + c];
+            sum_sq += d * d;
+        }
+    }
+    free( decoded );
+
+    double mse = sum_sq / (double)( num_texels * num_channels );
+    if ( mse <= 0.0 ) {
+        return INFINITY;
+    }
+    return 10.0 * log10( 255.0 * 255.0 / mse );
+}
+
+void log_compression_tiers( const char *name, const unsigned char *rgba, int width,
+                            int height, Block_Format format ) {
+    double megapixels = (double)width * height / 1e6;
+    gl_log_err( "BC%i tiers for %s (%ix%i):\n", block_format_number( format ), name,
+                width, height );
+    for ( int q = 0; q < COMPRESS_QUALITY_COUNT; q++ ) {
+        Compressed_Image image;
+        double start = seconds_now();
+        if ( !compress_image( rgba, width, height, format, (Compress_Quality)q, &image ) ) {
+            return;
+        }
+        double elapsed = seconds_now() - start;
+        gl_log_err( "  %-6s %8.2f dB PSNR %8.1f Mpix/s %u -> %u bytes (%.1fx)\n",
+                    g_quality_names[q], compressed_image_psnr( rgba, &image ),
+                    megapixels / elapsed, (unsigned int)( (size_t)width * height * 4 ),
+                    (unsigned int)image.size,
+                    (double)width * height * 4 / (double)image.size );
+        free_compressed_image( &image );
+    }
+}
+
+bool log_texture_file_tiers( const char *file_name ) {
+    int x, y, n;
+    stbi_set_flip_vertically_on_load( 1 );
+    unsigned char *rgba = stbi_load( file_name, &x, &y, &n, 4 );
+    if ( !rgba ) {
+        gl_log_err( "ERROR: could not load %s\n", file_name );
+        return false;
+    }
+    log_compression_tiers( file_name, rgba, x, y, BLOCK_FORMAT_BC1 );
+    log_compression_tiers( file_name, rgba, x, y, BLOCK_FORMAT_BC3 );
+    log_compression_tiers( file_name, rgba, x, y, BLOCK_FORMAT_BC5 );
+    stbi_image_free( rgba );
+    return true;
+}
+
+/*-------------------------------------CACHE----------------------------------*/
+struct Compressed_Cache_Header {
+    unsigned int magic;
+    unsigned int version;
+    int format;
+    int quality;
+    int width;
+    int height;
+    unsigned int size;
+};
+
+/* e.g. textures/skulluvmap.png -> textures/skulluvmap.png.bc1_high.cache */
+static void compressed_cache_file_name( const char *file_name, Block_Format format,
+                                        Compress_Quality quality, char *cache_name,
+                                        int max_len ) {
+    snprintf( cache_name, max_len, "%s.bc%i_%s.cache", file_name,
+              block_format_number( format ), g_quality_names[quality] );
+}
+
+static bool read_compressed_cache( const char *cache_name, const char *file_name,
+                                   Block_Format format, Compress_Quality quality,
+                                   Compressed_Image *image ) {
+    /* stale if the source image was saved after the cache was written */
+    struct stat src_stat, cache_stat;
+    if ( 0 != stat( cache_name, &cache_stat ) ) {
+        return false;
+    }
+    if ( 0 == stat( file_name, &src_stat ) && src_stat.st_mtime > cache_stat.st_mtime ) {
+        return false;
+    }
+
+    FILE *file = fopen( cache_name, "rb" );
+    if ( !file ) {
+        return false;
+    }
+    Compressed_Cache_Header header;
+    if ( 1 != fread( &header, sizeof( header ), 1, file ) ||
+         COMPRESSED_CACHE_MAGIC != header.magic ||
+         COMPRESSED_CACHE_VERSION != header.version || (int)format != header.format ||
+         (int)quality != header.quality ) {
+        fclose( file );
+        return false;
+    }
+    /* the size goes straight to glCompressedTexImage2D, so it has to be what
+     the dimensions need. anything else is a damaged cache */
+    if ( header.width < 1 || header.height < 1 || header.width > MAX_CACHED_TEXTURE_SIZE ||
+         header.height > MAX_CACHED_TEXTURE_SIZE ||
+         (size_t)header.size != compressed_image_size( header.width, header.height, format ) ) {
+        gl_log_err( "WARNING: texture cache %s does not match its %ix%i image, ignoring it\n",
+                    cache_name, header.width, header.height );
+        fclose( file );
+        return false;
+    }
+    image->width = header.width;
+    image->height = header.height;
+    image->format = format;
+    image->size = header.size;
+    image->data = (unsigned char *)malloc( image->size );
+    if ( !image->data || 1 != fread( image->data, image->size, 1, file ) ) {
+        free( image->data );
+        image->data = NULL;
+        fclose( file );
+        return false;
+    }
+    fclose( file );
+    return true;
+}
+
+static bool write_compressed_cache( const char *cache_name, Compress_Quality quality,
+                                    const Compressed_Image *image ) {
+    FILE *file = fopen( cache_name, "wb" );
+    if ( !file ) {
+        return false;
+    }
+    Compressed_Cache_Header header;
+    header.magic = COMPRESSED_CACHE_MAGIC;
+    header.version = COMPRESSED_CACHE_VERSION;
+    header.format = (int)image->format;
+    header.quality = (int)quality;
+    header.width = image->width;
+    header.height = image->height;
+    header.size = (unsigned int)image->size;
+    bool ok = 1 == fwrite( &header, sizeof( header ), 1, file ) &&
+              1 == fwrite( image->data, image->size, 1, file );
+    if ( EOF == fclose( file ) ) {
+        ok = false;
+    }
+    return ok;
+}
+
+/*-------------------------------------IMPORT---------------------------------*/
+bool load_texture( const char *file_name, Block_Format format,
+                   Compress_Quality quality, GLuint *tex ) {
+    char cache_name[1024];
+    compressed_cache_file_name( file_name, format, quality, cache_name,
+                                sizeof( cache_name ) );
+
+    Compressed_Image image;
+    if ( read_compressed_cache( cache_name, file_name, format, quality, &image ) ) {
+        gl_log( "texture %s: using cached blocks %s\n", file_name, cache_name );
+    } else {
+        int x, y, n;
+        /* GL expects the first row of texels at the bottom */
+        stbi_set_flip_vertically_on_load( 1 );
+        unsigned char *rgba = stbi_load( file_name, &x, &y, &n, 4 );
+        if ( !rgba ) {
+            gl_log_err( "ERROR: could not load %s\n", file_name );
+            return false;
+        }
+        double start = seconds_now();
+        if ( !compress_image( rgba, x, y, format, quality, &image ) ) {
+            stbi_image_free( rgba );
+            return false;
+        }
+        double elapsed = seconds_now() - start;
+        gl_log( "texture %s: %ix%i BC%i %s, %.2f dB PSNR, %.1f Mpix/s, "
+                "%u -> %u bytes\n",
+                file_name, x, y, block_format_number( format ),
+                g_quality_names[quality], compressed_image_psnr( rgba, &image ),
+                (double)x * y / 1e6 / elapsed, (unsigned int)( (size_t)x * y * 4 ),
+                (unsigned int)image.size );
+        stbi_image_free( rgba );
+
+        if ( !write_compressed_cache( cache_name, quality, &image ) ) {
+            gl_log_err( "WARNING: could not write texture cache %s\n", cache_name );
+        }
+    }
+
+    glGenTextures( 1, tex );
+    glActiveTexture( GL_TEXTURE0 );
+    glBindTexture( GL_TEXTURE_2D, *tex );
+    glCompressedTexImage2D( GL_TEXTURE_2D, 0, block_format_gl( format ), image.width,
+                            image.height, 0, (GLsizei)image.size, image.data );
+    /* no mip chain is stored, so don't let GL go looking for one */
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0 );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+    free_compressed_image( &image );
+    return true;
+}
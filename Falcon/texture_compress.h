@@ -0,0 +1,66 @@
+#ifndef _TEXTURE_COMPRESS_H_
+#define _TEXTURE_COMPRESS_H_
+
+#include <GL/glew.h> // include GLEW and new version of GL on Windows
+#include <stddef.h>
+
+/* GPU block-compression formats. all of them work on 4x4 texel blocks; BC1
+ stores a block in 8 bytes (8x smaller than RGBA8), BC3 and BC5 in 16 bytes
+ (4x smaller) */
+enum Block_Format {
+    BLOCK_FORMAT_BC1, // RGB colour, no alpha
+    BLOCK_FORMAT_BC3, // RGB colour + interpolated alpha
+    BLOCK_FORMAT_BC5  // two interpolated channels (R,G) - tangent-space normal maps
+};
+
+/* how hard the encoder tries to find good block endpoints */
+enum Compress_Quality {
+    COMPRESS_QUALITY_FAST,   // bounding box of the block's texels
+    COMPRESS_QUALITY_NORMAL, // principal axis of the block's texels
+    COMPRESS_QUALITY_HIGH,   // principal axis + least-squares endpoint refinement
+    COMPRESS_QUALITY_COUNT
+};
+
+struct Compressed_Image {
+    unsigned char *data; // tightly packed blocks, row by row
+    size_t size;				 // size of data in bytes
+    int width;
+    int height;
+    Block_Format format;
+};
+
+/* encode a tightly-packed RGBA8 image. width and height do not need to be
+ multiples of 4; edge blocks repeat the last row/column. block rows are spread
+ over all hardware threads. returns false if out of memory */
+bool compress_image( const unsigned char *rgba, int width, int height,
+                     Block_Format format, Compress_Quality quality,
+                     Compressed_Image *image );
+
+/* decode back to RGBA8 (width * height * 4 bytes). channels a format does not
+ store come back as 0 (colour) or 255 (alpha) */
+void decompress_image( const Compressed_Image *image, unsigned char *rgba );
+
+/* peak signal-to-noise ratio in dB of the compressed image against its
+ source, over the channels the format stores */
+double compressed_image_psnr( const unsigned char *rgba,
+                              const Compressed_Image *image );
+
+void free_compressed_image( Compressed_Image *image );
+
+/* print size, PSNR and encoder throughput (megapixels per second) for every
+ quality tier. useful to decide what tier an asset should use */
+void log_compression_tiers( const char *name, const unsigned char *rgba,
+                            int width, int height, Block_Format format );
+
+/* load an image file and log_compression_tiers() it as BC1, BC3 and BC5.
+ returns false if the image could not be loaded */
+bool log_texture_file_tiers( const char *file_name );
+
+/* load an image file with stb_image, block-compress it and upload it to a new
+ GL texture. the compressed blocks are cached next to the source file as
+ <file>.bc<N>_<quality>.cache, so compression only runs again if the source
+ image changes */
+bool load_texture( const char *file_name, Block_Format format,
+                   Compress_Quality quality, GLuint *tex );
+
+#endif
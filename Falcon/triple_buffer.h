@@ -0,0 +1,51 @@
+#ifndef _TRIPLE_BUFFER_H_
+#define _TRIPLE_BUFFER_H_
+
+#include <atomic>
+
+/* lock-free single-producer/single-consumer triple buffer. the producer
+ always has a slot of its own to write into, the consumer always has a slot of
+ its own to read from, and the third slot holds the most recently published
+ value. neither side ever waits on the other; the consumer just sees the
+ newest complete value whenever it looks.
+
+ producer: fill write_slot(), then publish().
+ consumer: acquire(), then read read_slot() until the next acquire(). */
+template <typename T> struct Triple_Buffer {
+    Triple_Buffer() : write_index( 0 ), read_index( 1 ), shared( 2 ) {}
+
+    T *write_slot() { return &slots[write_index]; }
+
+    /* slot i of 0..2, for setting all of them up before either side starts */
+    T *slot( int i ) { return &slots[i]; }
+
+    /* hand the write slot over as the latest value and take back whatever
+     slot was in the middle */
+    void publish() {
+        write_index = shared.exchange( write_index | FRESH_BIT, std::memory_order_acq_rel ) &
+                      INDEX_MASK;
+    }
+
+    /* swap in the latest value if one was published since the last call.
+     returns false (and keeps the current read slot) if nothing new */
+    bool acquire() {
+        if ( !( shared.load( std::memory_order_relaxed ) & FRESH_BIT ) ) {
+            return false;
+        }
+        read_index = shared.exchange( read_index, std::memory_order_acq_rel ) & INDEX_MASK;
+        return true;
+    }
+
+    const T *read_slot() const { return &slots[read_index]; }
+
+  private:
+    enum { INDEX_MASK = 3, FRESH_BIT = 4 };
+
+    T slots[3];
+    int write_index; // only touched by the producer
+    int read_index;	// only touched by the consumer
+    /* index of the middle slot, plus FRESH_BIT if the consumer hasn't seen it */
+    std::atomic<int> shared;
+};
+
+#endif
@@ -78,6 +78,12 @@ namespace detail
 	}
 */
 	
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fade(T const & t)
+	{
+		return (t * t * t) * (t * (t * T(6) - T(15)) + T(10));
+	}
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec2<T, P> fade(tvec2<T, P> const & t)
 	{
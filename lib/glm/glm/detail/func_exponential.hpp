@@ -7,6 +7,9 @@
 /// @ingroup core
 /// 
 /// These all operate component-wise. The description is per component.
+///
+/// With SIMD, pow, exp and log of aligned float vec4 are within 1 ULP, exp and log
+/// within 3.5 ULP with aligned_lowp.
 
 #pragma once
 
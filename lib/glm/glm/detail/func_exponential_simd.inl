@@ -8,6 +8,64 @@
 namespace glm{
 namespace detail
 {
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// Without FMA, the double evaluation of glm_vec4_pow is slower than the C library
+	template <precision P>
+	struct compute_pow<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & base, tvec4<float, P> const & exponent)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_pow(base.data, exponent.data);
+			return result;
+		}
+	};
+#	endif
+
+	template <precision P>
+	struct compute_exp<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_exp(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_exp_lowp(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_log<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_log(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_log_lowp(v.data);
+			return result;
+		}
+	};
+
 	template <precision P>
 	struct compute_sqrt<tvec4, float, P, true>
 	{
@@ -45,7 +45,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/dot.xml">GLSL dot man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL T dot(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T dot(
 		vecType<T, P> const & x,
 		vecType<T, P> const & y);
 
@@ -56,7 +56,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/cross.xml">GLSL cross man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> cross(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> cross(
 		tvec3<T, P> const & x,
 		tvec3<T, P> const & y);
 
@@ -11,6 +11,9 @@
 /// the divisor of a ratio is 0, then results will be undefined.
 /// 
 /// These all operate component-wise. The description is per component.
+///
+/// With SIMD, sin, cos, sincos, acos and atan(y, x) of aligned float vec4 are within 1 ULP,
+/// within 3.5 ULP with aligned_lowp.
 
 #pragma once
 
@@ -60,6 +63,24 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_DECL vecType<T, P> cos(vecType<T, P> const & angle);
 
+	/// Sine and cosine of the same angles, s being sin(angle) and c cos(angle).
+	/// Cheaper than sin and cos with SIMD, as both come from one range reduction.
+	///
+	/// @tparam genType Floating-point scalar or vector types.
+	///
+	/// @see core_func_trigonometric
+	template <typename genType>
+	GLM_FUNC_DECL void sincos(genType angle, genType & s, genType & c);
+
+	/// Sine and cosine of the same angles, s being sin(angle) and c cos(angle).
+	/// Cheaper than sin and cos with SIMD, as both come from one range reduction.
+	///
+	/// @tparam genType Floating-point scalar or vector types.
+	///
+	/// @see core_func_trigonometric
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL void sincos(vecType<T, P> const & angle, vecType<T, P> & s, vecType<T, P> & c);
+
 	/// The standard trigonometric tangent function.
 	///
 	/// @tparam genType Floating-point scalar or vector types.
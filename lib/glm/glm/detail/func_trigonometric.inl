@@ -5,8 +5,58 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(::std::sin, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(::std::cos, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_sincos
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<T, P> const & x, vecType<T, P> & s, vecType<T, P> & c)
+		{
+			// x may be s or c
+			vecType<T, P> const Sin(compute_sin<vecType, T, P, Aligned>::call(x));
+			c = compute_cos<vecType, T, P, Aligned>::call(x);
+			s = Sin;
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_acos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(::std::acos, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_atan2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & y, vecType<T, P> const & x)
+		{
+			return detail::functor2<T, P, vecType>::call(::std::atan2, y, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template <typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -43,7 +93,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> sin(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(sin, v);
+		return detail::compute_sin<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// cos
@@ -52,7 +102,23 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> cos(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(cos, v);
+		return detail::compute_cos<vecType, T, P, detail::is_aligned<P>::value>::call(v);
+	}
+
+	// sincos
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void sincos(genType angle, genType & s, genType & c)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'sincos' only accept floating-point input");
+
+		s = std::sin(angle);
+		c = std::cos(angle);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void sincos(vecType<T, P> const & angle, vecType<T, P> & s, vecType<T, P> & c)
+	{
+		detail::compute_sincos<vecType, T, P, detail::is_aligned<P>::value>::call(angle, s, c);
 	}
 
 	// tan
@@ -79,7 +145,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> acos(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(acos, v);
+		return detail::compute_acos<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// atan
@@ -94,7 +160,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> atan(vecType<T, P> const & a, vecType<T, P> const & b)
 	{
-		return detail::functor2<T, P, vecType>::call(::std::atan2, a, b);
+		return detail::compute_atan2<vecType, T, P, detail::is_aligned<P>::value>::call(a, b);
 	}
 
 	using std::atan;
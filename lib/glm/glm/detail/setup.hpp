@@ -348,6 +348,25 @@
 #	define GLM_HAS_CONSTEXPR_PARTIAL (GLM_HAS_CONSTEXPR || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC14)))
 #endif
 
+// N3652, Visual C++ is left out for the same bug #594 that disables GLM_CONSTEXPR_CTOR
+#if GLM_COMPILER & GLM_COMPILER_CLANG
+#	define GLM_HAS_CONSTEXPR_CXX14 (GLM_HAS_CONSTEXPR && __has_feature(cxx_relaxed_constexpr))
+#elif GLM_COMPILER & GLM_COMPILER_VC
+#	define GLM_HAS_CONSTEXPR_CXX14 0
+#else
+#	define GLM_HAS_CONSTEXPR_CXX14 (GLM_HAS_CONSTEXPR && (GLM_LANG & GLM_LANG_CXX14_FLAG))
+#endif
+
+// Lets the relaxed constexpr functions take a constant evaluation friendly path at compile time only
+#if defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED GLM_HAS_CONSTEXPR_CXX14
+#	endif
+#endif
+#ifndef GLM_HAS_IS_CONSTANT_EVALUATED
+#	define GLM_HAS_IS_CONSTANT_EVALUATED 0
+#endif
+
 // N2672
 #if GLM_COMPILER & GLM_COMPILER_CLANG
 #	define GLM_HAS_INITIALIZER_LISTS __has_feature(cxx_generalized_initializers)
@@ -451,6 +470,17 @@
 		((GLM_COMPILER & GLM_COMPILER_CUDA) && (GLM_COMPILER >= GLM_COMPILER_CUDA70))))
 #endif
 
+// N2659
+#if GLM_COMPILER & GLM_COMPILER_CLANG
+#	define GLM_HAS_THREAD_LOCAL __has_feature(cxx_thread_local)
+#elif GLM_LANG & GLM_LANG_CXX11_FLAG
+#	define GLM_HAS_THREAD_LOCAL 1
+#else
+#	define GLM_HAS_THREAD_LOCAL ((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (\
+		((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC48)) || \
+		((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC14))))
+#endif
+
 #define GLM_HAS_ONLY_XYZW ((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER < GLM_COMPILER_GCC46))
 #if GLM_HAS_ONLY_XYZW
 #	pragma message("GLM: GCC older than 4.6 has a bug presenting the use of rgba and stpq components")
@@ -485,6 +515,15 @@
 		((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC14) && (GLM_ARCH & GLM_ARCH_X86_BIT))))
 #endif
 
+// F16C half float conversions come with /arch:AVX2 on Visual C++ but need -mf16c with GCC and Clang
+#if !(GLM_ARCH & GLM_ARCH_AVX_BIT)
+#	define GLM_HAS_F16C 0
+#elif defined(__F16C__)
+#	define GLM_HAS_F16C 1
+#else
+#	define GLM_HAS_F16C ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#endif
+
 // OpenMP
 #ifdef _OPENMP
 #	if GLM_COMPILER & GLM_COMPILER_GCC
@@ -762,6 +801,14 @@
 #	define GLM_CONSTEXPR_SIMD
 #endif
 
+// Functions with a body beyond a single return statement: arithmetic operators, matrix
+// constructors and transform builders
+#if GLM_HAS_CONSTEXPR_CXX14
+#	define GLM_CONSTEXPR_CXX14 constexpr
+#else
+#	define GLM_CONSTEXPR_CXX14
+#endif
+
 #ifdef GLM_FORCE_EXPLICIT_CTOR
 #	define GLM_EXPLICIT explicit
 #else
@@ -1,7 +1,142 @@
 /// @ref core
-/// @file glm/detail/type_mat4x4_sse2.inl
+/// @file glm/detail/type_mat4x4_simd.inl
 
-namespace glm
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+	template <precision P>
+	struct compute_mat4_mul<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			GLM_STATIC_ASSERT(detail::is_aligned<P>::value, "Specialization requires aligned");
+
+			tmat4x4<float, P> Result(uninitialize);
+			glm_mat4_mul(
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	// Packed matrices have no alignment guarantee, so their columns go through unaligned loads and stores
+	template <precision P>
+	struct compute_mat4_mul<float, P, false>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			glm_vec4 const a[4] = {
+				_mm_loadu_ps(&m1[0][0]), _mm_loadu_ps(&m1[1][0]), _mm_loadu_ps(&m1[2][0]), _mm_loadu_ps(&m1[3][0])};
+			glm_vec4 const b[4] = {
+				_mm_loadu_ps(&m2[0][0]), _mm_loadu_ps(&m2[1][0]), _mm_loadu_ps(&m2[2][0]), _mm_loadu_ps(&m2[3][0])};
+			glm_vec4 r[4];
+			glm_mat4_mul(a, b, r);
+
+			tmat4x4<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0][0], r[0]);
+			_mm_storeu_ps(&Result[1][0], r[1]);
+			_mm_storeu_ps(&Result[2][0], r[2]);
+			_mm_storeu_ps(&Result[3][0], r[3]);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul_vec4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tmat4x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			GLM_STATIC_ASSERT(detail::is_aligned<P>::value, "Specialization requires aligned");
+
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_mat4_mul_vec4(*reinterpret_cast<glm_vec4 const(*)[4]>(&m[0].data), v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul_vec4<float, P, false>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tmat4x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			glm_vec4 const a[4] = {
+				_mm_loadu_ps(&m[0][0]), _mm_loadu_ps(&m[1][0]), _mm_loadu_ps(&m[2][0]), _mm_loadu_ps(&m[3][0])};
+
+			tvec4<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_mat4_mul_vec4(a, _mm_loadu_ps(&v[0])));
+			return Result;
+		}
+	};
 
+	template <precision P>
+	struct compute_vec4_mul_mat4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v, tmat4x4<float, P> const & m)
+		{
+			GLM_STATIC_ASSERT(detail::is_aligned<P>::value, "Specialization requires aligned");
+
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_mul_mat4(v.data, *reinterpret_cast<glm_vec4 const(*)[4]>(&m[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mul_mat4<float, P, false>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v, tmat4x4<float, P> const & m)
+		{
+			glm_vec4 const a[4] = {
+				_mm_loadu_ps(&m[0][0]), _mm_loadu_ps(&m[1][0]), _mm_loadu_ps(&m[2][0]), _mm_loadu_ps(&m[3][0])};
+
+			tvec4<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_mul_mat4(_mm_loadu_ps(&v[0]), a));
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// A double column fills a 256-bit register. Loads and stores are unaligned as only
+	// aligned_* dvec4 are 32-byte aligned
+	template <precision P, bool Aligned>
+	struct compute_mat4_mul<double, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<double, P> call(tmat4x4<double, P> const & m1, tmat4x4<double, P> const & m2)
+		{
+			__m256d const a[4] = {
+				_mm256_loadu_pd(&m1[0][0]), _mm256_loadu_pd(&m1[1][0]), _mm256_loadu_pd(&m1[2][0]), _mm256_loadu_pd(&m1[3][0])};
+			__m256d r[4];
+			glm_dmat4_mul(a, &m2[0][0], r);
+
+			tmat4x4<double, P> Result(uninitialize);
+			_mm256_storeu_pd(&Result[0][0], r[0]);
+			_mm256_storeu_pd(&Result[1][0], r[1]);
+			_mm256_storeu_pd(&Result[2][0], r[2]);
+			_mm256_storeu_pd(&Result[3][0], r[3]);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_mat4_mul_vec4<double, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tmat4x4<double, P> const & m, tvec4<double, P> const & v)
+		{
+			__m256d const a[4] = {
+				_mm256_loadu_pd(&m[0][0]), _mm256_loadu_pd(&m[1][0]), _mm256_loadu_pd(&m[2][0]), _mm256_loadu_pd(&m[3][0])};
+
+			tvec4<double, P> Result(uninitialize);
+			_mm256_storeu_pd(&Result[0], glm_dmat4_mul_dvec4(a, &v[0]));
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
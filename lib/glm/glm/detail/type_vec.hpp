@@ -9,11 +9,13 @@
 namespace glm{
 namespace detail
 {
+	// Signed bytes, not uint8: GCC treats an unsigned char array as typeless storage, and with one in
+	// the union it drops component stores that operator[] reads back through &x at -O2
 	template <typename T, std::size_t size, bool aligned>
 	struct storage
 	{
 		typedef struct type {
-			uint8 data[size];
+			int8 data[size];
 		} type;
 	};
 
@@ -21,7 +23,7 @@ namespace detail
 		template <typename T> \
 		struct storage<T, x, true> { \
 			GLM_ALIGNED_STRUCT(x) type { \
-				uint8 data[x]; \
+				int8 data[x]; \
 			}; \
 		};
 
@@ -462,19 +462,19 @@ namespace detail
 	template <>
 	template <>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
-		data(_mm_castsi128_ps(_mm_set_epi32(d, c, b, a)))
+		data(_mm_cvtepi32_ps(_mm_set_epi32(d, c, b, a)))
 	{}
 
 	template <>
 	template <>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
-		data(_mm_castsi128_ps(_mm_set_epi32(d, c, b, a)))
+		data(_mm_cvtepi32_ps(_mm_set_epi32(d, c, b, a)))
 	{}
 
 	template <>
 	template <>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
-		data(_mm_castsi128_ps(_mm_set_epi32(d, c, b, a)))
+		data(_mm_cvtepi32_ps(_mm_set_epi32(d, c, b, a)))
 	{}
 }//namespace glm
 
@@ -59,7 +59,9 @@
 #	include "./gtc/type_aligned.hpp"
 #endif
 
+#include "./gtx/affine.hpp"
 #include "./gtx/associated_min_max.hpp"
+#include "./gtx/batch.hpp"
 #include "./gtx/bit.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_space.hpp"
@@ -105,6 +107,7 @@
 #include "./gtx/transform2.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
+#include "./gtx/wide.hpp"
 #include "./gtx/wrap.hpp"
 
 #if GLM_HAS_TEMPLATE_ALIASES
@@ -55,7 +55,7 @@ namespace glm
 	/// @see - translate(tmat4x4<T, P> const & m, T x, T y, T z)
 	/// @see - translate(tvec3<T, P> const & v)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> translate(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> translate(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v);
 		
@@ -83,7 +83,7 @@ namespace glm
 	/// @see - scale(tmat4x4<T, P> const & m, T x, T y, T z)
 	/// @see - scale(tvec3<T, P> const & v)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> scale(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v);
 
@@ -99,7 +99,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho(
 		T left,
 		T right,
 		T bottom,
@@ -119,7 +119,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> orthoLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoLH(
 		T left,
 		T right,
 		T bottom,
@@ -139,7 +139,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> orthoRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoRH(
 		T left,
 		T right,
 		T bottom,
@@ -157,7 +157,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top, T const & zNear, T const & zFar)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho(
 		T left,
 		T right,
 		T bottom,
@@ -174,7 +174,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> frustum(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustum(
 		T left,
 		T right,
 		T bottom,
@@ -193,7 +193,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> frustumLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumLH(
 		T left,
 		T right,
 		T bottom,
@@ -212,7 +212,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> frustumRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumRH(
 		T left,
 		T right,
 		T bottom,
@@ -229,7 +229,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> perspective(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspective(
 		T fovy,
 		T aspect,
 		T near,
@@ -244,7 +244,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> perspectiveRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveRH(
 		T fovy,
 		T aspect,
 		T near,
@@ -259,7 +259,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> perspectiveLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveLH(
 		T fovy,
 		T aspect,
 		T near,
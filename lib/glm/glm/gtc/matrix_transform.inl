@@ -5,10 +5,108 @@
 #include "../trigonometric.hpp"
 #include "../matrix.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <typename T, precision P, bool Aligned>
+	struct compute_rotation
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(T angle, tvec3<T, P> const & v)
+		{
+			T const a = angle;
+			T const c = cos(a);
+			T const s = sin(a);
+
+			tvec3<T, P> axis(normalize(v));
+			tvec3<T, P> temp((T(1) - c) * axis);
+
+			tmat4x4<T, P> Rotate(static_cast<T>(1));
+			Rotate[0][0] = c + temp[0] * axis[0];
+			Rotate[0][1] = temp[0] * axis[1] + s * axis[2];
+			Rotate[0][2] = temp[0] * axis[2] - s * axis[1];
+
+			Rotate[1][0] = temp[1] * axis[0] - s * axis[2];
+			Rotate[1][1] = c + temp[1] * axis[1];
+			Rotate[1][2] = temp[1] * axis[2] + s * axis[0];
+
+			Rotate[2][0] = temp[2] * axis[0] + s * axis[1];
+			Rotate[2][1] = temp[2] * axis[1] - s * axis[0];
+			Rotate[2][2] = c + temp[2] * axis[2];
+			return Rotate;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_rotate
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m, T angle, tvec3<T, P> const & v)
+		{
+			tmat4x4<T, P> const Rotate(compute_rotation<T, P, Aligned>::call(angle, v));
+
+			tmat4x4<T, P> Result(uninitialize);
+			Result[0] = m[0] * Rotate[0][0] + m[1] * Rotate[0][1] + m[2] * Rotate[0][2];
+			Result[1] = m[0] * Rotate[1][0] + m[1] * Rotate[1][1] + m[2] * Rotate[1][2];
+			Result[2] = m[0] * Rotate[2][0] + m[1] * Rotate[2][1] + m[2] * Rotate[2][2];
+			Result[3] = m[3];
+			return Result;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_lookAtRH
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tvec3<T, P> const & eye, tvec3<T, P> const & center, tvec3<T, P> const & up)
+		{
+			tvec3<T, P> const f(normalize(center - eye));
+			tvec3<T, P> const s(normalize(cross(f, up)));
+			tvec3<T, P> const u(cross(s, f));
+
+			tmat4x4<T, P> Result(1);
+			Result[0][0] = s.x;
+			Result[1][0] = s.y;
+			Result[2][0] = s.z;
+			Result[0][1] = u.x;
+			Result[1][1] = u.y;
+			Result[2][1] = u.z;
+			Result[0][2] =-f.x;
+			Result[1][2] =-f.y;
+			Result[2][2] =-f.z;
+			Result[3][0] =-dot(s, eye);
+			Result[3][1] =-dot(u, eye);
+			Result[3][2] = dot(f, eye);
+			return Result;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_lookAtLH
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tvec3<T, P> const & eye, tvec3<T, P> const & center, tvec3<T, P> const & up)
+		{
+			tvec3<T, P> const f(normalize(center - eye));
+			tvec3<T, P> const s(normalize(cross(up, f)));
+			tvec3<T, P> const u(cross(f, s));
+
+			tmat4x4<T, P> Result(1);
+			Result[0][0] = s.x;
+			Result[1][0] = s.y;
+			Result[2][0] = s.z;
+			Result[0][1] = u.x;
+			Result[1][1] = u.y;
+			Result[2][1] = u.z;
+			Result[0][2] = f.x;
+			Result[1][2] = f.y;
+			Result[2][2] = f.z;
+			Result[3][0] = -dot(s, eye);
+			Result[3][1] = -dot(u, eye);
+			Result[3][2] = -dot(f, eye);
+			return Result;
+		}
+	};
+}//namespace detail
+
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> translate(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> translate(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
 	{
 		tmat4x4<T, P> Result(m);
 		Result[3] = m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3];
@@ -18,32 +116,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> rotate(tmat4x4<T, P> const & m, T angle, tvec3<T, P> const & v)
 	{
-		T const a = angle;
-		T const c = cos(a);
-		T const s = sin(a);
-
-		tvec3<T, P> axis(normalize(v));
-		tvec3<T, P> temp((T(1) - c) * axis);
-
-		tmat4x4<T, P> Rotate(uninitialize);
-		Rotate[0][0] = c + temp[0] * axis[0];
-		Rotate[0][1] = temp[0] * axis[1] + s * axis[2];
-		Rotate[0][2] = temp[0] * axis[2] - s * axis[1];
-
-		Rotate[1][0] = temp[1] * axis[0] - s * axis[2];
-		Rotate[1][1] = c + temp[1] * axis[1];
-		Rotate[1][2] = temp[1] * axis[2] + s * axis[0];
-
-		Rotate[2][0] = temp[2] * axis[0] + s * axis[1];
-		Rotate[2][1] = temp[2] * axis[1] - s * axis[0];
-		Rotate[2][2] = c + temp[2] * axis[2];
-
-		tmat4x4<T, P> Result(uninitialize);
-		Result[0] = m[0] * Rotate[0][0] + m[1] * Rotate[0][1] + m[2] * Rotate[0][2];
-		Result[1] = m[0] * Rotate[1][0] + m[1] * Rotate[1][1] + m[2] * Rotate[1][2];
-		Result[2] = m[0] * Rotate[2][0] + m[1] * Rotate[2][1] + m[2] * Rotate[2][2];
-		Result[3] = m[3];
-		return Result;
+		return detail::compute_rotate<T, P, detail::is_aligned<P>::value>::call(m, angle, v);
 	}
 		
 	template <typename T, precision P>
@@ -76,7 +149,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> scale(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
 	{
 		tmat4x4<T, P> Result(uninitialize);
 		Result[0] = m[0] * v[0];
@@ -97,7 +170,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top,
@@ -112,7 +185,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> orthoLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoLH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -137,7 +210,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> orthoRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoRH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -162,7 +235,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top
@@ -178,7 +251,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustum
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustum
 	(
 		T left, T right,
 		T bottom, T top,
@@ -193,7 +266,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustumLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumLH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -219,7 +292,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustumRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumRH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -245,7 +318,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspective(T fovy, T aspect, T zNear, T zFar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspective(T fovy, T aspect, T zNear, T zFar)
 	{
 #		if GLM_COORDINATE_SYSTEM == GLM_LEFT_HANDED
 			return perspectiveLH(fovy, aspect, zNear, zFar);
@@ -255,9 +328,9 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveRH(T fovy, T aspect, T zNear, T zFar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveRH(T fovy, T aspect, T zNear, T zFar)
 	{
-		assert(abs(aspect - std::numeric_limits<T>::epsilon()) > static_cast<T>(0));
+		assert(aspect - std::numeric_limits<T>::epsilon() != static_cast<T>(0));
 
 		T const tanHalfFovy = tan(fovy / static_cast<T>(2));
 
@@ -278,9 +351,9 @@ namespace glm
 	}
 	
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveLH(T fovy, T aspect, T zNear, T zFar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveLH(T fovy, T aspect, T zNear, T zFar)
 	{
-		assert(abs(aspect - std::numeric_limits<T>::epsilon()) > static_cast<T>(0));
+		assert(aspect - std::numeric_limits<T>::epsilon() != static_cast<T>(0));
 
 		T const tanHalfFovy = tan(fovy / static_cast<T>(2));
 		
@@ -525,24 +598,7 @@ namespace glm
 		tvec3<T, P> const & up
 	)
 	{
-		tvec3<T, P> const f(normalize(center - eye));
-		tvec3<T, P> const s(normalize(cross(f, up)));
-		tvec3<T, P> const u(cross(s, f));
-
-		tmat4x4<T, P> Result(1);
-		Result[0][0] = s.x;
-		Result[1][0] = s.y;
-		Result[2][0] = s.z;
-		Result[0][1] = u.x;
-		Result[1][1] = u.y;
-		Result[2][1] = u.z;
-		Result[0][2] =-f.x;
-		Result[1][2] =-f.y;
-		Result[2][2] =-f.z;
-		Result[3][0] =-dot(s, eye);
-		Result[3][1] =-dot(u, eye);
-		Result[3][2] = dot(f, eye);
-		return Result;
+		return detail::compute_lookAtRH<T, P, detail::is_aligned<P>::value>::call(eye, center, up);
 	}
 
 	template <typename T, precision P>
@@ -553,23 +609,10 @@ namespace glm
 		tvec3<T, P> const & up
 	)
 	{
-		tvec3<T, P> const f(normalize(center - eye));
-		tvec3<T, P> const s(normalize(cross(up, f)));
-		tvec3<T, P> const u(cross(f, s));
-
-		tmat4x4<T, P> Result(1);
-		Result[0][0] = s.x;
-		Result[1][0] = s.y;
-		Result[2][0] = s.z;
-		Result[0][1] = u.x;
-		Result[1][1] = u.y;
-		Result[2][1] = u.z;
-		Result[0][2] = f.x;
-		Result[1][2] = f.y;
-		Result[2][2] = f.z;
-		Result[3][0] = -dot(s, eye);
-		Result[3][1] = -dot(u, eye);
-		Result[3][2] = -dot(f, eye);
-		return Result;
+		return detail::compute_lookAtLH<T, P, detail::is_aligned<P>::value>::call(eye, center, up);
 	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "matrix_transform_simd.inl"
+#endif
@@ -0,0 +1,127 @@
+/// @ref gtc_matrix_transform
+/// @file glm/gtc/matrix_transform_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/geometric.h"
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template <bool Aligned>
+	struct matrix_transform_simd_storage
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void load(tmat4x4<float, P> const & m, glm_vec4 out[4])
+		{
+			for(length_t i = 0; i < 4; ++i)
+				out[i] = m[i].data;
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void store(tmat4x4<float, P> & m, glm_vec4 const in[4])
+		{
+			for(length_t i = 0; i < 4; ++i)
+				m[i].data = in[i];
+		}
+	};
+
+	// Packed matrices have no alignment guarantee, so their columns go through unaligned loads and stores
+	template <>
+	struct matrix_transform_simd_storage<false>
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void load(tmat4x4<float, P> const & m, glm_vec4 out[4])
+		{
+			for(length_t i = 0; i < 4; ++i)
+				out[i] = _mm_loadu_ps(&m[i][0]);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void store(tmat4x4<float, P> & m, glm_vec4 const in[4])
+		{
+			for(length_t i = 0; i < 4; ++i)
+				_mm_storeu_ps(&m[i][0], in[i]);
+		}
+	};
+
+	// Exact normalization: the rsqrt estimate of glm_vec4_normalize is too coarse for a basis
+	GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize_highp(glm_vec4 v)
+	{
+		return _mm_div_ps(v, _mm_sqrt_ps(glm_vec4_dot(v, v)));
+	}
+
+	template <precision P, bool Aligned>
+	struct compute_rotation<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(float angle, tvec3<float, P> const & v)
+		{
+			glm_vec4 r[4];
+			glm_mat4_rotation(cos(angle), sin(angle), glm_vec4_normalize_highp(_mm_setr_ps(v.x, v.y, v.z, 0.0f)), r);
+			r[3] = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+			tmat4x4<float, P> Result(uninitialize);
+			matrix_transform_simd_storage<Aligned>::store(Result, r);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_rotate<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m, float angle, tvec3<float, P> const & v)
+		{
+			glm_vec4 in[4];
+			matrix_transform_simd_storage<Aligned>::load(m, in);
+
+			glm_vec4 out[4];
+			glm_mat4_rotate(in, cos(angle), sin(angle), glm_vec4_normalize_highp(_mm_setr_ps(v.x, v.y, v.z, 0.0f)), out);
+
+			tmat4x4<float, P> Result(uninitialize);
+			matrix_transform_simd_storage<Aligned>::store(Result, out);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_lookAtRH<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tvec3<float, P> const & eye, tvec3<float, P> const & center, tvec3<float, P> const & up)
+		{
+			glm_vec4 const e = _mm_setr_ps(eye.x, eye.y, eye.z, 0.0f);
+			glm_vec4 const f = glm_vec4_normalize_highp(_mm_sub_ps(_mm_setr_ps(center.x, center.y, center.z, 0.0f), e));
+			glm_vec4 const s = glm_vec4_normalize_highp(glm_vec4_cross(f, _mm_setr_ps(up.x, up.y, up.z, 0.0f)));
+			glm_vec4 const u = glm_vec4_cross(s, f);
+
+			glm_vec4 out[4];
+			glm_mat4_lookAt(e, s, u, _mm_sub_ps(_mm_setzero_ps(), f), out);
+
+			tmat4x4<float, P> Result(uninitialize);
+			matrix_transform_simd_storage<Aligned>::store(Result, out);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_lookAtLH<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tvec3<float, P> const & eye, tvec3<float, P> const & center, tvec3<float, P> const & up)
+		{
+			glm_vec4 const e = _mm_setr_ps(eye.x, eye.y, eye.z, 0.0f);
+			glm_vec4 const f = glm_vec4_normalize_highp(_mm_sub_ps(_mm_setr_ps(center.x, center.y, center.z, 0.0f), e));
+			glm_vec4 const s = glm_vec4_normalize_highp(glm_vec4_cross(_mm_setr_ps(up.x, up.y, up.z, 0.0f), f));
+			glm_vec4 const u = glm_vec4_cross(f, s);
+
+			glm_vec4 out[4];
+			glm_mat4_lookAt(e, s, u, f, out);
+
+			tmat4x4<float, P> Result(uninitialize);
+			matrix_transform_simd_storage<Aligned>::store(Result, out);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -25,6 +25,12 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include <cstddef>
+#if GLM_HAS_CXX11_STL
+#	include <functional>
+#	include <thread>
+#	include <vector>
+#endif
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -54,6 +60,85 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vecType<T, P> const & p);
 
+	/// Fractal Brownian motion: Octaves octaves of simplex noise summed,
+	/// each with Lacunarity times the frequency and Gain times the amplitude of the previous one.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL T fbm(
+		vecType<T, P> const & p,
+		int Octaves,
+		T Lacunarity,
+		T Gain);
+
+	/// Classic perlin noise of Count points, Result[i] being bit for bit perlin(p[i]).
+	/// Several points are evaluated at once with SSE2 or AVX. Disjoint ranges may be evaluated by several threads.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void perlin(
+		vecType<T, P> const * p,
+		T * Result,
+		std::size_t Count);
+
+	/// Simplex noise of Count points, Result[i] being bit for bit simplex(p[i]).
+	/// Several points are evaluated at once with SSE2 or AVX. Disjoint ranges may be evaluated by several threads.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void simplex(
+		vecType<T, P> const * p,
+		T * Result,
+		std::size_t Count);
+
+	/// Fractal Brownian motion of Count points, Result[i] being bit for bit fbm(p[i], Octaves, Lacunarity, Gain).
+	/// Several points are evaluated at once with SSE2 or AVX. Disjoint ranges may be evaluated by several threads.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void fbm(
+		vecType<T, P> const * p,
+		T * Result,
+		std::size_t Count,
+		int Octaves,
+		T Lacunarity,
+		T Gain);
+
+	/// Classic perlin noise of the grid of Size points Origin + Step * Index, Result being stored x first.
+	/// Result[i] is bit for bit the batch result of these points. The rows along x are spread over Threads threads,
+	/// 0 using one per hardware thread. Without the C++11 library, the calling thread evaluates the whole grid.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void perlinGrid(
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Size,
+		T * Result,
+		unsigned int Threads);
+
+	/// Simplex noise of the grid of Size points Origin + Step * Index, Result being stored x first.
+	/// Result[i] is bit for bit the batch result of these points. The rows along x are spread over Threads threads,
+	/// 0 using one per hardware thread. Without the C++11 library, the calling thread evaluates the whole grid.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void simplexGrid(
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Size,
+		T * Result,
+		unsigned int Threads);
+
+	/// Fractal Brownian motion of the grid of Size points Origin + Step * Index, Result being stored x first.
+	/// Result[i] is bit for bit the batch result of these points. The rows along x are spread over Threads threads,
+	/// 0 using one per hardware thread. Without the C++11 library, the calling thread evaluates the whole grid.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void fbmGrid(
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Size,
+		T * Result,
+		unsigned int Threads,
+		int Octaves,
+		T Lacunarity,
+		T Gain);
+
 	/// @}
 }//namespace glm
 
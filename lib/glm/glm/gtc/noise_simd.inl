@@ -0,0 +1,171 @@
+/// @ref gtc_noise
+/// @file glm/gtc/noise_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// floor exactly as std::floor, unlike the SSE2 path of glm_vec4_floor which is off for -0 and 2^23 <= |x| < 2^24
+	GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_floor_exact(glm_vec4 x)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return _mm_floor_ps(x);
+#		else
+			glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+			glm_vec4 const trc0 = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+			glm_vec4 const flr0 = _mm_sub_ps(trc0, _mm_and_ps(_mm_cmpgt_ps(trc0, x), _mm_set1_ps(1.0f)));
+			glm_vec4 const res0 = _mm_or_ps(flr0, _mm_and_ps(sgn0, x));
+			// |x| >= 2^23 and NaN are already integral
+			glm_vec4 const big0 = _mm_cmpnlt_ps(_mm_andnot_ps(sgn0, x), _mm_set1_ps(8388608.0f));
+			return _mm_or_ps(_mm_and_ps(big0, x), _mm_andnot_ps(big0, res0));
+#		endif
+	}
+
+	// Four points, one per lane, for the noise kernels. Each operation is the one of glm scalar functions.
+	struct noise_vec4
+	{
+		glm_vec4 data;
+
+		GLM_FUNC_QUALIFIER noise_vec4(float s) : data(_mm_set1_ps(s)) {}
+		GLM_FUNC_QUALIFIER explicit noise_vec4(glm_vec4 v) : data(v) {}
+
+		template <typename vecType>
+		GLM_FUNC_QUALIFIER static noise_vec4 gather(vecType const * p, std::size_t Stride, length_t c)
+		{
+			return noise_vec4(_mm_setr_ps(p[0][c], p[Stride][c], p[Stride * 2][c], p[Stride * 3][c]));
+		}
+
+		GLM_FUNC_QUALIFIER void store(float * out) const
+		{
+			_mm_storeu_ps(out, data);
+		}
+
+		friend noise_vec4 operator+(noise_vec4 const & a, noise_vec4 const & b){return noise_vec4(_mm_add_ps(a.data, b.data));}
+		friend noise_vec4 operator-(noise_vec4 const & a, noise_vec4 const & b){return noise_vec4(_mm_sub_ps(a.data, b.data));}
+		friend noise_vec4 operator*(noise_vec4 const & a, noise_vec4 const & b){return noise_vec4(_mm_mul_ps(a.data, b.data));}
+		friend noise_vec4 operator/(noise_vec4 const & a, noise_vec4 const & b){return noise_vec4(_mm_div_ps(a.data, b.data));}
+
+		friend noise_vec4 floor(noise_vec4 const & x){return noise_vec4(glm_vec4_floor_exact(x.data));}
+		friend noise_vec4 fract(noise_vec4 const & x){return x - floor(x);}
+		friend noise_vec4 mod(noise_vec4 const & x, noise_vec4 const & y){return x - y * floor(x / y);}
+		friend noise_vec4 min(noise_vec4 const & x, noise_vec4 const & y){return noise_vec4(_mm_min_ps(x.data, y.data));}
+		friend noise_vec4 max(noise_vec4 const & x, noise_vec4 const & y){return noise_vec4(_mm_max_ps(x.data, y.data));}
+		friend noise_vec4 clamp(noise_vec4 const & x, noise_vec4 const & minVal, noise_vec4 const & maxVal){return min(max(x, minVal), maxVal);}
+		friend noise_vec4 mix(noise_vec4 const & x, noise_vec4 const & y, noise_vec4 const & a){return x + a * (y - x);}
+
+		// x >= 0 ? x : -x, which keeps the sign of -0
+		friend noise_vec4 abs(noise_vec4 const & x)
+		{
+			glm_vec4 const pos0 = _mm_cmpge_ps(x.data, _mm_setzero_ps());
+			glm_vec4 const neg0 = _mm_xor_ps(x.data, _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000))));
+			return noise_vec4(_mm_or_ps(_mm_and_ps(pos0, x.data), _mm_andnot_ps(pos0, neg0)));
+		}
+
+		// x < edge ? 0 : 1
+		friend noise_vec4 step(noise_vec4 const & edge, noise_vec4 const & x)
+		{
+			return noise_vec4(_mm_andnot_ps(_mm_cmplt_ps(x.data, edge.data), _mm_set1_ps(1.0f)));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Eight points, one per lane, for the noise kernels. Each operation is the one of glm scalar functions.
+	struct noise_vec8
+	{
+		__m256 data;
+
+		GLM_FUNC_QUALIFIER noise_vec8(float s) : data(_mm256_set1_ps(s)) {}
+		GLM_FUNC_QUALIFIER explicit noise_vec8(__m256 v) : data(v) {}
+
+		template <typename vecType>
+		GLM_FUNC_QUALIFIER static noise_vec8 gather(vecType const * p, std::size_t Stride, length_t c)
+		{
+			return noise_vec8(_mm256_setr_ps(
+				p[0][c], p[Stride][c], p[Stride * 2][c], p[Stride * 3][c],
+				p[Stride * 4][c], p[Stride * 5][c], p[Stride * 6][c], p[Stride * 7][c]));
+		}
+
+		GLM_FUNC_QUALIFIER void store(float * out) const
+		{
+			_mm256_storeu_ps(out, data);
+		}
+
+		friend noise_vec8 operator+(noise_vec8 const & a, noise_vec8 const & b){return noise_vec8(_mm256_add_ps(a.data, b.data));}
+		friend noise_vec8 operator-(noise_vec8 const & a, noise_vec8 const & b){return noise_vec8(_mm256_sub_ps(a.data, b.data));}
+		friend noise_vec8 operator*(noise_vec8 const & a, noise_vec8 const & b){return noise_vec8(_mm256_mul_ps(a.data, b.data));}
+		friend noise_vec8 operator/(noise_vec8 const & a, noise_vec8 const & b){return noise_vec8(_mm256_div_ps(a.data, b.data));}
+
+		friend noise_vec8 floor(noise_vec8 const & x){return noise_vec8(_mm256_floor_ps(x.data));}
+		friend noise_vec8 fract(noise_vec8 const & x){return x - floor(x);}
+		friend noise_vec8 mod(noise_vec8 const & x, noise_vec8 const & y){return x - y * floor(x / y);}
+		friend noise_vec8 min(noise_vec8 const & x, noise_vec8 const & y){return noise_vec8(_mm256_min_ps(x.data, y.data));}
+		friend noise_vec8 max(noise_vec8 const & x, noise_vec8 const & y){return noise_vec8(_mm256_max_ps(x.data, y.data));}
+		friend noise_vec8 clamp(noise_vec8 const & x, noise_vec8 const & minVal, noise_vec8 const & maxVal){return min(max(x, minVal), maxVal);}
+		friend noise_vec8 mix(noise_vec8 const & x, noise_vec8 const & y, noise_vec8 const & a){return x + a * (y - x);}
+
+		// x >= 0 ? x : -x, which keeps the sign of -0
+		friend noise_vec8 abs(noise_vec8 const & x)
+		{
+			__m256 const pos0 = _mm256_cmp_ps(x.data, _mm256_setzero_ps(), _CMP_GE_OQ);
+			__m256 const neg0 = _mm256_xor_ps(x.data, _mm256_set1_ps(-0.0f));
+			return noise_vec8(_mm256_blendv_ps(neg0, x.data, pos0));
+		}
+
+		// x < edge ? 0 : 1
+		friend noise_vec8 step(noise_vec8 const & edge, noise_vec8 const & x)
+		{
+			return noise_vec8(_mm256_andnot_ps(_mm256_cmp_ps(x.data, edge.data, _CMP_LT_OQ), _mm256_set1_ps(1.0f)));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template <typename Noise, typename V, precision P>
+	GLM_FUNC_QUALIFIER V noise_lanes(tvec2<float, P> const * p, std::size_t Stride, int Octaves, float Lacunarity, float Gain)
+	{
+		return Noise::template call<float>(V::gather(p, Stride, 0), V::gather(p, Stride, 1), Octaves, Lacunarity, Gain);
+	}
+
+	template <typename Noise, typename V, precision P>
+	GLM_FUNC_QUALIFIER V noise_lanes(tvec3<float, P> const * p, std::size_t Stride, int Octaves, float Lacunarity, float Gain)
+	{
+		return Noise::template call<float>(V::gather(p, Stride, 0), V::gather(p, Stride, 1), V::gather(p, Stride, 2), Octaves, Lacunarity, Gain);
+	}
+
+	template <typename Noise, typename V, precision P>
+	GLM_FUNC_QUALIFIER V noise_lanes(tvec4<float, P> const * p, std::size_t Stride, int Octaves, float Lacunarity, float Gain)
+	{
+		return Noise::template call<float>(V::gather(p, Stride, 0), V::gather(p, Stride, 1), V::gather(p, Stride, 2), V::gather(p, Stride, 3), Octaves, Lacunarity, Gain);
+	}
+
+	// A single point goes through the lanes as well, every lane evaluating it: the compiler may fuse
+	// multiplies and adds differently in scalar code, which would break the match with the batches.
+	template <typename Noise, precision P, template <typename, precision> class vecType>
+	struct compute_noise<Noise, float, P, vecType>
+	{
+		GLM_FUNC_QUALIFIER static float call(vecType<float, P> const & p, int Octaves, float Lacunarity, float Gain)
+		{
+			return _mm_cvtss_f32(noise_lanes<Noise, noise_vec4>(&p, 0, Octaves, Lacunarity, Gain).data);
+		}
+	};
+
+	template <typename Noise, precision P, template <typename, precision> class vecType>
+	struct compute_noise_batch<Noise, float, P, vecType>
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<float, P> const * p, float * Result, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+					noise_lanes<Noise, noise_vec8>(p + i, 1, Octaves, Lacunarity, Gain).store(Result + i);
+#			endif
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+				noise_lanes<Noise, noise_vec4>(p + i, 1, Octaves, Lacunarity, Gain).store(Result + i);
+			for(; i < Count; ++i)
+				Result[i] = compute_noise<Noise, float, P, vecType>::call(p[i], Octaves, Lacunarity, Gain);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
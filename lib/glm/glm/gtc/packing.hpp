@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "type_precision.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -573,6 +574,98 @@ namespace glm
 	/// @see gtc_packing
 	/// @see uint8 packUnorm2x3_1x2(vec3 const & v)
 	GLM_FUNC_DECL vec3 unpackUnorm2x3_1x2(uint8 p);
+
+	/// Encodes a direction as the octahedral projection of the unit sphere, folded on its lower hemisphere,
+	/// then packs the two coordinates with packSnorm2x16. v doesn't have to be normalized.
+	/// 
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x16(uint32 p)
+	/// @see uint32 packSnorm2x16(vec2 const & v)
+	GLM_FUNC_DECL uint32 packOctahedral2x16(vec3 const & v);
+
+	/// Decodes a normalized direction packed by packOctahedral2x16.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x16(vec3 const & v)
+	GLM_FUNC_DECL vec3 unpackOctahedral2x16(uint32 p);
+
+	/// Array versions of the functions above, to convert whole vertex streams: p[i] is the packing of v[i], v[i] the unpacking of p[i].
+	/// Arrays of any alignment are accepted. With SSE2 the elements are converted several at once,
+	/// giving the same results as the single element functions.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packUnorm1x8(float v)
+	GLM_FUNC_DECL void packUnorm(float const * v, uint8 * p, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x8(uint8 p)
+	GLM_FUNC_DECL void unpackUnorm(uint8 const * p, float * v, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint16 packUnorm1x16(float v)
+	GLM_FUNC_DECL void packUnorm(float const * v, uint16 * p, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x16(uint16 p)
+	GLM_FUNC_DECL void unpackUnorm(uint16 const * p, float * v, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint8 packSnorm1x8(float v)
+	GLM_FUNC_DECL void packSnorm(float const * v, int8 * p, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x8(uint8 p)
+	GLM_FUNC_DECL void unpackSnorm(int8 const * p, float * v, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint16 packSnorm1x16(float v)
+	GLM_FUNC_DECL void packSnorm(float const * v, int16 * p, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x16(uint16 p)
+	GLM_FUNC_DECL void unpackSnorm(int16 const * p, float * v, std::size_t Count);
+
+	/// Converts to half floats rounding to the nearest even value, as F16C and GPUs do, where packHalf1x16 rounds halfway cases away from zero.
+	/// Both agree on every other value. NaNs are made quiet, keeping the high bits of their payload.
+	/// F16C instructions are used when available (GLM_HAS_F16C).
+	///
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float v)
+	GLM_FUNC_DECL void packHalf(float const * v, uint16 * p, std::size_t Count);
+
+	/// Converts half floats exactly, as unpackHalf1x16, except that NaNs are made quiet.
+	/// F16C instructions are used when available (GLM_HAS_F16C).
+	///
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 p)
+	GLM_FUNC_DECL void unpackHalf(uint16 const * p, float * v, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint32 packSnorm3x10_1x2(vec4 const & v)
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm3x10_1x2(uint32 p)
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint32 packUnorm3x10_1x2(vec4 const & v)
+	GLM_FUNC_DECL void packUnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm3x10_1x2(uint32 p)
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x16(vec3 const & v)
+	GLM_FUNC_DECL void packOctahedral2x16(vec3 const * v, uint32 * p, std::size_t Count);
+
+	/// The SIMD path may fuse multiplies and adds differently from unpackOctahedral2x16 when FMA is enabled,
+	/// in which case the results can differ in the last bit.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x16(uint32 p)
+	GLM_FUNC_DECL void unpackOctahedral2x16(uint32 const * p, vec3 * v, std::size_t Count);
 	/// @}
 }// namespace glm
 
@@ -5,7 +5,10 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../geometric.hpp"
+#include "../packing.hpp"
 #include "../detail/type_half.hpp"
+#include "../simd/packing.h"
 #include <cstring>
 #include <limits>
 
@@ -173,6 +176,44 @@ namespace detail
 		return Temp;
 	}
 
+	// Rounds to nearest even and makes NaNs quiet, as F16C and glm_vec4_packHalf_i32 do
+	GLM_FUNC_QUALIFIER glm::uint16 float2halfNearestEven(glm::uint32 f)
+	{
+		glm::uint32 const Sign = (f >> 16) & 0x8000;
+		glm::uint32 const Abs = f & 0x7fffffff;
+
+		if(Abs > 0x7f800000) // NaN
+			return static_cast<glm::uint16>(Sign | 0x7e00 | ((Abs >> 13) & 0x03ff));
+		else if(Abs > 0x477fefff) // Rounds to infinity
+			return static_cast<glm::uint16>(Sign | 0x7c00);
+		else if(Abs < 0x38800000) // Subnormal: adding 0.5 aligns the mantissa with the bottom of the float and rounds it
+		{
+			float Value = 0;
+			memcpy(&Value, &Abs, sizeof(Value));
+			Value += 0.5f;
+			glm::uint32 Bits = 0;
+			memcpy(&Bits, &Value, sizeof(Bits));
+			return static_cast<glm::uint16>(Sign | (Bits - 0x3f000000));
+		}
+
+		// Rebias the exponent, then round on the 13 dropped bits
+		return static_cast<glm::uint16>(Sign | ((Abs + 0xc8000fff + ((Abs >> 13) & 1)) >> 13));
+	}
+
+	// Exact, with NaNs made quiet as F16C and glm_vec4_unpackHalf_i32 do
+	GLM_FUNC_QUALIFIER float half2floatQuiet(glm::uint16 h)
+	{
+		float Result = toFloat32(static_cast<hdata>(h));
+		if((h & 0x7fff) > 0x7c00)
+		{
+			glm::uint32 Bits = 0;
+			memcpy(&Bits, &Result, sizeof(Bits));
+			Bits |= 0x00400000;
+			memcpy(&Result, &Bits, sizeof(Result));
+		}
+		return Result;
+	}
+
 //	GLM_FUNC_QUALIFIER glm::uint f11_f11_f10(float x, float y, float z)
 //	{
 //		return ((floatTo11bit(x) & ((1 << 11) - 1)) << 0) |  ((floatTo11bit(y) & ((1 << 11) - 1)) << 11) | ((floatTo10bit(z) & ((1 << 10) - 1)) << 22);
@@ -777,5 +818,272 @@ namespace detail
 		Unpack.pack = v;
 		return vec3(Unpack.data.x, Unpack.data.y, Unpack.data.z) * ScaleFactor;
 	}
+
+	GLM_FUNC_QUALIFIER uint32 packOctahedral2x16(vec3 const & v)
+	{
+		vec3 const n = v / (abs(v.x) + abs(v.y) + abs(v.z));
+		if(n.z >= 0.0f)
+			return packSnorm2x16(vec2(n.x, n.y));
+
+		return packSnorm2x16(vec2(
+			(1.0f - abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+			(1.0f - abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f)));
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral2x16(uint32 p)
+	{
+		vec2 const f = unpackSnorm2x16(p);
+		vec3 n(f.x, f.y, 1.0f - abs(f.x) - abs(f.y));
+		if(n.z < 0.0f)
+		{
+			n.x = (1.0f - abs(f.y)) * (f.x >= 0.0f ? 1.0f : -1.0f);
+			n.y = (1.0f - abs(f.x)) * (f.y >= 0.0f ? 1.0f : -1.0f);
+		}
+		return normalize(n);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm(float const * v, uint8 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count16 = Count & ~std::size_t(15); i < Count16; i += 16)
+			{
+				glm_vec4 const In[4] = {_mm_loadu_ps(v + i), _mm_loadu_ps(v + i + 4), _mm_loadu_ps(v + i + 8), _mm_loadu_ps(v + i + 12)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packUnorm16x8(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = packUnorm1x8(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm(uint8 const * p, float * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count16 = Count & ~std::size_t(15); i < Count16; i += 16)
+			{
+				glm_vec4 Out[4];
+				glm_unpackUnorm16x8(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				for(std::size_t j = 0; j < 4; ++j)
+					_mm_storeu_ps(v + i + j * 4, Out[j]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackUnorm1x8(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm(float const * v, uint16 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+			{
+				glm_vec4 const In[2] = {_mm_loadu_ps(v + i), _mm_loadu_ps(v + i + 4)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packUnorm8x16(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = packUnorm1x16(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm(uint16 const * p, float * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+			{
+				glm_vec4 Out[2];
+				glm_unpackUnorm8x16(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				_mm_storeu_ps(v + i, Out[0]);
+				_mm_storeu_ps(v + i + 4, Out[1]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackUnorm1x16(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm(float const * v, int8 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count16 = Count & ~std::size_t(15); i < Count16; i += 16)
+			{
+				glm_vec4 const In[4] = {_mm_loadu_ps(v + i), _mm_loadu_ps(v + i + 4), _mm_loadu_ps(v + i + 8), _mm_loadu_ps(v + i + 12)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packSnorm16x8(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = static_cast<int8>(packSnorm1x8(v[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm(int8 const * p, float * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count16 = Count & ~std::size_t(15); i < Count16; i += 16)
+			{
+				glm_vec4 Out[4];
+				glm_unpackSnorm16x8(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				for(std::size_t j = 0; j < 4; ++j)
+					_mm_storeu_ps(v + i + j * 4, Out[j]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackSnorm1x8(static_cast<uint8>(p[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm(float const * v, int16 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+			{
+				glm_vec4 const In[2] = {_mm_loadu_ps(v + i), _mm_loadu_ps(v + i + 4)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packSnorm8x16(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = static_cast<int16>(packSnorm1x16(v[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm(int16 const * p, float * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+			{
+				glm_vec4 Out[2];
+				glm_unpackSnorm8x16(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				_mm_storeu_ps(v + i, Out[0]);
+				_mm_storeu_ps(v + i + 4, Out[1]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackSnorm1x16(static_cast<uint16>(p[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf(float const * v, uint16 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+			{
+				glm_vec4 const In[2] = {_mm_loadu_ps(v + i), _mm_loadu_ps(v + i + 4)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packHalf8x16(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+		{
+			uint32 Bits = 0;
+			memcpy(&Bits, v + i, sizeof(Bits));
+			p[i] = detail::float2halfNearestEven(Bits);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const * p, float * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count8 = Count & ~std::size_t(7); i < Count8; i += 8)
+			{
+				glm_vec4 Out[2];
+				glm_unpackHalf8x16(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				_mm_storeu_ps(v + i, Out[0]);
+				_mm_storeu_ps(v + i + 4, Out[1]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = detail::half2floatQuiet(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+			{
+				glm_vec4 const In[4] = {_mm_loadu_ps(&v[i].x), _mm_loadu_ps(&v[i + 1].x), _mm_loadu_ps(&v[i + 2].x), _mm_loadu_ps(&v[i + 3].x)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packSnorm3x10_1x2(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = packSnorm3x10_1x2(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+			{
+				glm_vec4 Out[4];
+				glm_unpackSnorm3x10_1x2(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				for(std::size_t j = 0; j < 4; ++j)
+					_mm_storeu_ps(&v[i + j].x, Out[j]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackSnorm3x10_1x2(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+			{
+				glm_vec4 const In[4] = {_mm_loadu_ps(&v[i].x), _mm_loadu_ps(&v[i + 1].x), _mm_loadu_ps(&v[i + 2].x), _mm_loadu_ps(&v[i + 3].x)};
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packUnorm3x10_1x2(In));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = packUnorm3x10_1x2(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+			{
+				glm_vec4 Out[4];
+				glm_unpackUnorm3x10_1x2(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), Out);
+				for(std::size_t j = 0; j < 4; ++j)
+					_mm_storeu_ps(&v[i + j].x, Out[j]);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackUnorm3x10_1x2(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral2x16(vec3 const * v, uint32 * p, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+			{
+				glm_vec4 x, y, z;
+				glm_vec3x4_load_soa(&v[i].x, x, y, z);
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_packOctahedral2x16(x, y, z));
+			}
+#		endif
+		for(; i < Count; ++i)
+			p[i] = packOctahedral2x16(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral2x16(uint32 const * p, vec3 * v, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const Count4 = Count & ~std::size_t(3); i < Count4; i += 4)
+			{
+				glm_vec4 x, y, z;
+				glm_unpackOctahedral2x16(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i)), x, y, z);
+				glm_vec3x4_store_soa(&v[i].x, x, y, z);
+			}
+#		endif
+		for(; i < Count; ++i)
+			v[i] = unpackOctahedral2x16(p[i]);
+	}
 }//namespace glm
 
@@ -71,10 +71,10 @@ namespace glm
 
 		typedef length_t length_type;
 		/// Return the count of components of a quaternion
-		GLM_FUNC_DECL static length_type length(){return 4;}
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 4;}
 
-		GLM_FUNC_DECL T & operator[](length_type i);
-		GLM_FUNC_DECL T const & operator[](length_type i) const;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T & operator[](length_type i);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T const & operator[](length_type i) const;
 
 		// -- Implicit basic constructors --
 
@@ -115,66 +115,66 @@ namespace glm
 
 		// -- Unary arithmetic operators --
 
-		GLM_FUNC_DECL tquat<T, P> & operator=(tquat<T, P> const & m) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator=(tquat<T, P> const & m) GLM_DEFAULT;
 
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator=(tquat<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator=(tquat<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator+=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator+=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator-=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator-=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator*=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator*=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator*=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator*=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator/=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator/=(U s);
 	};
 
 	// -- Unary bit operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator+(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator-(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator-(tquat<T, P> const & q);
 
 	// -- Binary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator+(tquat<T, P> const & q, tquat<T, P> const & p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q, tquat<T, P> const & p);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(tquat<T, P> const & q, tquat<T, P> const & p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, tquat<T, P> const & p);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> operator*(tquat<T, P> const & q, tvec3<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tquat<T, P> const & q, tvec3<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec4<T, P> operator*(tquat<T, P> const & q, tvec4<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tquat<T, P> const & q, tvec4<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(tquat<T, P> const & q, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(T const & s, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(T const & s, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator/(tquat<T, P> const & q, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator/(tquat<T, P> const & q, T const & s);
 
 	// -- Boolean operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator==(tquat<T, P> const & q1, tquat<T, P> const & q2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator==(tquat<T, P> const & q1, tquat<T, P> const & q2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator!=(tquat<T, P> const & q1, tquat<T, P> const & q2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator!=(tquat<T, P> const & q1, tquat<T, P> const & q2);
 
 	/// Returns the length of the quaternion.
 	/// 
@@ -192,7 +192,7 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P, template <typename, precision> class quatType>
-	GLM_FUNC_DECL T dot(quatType<T, P> const & x, quatType<T, P> const & y);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T dot(quatType<T, P> const & x, quatType<T, P> const & y);
 
 	/// Spherical linear interpolation of two quaternions.
 	/// The interpolation is oriented and the rotation is performed at constant speed.
@@ -233,13 +233,13 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> conjugate(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> conjugate(tquat<T, P> const & q);
 
 	/// Returns the q inverse.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> inverse(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> inverse(tquat<T, P> const & q);
 
 	/// Rotates a quaternion from a vector of 3 components axis and an angle.
 	/// 
@@ -12,7 +12,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tquat, T, P, Aligned>
 	{
-		static GLM_FUNC_QUALIFIER T call(tquat<T, P> const& x, tquat<T, P> const& y)
+		static GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T call(tquat<T, P> const& x, tquat<T, P> const& y)
 		{
 			tvec4<T, P> tmp(x.x * y.x, x.y * y.y, x.z * y.z, x.w * y.w);
 			return (tmp.x + tmp.y) + (tmp.z + tmp.w);
@@ -22,7 +22,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_quat_add
 	{
-		static tquat<T, P> call(tquat<T, P> const& q, tquat<T, P> const& p)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tquat<T, P> call(tquat<T, P> const& q, tquat<T, P> const& p)
 		{
 			return tquat<T, P>(q.w + p.w, q.x + p.x, q.y + p.y, q.z + p.z);
 		}
@@ -31,7 +31,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_quat_sub
 	{
-		static tquat<T, P> call(tquat<T, P> const& q, tquat<T, P> const& p)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tquat<T, P> call(tquat<T, P> const& q, tquat<T, P> const& p)
 		{
 			return tquat<T, P>(q.w - p.w, q.x - p.x, q.y - p.y, q.z - p.z);
 		}
@@ -40,7 +40,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_quat_mul_scalar
 	{
-		static tquat<T, P> call(tquat<T, P> const& q, T s)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tquat<T, P> call(tquat<T, P> const& q, T s)
 		{
 			return tquat<T, P>(q.w * s, q.x * s, q.y * s, q.z * s);
 		}
@@ -49,7 +49,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_quat_div_scalar
 	{
-		static tquat<T, P> call(tquat<T, P> const& q, T s)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tquat<T, P> call(tquat<T, P> const& q, T s)
 		{
 			return tquat<T, P>(q.w / s, q.x / s, q.y / s, q.z / s);
 		}
@@ -58,26 +58,224 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_quat_mul_vec4
 	{
-		static tvec4<T, P> call(tquat<T, P> const & q, tvec4<T, P> const & v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec4<T, P> call(tquat<T, P> const & q, tvec4<T, P> const & v)
 		{
 			return tvec4<T, P>(q * tvec3<T, P>(v), v.w);
 		}
 	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_quat_mul_vec3
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec3<T, P> call(tquat<T, P> const & q, tvec3<T, P> const & v)
+		{
+			tvec3<T, P> const QuatVector(q.x, q.y, q.z);
+			tvec3<T, P> const uv(glm::cross(QuatVector, v));
+			tvec3<T, P> const uuv(glm::cross(QuatVector, uv));
+
+			return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_quat_normalize
+	{
+		GLM_FUNC_QUALIFIER static tquat<T, P> call(tquat<T, P> const & q)
+		{
+			T len = length(q);
+			if(len <= T(0)) // Problem
+				return tquat<T, P>(1, 0, 0, 0);
+			T oneOverLen = T(1) / len;
+			return tquat<T, P>(q.w * oneOverLen, q.x * oneOverLen, q.y * oneOverLen, q.z * oneOverLen);
+		}
+	};
+
+	// mix when Shortest is false, slerp when it is true
+	template <typename T, precision P, bool Aligned, bool Shortest>
+	struct compute_quat_slerp
+	{
+		GLM_FUNC_QUALIFIER static tquat<T, P> call(tquat<T, P> const & x, tquat<T, P> const & y, T a)
+		{
+			tquat<T, P> z = y;
+
+			T cosTheta = dot(x, y);
+
+			// If cosTheta < 0, the interpolation will take the long way around the sphere. 
+			// To fix this, one quat must be negated.
+			if(Shortest && cosTheta < T(0))
+			{
+				z        = -y;
+				cosTheta = -cosTheta;
+			}
+
+			// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
+			if(cosTheta > T(1) - epsilon<T>())
+			{
+				// Linear interpolation
+				return tquat<T, P>(
+					mix(x.w, z.w, a),
+					mix(x.x, z.x, a),
+					mix(x.y, z.y, a),
+					mix(x.z, z.z, a));
+			}
+			else
+			{
+				// Essential Mathematics, page 467
+				T angle = acos(cosTheta);
+				return (sin((T(1) - a) * angle) * x + sin(a * angle) * z) / sin(angle);
+			}
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_quat_mat3_cast
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<T, P> call(tquat<T, P> const & q)
+		{
+			tmat3x3<T, P> Result(T(1));
+			T qxx(q.x * q.x);
+			T qyy(q.y * q.y);
+			T qzz(q.z * q.z);
+			T qxz(q.x * q.z);
+			T qxy(q.x * q.y);
+			T qyz(q.y * q.z);
+			T qwx(q.w * q.x);
+			T qwy(q.w * q.y);
+			T qwz(q.w * q.z);
+
+			Result[0][0] = T(1) - T(2) * (qyy +  qzz);
+			Result[0][1] = T(2) * (qxy + qwz);
+			Result[0][2] = T(2) * (qxz - qwy);
+
+			Result[1][0] = T(2) * (qxy - qwz);
+			Result[1][1] = T(1) - T(2) * (qxx +  qzz);
+			Result[1][2] = T(2) * (qyz + qwx);
+
+			Result[2][0] = T(2) * (qxz + qwy);
+			Result[2][1] = T(2) * (qyz - qwx);
+			Result[2][2] = T(1) - T(2) * (qxx +  qyy);
+			return Result;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_quat_mat4_cast
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tquat<T, P> const & q)
+		{
+			return tmat4x4<T, P>(compute_quat_mat3_cast<T, P, Aligned>::call(q));
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_quat_cast
+	{
+		GLM_FUNC_QUALIFIER static tquat<T, P> call(tmat3x3<T, P> const & m)
+		{
+			T fourXSquaredMinus1 = m[0][0] - m[1][1] - m[2][2];
+			T fourYSquaredMinus1 = m[1][1] - m[0][0] - m[2][2];
+			T fourZSquaredMinus1 = m[2][2] - m[0][0] - m[1][1];
+			T fourWSquaredMinus1 = m[0][0] + m[1][1] + m[2][2];
+
+			int biggestIndex = 0;
+			T fourBiggestSquaredMinus1 = fourWSquaredMinus1;
+			if(fourXSquaredMinus1 > fourBiggestSquaredMinus1)
+			{
+				fourBiggestSquaredMinus1 = fourXSquaredMinus1;
+				biggestIndex = 1;
+			}
+			if(fourYSquaredMinus1 > fourBiggestSquaredMinus1)
+			{
+				fourBiggestSquaredMinus1 = fourYSquaredMinus1;
+				biggestIndex = 2;
+			}
+			if(fourZSquaredMinus1 > fourBiggestSquaredMinus1)
+			{
+				fourBiggestSquaredMinus1 = fourZSquaredMinus1;
+				biggestIndex = 3;
+			}
+
+			T biggestVal = sqrt(fourBiggestSquaredMinus1 + T(1)) * T(0.5);
+			T mult = static_cast<T>(0.25) / biggestVal;
+
+			tquat<T, P> Result(uninitialize);
+			switch(biggestIndex)
+			{
+			case 0:
+				Result.w = biggestVal;
+				Result.x = (m[1][2] - m[2][1]) * mult;
+				Result.y = (m[2][0] - m[0][2]) * mult;
+				Result.z = (m[0][1] - m[1][0]) * mult;
+				break;
+			case 1:
+				Result.w = (m[1][2] - m[2][1]) * mult;
+				Result.x = biggestVal;
+				Result.y = (m[0][1] + m[1][0]) * mult;
+				Result.z = (m[2][0] + m[0][2]) * mult;
+				break;
+			case 2:
+				Result.w = (m[2][0] - m[0][2]) * mult;
+				Result.x = (m[0][1] + m[1][0]) * mult;
+				Result.y = biggestVal;
+				Result.z = (m[1][2] + m[2][1]) * mult;
+				break;
+			case 3:
+				Result.w = (m[0][1] - m[1][0]) * mult;
+				Result.x = (m[2][0] + m[0][2]) * mult;
+				Result.y = (m[1][2] + m[2][1]) * mult;
+				Result.z = biggestVal;
+				break;
+				
+			default:					// Silence a -Wswitch-default warning in GCC. Should never actually get here. Assert is just for sanity.
+				assert(false);
+				break;
+			}
+			return Result;
+		}
+	};
 }//namespace detail
 
 	// -- Component accesses --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER T & tquat<T, P>::operator[](typename tquat<T, P>::length_type i)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T & tquat<T, P>::operator[](typename tquat<T, P>::length_type i)
 	{
 		assert(i >= 0 && i < this->length());
+#		if GLM_HAS_CONSTEXPR_CXX14
+			// Indexing past &x isn't a constant expression, so constant evaluation picks the component by name
+#			if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+#			endif
+			switch(i)
+			{
+			default:
+			case 0: return x;
+			case 1: return y;
+			case 2: return z;
+			case 3: return w;
+			}
+#		endif
 		return (&x)[i];
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER T const & tquat<T, P>::operator[](typename tquat<T, P>::length_type i) const
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T const & tquat<T, P>::operator[](typename tquat<T, P>::length_type i) const
 	{
 		assert(i >= 0 && i < this->length());
+#		if GLM_HAS_CONSTEXPR_CXX14
+			// Indexing past &x isn't a constant expression, so constant evaluation picks the component by name
+#			if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+#			endif
+			switch(i)
+			{
+			default:
+			case 0: return x;
+			case 1: return y;
+			case 2: return z;
+			case 3: return w;
+			}
+#		endif
 		return (&x)[i];
 	}
 
@@ -199,13 +397,13 @@ namespace detail
 #	endif//GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> conjugate(tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> conjugate(tquat<T, P> const & q)
 	{
 		return tquat<T, P>(q.w, -q.x, -q.y, -q.z);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> inverse(tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> inverse(tquat<T, P> const & q)
 	{
 		return conjugate(q) / dot(q, q);
 	}
@@ -214,7 +412,7 @@ namespace detail
 
 #	if !GLM_HAS_DEFAULTED_FUNCTIONS
 		template <typename T, precision P>
-		GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator=(tquat<T, P> const & q)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator=(tquat<T, P> const & q)
 		{
 			this->w = q.w;
 			this->x = q.x;
@@ -226,7 +424,7 @@ namespace detail
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator=(tquat<U, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator=(tquat<U, P> const & q)
 	{
 		this->w = static_cast<T>(q.w);
 		this->x = static_cast<T>(q.x);
@@ -237,21 +435,21 @@ namespace detail
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator+=(tquat<U, P> const& q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator+=(tquat<U, P> const& q)
 	{
 		return (*this = detail::compute_quat_add<T, P, detail::is_aligned<P>::value>::call(*this, tquat<T, P>(q)));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator-=(tquat<U, P> const& q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator-=(tquat<U, P> const& q)
 	{
 		return (*this = detail::compute_quat_sub<T, P, detail::is_aligned<P>::value>::call(*this, tquat<T, P>(q)));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator*=(tquat<U, P> const & r)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator*=(tquat<U, P> const & r)
 	{
 		tquat<T, P> const p(*this);
 		tquat<T, P> const q(r);
@@ -265,14 +463,14 @@ namespace detail
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator*=(U s)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator*=(U s)
 	{
 		return (*this = detail::compute_quat_mul_scalar<T, P, detail::is_aligned<P>::value>::call(*this, static_cast<U>(s)));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tquat<T, P> & tquat<T, P>::operator/=(U s)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> & tquat<T, P>::operator/=(U s)
 	{
 		return (*this = detail::compute_quat_div_scalar<T, P, detail::is_aligned<P>::value>::call(*this, static_cast<U>(s)));
 	}
@@ -280,13 +478,13 @@ namespace detail
 	// -- Unary bit operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator+(tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q)
 	{
 		return q;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator-(tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator-(tquat<T, P> const & q)
 	{
 		return tquat<T, P>(-q.w, -q.x, -q.y, -q.z);
 	}
@@ -294,60 +492,65 @@ namespace detail
 	// -- Binary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator+(tquat<T, P> const & q,	tquat<T, P> const & p)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q,	tquat<T, P> const & p)
 	{
 		return tquat<T, P>(q) += p;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator*(tquat<T, P> const & q,	tquat<T, P> const & p)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q,	tquat<T, P> const & p)
 	{
 		return tquat<T, P>(q) *= p;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tquat<T, P> const & q,	tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tquat<T, P> const & q,	tvec3<T, P> const & v)
 	{
-		tvec3<T, P> const QuatVector(q.x, q.y, q.z);
-		tvec3<T, P> const uv(glm::cross(QuatVector, v));
-		tvec3<T, P> const uuv(glm::cross(QuatVector, uv));
-
-		return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+#		if GLM_HAS_IS_CONSTANT_EVALUATED
+			// The SIMD specializations can't run at compile time, this is the generic code inlined
+			if(__builtin_is_constant_evaluated())
+			{
+				tvec3<T, P> const QuatVector(q.x, q.y, q.z);
+				tvec3<T, P> const uv(glm::cross(QuatVector, v));
+				return v + ((uv * q.w) + glm::cross(QuatVector, uv)) * static_cast<T>(2);
+			}
+#		endif
+		return detail::compute_quat_mul_vec3<T, P, detail::is_aligned<P>::value>::call(q, v);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q)
 	{
 		return glm::inverse(q) * v;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec4<T, P> operator*(tquat<T, P> const& q, tvec4<T, P> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tquat<T, P> const& q, tvec4<T, P> const& v)
 	{
 		return detail::compute_quat_mul_vec4<T, P, detail::is_aligned<P>::value>::call(q, v);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q)
 	{
 		return glm::inverse(q) * v;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator*(tquat<T, P> const & q, T const & s)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, T const & s)
 	{
 		return tquat<T, P>(
 			q.w * s, q.x * s, q.y * s, q.z * s);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator*(T const & s, tquat<T, P> const & q)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(T const & s, tquat<T, P> const & q)
 	{
 		return q * s;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tquat<T, P> operator/(tquat<T, P> const & q, T const & s)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tquat<T, P> operator/(tquat<T, P> const & q, T const & s)
 	{
 		return tquat<T, P>(
 			q.w / s, q.x / s, q.y / s, q.z / s);
@@ -356,13 +559,13 @@ namespace detail
 	// -- Boolean operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER bool operator==(tquat<T, P> const & q1, tquat<T, P> const & q2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 bool operator==(tquat<T, P> const & q1, tquat<T, P> const & q2)
 	{
 		return (q1.x == q2.x) && (q1.y == q2.y) && (q1.z == q2.z) && (q1.w == q2.w);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER bool operator!=(tquat<T, P> const & q1, tquat<T, P> const & q2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 bool operator!=(tquat<T, P> const & q1, tquat<T, P> const & q2)
 	{
 		return (q1.x != q2.x) || (q1.y != q2.y) || (q1.z != q2.z) || (q1.w != q2.w);
 	}
@@ -378,11 +581,7 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tquat<T, P> normalize(tquat<T, P> const & q)
 	{
-		T len = length(q);
-		if(len <= T(0)) // Problem
-			return tquat<T, P>(1, 0, 0, 0);
-		T oneOverLen = T(1) / len;
-		return tquat<T, P>(q.w * oneOverLen, q.x * oneOverLen, q.y * oneOverLen, q.z * oneOverLen);
+		return detail::compute_quat_normalize<T, P, detail::is_aligned<P>::value>::call(q);
 	}
 
 	template <typename T, precision P>
@@ -474,24 +673,7 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tquat<T, P> mix(tquat<T, P> const & x, tquat<T, P> const & y, T a)
 	{
-		T cosTheta = dot(x, y);
-
-		// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
-		if(cosTheta > T(1) - epsilon<T>())
-		{
-			// Linear interpolation
-			return tquat<T, P>(
-				mix(x.w, y.w, a),
-				mix(x.x, y.x, a),
-				mix(x.y, y.y, a),
-				mix(x.z, y.z, a));
-		}
-		else
-		{
-			// Essential Mathematics, page 467
-			T angle = acos(cosTheta);
-			return (sin((T(1) - a) * angle) * x + sin(a * angle) * y) / sin(angle);
-		}
+		return detail::compute_quat_slerp<T, P, detail::is_aligned<P>::value, false>::call(x, y, a);
 	}
 
 	template <typename T, precision P>
@@ -507,34 +689,7 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tquat<T, P> slerp(tquat<T, P> const & x,	tquat<T, P> const & y, T a)
 	{
-		tquat<T, P> z = y;
-
-		T cosTheta = dot(x, y);
-
-		// If cosTheta < 0, the interpolation will take the long way around the sphere. 
-		// To fix this, one quat must be negated.
-		if (cosTheta < T(0))
-		{
-			z        = -y;
-			cosTheta = -cosTheta;
-		}
-
-		// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
-		if(cosTheta > T(1) - epsilon<T>())
-		{
-			// Linear interpolation
-			return tquat<T, P>(
-				mix(x.w, z.w, a),
-				mix(x.x, z.x, a),
-				mix(x.y, z.y, a),
-				mix(x.z, z.z, a));
-		}
-		else
-		{
-			// Essential Mathematics, page 467
-			T angle = acos(cosTheta);
-			return (sin((T(1) - a) * angle) * x + sin(a * angle) * z) / sin(angle);
-		}
+		return detail::compute_quat_slerp<T, P, detail::is_aligned<P>::value, true>::call(x, y, a);
 	}
 
 	template <typename T, precision P>
@@ -586,99 +741,19 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat3x3<T, P> mat3_cast(tquat<T, P> const & q)
 	{
-		tmat3x3<T, P> Result(T(1));
-		T qxx(q.x * q.x);
-		T qyy(q.y * q.y);
-		T qzz(q.z * q.z);
-		T qxz(q.x * q.z);
-		T qxy(q.x * q.y);
-		T qyz(q.y * q.z);
-		T qwx(q.w * q.x);
-		T qwy(q.w * q.y);
-		T qwz(q.w * q.z);
-
-		Result[0][0] = T(1) - T(2) * (qyy +  qzz);
-		Result[0][1] = T(2) * (qxy + qwz);
-		Result[0][2] = T(2) * (qxz - qwy);
-
-		Result[1][0] = T(2) * (qxy - qwz);
-		Result[1][1] = T(1) - T(2) * (qxx +  qzz);
-		Result[1][2] = T(2) * (qyz + qwx);
-
-		Result[2][0] = T(2) * (qxz + qwy);
-		Result[2][1] = T(2) * (qyz - qwx);
-		Result[2][2] = T(1) - T(2) * (qxx +  qyy);
-		return Result;
+		return detail::compute_quat_mat3_cast<T, P, detail::is_aligned<P>::value>::call(q);
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> mat4_cast(tquat<T, P> const & q)
 	{
-		return tmat4x4<T, P>(mat3_cast(q));
+		return detail::compute_quat_mat4_cast<T, P, detail::is_aligned<P>::value>::call(q);
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tquat<T, P> quat_cast(tmat3x3<T, P> const & m)
 	{
-		T fourXSquaredMinus1 = m[0][0] - m[1][1] - m[2][2];
-		T fourYSquaredMinus1 = m[1][1] - m[0][0] - m[2][2];
-		T fourZSquaredMinus1 = m[2][2] - m[0][0] - m[1][1];
-		T fourWSquaredMinus1 = m[0][0] + m[1][1] + m[2][2];
-
-		int biggestIndex = 0;
-		T fourBiggestSquaredMinus1 = fourWSquaredMinus1;
-		if(fourXSquaredMinus1 > fourBiggestSquaredMinus1)
-		{
-			fourBiggestSquaredMinus1 = fourXSquaredMinus1;
-			biggestIndex = 1;
-		}
-		if(fourYSquaredMinus1 > fourBiggestSquaredMinus1)
-		{
-			fourBiggestSquaredMinus1 = fourYSquaredMinus1;
-			biggestIndex = 2;
-		}
-		if(fourZSquaredMinus1 > fourBiggestSquaredMinus1)
-		{
-			fourBiggestSquaredMinus1 = fourZSquaredMinus1;
-			biggestIndex = 3;
-		}
-
-		T biggestVal = sqrt(fourBiggestSquaredMinus1 + T(1)) * T(0.5);
-		T mult = static_cast<T>(0.25) / biggestVal;
-
-		tquat<T, P> Result(uninitialize);
-		switch(biggestIndex)
-		{
-		case 0:
-			Result.w = biggestVal;
-			Result.x = (m[1][2] - m[2][1]) * mult;
-			Result.y = (m[2][0] - m[0][2]) * mult;
-			Result.z = (m[0][1] - m[1][0]) * mult;
-			break;
-		case 1:
-			Result.w = (m[1][2] - m[2][1]) * mult;
-			Result.x = biggestVal;
-			Result.y = (m[0][1] + m[1][0]) * mult;
-			Result.z = (m[2][0] + m[0][2]) * mult;
-			break;
-		case 2:
-			Result.w = (m[2][0] - m[0][2]) * mult;
-			Result.x = (m[0][1] + m[1][0]) * mult;
-			Result.y = biggestVal;
-			Result.z = (m[1][2] + m[2][1]) * mult;
-			break;
-		case 3:
-			Result.w = (m[0][1] - m[1][0]) * mult;
-			Result.x = (m[2][0] + m[0][2]) * mult;
-			Result.y = (m[1][2] + m[2][1]) * mult;
-			Result.z = biggestVal;
-			break;
-			
-		default:					// Silence a -Wswitch-default warning in GCC. Should never actually get here. Assert is just for sanity.
-			assert(false);
-			break;
-		}
-		return Result;
+		return detail::compute_quat_cast<T, P, detail::is_aligned<P>::value>::call(m);
 	}
 
 	template <typename T, precision P>
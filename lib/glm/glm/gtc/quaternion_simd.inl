@@ -191,6 +191,188 @@ namespace detail
 			return Result;
 		}
 	};
+
+	// Aligned quaternions are read and written through their __m128, packed ones with unaligned loads and stores
+	template <bool Aligned>
+	struct quat_simd_storage
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static glm_vec4 load(tquat<float, P> const & q){return q.data;}
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void store(tquat<float, P> & q, glm_vec4 v){q.data = v;}
+	};
+
+	template <>
+	struct quat_simd_storage<false>
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static glm_vec4 load(tquat<float, P> const & q){return _mm_loadu_ps(&q.x);}
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void store(tquat<float, P> & q, glm_vec4 v){_mm_storeu_ps(&q.x, v);}
+	};
+
+	// The scalar code above, reordered into lanes: every lane does the same operations in the same
+	// order, so without FMA contraction the results are the same to the bit
+
+	template <precision P, bool Aligned>
+	struct compute_quat_mul_vec3<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tquat<float, P> const & q, tvec3<float, P> const & v)
+		{
+			glm_vec4 const q0 = quat_simd_storage<Aligned>::load(q);
+			glm_vec4 const v0 = _mm_setr_ps(v.x, v.y, v.z, 0.0f);
+
+			// cross(a, b) = a.yzx * b.zxy - b.yzx * a.zxy
+			glm_vec4 const q_yzx = _mm_shuffle_ps(q0, q0, _MM_SHUFFLE(3, 0, 2, 1));
+			glm_vec4 const q_zxy = _mm_shuffle_ps(q0, q0, _MM_SHUFFLE(3, 1, 0, 2));
+			glm_vec4 const uv = _mm_sub_ps(
+				_mm_mul_ps(q_yzx, _mm_shuffle_ps(v0, v0, _MM_SHUFFLE(3, 1, 0, 2))),
+				_mm_mul_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(3, 0, 2, 1)), q_zxy));
+			glm_vec4 const uuv = _mm_sub_ps(
+				_mm_mul_ps(q_yzx, _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(3, 1, 0, 2))),
+				_mm_mul_ps(_mm_shuffle_ps(uv, uv, _MM_SHUFFLE(3, 0, 2, 1)), q_zxy));
+
+			glm_vec4 const q_wwww = _mm_shuffle_ps(q0, q0, _MM_SHUFFLE(3, 3, 3, 3));
+			glm_vec4 const sum0 = _mm_add_ps(_mm_mul_ps(uv, q_wwww), uuv);
+			glm_vec4 const res0 = _mm_add_ps(v0, _mm_mul_ps(sum0, _mm_set1_ps(2.0f)));
+
+			float Result[4];
+			_mm_storeu_ps(Result, res0);
+			return tvec3<float, P>(Result[0], Result[1], Result[2]);
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_quat_normalize<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tquat<float, P> call(tquat<float, P> const & q)
+		{
+			// The length goes through dot like the scalar code, so that FMA contraction of one and
+			// not the other doesn't move the result
+			float const len = length(q);
+			if(len <= 0.0f) // Problem
+				return tquat<float, P>(1, 0, 0, 0);
+
+			tquat<float, P> Result(uninitialize);
+			quat_simd_storage<Aligned>::store(Result, _mm_mul_ps(quat_simd_storage<Aligned>::load(q), _mm_set1_ps(1.0f / len)));
+			return Result;
+		}
+	};
+
+	// Only the blend is in lanes, the dot product, acos and sin stay scalar
+	template <precision P, bool Aligned, bool Shortest>
+	struct compute_quat_slerp<float, P, Aligned, Shortest>
+	{
+		GLM_FUNC_QUALIFIER static tquat<float, P> call(tquat<float, P> const & x, tquat<float, P> const & y, float a)
+		{
+			glm_vec4 const x0 = quat_simd_storage<Aligned>::load(x);
+			glm_vec4 z0 = quat_simd_storage<Aligned>::load(y);
+
+			float cosTheta = dot(x, y);
+			if(Shortest && cosTheta < 0.0f)
+			{
+				z0 = _mm_xor_ps(z0, _mm_set1_ps(-0.0f));
+				cosTheta = -cosTheta;
+			}
+
+			glm_vec4 res0;
+			if(cosTheta > 1.0f - epsilon<float>())
+				res0 = _mm_add_ps(x0, _mm_mul_ps(_mm_set1_ps(a), _mm_sub_ps(z0, x0)));
+			else
+			{
+				float const angle = acos(cosTheta);
+				glm_vec4 const mul0 = _mm_mul_ps(_mm_set1_ps(sin((1.0f - a) * angle)), x0);
+				glm_vec4 const mul1 = _mm_mul_ps(_mm_set1_ps(sin(a * angle)), z0);
+				res0 = _mm_div_ps(_mm_add_ps(mul0, mul1), _mm_set1_ps(sin(angle)));
+			}
+
+			tquat<float, P> Result(uninitialize);
+			quat_simd_storage<Aligned>::store(Result, res0);
+			return Result;
+		}
+	};
+
+	// Column c is base + 2 * sign1 * (a * b + sign2 * c * d), with a, b, c and d permutations of q
+	template <int A, int B, int C, int D>
+	GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mat_column(glm_vec4 q, glm_vec4 base, glm_vec4 sign1, glm_vec4 sign2)
+	{
+		glm_vec4 const mul0 = _mm_mul_ps(_mm_shuffle_ps(q, q, A), _mm_shuffle_ps(q, q, B));
+		glm_vec4 const mul1 = _mm_mul_ps(_mm_shuffle_ps(q, q, C), _mm_shuffle_ps(q, q, D));
+		glm_vec4 const add0 = _mm_add_ps(mul0, _mm_xor_ps(mul1, sign2));
+		return _mm_add_ps(base, _mm_mul_ps(_mm_set1_ps(2.0f), _mm_xor_ps(add0, sign1)));
+	}
+
+	// The three columns of mat3_cast with 0 in their w lane
+	GLM_FUNC_QUALIFIER void glm_quat_mat3(glm_vec4 q, glm_vec4 out[3])
+	{
+		glm_vec4 const neg = _mm_set1_ps(-0.0f);
+		glm_vec4 const zero = _mm_setzero_ps();
+		glm_vec4 const one = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+		// [0] = (1 - 2(yy + zz), 2(xy + wz), 2(xz - wy))
+		out[0] = glm_quat_mat_column<_MM_SHUFFLE(0, 0, 0, 1), _MM_SHUFFLE(0, 2, 1, 1), _MM_SHUFFLE(0, 3, 3, 2), _MM_SHUFFLE(0, 1, 2, 2)>(
+			q, one, _mm_move_ss(zero, neg), _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f));
+		// [1] = (2(xy - wz), 1 - 2(xx + zz), 2(yz + wx))
+		out[1] = glm_quat_mat_column<_MM_SHUFFLE(0, 1, 0, 0), _MM_SHUFFLE(0, 2, 0, 1), _MM_SHUFFLE(0, 3, 2, 3), _MM_SHUFFLE(0, 0, 2, 2)>(
+			q, _mm_shuffle_ps(one, one, _MM_SHUFFLE(1, 1, 0, 1)), _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f), _mm_move_ss(zero, neg));
+		// [2] = (2(xz + wy), 2(yz - wx), 1 - 2(xx + yy))
+		out[2] = glm_quat_mat_column<_MM_SHUFFLE(0, 0, 1, 0), _MM_SHUFFLE(0, 0, 2, 2), _MM_SHUFFLE(0, 1, 3, 3), _MM_SHUFFLE(0, 1, 0, 1)>(
+			q, _mm_shuffle_ps(one, one, _MM_SHUFFLE(1, 0, 1, 1)), _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f), _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f));
+
+		// The w lane of the products holds x * x, drop it
+		glm_vec4 const xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		out[0] = _mm_and_ps(out[0], xyz);
+		out[1] = _mm_and_ps(out[1], xyz);
+		out[2] = _mm_and_ps(out[2], xyz);
+	}
+
+	template <precision P, bool Aligned>
+	struct compute_quat_mat3_cast<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<float, P> call(tquat<float, P> const & q)
+		{
+			glm_vec4 Columns[3];
+			glm_quat_mat3(quat_simd_storage<Aligned>::load(q), Columns);
+
+			float Result[12];
+			_mm_storeu_ps(Result + 0, Columns[0]);
+			_mm_storeu_ps(Result + 4, Columns[1]);
+			_mm_storeu_ps(Result + 8, Columns[2]);
+			return tmat3x3<float, P>(
+				Result[0], Result[1], Result[2],
+				Result[4], Result[5], Result[6],
+				Result[8], Result[9], Result[10]);
+		}
+	};
+
+	template <precision P>
+	struct compute_quat_mat4_cast<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tquat<float, P> const & q)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			glm_quat_mat3(q.data, reinterpret_cast<glm_vec4*>(&Result[0].data));
+			Result[3].data = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_quat_mat4_cast<float, P, false>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tquat<float, P> const & q)
+		{
+			glm_vec4 Columns[3];
+			glm_quat_mat3(_mm_loadu_ps(&q.x), Columns);
+
+			tmat4x4<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0][0], Columns[0]);
+			_mm_storeu_ps(&Result[1][0], Columns[1]);
+			_mm_storeu_ps(&Result[2][0], Columns[2]);
+			_mm_storeu_ps(&Result[3][0], _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
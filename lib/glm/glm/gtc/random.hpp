@@ -10,6 +10,16 @@
 ///
 /// @brief Generate random number from various distribution methods.
 ///
+/// The functions draw from a random engine: either the one given as first argument or,
+/// without it, the engine of the calling thread returned by randomEngine().
+/// An engine is any type with a result_type of 32 or 64 bits, whose operator() returns
+/// uniformly distributed values over the full range of that type: xoshiro256, pcg32,
+/// std::mt19937 or std::mt19937_64 for example, but not std::minstd_rand.
+///
+/// The functions filling arrays draw from four xoshiro256 streams seeded from the engine,
+/// which the SIMD paths advance side by side. They generate the same integers on every
+/// instruction set, so a seed reproduces the same samples up to the rounding of the math functions.
+///
 /// <glm/gtc/random.hpp> need to be included to use these functionalities.
 
 #pragma once
@@ -17,6 +27,7 @@
 // Dependency:
 #include "../vec2.hpp"
 #include "../vec3.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -26,7 +37,63 @@ namespace glm
 {
 	/// @addtogroup gtc_random
 	/// @{
-	
+
+	/// xoshiro256** random engine by Blackman and Vigna: 256 bits of state, 64 bits outputs and a period of 2^256 - 1.
+	/// It is fast, passes BigCrush and PractRand, and jump() splits it into non-overlapping streams.
+	/// 
+	/// @see gtc_random
+	struct xoshiro256
+	{
+		typedef uint64 result_type;
+
+		uint64 s[4];
+
+		/// The state is generated from the seed with splitmix64 so that close seeds give unrelated sequences.
+		GLM_FUNC_DECL explicit xoshiro256(uint64 Seed = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Advance the engine by 2^128 outputs: each of 2^128 engines jumped from the same one gets its own stream.
+		GLM_FUNC_DECL void jump();
+
+		GLM_FUNC_DECL static result_type min(){return 0;}
+		GLM_FUNC_DECL static result_type max(){return ~static_cast<result_type>(0);}
+	};
+
+	/// PCG32 random engine by O'Neill (XSH RR variant): a 64 bits linear congruential generator with a 32 bits output permutation.
+	/// Each of the 2^63 streams is a different sequence with a period of 2^64, convenient to give one to each thread.
+	/// Seeding and outputs are the ones of the pcg32 reference implementation.
+	/// 
+	/// @see gtc_random
+	struct pcg32
+	{
+		typedef uint32 result_type;
+
+		uint64 state;
+		uint64 inc;
+
+		GLM_FUNC_DECL explicit pcg32(uint64 Seed = 0x853c49e6748fea9bull, uint64 Stream = 0xda3e39cb94b95bdbull);
+
+		GLM_FUNC_DECL void seed(uint64 Seed, uint64 Stream);
+
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Advance the engine by Delta outputs in O(log(Delta)) steps.
+		GLM_FUNC_DECL void advance(uint64 Delta);
+
+		GLM_FUNC_DECL static result_type min(){return 0;}
+		GLM_FUNC_DECL static result_type max(){return ~static_cast<result_type>(0);}
+	};
+
+	/// The engine of the calling thread used by the functions without engine argument.
+	/// Threads get different seeds, in the order they first call it, and never share a state.
+	/// Compilers without thread_local support share a single engine instead, which is not thread safe.
+	/// 
+	/// @see gtc_random
+	GLM_FUNC_DECL xoshiro256 & randomEngine();
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution 
 	/// 
 	/// @param Min 
@@ -50,6 +117,37 @@ namespace glm
 		vecType<T, P> const & Min,
 		vecType<T, P> const & Max);
 
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution, from Engine
+	/// 
+	/// Integers are unbiased: every value of the interval has the same probability.
+	/// @see gtc_random
+	template <typename genType, typename Engine>
+	GLM_FUNC_DECL genType linearRand(
+		Engine & e,
+		genType Min,
+		genType Max);
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution, from Engine
+	/// 
+	/// @see gtc_random
+	template <typename T, precision P, template <typename, precision> class vecType, typename Engine>
+	GLM_FUNC_DECL vecType<T, P> linearRand(
+		Engine & e,
+		vecType<T, P> const & Min,
+		vecType<T, P> const & Max);
+
+	/// Fill Out with Count random numbers in the interval [Min, Max), according a linear distribution
+	/// 
+	/// @tparam T Value type. Currently supported: float or double.
+	/// @see gtc_random
+	template <typename T, typename Engine>
+	GLM_FUNC_DECL void linearRand(
+		Engine & e,
+		T Min,
+		T Max,
+		T * Out,
+		std::size_t Count);
+
 	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution 
 	/// 
 	/// @param Mean
@@ -59,6 +157,26 @@ namespace glm
 	GLM_FUNC_DECL genType gaussRand(
 		genType Mean,
 		genType Deviation);
+
+	/// Generate random numbers according a gaussian distribution of mean Mean and standard deviation Deviation, from Engine
+	/// 
+	/// @see gtc_random
+	template <typename genType, typename Engine>
+	GLM_FUNC_DECL genType gaussRand(
+		Engine & e,
+		genType Mean,
+		genType Deviation);
+
+	/// Fill Out with Count random numbers according a gaussian distribution of mean Mean and standard deviation Deviation
+	/// 
+	/// @see gtc_random
+	template <typename T, typename Engine>
+	GLM_FUNC_DECL void gaussRand(
+		Engine & e,
+		T Mean,
+		T Deviation,
+		T * Out,
+		std::size_t Count);
 	
 	/// Generate a random 2D vector which coordinates are regulary distributed on a circle of a given radius
 	/// 
@@ -67,6 +185,24 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL tvec2<T, defaultp> circularRand(
 		T Radius);
+
+	/// Generate a random 2D vector which coordinates are regulary distributed on a circle of a given radius, from Engine
+	/// 
+	/// @see gtc_random
+	template <typename T, typename Engine>
+	GLM_FUNC_DECL tvec2<T, defaultp> circularRand(
+		Engine & e,
+		T Radius);
+
+	/// Fill Out with Count random vectors which coordinates are regulary distributed on a circle of a given radius
+	/// 
+	/// @see gtc_random
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_DECL void circularRand(
+		Engine & e,
+		T Radius,
+		tvec2<T, P> * Out,
+		std::size_t Count);
 	
 	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius
 	/// 
@@ -75,6 +211,24 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL tvec3<T, defaultp> sphericalRand(
 		T Radius);
+
+	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius, from Engine
+	/// 
+	/// @see gtc_random
+	template <typename T, typename Engine>
+	GLM_FUNC_DECL tvec3<T, defaultp> sphericalRand(
+		Engine & e,
+		T Radius);
+
+	/// Fill Out with Count random vectors which coordinates are regulary distributed on a sphere of a given radius
+	/// 
+	/// @see gtc_random
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_DECL void sphericalRand(
+		Engine & e,
+		T Radius,
+		tvec3<T, P> * Out,
+		std::size_t Count);
 	
 	/// Generate a random 2D vector which coordinates are regulary distributed within the area of a disk of a given radius
 	/// 
@@ -83,6 +237,24 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL tvec2<T, defaultp> diskRand(
 		T Radius);
+
+	/// Generate a random 2D vector which coordinates are regulary distributed within the area of a disk of a given radius, from Engine
+	/// 
+	/// @see gtc_random
+	template <typename T, typename Engine>
+	GLM_FUNC_DECL tvec2<T, defaultp> diskRand(
+		Engine & e,
+		T Radius);
+
+	/// Fill Out with Count random vectors which coordinates are regulary distributed within the area of a disk of a given radius
+	/// 
+	/// @see gtc_random
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_DECL void diskRand(
+		Engine & e,
+		T Radius,
+		tvec2<T, P> * Out,
+		std::size_t Count);
 	
 	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius
 	/// 
@@ -91,6 +263,24 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL tvec3<T, defaultp> ballRand(
 		T Radius);
+
+	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius, from Engine
+	/// 
+	/// @see gtc_random
+	template <typename T, typename Engine>
+	GLM_FUNC_DECL tvec3<T, defaultp> ballRand(
+		Engine & e,
+		T Radius);
+
+	/// Fill Out with Count random vectors which coordinates are regulary distributed within the volume of a ball of a given radius
+	/// 
+	/// @see gtc_random
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_DECL void ballRand(
+		Engine & e,
+		T Radius,
+		tvec3<T, P> * Out,
+		std::size_t Count);
 	
 	/// @}
 }//namespace glm
@@ -3,348 +3,618 @@
 
 #include "../geometric.hpp"
 #include "../exponential.hpp"
-#include <cstdlib>
-#include <ctime>
+#include "../trigonometric.hpp"
+#include <cmath>
+#include <limits>
 #include <cassert>
+#if GLM_HAS_THREAD_LOCAL && GLM_HAS_CXX11_STL
+#	include <atomic>
+#endif
 
 namespace glm{
 namespace detail
 {
-	template <typename T, precision P, template <class, precision> class vecType>
-	struct compute_rand
+	GLM_FUNC_QUALIFIER uint64 rand_rotl(uint64 x, int k)
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call();
-	};
+		return (x << k) | (x >> (64 - k));
+	}
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec1>
+	// splitmix64 by Vigna, which the xoshiro authors recommend to expand a seed into a state
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64 & State)
 	{
-		GLM_FUNC_QUALIFIER static tvec1<uint8, P> call()
-		{
-			return tvec1<uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		uint64 z = (State += 0x9e3779b97f4a7c15ull);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec2>
-	{
-		GLM_FUNC_QUALIFIER static tvec2<uint8, P> call()
-		{
-			return tvec2<uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+	GLM_FUNC_QUALIFIER uint64 xoshiro256_next(uint64 & s0, uint64 & s1, uint64 & s2, uint64 & s3)
+	{
+		uint64 const Result = rand_rotl(s1 * 5, 7) * 9;
+		uint64 const t = s1 << 17;
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = rand_rotl(s3, 45);
+		return Result;
+	}
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec3>
+	// 32 and 64 bits words from engines of either output size
+	template <typename Engine, bool Is64 = sizeof(typename Engine::result_type) == 8>
+	struct engine_bits
 	{
-		GLM_FUNC_QUALIFIER static tvec3<uint8, P> call()
+		GLM_FUNC_QUALIFIER static uint32 u32(Engine & e)
 		{
-			return tvec3<uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			return static_cast<uint32>(e());
 		}
-	};
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec4>
-	{
-		GLM_FUNC_QUALIFIER static tvec4<uint8, P> call()
+		GLM_FUNC_QUALIFIER static uint64 u64(Engine & e)
 		{
-			return tvec4<uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			uint64 const High = static_cast<uint64>(static_cast<uint32>(e()));
+			uint64 const Low = static_cast<uint64>(static_cast<uint32>(e()));
+			return (High << 32) | Low;
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_rand<uint16, P, vecType>
+	template <typename Engine>
+	struct engine_bits<Engine, true>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint16, P> call()
+		GLM_FUNC_QUALIFIER static uint32 u32(Engine & e)
 		{
-			return
-				(vecType<uint16, P>(compute_rand<uint8, P, vecType>::call()) << static_cast<uint16>(8)) |
-				(vecType<uint16, P>(compute_rand<uint8, P, vecType>::call()) << static_cast<uint16>(0));
+			return static_cast<uint32>(static_cast<uint64>(e()) >> 32);
 		}
-	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_rand<uint32, P, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<uint32, P> call()
+		GLM_FUNC_QUALIFIER static uint64 u64(Engine & e)
 		{
-			return
-				(vecType<uint32, P>(compute_rand<uint16, P, vecType>::call()) << static_cast<uint32>(16)) |
-				(vecType<uint32, P>(compute_rand<uint16, P, vecType>::call()) << static_cast<uint32>(0));
+			return static_cast<uint64>(e());
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_rand<uint64, P, vecType>
+	// Uniform integer in [0, Range) for 1 <= Range <= 2^32, by Lemire's multiply and shift with rejection of the biased values
+	template <typename Engine>
+	GLM_FUNC_QUALIFIER uint32 rand_bounded32(Engine & e, uint64 Range)
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint64, P> call()
+		if(Range > static_cast<uint64>(0xffffffffu))
+			return engine_bits<Engine>::u32(e);
+
+		uint32 const Range32 = static_cast<uint32>(Range);
+		uint64 m = static_cast<uint64>(engine_bits<Engine>::u32(e)) * Range32;
+		if(static_cast<uint32>(m) < Range32)
 		{
-			return
-				(vecType<uint64, P>(compute_rand<uint32, P, vecType>::call()) << static_cast<uint64>(32)) |
-				(vecType<uint64, P>(compute_rand<uint32, P, vecType>::call()) << static_cast<uint64>(0));
+			uint32 const Threshold = (0u - Range32) % Range32;
+			while(static_cast<uint32>(m) < Threshold)
+				m = static_cast<uint64>(engine_bits<Engine>::u32(e)) * Range32;
 		}
-	};
+		return static_cast<uint32>(m >> 32);
+	}
 
-	template <typename T, precision P, template <class, precision> class vecType>
-	struct compute_linearRand
+	// Uniform integer in [0, Range), Range == 0 standing for 2^64
+	template <typename Engine>
+	GLM_FUNC_QUALIFIER uint64 rand_bounded64(Engine & e, uint64 Range)
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & Min, vecType<T, P> const & Max);
-	};
+		if(Range == 0)
+			return engine_bits<Engine>::u64(e);
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<int8, P, vecType>
+		uint64 const Threshold = (0ull - Range) % Range;
+		uint64 x = engine_bits<Engine>::u64(e);
+		while(x < Threshold)
+			x = engine_bits<Engine>::u64(e);
+		return x % Range;
+	}
+
+	// Uniform value in [0, 1) with the precision of T: 53 bits for double, 24 bits for float
+	template <typename T>
+	struct compute_rand_unit
 	{
-		GLM_FUNC_QUALIFIER static vecType<int8, P> call(vecType<int8, P> const & Min, vecType<int8, P> const & Max)
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static T call(Engine & e)
 		{
-			return (vecType<int8, P>(compute_rand<uint8, P, vecType>::call() % vecType<uint8, P>(Max + static_cast<int8>(1) - Min))) + Min;
+			return static_cast<T>(engine_bits<Engine>::u64(e) >> 11) * static_cast<T>(1.1102230246251565404236316680908203125e-16);
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<uint8, P, vecType>
+	template <>
+	struct compute_rand_unit<float>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint8, P> call(vecType<uint8, P> const & Min, vecType<uint8, P> const & Max)
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static float call(Engine & e)
 		{
-			return (compute_rand<uint8, P, vecType>::call() % (Max + static_cast<uint8>(1) - Min)) + Min;
+			return static_cast<float>(engine_bits<Engine>::u32(e) >> 8) * 5.9604644775390625e-8f;
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<int16, P, vecType>
+	template <typename T, bool isInteger = std::numeric_limits<T>::is_integer, bool is64 = sizeof(T) == 8>
+	struct compute_linearRand
 	{
-		GLM_FUNC_QUALIFIER static vecType<int16, P> call(vecType<int16, P> const & Min, vecType<int16, P> const & Max)
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static T call(Engine & e, T Min, T Max)
 		{
-			return (vecType<int16, P>(compute_rand<uint16, P, vecType>::call() % vecType<uint16, P>(Max + static_cast<int16>(1) - Min))) + Min;
+			return compute_rand_unit<T>::call(e) * (Max - Min) + Min;
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<uint16, P, vecType>
+	template <typename T>
+	struct compute_linearRand<T, true, false>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint16, P> call(vecType<uint16, P> const & Min, vecType<uint16, P> const & Max)
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static T call(Engine & e, T Min, T Max)
 		{
-			return (compute_rand<uint16, P, vecType>::call() % (Max + static_cast<uint16>(1) - Min)) + Min;
+			uint64 const Range = static_cast<uint64>(static_cast<int64>(Max) - static_cast<int64>(Min)) + 1;
+			return static_cast<T>(static_cast<int64>(Min) + static_cast<int64>(rand_bounded32(e, Range)));
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<int32, P, vecType>
+	template <typename T>
+	struct compute_linearRand<T, true, true>
 	{
-		GLM_FUNC_QUALIFIER static vecType<int32, P> call(vecType<int32, P> const & Min, vecType<int32, P> const & Max)
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static T call(Engine & e, T Min, T Max)
 		{
-			return (vecType<int32, P>(compute_rand<uint32, P, vecType>::call() % vecType<uint32, P>(Max + static_cast<int32>(1) - Min))) + Min;
+			uint64 const Range = static_cast<uint64>(Max) - static_cast<uint64>(Min) + 1;
+			return static_cast<T>(static_cast<uint64>(Min) + rand_bounded64(e, Range));
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<uint32, P, vecType>
+	// Four xoshiro256** streams side by side, seeded from the caller's engine, that the array functions draw from.
+	// s[w][l] is the word w of the state of the lane l so that the SIMD paths load a word of all the lanes at once.
+	struct xoshiro256x4
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint32, P> call(vecType<uint32, P> const & Min, vecType<uint32, P> const & Max)
+		uint64 s[4][4];
+
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER explicit xoshiro256x4(Engine & e)
 		{
-			return (compute_rand<uint32, P, vecType>::call() % (Max + static_cast<uint32>(1) - Min)) + Min;
+			for(length_t l = 0; l < 4; ++l)
+			{
+				uint64 Seed = engine_bits<Engine>::u64(e);
+				for(length_t w = 0; w < 4; ++w)
+					s[w][l] = splitmix64(Seed);
+			}
 		}
-	};
- 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<int64, P, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<int64, P> call(vecType<int64, P> const & Min, vecType<int64, P> const & Max)
+
+		// One output of each lane
+		GLM_FUNC_QUALIFIER void next(uint64 Out[4])
 		{
-			return (vecType<int64, P>(compute_rand<uint64, P, vecType>::call() % vecType<uint64, P>(Max + static_cast<int64>(1) - Min))) + Min;
+			for(length_t l = 0; l < 4; ++l)
+				Out[l] = xoshiro256_next(s[0][l], s[1][l], s[2][l], s[3][l]);
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_linearRand<uint64, P, vecType>
+	// The uniform values in [0, 1) the array functions get from each output of the four lanes:
+	// one per lane for double, two per lane for float, the low 32 bits first.
+	template <typename T>
+	struct rand_block
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint64, P> call(vecType<uint64, P> const & Min, vecType<uint64, P> const & Max)
+		static length_t const size = 4;
+
+		GLM_FUNC_QUALIFIER static void unit(xoshiro256x4 & Lanes, T u[size])
 		{
-			return (compute_rand<uint64, P, vecType>::call() % (Max + static_cast<uint64>(1) - Min)) + Min;
+			uint64 w[4];
+			Lanes.next(w);
+			for(length_t l = 0; l < 4; ++l)
+				u[l] = static_cast<T>(w[l] >> 11) * static_cast<T>(1.1102230246251565404236316680908203125e-16);
 		}
 	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<float, lowp, vecType>
+	template <>
+	struct rand_block<float>
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, lowp> call(vecType<float, lowp> const & Min, vecType<float, lowp> const & Max)
+		static length_t const size = 8;
+
+		GLM_FUNC_QUALIFIER static void unit(xoshiro256x4 & Lanes, float u[size])
 		{
-			return vecType<float, lowp>(compute_rand<uint8, lowp, vecType>::call()) / static_cast<float>(std::numeric_limits<uint8>::max()) * (Max - Min) + Min;
+			uint64 w[4];
+			Lanes.next(w);
+			for(length_t l = 0; l < 4; ++l)
+			{
+				u[l * 2 + 0] = static_cast<float>(static_cast<uint32>(w[l]) >> 8) * 5.9604644775390625e-8f;
+				u[l * 2 + 1] = static_cast<float>(static_cast<uint32>(w[l] >> 32) >> 8) * 5.9604644775390625e-8f;
+			}
 		}
 	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<float, mediump, vecType>
+	// The array functions: every block of uniform values gives a fixed number of samples, which keeps the
+	// samples of a seed independent of the instruction set. The SIMD specializations must draw the same way.
+	//  - linearRand: one sample per value.
+	//  - gaussRand: Box-Muller, the first half of the block gives the radii and the second half the angles.
+	//    The cosines fill the first half of the samples, the sines the second half.
+	//  - circularRand: one angle per value.
+	//  - sphericalRand: z from the first half of the block, the angle around z from the second half.
+	//  - diskRand: the radius from the first half of the block, the angle from the second half.
+	//  - ballRand: x, y and z of a candidate from three consecutive blocks, kept if within the unit ball.
+	template <typename T>
+	struct compute_rand_array
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, mediump> call(vecType<float, mediump> const & Min, vecType<float, mediump> const & Max)
+		static length_t const Size = rand_block<T>::size;
+		static length_t const Half = Size / 2;
+
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static void linearRand(Engine & e, T Min, T Max, T * Out, std::size_t Count)
 		{
-			return vecType<float, mediump>(compute_rand<uint16, mediump, vecType>::call()) / static_cast<float>(std::numeric_limits<uint16>::max()) * (Max - Min) + Min;
+			xoshiro256x4 Lanes(e);
+			for(std::size_t i = 0; i < Count; i += Size)
+			{
+				T u[Size];
+				rand_block<T>::unit(Lanes, u);
+				for(std::size_t k = 0, n = glm::min(static_cast<std::size_t>(Size), Count - i); k < n; ++k)
+					Out[i + k] = u[k] * (Max - Min) + Min;
+			}
 		}
-	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<float, highp, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<float, highp> call(vecType<float, highp> const & Min, vecType<float, highp> const & Max)
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static void gaussRand(Engine & e, T Mean, T Deviation, T * Out, std::size_t Count)
 		{
-			return vecType<float, highp>(compute_rand<uint32, highp, vecType>::call()) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			xoshiro256x4 Lanes(e);
+			for(std::size_t i = 0; i < Count; i += Size)
+			{
+				T u[Size];
+				rand_block<T>::unit(Lanes, u);
+
+				T z[Size];
+				for(length_t k = 0; k < Half; ++k)
+				{
+					T const r = Deviation * std::sqrt(static_cast<T>(-2) * std::log(static_cast<T>(1) - u[k]));
+					T const a = static_cast<T>(6.283185307179586476925286766559) * u[Half + k];
+					z[k] = r * std::cos(a) + Mean;
+					z[Half + k] = r * std::sin(a) + Mean;
+				}
+				for(std::size_t k = 0, n = glm::min(static_cast<std::size_t>(Size), Count - i); k < n; ++k)
+					Out[i + k] = z[k];
+			}
 		}
-	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<double, lowp, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<double, lowp> call(vecType<double, lowp> const & Min, vecType<double, lowp> const & Max)
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void circularRand(Engine & e, T Radius, tvec2<T, P> * Out, std::size_t Count)
 		{
-			return vecType<double, lowp>(compute_rand<uint16, lowp, vecType>::call()) / static_cast<double>(std::numeric_limits<uint16>::max()) * (Max - Min) + Min;
+			xoshiro256x4 Lanes(e);
+			for(std::size_t i = 0; i < Count; i += Size)
+			{
+				T u[Size];
+				rand_block<T>::unit(Lanes, u);
+				for(std::size_t k = 0, n = glm::min(static_cast<std::size_t>(Size), Count - i); k < n; ++k)
+				{
+					T const a = static_cast<T>(6.283185307179586476925286766559) * u[k];
+					Out[i + k] = tvec2<T, P>(std::cos(a), std::sin(a)) * Radius;
+				}
+			}
 		}
-	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<double, mediump, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<double, mediump> call(vecType<double, mediump> const & Min, vecType<double, mediump> const & Max)
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void sphericalRand(Engine & e, T Radius, tvec3<T, P> * Out, std::size_t Count)
 		{
-			return vecType<double, mediump>(compute_rand<uint32, mediump, vecType>::call()) / static_cast<double>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			xoshiro256x4 Lanes(e);
+			for(std::size_t i = 0; i < Count; i += Half)
+			{
+				T u[Size];
+				rand_block<T>::unit(Lanes, u);
+				for(std::size_t k = 0, n = glm::min(static_cast<std::size_t>(Half), Count - i); k < n; ++k)
+				{
+					T const z = u[k] * static_cast<T>(2) - static_cast<T>(1);
+					T const a = static_cast<T>(6.283185307179586476925286766559) * u[Half + k];
+					T const r = std::sqrt(static_cast<T>(1) - z * z);
+					Out[i + k] = tvec3<T, P>(r * std::cos(a), r * std::sin(a), z) * Radius;
+				}
+			}
 		}
-	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<double, highp, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<double, highp> call(vecType<double, highp> const & Min, vecType<double, highp> const & Max)
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void diskRand(Engine & e, T Radius, tvec2<T, P> * Out, std::size_t Count)
 		{
-			return vecType<double, highp>(compute_rand<uint64, highp, vecType>::call()) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			xoshiro256x4 Lanes(e);
+			for(std::size_t i = 0; i < Count; i += Half)
+			{
+				T u[Size];
+				rand_block<T>::unit(Lanes, u);
+				for(std::size_t k = 0, n = glm::min(static_cast<std::size_t>(Half), Count - i); k < n; ++k)
+				{
+					T const r = std::sqrt(u[k]) * Radius;
+					T const a = static_cast<T>(6.283185307179586476925286766559) * u[Half + k];
+					Out[i + k] = tvec2<T, P>(std::cos(a), std::sin(a)) * r;
+				}
+			}
 		}
-	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<long double, lowp, vecType>
-	{
-		GLM_FUNC_QUALIFIER static vecType<long double, lowp> call(vecType<long double, lowp> const & Min, vecType<long double, lowp> const & Max)
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void ballRand(Engine & e, T Radius, tvec3<T, P> * Out, std::size_t Count)
 		{
-			return vecType<long double, lowp>(compute_rand<uint32, lowp, vecType>::call()) / static_cast<long double>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			xoshiro256x4 Lanes(e);
+			for(std::size_t i = 0; i < Count;)
+			{
+				T x[Size], y[Size], z[Size];
+				rand_block<T>::unit(Lanes, x);
+				rand_block<T>::unit(Lanes, y);
+				rand_block<T>::unit(Lanes, z);
+				for(length_t k = 0; k < Size && i < Count; ++k)
+				{
+					tvec3<T, P> const v(x[k] * static_cast<T>(2) - static_cast<T>(1), y[k] * static_cast<T>(2) - static_cast<T>(1), z[k] * static_cast<T>(2) - static_cast<T>(1));
+					if(dot(v, v) <= static_cast<T>(1))
+						Out[i++] = v * Radius;
+				}
+			}
 		}
 	};
+}//namespace detail
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<long double, mediump, vecType>
+	GLM_FUNC_QUALIFIER xoshiro256::xoshiro256(uint64 Seed)
 	{
-		GLM_FUNC_QUALIFIER static vecType<long double, mediump> call(vecType<long double, mediump> const & Min, vecType<long double, mediump> const & Max)
+		this->seed(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256::seed(uint64 Seed)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			this->s[i] = detail::splitmix64(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256::result_type xoshiro256::operator()()
+	{
+		return detail::xoshiro256_next(this->s[0], this->s[1], this->s[2], this->s[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256::jump()
+	{
+		uint64 const Jump[] = {0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+
+		uint64 t[4] = {0, 0, 0, 0};
+		for(length_t i = 0; i < 4; ++i)
+		for(int b = 0; b < 64; ++b)
 		{
-			return vecType<long double, mediump>(compute_rand<uint64, mediump, vecType>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			if(Jump[i] & (static_cast<uint64>(1) << b))
+			{
+				t[0] ^= this->s[0];
+				t[1] ^= this->s[1];
+				t[2] ^= this->s[2];
+				t[3] ^= this->s[3];
+			}
+			(*this)();
 		}
-	};
 
-	template <template <class, precision> class vecType>
-	struct compute_linearRand<long double, highp, vecType>
+		for(length_t i = 0; i < 4; ++i)
+			this->s[i] = t[i];
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::pcg32(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void pcg32::seed(uint64 Seed, uint64 Stream)
+	{
+		this->state = 0;
+		this->inc = (Stream << 1) | 1;
+		(*this)();
+		this->state += Seed;
+		(*this)();
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::result_type pcg32::operator()()
 	{
-		GLM_FUNC_QUALIFIER static vecType<long double, highp> call(vecType<long double, highp> const & Min, vecType<long double, highp> const & Max)
+		uint64 const Old = this->state;
+		this->state = Old * 6364136223846793005ull + this->inc;
+		uint32 const Shifted = static_cast<uint32>(((Old >> 18) ^ Old) >> 27);
+		uint32 const Rot = static_cast<uint32>(Old >> 59);
+		return (Shifted >> Rot) | (Shifted << ((0u - Rot) & 31));
+	}
+
+	// Brown's algorithm: the affine step x * Mult + Plus composed with itself along the bits of Delta
+	GLM_FUNC_QUALIFIER void pcg32::advance(uint64 Delta)
+	{
+		uint64 Mult = 6364136223846793005ull;
+		uint64 Plus = this->inc;
+		uint64 AccMult = 1;
+		uint64 AccPlus = 0;
+		for(; Delta > 0; Delta >>= 1)
 		{
-			return vecType<long double, highp>(compute_rand<uint64, highp, vecType>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			if(Delta & 1)
+			{
+				AccMult *= Mult;
+				AccPlus = AccPlus * Mult + Plus;
+			}
+			Plus = (Mult + 1) * Plus;
+			Mult *= Mult;
 		}
-	};
-}//namespace detail
+		this->state = AccMult * this->state + AccPlus;
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256 & randomEngine()
+	{
+#		if GLM_HAS_THREAD_LOCAL && GLM_HAS_CXX11_STL
+			static std::atomic<uint64> Seed(0);
+			static thread_local xoshiro256 Engine(Seed++);
+#		elif GLM_HAS_THREAD_LOCAL
+			// Without <atomic>, the address of the engine tells threads apart
+			static thread_local xoshiro256 Engine(static_cast<uint64>(reinterpret_cast<std::size_t>(&Engine)));
+#		else
+			static xoshiro256 Engine;
+#		endif
+		return Engine;
+	}
+
+	template <typename genType, typename Engine>
+	GLM_FUNC_QUALIFIER genType linearRand(Engine & e, genType Min, genType Max)
+	{
+		return detail::compute_linearRand<genType>::call(e, Min, Max);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename Engine>
+	GLM_FUNC_QUALIFIER vecType<T, P> linearRand(Engine & e, vecType<T, P> const & Min, vecType<T, P> const & Max)
+	{
+		vecType<T, P> Result;
+		for(length_t i = 0; i < Result.length(); ++i)
+			Result[i] = detail::compute_linearRand<T>::call(e, Min[i], Max[i]);
+		return Result;
+	}
+
+	template <typename T, typename Engine>
+	GLM_FUNC_QUALIFIER void linearRand(Engine & e, T Min, T Max, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'linearRand' on arrays only accept floating-point inputs");
+
+		detail::compute_rand_array<T>::linearRand(e, Min, Max, Out, Count);
+	}
 
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
 	{
-		return detail::compute_linearRand<genType, highp, tvec1>::call(
-			tvec1<genType, highp>(Min),
-			tvec1<genType, highp>(Max)).x;
+		return linearRand(randomEngine(), Min, Max);
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> linearRand(vecType<T, P> const & Min, vecType<T, P> const & Max)
 	{
-		return detail::compute_linearRand<T, P, vecType>::call(Min, Max);
+		return linearRand(randomEngine(), Min, Max);
 	}
 
-	template <typename genType>
-	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation)
+	// Marsaglia's polar method
+	template <typename genType, typename Engine>
+	GLM_FUNC_QUALIFIER genType gaussRand(Engine & e, genType Mean, genType Deviation)
 	{
 		genType w, x1, x2;
-	
+
 		do
 		{
-			x1 = linearRand(genType(-1), genType(1));
-			x2 = linearRand(genType(-1), genType(1));
-		
+			x1 = linearRand(e, genType(-1), genType(1));
+			x2 = linearRand(e, genType(-1), genType(1));
+
 			w = x1 * x1 + x2 * x2;
-		} while(w > genType(1));
-	
-		return x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
+		} while(w > genType(1) || w == genType(0));
+
+		return x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
+	}
+
+	template <typename T, typename Engine>
+	GLM_FUNC_QUALIFIER void gaussRand(Engine & e, T Mean, T Deviation, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'gaussRand' on arrays only accept floating-point inputs");
+
+		detail::compute_rand_array<T>::gaussRand(e, Mean, Deviation, Out, Count);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation)
+	{
+		return gaussRand(randomEngine(), Mean, Deviation);
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> gaussRand(vecType<T, P> const & Mean, vecType<T, P> const & Deviation)
 	{
-		return detail::functor2<T, P, vecType>::call(gaussRand, Mean, Deviation);
+		xoshiro256 & e = randomEngine();
+
+		vecType<T, P> Result;
+		for(length_t i = 0; i < Result.length(); ++i)
+			Result[i] = gaussRand(e, Mean[i], Deviation[i]);
+		return Result;
 	}
 
-	template <typename T>
-	GLM_FUNC_QUALIFIER tvec2<T, defaultp> diskRand(T Radius)
-	{		
+	template <typename T, typename Engine>
+	GLM_FUNC_QUALIFIER tvec2<T, defaultp> diskRand(Engine & e, T Radius)
+	{
 		tvec2<T, defaultp> Result(T(0));
 		T LenRadius(T(0));
-		
+
 		do
 		{
-			Result = linearRand(
+			Result = linearRand(e,
 				tvec2<T, defaultp>(-Radius),
 				tvec2<T, defaultp>(Radius));
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
-		
+
 		return Result;
 	}
-	
+
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_QUALIFIER void diskRand(Engine & e, T Radius, tvec2<T, P> * Out, std::size_t Count)
+	{
+		detail::compute_rand_array<T>::diskRand(e, Radius, Out, Count);
+	}
+
 	template <typename T>
-	GLM_FUNC_QUALIFIER tvec3<T, defaultp> ballRand(T Radius)
-	{		
+	GLM_FUNC_QUALIFIER tvec2<T, defaultp> diskRand(T Radius)
+	{
+		return diskRand(randomEngine(), Radius);
+	}
+
+	template <typename T, typename Engine>
+	GLM_FUNC_QUALIFIER tvec3<T, defaultp> ballRand(Engine & e, T Radius)
+	{
 		tvec3<T, defaultp> Result(T(0));
 		T LenRadius(T(0));
-		
+
 		do
 		{
-			Result = linearRand(
+			Result = linearRand(e,
 				tvec3<T, defaultp>(-Radius),
 				tvec3<T, defaultp>(Radius));
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
-		
+
 		return Result;
 	}
-	
+
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_QUALIFIER void ballRand(Engine & e, T Radius, tvec3<T, P> * Out, std::size_t Count)
+	{
+		detail::compute_rand_array<T>::ballRand(e, Radius, Out, Count);
+	}
+
 	template <typename T>
-	GLM_FUNC_QUALIFIER tvec2<T, defaultp> circularRand(T Radius)
+	GLM_FUNC_QUALIFIER tvec3<T, defaultp> ballRand(T Radius)
+	{
+		return ballRand(randomEngine(), Radius);
+	}
+
+	template <typename T, typename Engine>
+	GLM_FUNC_QUALIFIER tvec2<T, defaultp> circularRand(Engine & e, T Radius)
+	{
+		T a = linearRand(e, T(0), T(6.283185307179586476925286766559f));
+		return tvec2<T, defaultp>(cos(a), sin(a)) * Radius;
+	}
+
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_QUALIFIER void circularRand(Engine & e, T Radius, tvec2<T, P> * Out, std::size_t Count)
 	{
-		T a = linearRand(T(0), T(6.283185307179586476925286766559f));
-		return tvec2<T, defaultp>(cos(a), sin(a)) * Radius;		
+		detail::compute_rand_array<T>::circularRand(e, Radius, Out, Count);
 	}
-	
+
 	template <typename T>
-	GLM_FUNC_QUALIFIER tvec3<T, defaultp> sphericalRand(T Radius)
+	GLM_FUNC_QUALIFIER tvec2<T, defaultp> circularRand(T Radius)
 	{
-		T z = linearRand(T(-1), T(1));
-		T a = linearRand(T(0), T(6.283185307179586476925286766559f));
-	
+		return circularRand(randomEngine(), Radius);
+	}
+
+	template <typename T, typename Engine>
+	GLM_FUNC_QUALIFIER tvec3<T, defaultp> sphericalRand(Engine & e, T Radius)
+	{
+		T z = linearRand(e, T(-1), T(1));
+		T a = linearRand(e, T(0), T(6.283185307179586476925286766559f));
+
 		T r = sqrt(T(1) - z * z);
-	
+
 		T x = r * cos(a);
 		T y = r * sin(a);
-	
-		return tvec3<T, defaultp>(x, y, z) * Radius;	
+
+		return tvec3<T, defaultp>(x, y, z) * Radius;
+	}
+
+	template <typename T, precision P, typename Engine>
+	GLM_FUNC_QUALIFIER void sphericalRand(Engine & e, T Radius, tvec3<T, P> * Out, std::size_t Count)
+	{
+		detail::compute_rand_array<T>::sphericalRand(e, Radius, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tvec3<T, defaultp> sphericalRand(T Radius)
+	{
+		return sphericalRand(randomEngine(), Radius);
 	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
+#	include "random_simd.inl"
+#endif
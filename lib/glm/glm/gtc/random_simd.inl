@@ -0,0 +1,330 @@
+/// @ref gtc_random
+/// @file glm/gtc/random_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/packing.h"
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// The four lanes of xoshiro256x4, two per register
+	struct rand_lanes_sse2
+	{
+		glm_ivec4 s[4][2];
+
+		GLM_FUNC_QUALIFIER explicit rand_lanes_sse2(xoshiro256x4 const & Lanes)
+		{
+			for(length_t w = 0; w < 4; ++w)
+			{
+				s[w][0] = _mm_loadu_si128(reinterpret_cast<glm_ivec4 const *>(&Lanes.s[w][0]));
+				s[w][1] = _mm_loadu_si128(reinterpret_cast<glm_ivec4 const *>(&Lanes.s[w][2]));
+			}
+		}
+
+		template <int k>
+		GLM_FUNC_QUALIFIER static glm_ivec4 rotl(glm_ivec4 x)
+		{
+			return _mm_or_si128(_mm_slli_epi64(x, k), _mm_srli_epi64(x, 64 - k));
+		}
+
+		GLM_FUNC_QUALIFIER static glm_ivec4 step(glm_ivec4 & s0, glm_ivec4 & s1, glm_ivec4 & s2, glm_ivec4 & s3)
+		{
+			glm_ivec4 const x5 = _mm_add_epi64(_mm_slli_epi64(s1, 2), s1);
+			glm_ivec4 const r7 = rotl<7>(x5);
+			glm_ivec4 const Result = _mm_add_epi64(_mm_slli_epi64(r7, 3), r7);
+			glm_ivec4 const t = _mm_slli_epi64(s1, 17);
+			s2 = _mm_xor_si128(s2, s0);
+			s3 = _mm_xor_si128(s3, s1);
+			s1 = _mm_xor_si128(s1, s2);
+			s0 = _mm_xor_si128(s0, s3);
+			s2 = _mm_xor_si128(s2, t);
+			s3 = rotl<45>(s3);
+			return Result;
+		}
+
+		// The outputs of the lanes 0 and 1 in a, of the lanes 2 and 3 in b
+		GLM_FUNC_QUALIFIER void next(glm_ivec4 & a, glm_ivec4 & b)
+		{
+			a = step(s[0][0], s[1][0], s[2][0], s[3][0]);
+			b = step(s[0][1], s[1][1], s[2][1], s[3][1]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// The four lanes of xoshiro256x4 in one register
+	struct rand_lanes_avx2
+	{
+		__m256i s[4];
+
+		GLM_FUNC_QUALIFIER explicit rand_lanes_avx2(xoshiro256x4 const & Lanes)
+		{
+			for(length_t w = 0; w < 4; ++w)
+				s[w] = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(&Lanes.s[w][0]));
+		}
+
+		template <int k>
+		GLM_FUNC_QUALIFIER static __m256i rotl(__m256i x)
+		{
+			return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+		}
+
+		GLM_FUNC_QUALIFIER void next(glm_ivec4 & a, glm_ivec4 & b)
+		{
+			__m256i const x5 = _mm256_add_epi64(_mm256_slli_epi64(s[1], 2), s[1]);
+			__m256i const r7 = rotl<7>(x5);
+			__m256i const Result = _mm256_add_epi64(_mm256_slli_epi64(r7, 3), r7);
+			__m256i const t = _mm256_slli_epi64(s[1], 17);
+			s[2] = _mm256_xor_si256(s[2], s[0]);
+			s[3] = _mm256_xor_si256(s[3], s[1]);
+			s[1] = _mm256_xor_si256(s[1], s[2]);
+			s[0] = _mm256_xor_si256(s[0], s[3]);
+			s[2] = _mm256_xor_si256(s[2], t);
+			s[3] = rotl<45>(s[3]);
+
+			a = _mm256_castsi256_si128(Result);
+			b = _mm256_extracti128_si256(Result, 1);
+		}
+	};
+
+	typedef rand_lanes_avx2 rand_lanes;
+#	else
+	typedef rand_lanes_sse2 rand_lanes;
+#	endif
+
+	// Four uniform values in [0, 1) from the high 24 bits of each 32 bits word, as rand_block<float>
+	GLM_FUNC_QUALIFIER glm_vec4 rand_vec4_unit(glm_ivec4 Bits)
+	{
+		return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Bits, 8)), _mm_set1_ps(5.9604644775390625e-8f));
+	}
+
+	// Natural logarithm of normal positive values, with the polynomial of Cephes logf
+	GLM_FUNC_QUALIFIER glm_vec4 rand_vec4_log(glm_vec4 x)
+	{
+		glm_ivec4 const Bits = _mm_castps_si128(x);
+		glm_vec4 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126)));
+		glm_vec4 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+
+		// m in [sqrt(1/2), sqrt(2)), minus 1
+		glm_vec4 const Low = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+		e = _mm_sub_ps(e, _mm_and_ps(Low, _mm_set1_ps(1.0f)));
+		m = _mm_add_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_and_ps(Low, m));
+
+		glm_vec4 const z = _mm_mul_ps(m, m);
+		glm_vec4 y = _mm_set1_ps(7.0376836292e-2f);
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.1514610310e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1676998740e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.2420140846e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.4249322787e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.6668057665e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.0000714765e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-2.4999993993e-1f));
+		y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(3.3333331174e-1f));
+		y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+		y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+		y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+		return _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+	}
+
+	// Sine and cosine of 2 pi u for u in [0, 1) multiple of 2^-24, with the polynomials of Cephes sinf and cosf.
+	// The quadrant comes exactly from u, which leaves a reduced angle in [-pi/4, pi/4].
+	GLM_FUNC_QUALIFIER void rand_vec4_sincos_turn(glm_vec4 u, glm_vec4 & s, glm_vec4 & c)
+	{
+		glm_vec4 const q = _mm_mul_ps(u, _mm_set1_ps(4.0f));
+		glm_ivec4 const n = _mm_cvttps_epi32(_mm_add_ps(q, _mm_set1_ps(0.5f)));
+		glm_vec4 const x = _mm_mul_ps(_mm_sub_ps(q, _mm_cvtepi32_ps(n)), _mm_set1_ps(1.57079632679489661923f));
+		glm_vec4 const x2 = _mm_mul_ps(x, x);
+
+		glm_vec4 ps = _mm_set1_ps(-1.9515295891e-4f);
+		ps = _mm_add_ps(_mm_mul_ps(ps, x2), _mm_set1_ps(8.3321608736e-3f));
+		ps = _mm_add_ps(_mm_mul_ps(ps, x2), _mm_set1_ps(-1.6666654611e-1f));
+		ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, x2), x), x);
+
+		glm_vec4 pc = _mm_set1_ps(2.443315711809948e-5f);
+		pc = _mm_add_ps(_mm_mul_ps(pc, x2), _mm_set1_ps(-1.388731625493765e-3f));
+		pc = _mm_add_ps(_mm_mul_ps(pc, x2), _mm_set1_ps(4.166664568298827e-2f));
+		pc = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(pc, x2), x2), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, _mm_set1_ps(0.5f))));
+
+		// Odd quadrants swap sine and cosine, the sine is negative in the quadrants 2 and 3, the cosine in 1 and 2
+		glm_ivec4 const One = _mm_set1_epi32(1);
+		glm_ivec4 const Two = _mm_set1_epi32(2);
+		glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(n, One), One));
+		glm_vec4 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(n, Two), 30));
+		glm_vec4 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(n, One), Two), 30));
+		s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, pc), _mm_andnot_ps(Swap, ps)), SinSign);
+		c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, ps), _mm_andnot_ps(Swap, pc)), CosSign);
+	}
+
+	// Two vec2 given by components per register, x0 y0 x1 y1 then x2 y2 x3 y3
+	GLM_FUNC_QUALIFIER void rand_vec2x4_store(float * out, glm_vec4 x, glm_vec4 y)
+	{
+		_mm_storeu_ps(out + 0, _mm_unpacklo_ps(x, y));
+		_mm_storeu_ps(out + 4, _mm_unpackhi_ps(x, y));
+	}
+
+	// Draws as the generic compute_rand_array<float>, one output of the four lanes at a time. The samples of the
+	// last, partial, block go through a local buffer.
+	template <>
+	struct compute_rand_array<float>
+	{
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static void linearRand(Engine & e, float Min, float Max, float * Out, std::size_t Count)
+		{
+			xoshiro256x4 const Seeds(e);
+			rand_lanes Lanes(Seeds);
+
+			glm_vec4 const Scale = _mm_set1_ps(Max - Min);
+			glm_vec4 const Offset = _mm_set1_ps(Min);
+			for(std::size_t i = 0; i < Count; i += 8)
+			{
+				float Tail[8];
+				float * Dst = Count - i >= 8 ? Out + i : Tail;
+
+				glm_ivec4 a, b;
+				Lanes.next(a, b);
+				_mm_storeu_ps(Dst + 0, _mm_add_ps(_mm_mul_ps(rand_vec4_unit(a), Scale), Offset));
+				_mm_storeu_ps(Dst + 4, _mm_add_ps(_mm_mul_ps(rand_vec4_unit(b), Scale), Offset));
+
+				if(Dst == Tail)
+					std::memcpy(Out + i, Tail, (Count - i) * sizeof(float));
+			}
+		}
+
+		template <typename Engine>
+		GLM_FUNC_QUALIFIER static void gaussRand(Engine & e, float Mean, float Deviation, float * Out, std::size_t Count)
+		{
+			xoshiro256x4 const Seeds(e);
+			rand_lanes Lanes(Seeds);
+
+			glm_vec4 const Dev = _mm_set1_ps(Deviation);
+			glm_vec4 const Mu = _mm_set1_ps(Mean);
+			for(std::size_t i = 0; i < Count; i += 8)
+			{
+				float Tail[8];
+				float * Dst = Count - i >= 8 ? Out + i : Tail;
+
+				glm_ivec4 a, b;
+				Lanes.next(a, b);
+				glm_vec4 const Log = rand_vec4_log(_mm_sub_ps(_mm_set1_ps(1.0f), rand_vec4_unit(a)));
+				glm_vec4 const r = _mm_mul_ps(Dev, _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), Log)));
+				glm_vec4 s, c;
+				rand_vec4_sincos_turn(rand_vec4_unit(b), s, c);
+				_mm_storeu_ps(Dst + 0, _mm_add_ps(_mm_mul_ps(r, c), Mu));
+				_mm_storeu_ps(Dst + 4, _mm_add_ps(_mm_mul_ps(r, s), Mu));
+
+				if(Dst == Tail)
+					std::memcpy(Out + i, Tail, (Count - i) * sizeof(float));
+			}
+		}
+
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void circularRand(Engine & e, float Radius, tvec2<float, P> * Out, std::size_t Count)
+		{
+			xoshiro256x4 const Seeds(e);
+			rand_lanes Lanes(Seeds);
+
+			glm_vec4 const R = _mm_set1_ps(Radius);
+			for(std::size_t i = 0; i < Count; i += 8)
+			{
+				float Tail[16];
+				float * Dst = Count - i >= 8 ? reinterpret_cast<float *>(Out + i) : Tail;
+
+				glm_ivec4 a, b;
+				Lanes.next(a, b);
+				glm_vec4 s, c;
+				rand_vec4_sincos_turn(rand_vec4_unit(a), s, c);
+				rand_vec2x4_store(Dst + 0, _mm_mul_ps(c, R), _mm_mul_ps(s, R));
+				rand_vec4_sincos_turn(rand_vec4_unit(b), s, c);
+				rand_vec2x4_store(Dst + 8, _mm_mul_ps(c, R), _mm_mul_ps(s, R));
+
+				if(Dst == Tail)
+					std::memcpy(reinterpret_cast<float *>(Out + i), Tail, (Count - i) * sizeof(tvec2<float, P>));
+			}
+		}
+
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void sphericalRand(Engine & e, float Radius, tvec3<float, P> * Out, std::size_t Count)
+		{
+			xoshiro256x4 const Seeds(e);
+			rand_lanes Lanes(Seeds);
+
+			glm_vec4 const R = _mm_set1_ps(Radius);
+			for(std::size_t i = 0; i < Count; i += 4)
+			{
+				float Tail[12];
+				float * Dst = Count - i >= 4 ? reinterpret_cast<float *>(Out + i) : Tail;
+
+				glm_ivec4 a, b;
+				Lanes.next(a, b);
+				glm_vec4 const z = _mm_sub_ps(_mm_mul_ps(rand_vec4_unit(a), _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f));
+				glm_vec4 const r = _mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, z)));
+				glm_vec4 s, c;
+				rand_vec4_sincos_turn(rand_vec4_unit(b), s, c);
+				glm_vec3x4_store_soa(Dst, _mm_mul_ps(_mm_mul_ps(r, c), R), _mm_mul_ps(_mm_mul_ps(r, s), R), _mm_mul_ps(z, R));
+
+				if(Dst == Tail)
+					std::memcpy(reinterpret_cast<float *>(Out + i), Tail, (Count - i) * sizeof(tvec3<float, P>));
+			}
+		}
+
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void diskRand(Engine & e, float Radius, tvec2<float, P> * Out, std::size_t Count)
+		{
+			xoshiro256x4 const Seeds(e);
+			rand_lanes Lanes(Seeds);
+
+			glm_vec4 const R = _mm_set1_ps(Radius);
+			for(std::size_t i = 0; i < Count; i += 4)
+			{
+				float Tail[8];
+				float * Dst = Count - i >= 4 ? reinterpret_cast<float *>(Out + i) : Tail;
+
+				glm_ivec4 a, b;
+				Lanes.next(a, b);
+				glm_vec4 const r = _mm_mul_ps(_mm_sqrt_ps(rand_vec4_unit(a)), R);
+				glm_vec4 s, c;
+				rand_vec4_sincos_turn(rand_vec4_unit(b), s, c);
+				rand_vec2x4_store(Dst, _mm_mul_ps(c, r), _mm_mul_ps(s, r));
+
+				if(Dst == Tail)
+					std::memcpy(reinterpret_cast<float *>(Out + i), Tail, (Count - i) * sizeof(tvec2<float, P>));
+			}
+		}
+
+		template <typename Engine, precision P>
+		GLM_FUNC_QUALIFIER static void ballRand(Engine & e, float Radius, tvec3<float, P> * Out, std::size_t Count)
+		{
+			xoshiro256x4 const Seeds(e);
+			rand_lanes Lanes(Seeds);
+
+			glm_vec4 const One = _mm_set1_ps(1.0f);
+			glm_vec4 const Two = _mm_set1_ps(2.0f);
+			glm_vec4 const R = _mm_set1_ps(Radius);
+			for(std::size_t i = 0; i < Count;)
+			{
+				glm_ivec4 Bits[3][2];
+				for(length_t c = 0; c < 3; ++c)
+					Lanes.next(Bits[c][0], Bits[c][1]);
+
+				for(length_t h = 0; h < 2 && i < Count; ++h)
+				{
+					glm_vec4 const x = _mm_sub_ps(_mm_mul_ps(rand_vec4_unit(Bits[0][h]), Two), One);
+					glm_vec4 const y = _mm_sub_ps(_mm_mul_ps(rand_vec4_unit(Bits[1][h]), Two), One);
+					glm_vec4 const z = _mm_sub_ps(_mm_mul_ps(rand_vec4_unit(Bits[2][h]), Two), One);
+					glm_vec4 const d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+					int Inside = _mm_movemask_ps(_mm_cmple_ps(d, One));
+
+					float v[12];
+					glm_vec3x4_store_soa(v, _mm_mul_ps(x, R), _mm_mul_ps(y, R), _mm_mul_ps(z, R));
+					for(length_t k = 0; Inside && i < Count; ++k, Inside >>= 1)
+						if(Inside & 1)
+							Out[i++] = tvec3<float, P>(v[k * 3 + 0], v[k * 3 + 1], v[k * 3 + 2]);
+				}
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,241 @@
+/// @ref gtx_affine
+/// @file glm/gtx/affine.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_affine GLM_GTX_affine
+/// @ingroup gtx
+///
+/// @brief Defines an affine transformation type stored as the 3 top rows of a 4 * 4 matrix.
+///
+/// Each row holds a row of the 3 * 3 linear part and, in w, a component of the translation.
+/// The bottom row of an affine matrix is always (0, 0, 0, 1), so it isn't stored: a taffine
+/// is 12 values instead of 16, and uploads as a vec4[3] per transformation, a point p being
+/// transformed in a shader by (dot(row[0], p), dot(row[1], p), dot(row[2], p)) with p.w = 1.
+///
+/// Products and inverses skip the work on the bottom row: composing two transformations
+/// takes 36 multiplies and 27 additions instead of the 64 and 48 of a mat4 product. With
+/// SSE2, float transformations are composed, inverted and applied on SIMD lanes.
+///
+/// <glm/gtx/affine.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_affine
+	/// @{
+
+	template <typename T, precision P = defaultp>
+	struct taffine
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef tvec4<T, P> row_type;
+		typedef taffine<T, P> type;
+
+		// -- Data --
+
+		row_type value[3];
+
+		// -- Component accesses --
+
+		typedef length_t length_type;
+		/// Return the count of stored rows
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 3;}
+
+		GLM_FUNC_DECL row_type & operator[](length_type i);
+		GLM_FUNC_DECL row_type const & operator[](length_type i) const;
+
+		// -- Implicit basic constructors --
+
+		/// The identity, unless GLM_FORCE_NO_CTOR_INIT is defined
+		GLM_FUNC_DECL taffine() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL taffine(taffine<T, P> const & m) GLM_DEFAULT;
+		template <precision Q>
+		GLM_FUNC_DECL taffine(taffine<T, Q> const & m);
+
+		// -- Explicit basic constructors --
+
+		GLM_FUNC_DECL explicit taffine(ctor);
+		GLM_FUNC_DECL explicit taffine(T const & s);
+		GLM_FUNC_DECL taffine(row_type const & r0, row_type const & r1, row_type const & r2);
+		GLM_FUNC_DECL taffine(tmat3x3<T, P> const & linear, tvec3<T, P> const & translation);
+
+		// -- Conversion constructors --
+
+		template <typename U, precision Q>
+		GLM_FUNC_DECL GLM_EXPLICIT taffine(taffine<U, Q> const & m);
+
+		/// Drops the bottom row, which must be (0, 0, 0, 1) for the result to be the same transformation
+		GLM_FUNC_DECL GLM_EXPLICIT taffine(tmat4x4<T, P> const & m);
+		GLM_FUNC_DECL GLM_EXPLICIT taffine(tmat4x3<T, P> const & m);
+
+		// -- Unary arithmetic operators --
+
+		GLM_FUNC_DECL taffine<T, P> & operator=(taffine<T, P> const & m) GLM_DEFAULT;
+
+		template <typename U>
+		GLM_FUNC_DECL taffine<T, P> & operator=(taffine<U, P> const & m);
+		template <typename U>
+		GLM_FUNC_DECL taffine<T, P> & operator*=(taffine<U, P> const & m);
+	};
+
+	// -- Binary operators --
+
+	/// Composes two transformations, m2 applies first: (m1 * m2) * p == m1 * (m2 * p).
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL taffine<T, P> operator*(taffine<T, P> const & m1, taffine<T, P> const & m2);
+
+	/// The stored rows times v: v.w is 1 for a point and 0 for a direction.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec3<T, P> operator*(taffine<T, P> const & m, tvec4<T, P> const & v);
+
+	// -- Boolean operators --
+
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool operator==(taffine<T, P> const & m1, taffine<T, P> const & m2);
+
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool operator!=(taffine<T, P> const & m1, taffine<T, P> const & m2);
+
+	/// Transforms a point, translation included.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec3<T, P> transformPoint(taffine<T, P> const & m, tvec3<T, P> const & p);
+
+	/// Transforms a direction by the linear part only.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec3<T, P> transformVector(taffine<T, P> const & m, tvec3<T, P> const & v);
+
+	/// out[i] = transformPoint(m, in[i]). in and out can be the same array.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(taffine<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count);
+
+	/// Inverse of any invertible affine transformation, through the adjugate of the linear part.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL taffine<T, P> inverse(taffine<T, P> const & m);
+
+	/// Inverse of a rotation and a translation: the linear part is transposed. The result is
+	/// wrong if the linear part isn't orthonormal, e.g. with a scale.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL taffine<T, P> inverseRigid(taffine<T, P> const & m);
+
+	/// Concatenates a hierarchy: world[i] = world[parents[i]] * local[i], or local[i] for a root,
+	/// whose parent is negative. A parent must come before its children.
+	/// local and world can be the same array.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL void localToWorld(taffine<T, P> const * local, int const * parents, taffine<T, P> * world, std::size_t count);
+
+	/// Converts an affine transformation to a 4 * 4 matrix, with a (0, 0, 0, 1) bottom row.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL tmat4x4<T, P> mat4_cast(taffine<T, P> const & m);
+
+	/// Converts an affine transformation to a 4 * 3 matrix, the translation in the last column.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL tmat4x3<T, P> mat4x3_cast(taffine<T, P> const & m);
+
+	/// Converts the top 3 rows of a 4 * 4 matrix to an affine transformation.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL taffine<T, P> affine_cast(tmat4x4<T, P> const & m);
+
+	/// Converts a 4 * 3 matrix, the translation in the last column, to an affine transformation.
+	///
+	/// @see gtx_affine
+	template <typename T, precision P>
+	GLM_FUNC_DECL taffine<T, P> affine_cast(tmat4x3<T, P> const & m);
+
+	/// Affine transformation of low single-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef taffine<float, lowp>		lowp_affine;
+
+	/// Affine transformation of medium single-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef taffine<float, mediump>		mediump_affine;
+
+	/// Affine transformation of high single-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef taffine<float, highp>		highp_affine;
+
+	/// Affine transformation of low double-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef taffine<double, lowp>		lowp_daffine;
+
+	/// Affine transformation of medium double-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef taffine<double, mediump>	mediump_daffine;
+
+	/// Affine transformation of high double-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef taffine<double, highp>		highp_daffine;
+
+#if(!defined(GLM_PRECISION_HIGHP_FLOAT) && !defined(GLM_PRECISION_MEDIUMP_FLOAT) && !defined(GLM_PRECISION_LOWP_FLOAT))
+	/// Affine transformation of default single-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef highp_affine			affine;
+#elif(defined(GLM_PRECISION_HIGHP_FLOAT) && !defined(GLM_PRECISION_MEDIUMP_FLOAT) && !defined(GLM_PRECISION_LOWP_FLOAT))
+	typedef highp_affine			affine;
+#elif(!defined(GLM_PRECISION_HIGHP_FLOAT) && defined(GLM_PRECISION_MEDIUMP_FLOAT) && !defined(GLM_PRECISION_LOWP_FLOAT))
+	typedef mediump_affine			affine;
+#elif(!defined(GLM_PRECISION_HIGHP_FLOAT) && !defined(GLM_PRECISION_MEDIUMP_FLOAT) && defined(GLM_PRECISION_LOWP_FLOAT))
+	typedef lowp_affine				affine;
+#else
+#	error "GLM error: multiple default precision requested for single-precision floating-point types"
+#endif
+
+#if(!defined(GLM_PRECISION_HIGHP_DOUBLE) && !defined(GLM_PRECISION_MEDIUMP_DOUBLE) && !defined(GLM_PRECISION_LOWP_DOUBLE))
+	/// Affine transformation of default double-precision floating-point numbers.
+	///
+	/// @see gtx_affine
+	typedef highp_daffine			daffine;
+#elif(defined(GLM_PRECISION_HIGHP_DOUBLE) && !defined(GLM_PRECISION_MEDIUMP_DOUBLE) && !defined(GLM_PRECISION_LOWP_DOUBLE))
+	typedef highp_daffine			daffine;
+#elif(!defined(GLM_PRECISION_HIGHP_DOUBLE) && defined(GLM_PRECISION_MEDIUMP_DOUBLE) && !defined(GLM_PRECISION_LOWP_DOUBLE))
+	typedef mediump_daffine			daffine;
+#elif(!defined(GLM_PRECISION_HIGHP_DOUBLE) && !defined(GLM_PRECISION_MEDIUMP_DOUBLE) && defined(GLM_PRECISION_LOWP_DOUBLE))
+	typedef lowp_daffine			daffine;
+#else
+#	error "GLM error: Multiple default precision requested for double-precision floating-point types"
+#endif
+
+	/// @}
+} //namespace glm
+
+#include "affine.inl"
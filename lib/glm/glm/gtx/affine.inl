@@ -0,0 +1,329 @@
+/// @ref gtx_affine
+/// @file glm/gtx/affine.inl
+
+#include "../geometric.hpp"
+
+namespace glm{
+namespace detail
+{
+	// Row i of the product: the rows of m2 weighted by the linear part of row i of m1, plus
+	// the translation of m1
+	template <typename T, precision P, bool Aligned>
+	struct compute_affine_mul
+	{
+		GLM_FUNC_QUALIFIER static taffine<T, P> call(taffine<T, P> const & m1, taffine<T, P> const & m2)
+		{
+			taffine<T, P> Result(uninitialize);
+			for(length_t i = 0; i < 3; ++i)
+			{
+				Result[i] = m2[0] * m1[i].x + m2[1] * m1[i].y + m2[2] * m1[i].z;
+				Result[i].w += m1[i].w;
+			}
+			return Result;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_affine_mul_vec4
+	{
+		GLM_FUNC_QUALIFIER static tvec3<T, P> call(taffine<T, P> const & m, tvec4<T, P> const & v)
+		{
+			return tvec3<T, P>(dot(m[0], v), dot(m[1], v), dot(m[2], v));
+		}
+	};
+
+	// The inverse of the linear part is its adjugate over its determinant. The columns of the
+	// adjugate are the cross products of the rows, and the translation is moved by the inverse
+	template <typename T, precision P, bool Aligned>
+	struct compute_affine_inverse
+	{
+		GLM_FUNC_QUALIFIER static taffine<T, P> call(taffine<T, P> const & m)
+		{
+			tvec3<T, P> const r0(m[0]);
+			tvec3<T, P> const r1(m[1]);
+			tvec3<T, P> const r2(m[2]);
+			T const OneOverDeterminant = static_cast<T>(1) / dot(r0, cross(r1, r2));
+
+			tvec3<T, P> const c0(cross(r1, r2) * OneOverDeterminant);
+			tvec3<T, P> const c1(cross(r2, r0) * OneOverDeterminant);
+			tvec3<T, P> const c2(cross(r0, r1) * OneOverDeterminant);
+			tvec3<T, P> const t(-(c0 * m[0].w + c1 * m[1].w + c2 * m[2].w));
+
+			return taffine<T, P>(
+				tvec4<T, P>(c0.x, c1.x, c2.x, t.x),
+				tvec4<T, P>(c0.y, c1.y, c2.y, t.y),
+				tvec4<T, P>(c0.z, c1.z, c2.z, t.z));
+		}
+	};
+
+	// The inverse of a rotation is its transpose
+	template <typename T, precision P, bool Aligned>
+	struct compute_affine_inverse_rigid
+	{
+		GLM_FUNC_QUALIFIER static taffine<T, P> call(taffine<T, P> const & m)
+		{
+			tvec3<T, P> const t(-(tvec3<T, P>(m[0]) * m[0].w + tvec3<T, P>(m[1]) * m[1].w + tvec3<T, P>(m[2]) * m[2].w));
+
+			return taffine<T, P>(
+				tvec4<T, P>(m[0].x, m[1].x, m[2].x, t.x),
+				tvec4<T, P>(m[0].y, m[1].y, m[2].y, t.y),
+				tvec4<T, P>(m[0].z, m[1].z, m[2].z, t.z));
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_affine_transform_points
+	{
+		GLM_FUNC_QUALIFIER static void call(taffine<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = compute_affine_mul_vec4<T, P, Aligned>::call(m, tvec4<T, P>(in[i], static_cast<T>(1)));
+		}
+	};
+}//namespace detail
+
+	// -- Component accesses --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename taffine<T, P>::row_type & taffine<T, P>::operator[](typename taffine<T, P>::length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename taffine<T, P>::row_type const & taffine<T, P>::operator[](typename taffine<T, P>::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	// -- Implicit basic constructors --
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+		template <typename T, precision P>
+		GLM_FUNC_QUALIFIER taffine<T, P>::taffine()
+		{
+#			ifndef GLM_FORCE_NO_CTOR_INIT
+				this->value[0] = row_type(1, 0, 0, 0);
+				this->value[1] = row_type(0, 1, 0, 0);
+				this->value[2] = row_type(0, 0, 1, 0);
+#			endif
+		}
+#	endif
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS
+		template <typename T, precision P>
+		GLM_FUNC_QUALIFIER taffine<T, P>::taffine(taffine<T, P> const & m)
+		{
+			this->value[0] = m.value[0];
+			this->value[1] = m.value[1];
+			this->value[2] = m.value[2];
+		}
+#	endif//!GLM_HAS_DEFAULTED_FUNCTIONS
+
+	template <typename T, precision P>
+	template <precision Q>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(taffine<T, Q> const & m)
+	{
+		this->value[0] = m.value[0];
+		this->value[1] = m.value[1];
+		this->value[2] = m.value[2];
+	}
+
+	// -- Explicit basic constructors --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(ctor)
+	{}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(T const & s)
+	{
+		this->value[0] = row_type(s, 0, 0, 0);
+		this->value[1] = row_type(0, s, 0, 0);
+		this->value[2] = row_type(0, 0, s, 0);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(row_type const & r0, row_type const & r1, row_type const & r2)
+	{
+		this->value[0] = r0;
+		this->value[1] = r1;
+		this->value[2] = r2;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(tmat3x3<T, P> const & m, tvec3<T, P> const & t)
+	{
+		this->value[0] = row_type(m[0][0], m[1][0], m[2][0], t.x);
+		this->value[1] = row_type(m[0][1], m[1][1], m[2][1], t.y);
+		this->value[2] = row_type(m[0][2], m[1][2], m[2][2], t.z);
+	}
+
+	// -- Conversion constructors --
+
+	template <typename T, precision P>
+	template <typename U, precision Q>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(taffine<U, Q> const & m)
+	{
+		this->value[0] = row_type(m.value[0]);
+		this->value[1] = row_type(m.value[1]);
+		this->value[2] = row_type(m.value[2]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(tmat4x4<T, P> const & m)
+	{
+		*this = affine_cast(m);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P>::taffine(tmat4x3<T, P> const & m)
+	{
+		*this = affine_cast(m);
+	}
+
+	// -- Unary arithmetic operators --
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS
+		template <typename T, precision P>
+		GLM_FUNC_QUALIFIER taffine<T, P> & taffine<T, P>::operator=(taffine<T, P> const & m)
+		{
+			this->value[0] = m.value[0];
+			this->value[1] = m.value[1];
+			this->value[2] = m.value[2];
+			return *this;
+		}
+#	endif//!GLM_HAS_DEFAULTED_FUNCTIONS
+
+	template <typename T, precision P>
+	template <typename U>
+	GLM_FUNC_QUALIFIER taffine<T, P> & taffine<T, P>::operator=(taffine<U, P> const & m)
+	{
+		this->value[0] = row_type(m.value[0]);
+		this->value[1] = row_type(m.value[1]);
+		this->value[2] = row_type(m.value[2]);
+		return *this;
+	}
+
+	template <typename T, precision P>
+	template <typename U>
+	GLM_FUNC_QUALIFIER taffine<T, P> & taffine<T, P>::operator*=(taffine<U, P> const & m)
+	{
+		return (*this = *this * taffine<T, P>(m));
+	}
+
+	// -- Binary operators --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P> operator*(taffine<T, P> const & m1, taffine<T, P> const & m2)
+	{
+		return detail::compute_affine_mul<T, P, detail::is_aligned<P>::value>::call(m1, m2);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(taffine<T, P> const & m, tvec4<T, P> const & v)
+	{
+		return detail::compute_affine_mul_vec4<T, P, detail::is_aligned<P>::value>::call(m, v);
+	}
+
+	// -- Boolean operators --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool operator==(taffine<T, P> const & m1, taffine<T, P> const & m2)
+	{
+		return (m1[0] == m2[0]) && (m1[1] == m2[1]) && (m1[2] == m2[2]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool operator!=(taffine<T, P> const & m1, taffine<T, P> const & m2)
+	{
+		return (m1[0] != m2[0]) || (m1[1] != m2[1]) || (m1[2] != m2[2]);
+	}
+
+	// -- Functions --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec3<T, P> transformPoint(taffine<T, P> const & m, tvec3<T, P> const & p)
+	{
+		return m * tvec4<T, P>(p, static_cast<T>(1));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec3<T, P> transformVector(taffine<T, P> const & m, tvec3<T, P> const & v)
+	{
+		return m * tvec4<T, P>(v, static_cast<T>(0));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints(taffine<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+	{
+		detail::compute_affine_transform_points<T, P, detail::is_aligned<P>::value>::call(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P> inverse(taffine<T, P> const & m)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'inverse' only accept floating-point inputs");
+		return detail::compute_affine_inverse<T, P, detail::is_aligned<P>::value>::call(m);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P> inverseRigid(taffine<T, P> const & m)
+	{
+		return detail::compute_affine_inverse_rigid<T, P, detail::is_aligned<P>::value>::call(m);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void localToWorld(taffine<T, P> const * local, int const * parents, taffine<T, P> * world, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			assert(parents[i] < static_cast<int>(i));
+			world[i] = parents[i] < 0 ? local[i] : world[parents[i]] * local[i];
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat4x4<T, P> mat4_cast(taffine<T, P> const & m)
+	{
+		return tmat4x4<T, P>(
+			m[0].x, m[1].x, m[2].x, static_cast<T>(0),
+			m[0].y, m[1].y, m[2].y, static_cast<T>(0),
+			m[0].z, m[1].z, m[2].z, static_cast<T>(0),
+			m[0].w, m[1].w, m[2].w, static_cast<T>(1));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat4x3<T, P> mat4x3_cast(taffine<T, P> const & m)
+	{
+		return tmat4x3<T, P>(
+			m[0].x, m[1].x, m[2].x,
+			m[0].y, m[1].y, m[2].y,
+			m[0].z, m[1].z, m[2].z,
+			m[0].w, m[1].w, m[2].w);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P> affine_cast(tmat4x4<T, P> const & m)
+	{
+		return taffine<T, P>(
+			tvec4<T, P>(m[0][0], m[1][0], m[2][0], m[3][0]),
+			tvec4<T, P>(m[0][1], m[1][1], m[2][1], m[3][1]),
+			tvec4<T, P>(m[0][2], m[1][2], m[2][2], m[3][2]));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER taffine<T, P> affine_cast(tmat4x3<T, P> const & m)
+	{
+		return taffine<T, P>(
+			tvec4<T, P>(m[0][0], m[1][0], m[2][0], m[3][0]),
+			tvec4<T, P>(m[0][1], m[1][1], m[2][1], m[3][1]),
+			tvec4<T, P>(m[0][2], m[1][2], m[2][2], m[3][2]));
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "affine_simd.inl"
+#endif
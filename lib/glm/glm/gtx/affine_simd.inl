@@ -0,0 +1,181 @@
+/// @ref gtx_affine
+/// @file glm/gtx/affine_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/geometric.h"
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template <bool Aligned>
+	struct affine_simd_storage
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static glm_vec4 load(tvec4<float, P> const & v){return v.data;}
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void store(tvec4<float, P> & v, glm_vec4 x){v.data = x;}
+	};
+
+	template <>
+	struct affine_simd_storage<false>
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static glm_vec4 load(tvec4<float, P> const & v){return _mm_loadu_ps(&v.x);}
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void store(tvec4<float, P> & v, glm_vec4 x){_mm_storeu_ps(&v.x, x);}
+	};
+
+	// Row a of the left operand times the right operand b0, b1, b2, the translation of a added in w
+	GLM_FUNC_QUALIFIER glm_vec4 glm_affine_mul_row(glm_vec4 a, glm_vec4 b0, glm_vec4 b1, glm_vec4 b2)
+	{
+		glm_vec4 const mul0 = _mm_mul_ps(b0, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)));
+		glm_vec4 const mul1 = _mm_mul_ps(b1, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
+		glm_vec4 const mul2 = _mm_mul_ps(b2, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)));
+		glm_vec4 const w = _mm_and_ps(a, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)));
+		return _mm_add_ps(_mm_add_ps(mul0, mul1), _mm_add_ps(mul2, w));
+	}
+
+	template <precision P, bool Aligned>
+	struct compute_affine_mul<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static taffine<float, P> call(taffine<float, P> const & m1, taffine<float, P> const & m2)
+		{
+			glm_vec4 const b0 = affine_simd_storage<Aligned>::load(m2[0]);
+			glm_vec4 const b1 = affine_simd_storage<Aligned>::load(m2[1]);
+			glm_vec4 const b2 = affine_simd_storage<Aligned>::load(m2[2]);
+			glm_vec4 const r0 = glm_affine_mul_row(affine_simd_storage<Aligned>::load(m1[0]), b0, b1, b2);
+			glm_vec4 const r1 = glm_affine_mul_row(affine_simd_storage<Aligned>::load(m1[1]), b0, b1, b2);
+			glm_vec4 const r2 = glm_affine_mul_row(affine_simd_storage<Aligned>::load(m1[2]), b0, b1, b2);
+
+			taffine<float, P> Result(uninitialize);
+			affine_simd_storage<Aligned>::store(Result[0], r0);
+			affine_simd_storage<Aligned>::store(Result[1], r1);
+			affine_simd_storage<Aligned>::store(Result[2], r2);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_affine_mul_vec4<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(taffine<float, P> const & m, tvec4<float, P> const & v)
+		{
+			glm_vec4 const v0 = _mm_setr_ps(v.x, v.y, v.z, v.w);
+
+			// The rows times v, transposed so that adding the columns sums each row
+			glm_vec4 mul[4];
+			mul[0] = _mm_mul_ps(affine_simd_storage<Aligned>::load(m[0]), v0);
+			mul[1] = _mm_mul_ps(affine_simd_storage<Aligned>::load(m[1]), v0);
+			mul[2] = _mm_mul_ps(affine_simd_storage<Aligned>::load(m[2]), v0);
+			mul[3] = _mm_setzero_ps();
+
+			glm_vec4 col[4];
+			glm_mat4_transpose(mul, col);
+			glm_vec4 const res0 = _mm_add_ps(_mm_add_ps(col[0], col[1]), _mm_add_ps(col[2], col[3]));
+
+			float Result[4];
+			_mm_storeu_ps(Result, res0);
+			return tvec3<float, P>(Result[0], Result[1], Result[2]);
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_affine_inverse<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static taffine<float, P> call(taffine<float, P> const & m)
+		{
+			glm_vec4 const xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			glm_vec4 const r0 = affine_simd_storage<Aligned>::load(m[0]);
+			glm_vec4 const r1 = affine_simd_storage<Aligned>::load(m[1]);
+			glm_vec4 const r2 = affine_simd_storage<Aligned>::load(m[2]);
+
+			// With the translations masked out, the w lanes of the cross products are 0
+			glm_vec4 const l0 = _mm_and_ps(r0, xyz);
+			glm_vec4 const l1 = _mm_and_ps(r1, xyz);
+			glm_vec4 const l2 = _mm_and_ps(r2, xyz);
+			glm_vec4 const cross0 = glm_vec4_cross(l1, l2);
+			glm_vec4 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), glm_vec4_dot(l0, cross0));
+
+			glm_vec4 in[4];
+			in[0] = _mm_mul_ps(cross0, OneOverDeterminant);
+			in[1] = _mm_mul_ps(glm_vec4_cross(l2, l0), OneOverDeterminant);
+			in[2] = _mm_mul_ps(glm_vec4_cross(l0, l1), OneOverDeterminant);
+			in[3] = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(in[0], _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3))),
+				_mm_mul_ps(in[1], _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)))),
+				_mm_mul_ps(in[2], _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)))));
+
+			glm_vec4 out[4];
+			glm_mat4_transpose(in, out);
+
+			taffine<float, P> Result(uninitialize);
+			affine_simd_storage<Aligned>::store(Result[0], out[0]);
+			affine_simd_storage<Aligned>::store(Result[1], out[1]);
+			affine_simd_storage<Aligned>::store(Result[2], out[2]);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_affine_inverse_rigid<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static taffine<float, P> call(taffine<float, P> const & m)
+		{
+			glm_vec4 const xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			glm_vec4 const r0 = affine_simd_storage<Aligned>::load(m[0]);
+			glm_vec4 const r1 = affine_simd_storage<Aligned>::load(m[1]);
+			glm_vec4 const r2 = affine_simd_storage<Aligned>::load(m[2]);
+
+			glm_vec4 in[4];
+			in[0] = _mm_and_ps(r0, xyz);
+			in[1] = _mm_and_ps(r1, xyz);
+			in[2] = _mm_and_ps(r2, xyz);
+			in[3] = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(in[0], _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3))),
+				_mm_mul_ps(in[1], _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)))),
+				_mm_mul_ps(in[2], _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)))));
+
+			glm_vec4 out[4];
+			glm_mat4_transpose(in, out);
+
+			taffine<float, P> Result(uninitialize);
+			affine_simd_storage<Aligned>::store(Result[0], out[0]);
+			affine_simd_storage<Aligned>::store(Result[1], out[1]);
+			affine_simd_storage<Aligned>::store(Result[2], out[2]);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_affine_transform_points<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static void call(taffine<float, P> const & m, tvec3<float, P> const * in, tvec3<float, P> * out, std::size_t count)
+		{
+			glm_vec4 rows[4];
+			rows[0] = affine_simd_storage<Aligned>::load(m[0]);
+			rows[1] = affine_simd_storage<Aligned>::load(m[1]);
+			rows[2] = affine_simd_storage<Aligned>::load(m[2]);
+			rows[3] = _mm_setzero_ps();
+
+			glm_vec4 col[4];
+			glm_mat4_transpose(rows, col);
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				glm_vec4 const mul0 = _mm_mul_ps(col[0], _mm_set1_ps(in[i].x));
+				glm_vec4 const mul1 = _mm_mul_ps(col[1], _mm_set1_ps(in[i].y));
+				glm_vec4 const mul2 = _mm_mul_ps(col[2], _mm_set1_ps(in[i].z));
+				glm_vec4 const res0 = _mm_add_ps(_mm_add_ps(mul0, mul1), _mm_add_ps(mul2, col[3]));
+
+				// Three floats written, so that out[i + 1] isn't touched before in[i + 1] is read
+				_mm_storel_pi(reinterpret_cast<__m64*>(&out[i].x), res0);
+				_mm_store_ss(&out[i].z, _mm_movehl_ps(res0, res0));
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,113 @@
+/// @ref gtx_batch
+/// @file glm/gtx/batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch GLM_GTX_batch
+/// @ingroup gtx
+///
+/// @brief Transforms, products and normalizations over whole arrays of vectors and matrices.
+///
+/// Arrays are passed as a pointer and an element count. Vectors can be an array of vec3/vec4
+/// (AoS) or one float array per component (SoA). With float data the work is spread over SIMD
+/// lanes, any alignment is accepted and the elements left over at either end are handled
+/// internally. Other types and the aligned_* precisions take a scalar path.
+///
+/// Outputs of at least GLM_BATCH_STREAM_THRESHOLD bytes, 32 MiB by default, are written with
+/// non-temporal stores: they wouldn't stay in the last level cache anyway, and going around it
+/// doesn't evict everything else. Define it before including this file to change it, for
+/// instance to the cache size of a known target, or 0 to always stream.
+///
+/// An output may be the same array as an input, but the two may not partially overlap.
+///
+/// <glm/gtx/batch.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_batch extension included")
+#endif
+
+#ifndef GLM_BATCH_STREAM_THRESHOLD
+#	define GLM_BATCH_STREAM_THRESHOLD (32 << 20)
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch
+	/// @{
+
+	/// out[i] = (m * vec4(in[i], 1)).xyz, divided by w unless the bottom row of m is (0, 0, 0, 1).
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count);
+
+	/// transformPoints on SoA data, one array per component.
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ, std::size_t count);
+
+	/// out[i] = (m * vec4(in[i], 0)).xyz: directions, which the translation doesn't apply to.
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformVectors(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count);
+
+	/// out[i] = m * in[i].
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformVectors(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count);
+
+	/// transformVectors on SoA data, one array per component.
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformVectors(tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ, std::size_t count);
+
+	/// out[i] = a[i] * b[i].
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void multiplyMatrices(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count);
+
+	/// out[i] = a * b[i], e.g. a parent transform applied to its children.
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void multiplyMatrices(tmat4x4<T, P> const & a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count);
+
+	/// out[i] = normalize(in[i]). Zero vectors give NaNs, as with normalize.
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void normalizeVectors(tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count);
+
+	/// out[i] = normalize(in[i]). Zero vectors give NaNs, as with normalize.
+	///
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void normalizeVectors(tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count);
+
+	/// normalizeVectors on SoA data, one array per component.
+	///
+	/// @see gtx_batch
+	template <typename T>
+	GLM_FUNC_DECL void normalizeVectors(
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch.inl"
@@ -0,0 +1,779 @@
+/// @ref gtx_batch
+/// @file glm/gtx/batch.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/matrix.h"
+#endif
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// The implicit fourth component of a transformed vec3, and whether the result is divided by its w
+	enum batch_w
+	{
+		batch_w0,		// vectors
+		batch_w1,		// points, affine matrix
+		batch_w1_div	// points, projective matrix
+	};
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool batch_is_affine(tmat4x4<T, P> const & m)
+	{
+		return m[0][3] == static_cast<T>(0) && m[1][3] == static_cast<T>(0) && m[2][3] == static_cast<T>(0) && m[3][3] == static_cast<T>(1);
+	}
+
+	// m is column major. The inputs are read before any output is written so that they can be the same
+	template <batch_w W, typename T>
+	GLM_FUNC_QUALIFIER void batch_transform_one(T const * m, T x, T y, T z, T & outX, T & outY, T & outZ)
+	{
+		T rx = m[0] * x + m[4] * y + m[8] * z;
+		T ry = m[1] * x + m[5] * y + m[9] * z;
+		T rz = m[2] * x + m[6] * y + m[10] * z;
+		if(W != batch_w0)
+		{
+			rx += m[12];
+			ry += m[13];
+			rz += m[14];
+		}
+		if(W == batch_w1_div)
+		{
+			T const InvW = static_cast<T>(1) / (m[3] * x + m[7] * y + m[11] * z + m[15]);
+			rx *= InvW;
+			ry *= InvW;
+			rz *= InvW;
+		}
+		outX = rx;
+		outY = ry;
+		outZ = rz;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_normalize_one(T x, T y, T z, T & outX, T & outY, T & outZ)
+	{
+		T const InvLength = static_cast<T>(1) / std::sqrt(x * x + y * y + z * z);
+		outX = x * InvLength;
+		outY = y * InvLength;
+		outZ = z * InvLength;
+	}
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_batch
+	{
+		template <batch_w W>
+		GLM_FUNC_QUALIFIER static void transform(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				batch_transform_one<W>(&m[0][0], in[i].x, in[i].y, in[i].z, out[i].x, out[i].y, out[i].z);
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(tmat4x4<T, P> const * a, std::size_t strideA, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = a[i * strideA] * b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::normalize(in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::normalize(in[i]);
+		}
+	};
+
+	template <typename T>
+	struct compute_batch_soa
+	{
+		template <batch_w W>
+		GLM_FUNC_QUALIFIER static void transform(T const * m,
+			T const * inX, T const * inY, T const * inZ,
+			T * outX, T * outY, T * outZ, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				batch_transform_one<W>(m, inX[i], inY[i], inZ[i], outX[i], outY[i], outZ[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(
+			T const * inX, T const * inY, T const * inZ,
+			T * outX, T * outY, T * outZ, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				batch_normalize_one(inX[i], inY[i], inZ[i], outX[i], outY[i], outZ[i]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The register holding Lanes floats, with the loads and constants that can't be overloaded on it.
+	// Templates take the lane count rather than the register type, whose attributes would be dropped
+	template <int Lanes>
+	struct batch_simd;
+
+	template <>
+	struct batch_simd<4>
+	{
+		typedef glm_vec4 type;
+		enum { lanes = 4 };
+
+		GLM_FUNC_QUALIFIER static glm_vec4 set1(float s)
+		{
+			return _mm_set1_ps(s);
+		}
+
+		GLM_FUNC_QUALIFIER static glm_vec4 load(float const * p)
+		{
+			return _mm_loadu_ps(p);
+		}
+
+		// split is where the upper 128-bit half's floats start, there is no upper half here
+		GLM_FUNC_QUALIFIER static glm_vec4 load(float const * p, std::size_t)
+		{
+			return _mm_loadu_ps(p);
+		}
+	};
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store(float * p, glm_vec4 v)
+	{
+		if(Stream)
+			_mm_stream_ps(p, v);
+		else
+			_mm_storeu_ps(p, v);
+	}
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store(float * p, std::size_t, glm_vec4 v)
+	{
+		batch_store<Stream>(p, v);
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec4 batch_add(glm_vec4 a, glm_vec4 b){return _mm_add_ps(a, b);}
+	GLM_FUNC_QUALIFIER glm_vec4 batch_mul(glm_vec4 a, glm_vec4 b){return _mm_mul_ps(a, b);}
+	GLM_FUNC_QUALIFIER glm_vec4 batch_div(glm_vec4 a, glm_vec4 b){return _mm_div_ps(a, b);}
+	GLM_FUNC_QUALIFIER glm_vec4 batch_sqrt(glm_vec4 a){return _mm_sqrt_ps(a);}
+	GLM_FUNC_QUALIFIER glm_vec4 batch_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c){return glm_vec4_fma(a, b, c);}
+	GLM_FUNC_QUALIFIER glm_vec4 batch_unpacklo(glm_vec4 a, glm_vec4 b){return _mm_unpacklo_ps(a, b);}
+	GLM_FUNC_QUALIFIER glm_vec4 batch_unpackhi(glm_vec4 a, glm_vec4 b){return _mm_unpackhi_ps(a, b);}
+
+	template <int Imm>
+	GLM_FUNC_QUALIFIER glm_vec4 batch_shuffle(glm_vec4 a, glm_vec4 b){return _mm_shuffle_ps(a, b, Imm);}
+
+	GLM_FUNC_QUALIFIER void batch_mat4_mul(glm_vec4 const a[4], glm_vec4 const b[4], glm_vec4 out[4])
+	{
+		glm_mat4_mul(a, b, out);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Two 128-bit halves side by side, shuffles and unpacks work within each half
+	template <>
+	struct batch_simd<8>
+	{
+		typedef __m256 type;
+		enum { lanes = 8 };
+
+		GLM_FUNC_QUALIFIER static __m256 set1(float s)
+		{
+			return _mm256_set1_ps(s);
+		}
+
+		GLM_FUNC_QUALIFIER static __m256 load(float const * p)
+		{
+			return _mm256_loadu_ps(p);
+		}
+
+		GLM_FUNC_QUALIFIER static __m256 load(float const * p, std::size_t split)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + split), 1);
+		}
+	};
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store(float * p, __m256 v)
+	{
+		if(Stream)
+			_mm256_stream_ps(p, v);
+		else
+			_mm256_storeu_ps(p, v);
+	}
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store(float * p, std::size_t split, __m256 v)
+	{
+		batch_store<Stream>(p, _mm256_castps256_ps128(v));
+		batch_store<Stream>(p + split, _mm256_extractf128_ps(v, 1));
+	}
+
+	GLM_FUNC_QUALIFIER __m256 batch_add(__m256 a, __m256 b){return _mm256_add_ps(a, b);}
+	GLM_FUNC_QUALIFIER __m256 batch_mul(__m256 a, __m256 b){return _mm256_mul_ps(a, b);}
+	GLM_FUNC_QUALIFIER __m256 batch_div(__m256 a, __m256 b){return _mm256_div_ps(a, b);}
+	GLM_FUNC_QUALIFIER __m256 batch_sqrt(__m256 a){return _mm256_sqrt_ps(a);}
+	GLM_FUNC_QUALIFIER __m256 batch_fma(__m256 a, __m256 b, __m256 c){return glm_vec4x2_fma(a, b, c);}
+	GLM_FUNC_QUALIFIER __m256 batch_unpacklo(__m256 a, __m256 b){return _mm256_unpacklo_ps(a, b);}
+	GLM_FUNC_QUALIFIER __m256 batch_unpackhi(__m256 a, __m256 b){return _mm256_unpackhi_ps(a, b);}
+
+	template <int Imm>
+	GLM_FUNC_QUALIFIER __m256 batch_shuffle(__m256 a, __m256 b){return _mm256_shuffle_ps(a, b, Imm);}
+
+	GLM_FUNC_QUALIFIER void batch_mat4_mul(__m256 const a[4], __m256 const b[4], __m256 out[4])
+	{
+		glm_mat4_mul_x2(a, b, out);
+	}
+
+	enum { batch_lanes = 8 };
+#	else
+	enum { batch_lanes = 4 };
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	GLM_FUNC_QUALIFIER bool batch_is_aligned(void const * p, std::size_t align)
+	{
+		return reinterpret_cast<std::size_t>(p) % align == 0;
+	}
+
+	// Four x y z points per 128-bit half, the upper half's 12 floats after the lower's, to one register per component
+	template <int Lanes>
+	GLM_FUNC_QUALIFIER void batch_load_xyz(float const * p, typename batch_simd<Lanes>::type & x, typename batch_simd<Lanes>::type & y, typename batch_simd<Lanes>::type & z)
+	{
+		typedef typename batch_simd<Lanes>::type V;
+
+		V const a = batch_simd<Lanes>::load(p + 0, 12);	// x0 y0 z0 x1
+		V const b = batch_simd<Lanes>::load(p + 4, 12);	// y1 z1 x2 y2
+		V const c = batch_simd<Lanes>::load(p + 8, 12);	// z2 x3 y3 z3
+
+		V const t = batch_shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(b, c);	// x2 y2 x3 y3
+		x = batch_shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(a, t);
+		V const u = batch_shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a, b);	// y0 y0 y1 y1
+		y = batch_shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(u, t);
+		V const v = batch_shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a, b);	// z0 z0 z1 z1
+		z = batch_shuffle<_MM_SHUFFLE(3, 0, 2, 0)>(v, c);
+	}
+
+	template <bool Stream, int Lanes>
+	GLM_FUNC_QUALIFIER void batch_store_xyz(float * p, typename batch_simd<Lanes>::type x, typename batch_simd<Lanes>::type y, typename batch_simd<Lanes>::type z)
+	{
+		typedef typename batch_simd<Lanes>::type V;
+
+		V const lo = batch_unpacklo(x, y);	// x0 y0 x1 y1
+		V const hi = batch_unpackhi(x, y);	// x2 y2 x3 y3
+
+		V const s = batch_shuffle<_MM_SHUFFLE(2, 2, 0, 0)>(z, lo);	// z0 z0 x1 x1
+		V const a = batch_shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(lo, s);
+		V const t = batch_shuffle<_MM_SHUFFLE(1, 1, 3, 3)>(lo, z);	// y1 y1 z1 z1
+		V const b = batch_shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(t, hi);
+		V const u = batch_shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(z, hi);	// z2 z2 x3 x3
+		V const v = batch_shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(hi, z);	// y3 y3 z3 z3
+		V const c = batch_shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(u, v);
+
+		batch_store<Stream>(p + 0, 12, a);
+		batch_store<Stream>(p + 4, 12, b);
+		batch_store<Stream>(p + 8, 12, c);
+	}
+
+	template <batch_w W, int Lanes>
+	struct batch_transform_op
+	{
+		typedef typename batch_simd<Lanes>::type V;
+
+		explicit batch_transform_op(float const * m) :
+			m(m)
+		{
+			for(int i = 0; i < 16; ++i)
+				c[i] = batch_simd<Lanes>::set1(m[i]);
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(float & x, float & y, float & z) const
+		{
+			batch_transform_one<W>(m, x, y, z, x, y, z);
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(V & x, V & y, V & z) const
+		{
+			V rx, ry, rz;
+			if(W == batch_w0)
+			{
+				rx = batch_mul(c[8], z);
+				ry = batch_mul(c[9], z);
+				rz = batch_mul(c[10], z);
+			}
+			else
+			{
+				rx = batch_fma(c[8], z, c[12]);
+				ry = batch_fma(c[9], z, c[13]);
+				rz = batch_fma(c[10], z, c[14]);
+			}
+			rx = batch_fma(c[0], x, batch_fma(c[4], y, rx));
+			ry = batch_fma(c[1], x, batch_fma(c[5], y, ry));
+			rz = batch_fma(c[2], x, batch_fma(c[6], y, rz));
+			if(W == batch_w1_div)
+			{
+				// One division per lane, shared by the three components
+				V const w = batch_fma(c[3], x, batch_fma(c[7], y, batch_fma(c[11], z, c[15])));
+				V const InvW = batch_div(batch_simd<Lanes>::set1(1.0f), w);
+				rx = batch_mul(rx, InvW);
+				ry = batch_mul(ry, InvW);
+				rz = batch_mul(rz, InvW);
+			}
+			x = rx;
+			y = ry;
+			z = rz;
+		}
+
+		float const * m;
+		V c[16];
+	};
+
+	template <int Lanes>
+	struct batch_normalize_op
+	{
+		typedef typename batch_simd<Lanes>::type V;
+
+		GLM_FUNC_QUALIFIER void operator()(float & x, float & y, float & z) const
+		{
+			batch_normalize_one(x, y, z, x, y, z);
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(V & x, V & y, V & z) const
+		{
+			V const Dot = batch_fma(x, x, batch_fma(y, y, batch_mul(z, z)));
+			V const InvLength = batch_div(batch_simd<Lanes>::set1(1.0f), batch_sqrt(Dot));
+			x = batch_mul(x, InvLength);
+			y = batch_mul(y, InvLength);
+			z = batch_mul(z, InvLength);
+		}
+	};
+
+	// The kernels below give batch_run the layout of their data: how many elements a
+	// register holds, the alignment their streaming stores need, and the scalar and
+	// SIMD loops over a range of elements
+
+	template <int Lanes, typename Op>
+	struct batch_xyz_soa
+	{
+		typedef typename batch_simd<Lanes>::type V;
+		enum { lanes = Lanes, align = sizeof(V), bytes = 3 * sizeof(float) };
+
+		batch_xyz_soa(Op const & op, float const * inX, float const * inY, float const * inZ, float * outX, float * outY, float * outZ) :
+			op(op), inX(inX), inY(inY), inZ(inZ), outX(outX), outY(outY), outZ(outZ)
+		{}
+
+		GLM_FUNC_QUALIFIER bool aligned(std::size_t i) const
+		{
+			return batch_is_aligned(outX + i, align) && batch_is_aligned(outY + i, align) && batch_is_aligned(outZ + i, align);
+		}
+
+		GLM_FUNC_QUALIFIER void scalar(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; ++i)
+			{
+				float x = inX[i], y = inY[i], z = inZ[i];
+				op(x, y, z);
+				outX[i] = x;
+				outY[i] = y;
+				outZ[i] = z;
+			}
+		}
+
+		template <bool Stream>
+		GLM_FUNC_QUALIFIER void simd(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; i += lanes)
+			{
+				V x = batch_simd<Lanes>::load(inX + i);
+				V y = batch_simd<Lanes>::load(inY + i);
+				V z = batch_simd<Lanes>::load(inZ + i);
+				op(x, y, z);
+				batch_store<Stream>(outX + i, x);
+				batch_store<Stream>(outY + i, y);
+				batch_store<Stream>(outZ + i, z);
+			}
+		}
+
+		Op const & op;
+		float const * inX;
+		float const * inY;
+		float const * inZ;
+		float * outX;
+		float * outY;
+		float * outZ;
+	};
+
+	template <int Lanes, typename Op>
+	struct batch_xyz_aos
+	{
+		// 256-bit registers are stored a 128-bit half at a time
+		typedef typename batch_simd<Lanes>::type V;
+		enum { lanes = Lanes, align = 16, bytes = 3 * sizeof(float) };
+
+		batch_xyz_aos(Op const & op, float const * in, float * out) :
+			op(op), in(in), out(out)
+		{}
+
+		GLM_FUNC_QUALIFIER bool aligned(std::size_t i) const
+		{
+			return batch_is_aligned(out + i * 3, align);
+		}
+
+		GLM_FUNC_QUALIFIER void scalar(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; ++i)
+			{
+				float x = in[i * 3 + 0], y = in[i * 3 + 1], z = in[i * 3 + 2];
+				op(x, y, z);
+				out[i * 3 + 0] = x;
+				out[i * 3 + 1] = y;
+				out[i * 3 + 2] = z;
+			}
+		}
+
+		template <bool Stream>
+		GLM_FUNC_QUALIFIER void simd(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; i += lanes)
+			{
+				V x, y, z;
+				batch_load_xyz<Lanes>(in + i * 3, x, y, z);
+				op(x, y, z);
+				batch_store_xyz<Stream, Lanes>(out + i * 3, x, y, z);
+			}
+		}
+
+		Op const & op;
+		float const * in;
+		float * out;
+	};
+
+	template <int Lanes>
+	struct batch_transform_xyzw
+	{
+		typedef typename batch_simd<Lanes>::type V;
+		enum { lanes = Lanes / 4, align = sizeof(V), bytes = 4 * sizeof(float) };
+
+		batch_transform_xyzw(float const * m, float const * in, float * out) :
+			m(m), in(in), out(out)
+		{
+			// Each column in both halves of a 256-bit register
+			for(int i = 0; i < 4; ++i)
+				c[i] = batch_simd<Lanes>::load(m + i * 4, 0);
+		}
+
+		GLM_FUNC_QUALIFIER bool aligned(std::size_t i) const
+		{
+			return batch_is_aligned(out + i * 4, align);
+		}
+
+		GLM_FUNC_QUALIFIER void scalar(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; ++i)
+			{
+				float const x = in[i * 4 + 0], y = in[i * 4 + 1], z = in[i * 4 + 2], w = in[i * 4 + 3];
+				for(int r = 0; r < 4; ++r)
+					out[i * 4 + r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+			}
+		}
+
+		// Same operations as glm_mat4_mul_vec4, on the one or two vectors of a register at a time
+		template <bool Stream>
+		GLM_FUNC_QUALIFIER void simd(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; i += lanes)
+			{
+				V const v = batch_simd<Lanes>::load(in + i * 4);
+				V const m0 = batch_mul(c[0], batch_shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(v, v));
+				V const m2 = batch_mul(c[2], batch_shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(v, v));
+				V const a0 = batch_fma(c[1], batch_shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(v, v), m0);
+				V const a1 = batch_fma(c[3], batch_shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(v, v), m2);
+				batch_store<Stream>(out + i * 4, batch_add(a0, a1));
+			}
+		}
+
+		float const * m;
+		float const * in;
+		float * out;
+		V c[4];
+	};
+
+	template <int Lanes>
+	struct batch_normalize_xyzw
+	{
+		typedef typename batch_simd<Lanes>::type V;
+		enum { lanes = Lanes, align = 16, bytes = 4 * sizeof(float) };
+
+		batch_normalize_xyzw(float const * in, float * out) :
+			in(in), out(out)
+		{}
+
+		GLM_FUNC_QUALIFIER bool aligned(std::size_t i) const
+		{
+			return batch_is_aligned(out + i * 4, align);
+		}
+
+		GLM_FUNC_QUALIFIER void scalar(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; ++i)
+			{
+				float const x = in[i * 4 + 0], y = in[i * 4 + 1], z = in[i * 4 + 2], w = in[i * 4 + 3];
+				float const InvLength = 1.0f / std::sqrt(x * x + y * y + z * z + w * w);
+				out[i * 4 + 0] = x * InvLength;
+				out[i * 4 + 1] = y * InvLength;
+				out[i * 4 + 2] = z * InvLength;
+				out[i * 4 + 3] = w * InvLength;
+			}
+		}
+
+		// Four vectors per 128-bit half, transposed to compute the lengths a component at a time
+		template <bool Stream>
+		GLM_FUNC_QUALIFIER void simd(std::size_t i, std::size_t end) const
+		{
+			for(; i < end; i += lanes)
+			{
+				float const * p = in + i * 4;
+				V const a = batch_simd<Lanes>::load(p + 0, 16);
+				V const b = batch_simd<Lanes>::load(p + 4, 16);
+				V const c = batch_simd<Lanes>::load(p + 8, 16);
+				V const d = batch_simd<Lanes>::load(p + 12, 16);
+
+				V const t0 = batch_unpacklo(a, b);
+				V const t1 = batch_unpacklo(c, d);
+				V const t2 = batch_unpackhi(a, b);
+				V const t3 = batch_unpackhi(c, d);
+				V const x = batch_shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+				V const y = batch_shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+				V const z = batch_shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+				V const w = batch_shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+
+				V const Dot = batch_fma(x, x, batch_fma(y, y, batch_fma(z, z, batch_mul(w, w))));
+				V const InvLength = batch_div(batch_simd<Lanes>::set1(1.0f), batch_sqrt(Dot));
+
+				float * q = out + i * 4;
+				batch_store<Stream>(q + 0, 16, batch_mul(a, batch_shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(InvLength, InvLength)));
+				batch_store<Stream>(q + 4, 16, batch_mul(b, batch_shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(InvLength, InvLength)));
+				batch_store<Stream>(q + 8, 16, batch_mul(c, batch_shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(InvLength, InvLength)));
+				batch_store<Stream>(q + 12, 16, batch_mul(d, batch_shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(InvLength, InvLength)));
+			}
+		}
+
+		float const * in;
+		float * out;
+	};
+
+	// Scalar elements until the output is aligned, whole registers, streamed if the output is
+	// big enough, then the scalar tail
+	template <typename Kernel>
+	GLM_FUNC_QUALIFIER void batch_run(Kernel const & kernel, std::size_t count)
+	{
+		std::size_t Head = 0;
+		while(Head < count && Head < Kernel::align / sizeof(float) && !kernel.aligned(Head))
+			++Head;
+		bool const Aligned = kernel.aligned(Head);
+		if(!Aligned)
+			Head = 0;
+		std::size_t const End = Head + (count - Head) / Kernel::lanes * Kernel::lanes;
+
+		kernel.scalar(0, Head);
+		if(Aligned && count * Kernel::bytes >= static_cast<std::size_t>(GLM_BATCH_STREAM_THRESHOLD))
+		{
+			kernel.template simd<true>(Head, End);
+			_mm_sfence();
+		}
+		else
+			kernel.template simd<false>(Head, End);
+		kernel.scalar(End, count);
+	}
+
+	// a[i * strideA] * b[i], so that a single matrix can be applied to a whole array with a stride of 0
+	template <bool Stream, int Lanes>
+	GLM_FUNC_QUALIFIER std::size_t batch_multiply_lanes(float const * a, std::size_t strideA, float const * b, float * out, std::size_t count)
+	{
+		typedef typename batch_simd<Lanes>::type V;
+		std::size_t const Matrices = Lanes / 4;
+		std::size_t i = 0;
+		for(; i + Matrices <= count; i += Matrices)
+		{
+			V x[4], y[4], r[4];
+			for(int c = 0; c < 4; ++c)
+			{
+				x[c] = batch_simd<Lanes>::load(a + i * strideA + c * 4, strideA);
+				y[c] = batch_simd<Lanes>::load(b + i * 16 + c * 4, 16);
+			}
+			batch_mat4_mul(x, y, r);
+			for(int c = 0; c < 4; ++c)
+				batch_store<Stream>(out + i * 16 + c * 4, 16, r[c]);
+		}
+		return i;
+	}
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_multiply(float const * a, std::size_t strideA, float const * b, float * out, std::size_t count)
+	{
+		std::size_t const i = batch_multiply_lanes<Stream, batch_lanes>(a, strideA, b, out, count);
+		// An odd matrix out when registers hold two
+		batch_multiply_lanes<Stream, 4>(a + i * strideA, strideA, b + i * 16, out + i * 16, count - i);
+	}
+
+	template <precision P>
+	struct compute_batch<float, P, false>
+	{
+		template <batch_w W>
+		GLM_FUNC_QUALIFIER static void transform(tmat4x4<float, P> const & m, tvec3<float, P> const * in, tvec3<float, P> * out, std::size_t count)
+		{
+			typedef batch_transform_op<W, batch_lanes> op_type;
+			op_type const Op(&m[0][0]);
+			batch_run(batch_xyz_aos<batch_lanes, op_type>(Op, reinterpret_cast<float const *>(in), reinterpret_cast<float *>(out)), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(tmat4x4<float, P> const & m, tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			batch_run(batch_transform_xyzw<batch_lanes>(&m[0][0], reinterpret_cast<float const *>(in), reinterpret_cast<float *>(out)), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(tmat4x4<float, P> const * a, std::size_t strideA, tmat4x4<float, P> const * b, tmat4x4<float, P> * out, std::size_t count)
+		{
+			float const * A = reinterpret_cast<float const *>(a);
+			float const * B = reinterpret_cast<float const *>(b);
+			float * Out = reinterpret_cast<float *>(out);
+			if(batch_is_aligned(out, 16) && count * sizeof(tmat4x4<float, P>) >= static_cast<std::size_t>(GLM_BATCH_STREAM_THRESHOLD))
+			{
+				batch_multiply<true>(A, strideA * 16, B, Out, count);
+				_mm_sfence();
+			}
+			else
+				batch_multiply<false>(A, strideA * 16, B, Out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(tvec3<float, P> const * in, tvec3<float, P> * out, std::size_t count)
+		{
+			typedef batch_normalize_op<batch_lanes> op_type;
+			op_type const Op = op_type();
+			batch_run(batch_xyz_aos<batch_lanes, op_type>(Op, reinterpret_cast<float const *>(in), reinterpret_cast<float *>(out)), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			batch_run(batch_normalize_xyzw<batch_lanes>(reinterpret_cast<float const *>(in), reinterpret_cast<float *>(out)), count);
+		}
+	};
+
+	template <>
+	struct compute_batch_soa<float>
+	{
+		template <batch_w W>
+		GLM_FUNC_QUALIFIER static void transform(float const * m,
+			float const * inX, float const * inY, float const * inZ,
+			float * outX, float * outY, float * outZ, std::size_t count)
+		{
+			typedef batch_transform_op<W, batch_lanes> op_type;
+			op_type const Op(m);
+			batch_run(batch_xyz_soa<batch_lanes, op_type>(Op, inX, inY, inZ, outX, outY, outZ), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(
+			float const * inX, float const * inY, float const * inZ,
+			float * outX, float * outY, float * outZ, std::size_t count)
+		{
+			typedef batch_normalize_op<batch_lanes> op_type;
+			op_type const Op = op_type();
+			batch_run(batch_xyz_soa<batch_lanes, op_type>(Op, inX, inY, inZ, outX, outY, outZ), count);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transformPoints' only accept floating-point inputs");
+
+		typedef detail::compute_batch<T, P, detail::is_aligned<P>::value> batch;
+		if(detail::batch_is_affine(m))
+			batch::template transform<detail::batch_w1>(m, in, out, count);
+		else
+			batch::template transform<detail::batch_w1_div>(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints(tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transformPoints' only accept floating-point inputs");
+
+		if(detail::batch_is_affine(m))
+			detail::compute_batch_soa<T>::template transform<detail::batch_w1>(&m[0][0], inX, inY, inZ, outX, outY, outZ, count);
+		else
+			detail::compute_batch_soa<T>::template transform<detail::batch_w1_div>(&m[0][0], inX, inY, inZ, outX, outY, outZ, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformVectors(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transformVectors' only accept floating-point inputs");
+
+		detail::compute_batch<T, P, detail::is_aligned<P>::value>::template transform<detail::batch_w0>(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformVectors(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transformVectors' only accept floating-point inputs");
+
+		detail::compute_batch<T, P, detail::is_aligned<P>::value>::transform(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformVectors(tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transformVectors' only accept floating-point inputs");
+
+		detail::compute_batch_soa<T>::template transform<detail::batch_w0>(&m[0][0], inX, inY, inZ, outX, outY, outZ, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void multiplyMatrices(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batch<T, P, detail::is_aligned<P>::value>::multiply(a, 1, b, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void multiplyMatrices(tmat4x4<T, P> const & a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batch<T, P, detail::is_aligned<P>::value>::multiply(&a, 0, b, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void normalizeVectors(tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalizeVectors' only accept floating-point inputs");
+
+		detail::compute_batch<T, P, detail::is_aligned<P>::value>::normalize(in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void normalizeVectors(tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalizeVectors' only accept floating-point inputs");
+
+		detail::compute_batch<T, P, detail::is_aligned<P>::value>::normalize(in, out, count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void normalizeVectors(
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalizeVectors' only accept floating-point inputs");
+
+		detail::compute_batch_soa<T>::normalize(inX, inY, inZ, outX, outY, outZ, count);
+	}
+}//namespace glm
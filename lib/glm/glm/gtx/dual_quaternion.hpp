@@ -12,6 +12,9 @@
 ///
 /// @brief Defines a templated dual-quaternion type and several dual-quaternion operations.
 ///
+/// With SSE2, the products, normalization, point transformation, conversions and blending of
+/// float dual quaternions run on SIMD lanes. The array functions take a pointer and an element count.
+///
 /// <glm/gtx/dual_quaternion.hpp> need to be included to use these functionalities.
 
 #pragma once
@@ -20,6 +23,7 @@
 #include "../glm.hpp"
 #include "../gtc/constants.hpp"
 #include "../gtc/quaternion.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTX_dual_quaternion extension included")
@@ -172,6 +176,49 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_DECL tdualquat<T, P> dualquat_cast(tmat3x4<T, P> const & x);
 
+	/// Converts a rigid 4 * 4 matrix, rotation and translation, to a dual quaternion.
+	/// Scaling and the bottom row are ignored.
+	///
+	/// @see gtx_dual_quaternion
+	template <typename T, precision P>
+	GLM_FUNC_DECL tdualquat<T, P> dualquat_cast(tmat4x4<T, P> const & x);
+
+	/// out[i] = dualquat_cast(in[i]), e.g. to convert a matrix palette.
+	///
+	/// @see gtx_dual_quaternion
+	template <typename T, precision P>
+	GLM_FUNC_DECL void dualquat_cast(tmat4x4<T, P> const * in, tdualquat<T, P> * out, std::size_t count);
+
+	/// out[i] = tdualquat(orientation[i], translation[i]).
+	///
+	/// @see gtx_dual_quaternion
+	template <typename T, precision P>
+	GLM_FUNC_DECL void dualquat_cast(tquat<T, P> const * orientation, tvec3<T, P> const * translation, tdualquat<T, P> * out, std::size_t count);
+
+	/// Dual quaternion linear blending (DLB) of count weighted dual quaternions, normalized.
+	/// Inputs whose real part is on the other side of the 4D sphere from the real part of q[0]
+	/// are negated first: q and -q are the same transformation, but would cancel each other.
+	/// count must be at least 1.
+	///
+	/// @see gtx_dual_quaternion
+	template <typename T, precision P>
+	GLM_FUNC_DECL tdualquat<T, P> linearBlend(tdualquat<T, P> const * q, T const * weights, std::size_t count);
+
+	/// linearBlend for count vertices with influences weighted joints each, as in skinning:
+	/// out[i] blends palette[joints[i * influences + j]] with weights[i * influences + j].
+	/// The joint indices can be of any integer type.
+	///
+	/// @see gtx_dual_quaternion
+	template <typename T, precision P, typename I>
+	GLM_FUNC_DECL void linearBlend(tdualquat<T, P> const * palette, I const * joints, T const * weights, std::size_t influences, tdualquat<T, P> * out, std::size_t count);
+
+	/// out[i] = q * in[i]. q is converted once to a matrix, which is cheaper per point than the
+	/// dual quaternion product. in and out may be the same array.
+	///
+	/// @see gtx_dual_quaternion
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(tdualquat<T, P> const & q, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count);
+
 
 	/// Dual-quaternion of low single-precision floating-point numbers.
 	///
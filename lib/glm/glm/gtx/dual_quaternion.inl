@@ -4,8 +4,91 @@
 #include "../geometric.hpp"
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <typename T, precision P, bool Aligned>
+	struct compute_dualquat_mul
+	{
+		GLM_FUNC_QUALIFIER static tdualquat<T, P> call(tdualquat<T, P> const & p, tdualquat<T, P> const & o)
+		{
+			return tdualquat<T, P>(p.real * o.real, p.real * o.dual + p.dual * o.real);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_dualquat_mul_vec3
+	{
+		GLM_FUNC_QUALIFIER static tvec3<T, P> call(tdualquat<T, P> const & q, tvec3<T, P> const & v)
+		{
+			tvec3<T, P> const real_v3(q.real.x,q.real.y,q.real.z);
+			tvec3<T, P> const dual_v3(q.dual.x,q.dual.y,q.dual.z);
+			return (cross(real_v3, cross(real_v3,v) + v * q.real.w + dual_v3) + dual_v3 * q.real.w - real_v3 * q.dual.w) * T(2) + v;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_dualquat_normalize
+	{
+		GLM_FUNC_QUALIFIER static tdualquat<T, P> call(tdualquat<T, P> const & q)
+		{
+			return q / length(q.real);
+		}
+	};
+
+	// The dual part is half the translation as a pure quaternion times the orientation
+	template <typename T, precision P, bool Aligned>
+	struct compute_dualquat_from_rt
+	{
+		GLM_FUNC_QUALIFIER static tdualquat<T, P> call(tquat<T, P> const & q, tvec3<T, P> const & p)
+		{
+			return tdualquat<T, P>(q, p);
+		}
+	};
+
+	// Maps i to i, for blending an array without a palette
+	struct dualquat_identity_index
+	{
+		GLM_FUNC_QUALIFIER std::size_t operator[](std::size_t i) const{return i;}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_dualquat_blend
+	{
+		template <typename J>
+		GLM_FUNC_QUALIFIER static tdualquat<T, P> call(tdualquat<T, P> const * palette, J const & joints, T const * weights, std::size_t count)
+		{
+			assert(count > 0);
+			tquat<T, P> const & pivot = palette[joints[0]].real;
+			tquat<T, P> real = pivot * weights[0];
+			tquat<T, P> dual = palette[joints[0]].dual * weights[0];
+			for(std::size_t i = 1; i < count; ++i)
+			{
+				tdualquat<T, P> const & q = palette[joints[i]];
+				T const w = dot(pivot, q.real) < static_cast<T>(0) ? -weights[i] : weights[i];
+				real = real + q.real * w;
+				dual = dual + q.dual * w;
+			}
+			return compute_dualquat_normalize<T, P, Aligned>::call(tdualquat<T, P>(real, dual));
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_dualquat_transform_points
+	{
+		GLM_FUNC_QUALIFIER static void call(tdualquat<T, P> const & q, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+		{
+			// Rows of the rigid transformation, the translation in w
+			tmat3x4<T, P> const m = mat3x4_cast(q);
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tvec4<T, P> const v(in[i], static_cast<T>(1));
+				out[i] = tvec3<T, P>(dot(m[0], v), dot(m[1], v), dot(m[2], v));
+			}
+		}
+	};
+}//namespace detail
+
 	// -- Component accesses --
 
 	template <typename T, precision P>
@@ -159,15 +242,13 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tdualquat<T, P> operator*(tdualquat<T, P> const & p, tdualquat<T, P> const & o)
 	{
-		return tdualquat<T, P>(p.real * o.real,p.real * o.dual + p.dual * o.real);
+		return detail::compute_dualquat_mul<T, P, detail::is_aligned<P>::value>::call(p, o);
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tdualquat<T, P> const & q, tvec3<T, P> const & v)
 	{
-		tvec3<T, P> const real_v3(q.real.x,q.real.y,q.real.z);
-		tvec3<T, P> const dual_v3(q.dual.x,q.dual.y,q.dual.z);
-		return (cross(real_v3, cross(real_v3,v) + v * q.real.w + dual_v3) + dual_v3 * q.real.w - real_v3 * q.dual.w) * T(2) + v;
+		return detail::compute_dualquat_mul_vec3<T, P, detail::is_aligned<P>::value>::call(q, v);
 	}
 
 	template <typename T, precision P>
@@ -225,7 +306,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tdualquat<T, P> normalize(tdualquat<T, P> const & q)
 	{
-		return q / length(q.real);
+		return detail::compute_dualquat_normalize<T, P, detail::is_aligned<P>::value>::call(q);
 	}
 
 	template <typename T, precision P>
@@ -257,7 +338,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat3x4<T, P> mat3x4_cast(tdualquat<T, P> const & x)
 	{
-		tquat<T, P> r = x.real / length2(x.real);
+		tquat<T, P> r = x.real / dot(x.real, x.real);
 		
 		tquat<T, P> const rr(r.w * x.real.w, r.x * x.real.x, r.y * x.real.y, r.z * x.real.z);
 		r *= static_cast<T>(2);
@@ -348,4 +429,47 @@ namespace glm
 		dual.w = -static_cast<T>(0.5) * ( x[0].w * real.x + x[1].w * real.y + x[2].w * real.z);
 		return tdualquat<T, P>(real, dual);
 	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tdualquat<T, P> dualquat_cast(tmat4x4<T, P> const & x)
+	{
+		return detail::compute_dualquat_from_rt<T, P, detail::is_aligned<P>::value>::call(quat_cast(x), tvec3<T, P>(x[3]));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void dualquat_cast(tmat4x4<T, P> const * in, tdualquat<T, P> * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = dualquat_cast(in[i]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void dualquat_cast(tquat<T, P> const * orientation, tvec3<T, P> const * translation, tdualquat<T, P> * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::compute_dualquat_from_rt<T, P, detail::is_aligned<P>::value>::call(orientation[i], translation[i]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tdualquat<T, P> linearBlend(tdualquat<T, P> const * q, T const * weights, std::size_t count)
+	{
+		return detail::compute_dualquat_blend<T, P, detail::is_aligned<P>::value>::call(q, detail::dualquat_identity_index(), weights, count);
+	}
+
+	template <typename T, precision P, typename I>
+	GLM_FUNC_QUALIFIER void linearBlend(tdualquat<T, P> const * palette, I const * joints, T const * weights, std::size_t influences, tdualquat<T, P> * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::compute_dualquat_blend<T, P, detail::is_aligned<P>::value>::call(palette, joints + i * influences, weights + i * influences, influences);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints(tdualquat<T, P> const & q, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+	{
+		detail::compute_dualquat_transform_points<T, P, detail::is_aligned<P>::value>::call(q, in, out, count);
+	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "dual_quaternion_simd.inl"
+#endif
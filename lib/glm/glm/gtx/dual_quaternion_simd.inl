@@ -0,0 +1,163 @@
+/// @ref gtx_dual_quaternion
+/// @file glm/gtx/dual_quaternion_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/geometric.h"
+
+namespace glm{
+namespace detail
+{
+	// Hamilton product of two xyzw quaternions:
+	// p * q = p.w * q + p.x * (q.w, -q.z, q.y, -q.x) + p.y * (q.z, q.w, -q.x, -q.y) + p.z * (-q.y, q.x, q.w, -q.z)
+	GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mul(glm_vec4 p, glm_vec4 q)
+	{
+		glm_vec4 const mul0 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), q);
+		glm_vec4 const mul1 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)),
+			_mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+		glm_vec4 const mul2 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)),
+			_mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+		glm_vec4 const mul3 = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)),
+			_mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+		return _mm_add_ps(_mm_add_ps(mul0, mul1), _mm_add_ps(mul2, mul3));
+	}
+
+	// Divides both parts by the length of the real part, broadcast in every lane
+	GLM_FUNC_QUALIFIER void glm_dualquat_normalize(glm_vec4 & real, glm_vec4 & dual)
+	{
+		glm_vec4 const len = _mm_sqrt_ps(glm_vec4_dot(real, real));
+		real = _mm_div_ps(real, len);
+		dual = _mm_div_ps(dual, len);
+	}
+
+	template <precision P, bool Aligned>
+	struct compute_dualquat_mul<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tdualquat<float, P> call(tdualquat<float, P> const & p, tdualquat<float, P> const & o)
+		{
+			glm_vec4 const p_real = quat_simd_storage<Aligned>::load(p.real);
+			glm_vec4 const o_real = quat_simd_storage<Aligned>::load(o.real);
+
+			tdualquat<float, P> Result(uninitialize);
+			quat_simd_storage<Aligned>::store(Result.real, glm_quat_mul(p_real, o_real));
+			quat_simd_storage<Aligned>::store(Result.dual, _mm_add_ps(
+				glm_quat_mul(p_real, quat_simd_storage<Aligned>::load(o.dual)),
+				glm_quat_mul(quat_simd_storage<Aligned>::load(p.dual), o_real)));
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_dualquat_mul_vec3<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tdualquat<float, P> const & q, tvec3<float, P> const & v)
+		{
+			glm_vec4 const real = quat_simd_storage<Aligned>::load(q.real);
+			glm_vec4 const dual = quat_simd_storage<Aligned>::load(q.dual);
+			glm_vec4 const v0 = _mm_setr_ps(v.x, v.y, v.z, 0.0f);
+			glm_vec4 const real_w = _mm_shuffle_ps(real, real, _MM_SHUFFLE(3, 3, 3, 3));
+			glm_vec4 const dual_w = _mm_shuffle_ps(dual, dual, _MM_SHUFFLE(3, 3, 3, 3));
+
+			// The w lanes hold garbage from here, they are dropped at the end
+			glm_vec4 const inner = _mm_add_ps(_mm_add_ps(glm_vec4_cross(real, v0), _mm_mul_ps(v0, real_w)), dual);
+			glm_vec4 const outer = _mm_sub_ps(_mm_add_ps(glm_vec4_cross(real, inner), _mm_mul_ps(dual, real_w)), _mm_mul_ps(real, dual_w));
+			glm_vec4 const res0 = _mm_add_ps(_mm_mul_ps(outer, _mm_set1_ps(2.0f)), v0);
+
+			float Result[4];
+			_mm_storeu_ps(Result, res0);
+			return tvec3<float, P>(Result[0], Result[1], Result[2]);
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_dualquat_normalize<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tdualquat<float, P> call(tdualquat<float, P> const & q)
+		{
+			glm_vec4 real = quat_simd_storage<Aligned>::load(q.real);
+			glm_vec4 dual = quat_simd_storage<Aligned>::load(q.dual);
+			glm_dualquat_normalize(real, dual);
+
+			tdualquat<float, P> Result(uninitialize);
+			quat_simd_storage<Aligned>::store(Result.real, real);
+			quat_simd_storage<Aligned>::store(Result.dual, dual);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_dualquat_from_rt<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tdualquat<float, P> call(tquat<float, P> const & q, tvec3<float, P> const & p)
+		{
+			glm_vec4 const real = quat_simd_storage<Aligned>::load(q);
+			glm_vec4 const half = _mm_setr_ps(p.x * 0.5f, p.y * 0.5f, p.z * 0.5f, 0.0f);
+
+			tdualquat<float, P> Result(uninitialize);
+			quat_simd_storage<Aligned>::store(Result.real, real);
+			quat_simd_storage<Aligned>::store(Result.dual, glm_quat_mul(half, real));
+			return Result;
+		}
+	};
+
+	// The sign of each weight comes from a compare of the dot product, without a branch
+	template <precision P, bool Aligned>
+	struct compute_dualquat_blend<float, P, Aligned>
+	{
+		template <typename J>
+		GLM_FUNC_QUALIFIER static tdualquat<float, P> call(tdualquat<float, P> const * palette, J const & joints, float const * weights, std::size_t count)
+		{
+			assert(count > 0);
+			glm_vec4 const zero = _mm_setzero_ps();
+			glm_vec4 const neg = _mm_set1_ps(-0.0f);
+			glm_vec4 const pivot = quat_simd_storage<Aligned>::load(palette[joints[0]].real);
+
+			glm_vec4 real = _mm_mul_ps(pivot, _mm_set1_ps(weights[0]));
+			glm_vec4 dual = _mm_mul_ps(quat_simd_storage<Aligned>::load(palette[joints[0]].dual), _mm_set1_ps(weights[0]));
+			for(std::size_t i = 1; i < count; ++i)
+			{
+				tdualquat<float, P> const & q = palette[joints[i]];
+				glm_vec4 const q_real = quat_simd_storage<Aligned>::load(q.real);
+				glm_vec4 const sign = _mm_and_ps(_mm_cmplt_ps(glm_vec4_dot(pivot, q_real), zero), neg);
+				glm_vec4 const w = _mm_xor_ps(_mm_set1_ps(weights[i]), sign);
+				real = _mm_add_ps(real, _mm_mul_ps(q_real, w));
+				dual = _mm_add_ps(dual, _mm_mul_ps(quat_simd_storage<Aligned>::load(q.dual), w));
+			}
+			glm_dualquat_normalize(real, dual);
+
+			tdualquat<float, P> Result(uninitialize);
+			quat_simd_storage<Aligned>::store(Result.real, real);
+			quat_simd_storage<Aligned>::store(Result.dual, dual);
+			return Result;
+		}
+	};
+
+	template <precision P, bool Aligned>
+	struct compute_dualquat_transform_points<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static void call(tdualquat<float, P> const & q, tvec3<float, P> const * in, tvec3<float, P> * out, std::size_t count)
+		{
+			// mat3x4_cast gives rows, transposed into the columns of a 3 * 4 matrix
+			tmat3x4<float, P> const m = mat3x4_cast(q);
+			glm_vec4 const col0 = _mm_setr_ps(m[0].x, m[1].x, m[2].x, 0.0f);
+			glm_vec4 const col1 = _mm_setr_ps(m[0].y, m[1].y, m[2].y, 0.0f);
+			glm_vec4 const col2 = _mm_setr_ps(m[0].z, m[1].z, m[2].z, 0.0f);
+			glm_vec4 const col3 = _mm_setr_ps(m[0].w, m[1].w, m[2].w, 0.0f);
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				glm_vec4 const mul0 = _mm_mul_ps(col0, _mm_set1_ps(in[i].x));
+				glm_vec4 const mul1 = _mm_mul_ps(col1, _mm_set1_ps(in[i].y));
+				glm_vec4 const mul2 = _mm_mul_ps(col2, _mm_set1_ps(in[i].z));
+				glm_vec4 const res0 = _mm_add_ps(_mm_add_ps(mul0, mul1), _mm_add_ps(mul2, col3));
+
+				// Three floats written, so that out[i + 1] isn't touched before in[i + 1] is read
+				_mm_storel_pi(reinterpret_cast<__m64*>(&out[i].x), res0);
+				_mm_store_ss(&out[i].z, _mm_movehl_ps(res0, res0));
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
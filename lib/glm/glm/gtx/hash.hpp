@@ -6,13 +6,18 @@
 /// @defgroup gtx_hash GLM_GTX_hash
 /// @ingroup gtx
 /// 
-/// @brief Add std::hash support for glm types
+/// @brief Add std::hash support for glm types, fast hashing of values and arrays and spatial grid hashing
+/// 
+/// Values are hashed from the bits of their components, with -0.0 hashed as 0.0 and every NaN as the same NaN,
+/// through 64 bits multiply and xorshift rounds, two float components per round, and a murmur3 finalizer.
+/// Equal values always hash equal; the hashes are the same on every platform but not guaranteed across GLM versions.
 /// 
 /// <glm/gtx/hash.hpp> need to be included to use these functionalities.
 
 #pragma once
 
 #include <functional>
+#include <cstddef>
 
 #include "../vec2.hpp"
 #include "../vec3.hpp"
@@ -38,6 +43,51 @@
 #	error "GLM_GTX_hash requires C++11 standard library support"
 #endif
 
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_hash extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_hash
+	/// @{
+
+	/// Hash of a scalar. Seed chains hashes: hashValue(b, hashValue(a)) hashes the pair a, b.
+	/// @see gtx_hash
+	template <typename genType>
+	GLM_FUNC_DECL uint64 hashValue(genType x, uint64 Seed = 0);
+
+	/// Hash of a vector, quaternion, dual quaternion or matrix, from its components in order: x, y, z, w or columns.
+	/// @see gtx_hash
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL uint64 hashValue(vecType<T, P> const & x, uint64 Seed = 0);
+
+	/// Hash of each of Count values: Out[i] = hashValue(In[i], Seed).
+	/// @see gtx_hash
+	template <typename genType>
+	GLM_FUNC_DECL void hashValue(genType const * In, uint64 * Out, std::size_t Count, uint64 Seed = 0);
+
+	/// Hash of the content of an array of Count scalars, vectors, quaternions or matrices, to tell buffers apart.
+	/// Long arrays go through four independent rounds at once.
+	/// @see gtx_hash
+	template <typename genType>
+	GLM_FUNC_DECL uint64 hashRange(genType const * Data, std::size_t Count, uint64 Seed = 0);
+
+	/// The cell of a grid of CellSize sided cells, with the cell 0 at [0, CellSize), that contains Position.
+	/// Positions closer than CellSize are in the same cell or in adjacent ones, which is how
+	/// vertex welding and neighborhood queries look up close points.
+	/// @see gtx_hash
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<int, P> gridCell(vecType<T, P> const & Position, T CellSize);
+
+	/// Hash of the grid cell that contains Position, for spatial hash maps: hashValue(gridCell(Position, CellSize), Seed).
+	/// @see gtx_hash
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL uint64 gridHash(vecType<T, P> const & Position, T CellSize, uint64 Seed = 0);
+
+	/// @}
+}//namespace glm
+
 namespace std
 {
 	template <typename T, glm::precision P>
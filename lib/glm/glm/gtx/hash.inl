@@ -10,176 +10,298 @@
 ///
 /// <glm/gtx/hash.inl> need to be included to use these functionalities.
 
-namespace glm {
+#include "../common.hpp"
+#include <cstring>
+#include <limits>
+
+namespace glm{
 namespace detail
 {
-	GLM_INLINE void hash_combine(size_t &seed, size_t hash)
+	// Component bits hashed: -0.0 as 0.0, every NaN as the default quiet NaN. Integers and floats
+	// up to 32 bits give 32 bits, 64 bits types give 64 bits.
+	template <typename T, bool isFloat = std::numeric_limits<T>::is_iec559, bool is64 = sizeof(T) == 8>
+	struct compute_hash_bits
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static uint32 call(T x)
+		{
+			return static_cast<uint32>(x);
+		}
+	};
+
+	template <typename T>
+	struct compute_hash_bits<T, false, true>
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			return static_cast<uint64>(x);
+		}
+	};
+
+	template <>
+	struct compute_hash_bits<float, true, false>
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static uint32 call(float x)
+		{
+			uint32 Bits;
+			std::memcpy(&Bits, &x, sizeof(Bits));
+			Bits = x == 0.0f ? 0u : Bits;
+			return x != x ? 0x7fc00000u : Bits;
+		}
+	};
+
+	template <typename T>
+	struct compute_hash_bits<T, true, true>
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			uint64 Bits;
+			std::memcpy(&Bits, &x, sizeof(Bits));
+			Bits = x == static_cast<T>(0) ? 0ull : Bits;
+			return x != x ? 0x7ff8000000000000ull : Bits;
+		}
+	};
+
+	// Wider floats, long double, hash as double
+	template <typename T>
+	struct compute_hash_bits<T, true, false>
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			return compute_hash_bits<double>::call(static_cast<double>(x));
+		}
+	};
+
+	GLM_FUNC_QUALIFIER uint64 hash_round(uint64 h, uint64 w)
+	{
+		h = (h ^ w) * 0xbf58476d1ce4e5b9ull;
+		return h ^ (h >> 31);
+	}
+
+	// The murmur3 finalizer: every bit of the result depends on every bit of h
+	GLM_FUNC_QUALIFIER uint64 hash_fmix(uint64 h)
+	{
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		return h ^ (h >> 33);
+	}
+
+	// Components go in 64 bits words, two 32 bits components per word. With a fixed number of
+	// components, the compiler resolves the pairing at compile time.
+	struct hash_state
+	{
+		uint64 Hash;
+		uint64 Half;
+		uint64 Bytes;
+
+		GLM_FUNC_QUALIFIER explicit hash_state(uint64 Seed) :
+			Hash(Seed ^ 0x9e3779b97f4a7c15ull), Half(0), Bytes(0)
+		{}
+
+		GLM_FUNC_QUALIFIER void add(uint32 x)
+		{
+			if(Bytes & 4)
+				Hash = hash_round(Hash, Half | (static_cast<uint64>(x) << 32));
+			else
+				Half = x;
+			Bytes += 4;
+		}
+
+		GLM_FUNC_QUALIFIER void add(uint64 x)
+		{
+			if(Bytes & 4)
+			{
+				Hash = hash_round(Hash, Half);
+				Bytes += 4;
+			}
+			Hash = hash_round(Hash, x);
+			Bytes += 8;
+		}
+
+		GLM_FUNC_QUALIFIER uint64 result() const
+		{
+			uint64 const h = Bytes & 4 ? hash_round(Hash, Half) : Hash;
+			return hash_fmix(h ^ Bytes);
+		}
+	};
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void hash_add(hash_state & State, genType x)
+	{
+		State.add(compute_hash_bits<genType>::call(x));
+	}
+
+	// Vectors and quaternions give their components, matrices and dual quaternions their columns and parts
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void hash_add(hash_state & State, vecType<T, P> const & x)
+	{
+		for(length_t i = 0; i < x.length(); ++i)
+			hash_add(State, x[i]);
+	}
+}//namespace detail
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER uint64 hashValue(genType x, uint64 Seed)
+	{
+		detail::hash_state State(Seed);
+		detail::hash_add(State, x);
+		return State.result();
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER uint64 hashValue(vecType<T, P> const & x, uint64 Seed)
+	{
+		detail::hash_state State(Seed);
+		detail::hash_add(State, x);
+		return State.result();
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void hashValue(genType const * In, uint64 * Out, std::size_t Count, uint64 Seed)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = hashValue(In[i], Seed);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER uint64 hashRange(genType const * Data, std::size_t Count, uint64 Seed)
+	{
+		detail::hash_state State0(Seed);
+		detail::hash_state State1(Seed + 1);
+		detail::hash_state State2(Seed + 2);
+		detail::hash_state State3(Seed + 3);
+
+		std::size_t i = 0;
+		for(std::size_t const Count4 = Count & ~static_cast<std::size_t>(3); i < Count4; i += 4)
+		{
+			detail::hash_add(State0, Data[i + 0]);
+			detail::hash_add(State1, Data[i + 1]);
+			detail::hash_add(State2, Data[i + 2]);
+			detail::hash_add(State3, Data[i + 3]);
+		}
+		for(; i < Count; ++i)
+			detail::hash_add(State0, Data[i]);
+
+		detail::hash_state State(State0.result());
+		State.add(State1.result());
+		State.add(State2.result());
+		State.add(State3.result());
+		return State.result();
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<int, P> gridCell(vecType<T, P> const & Position, T CellSize)
+	{
+		return vecType<int, P>(floor(Position / CellSize));
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER uint64 gridHash(vecType<T, P> const & Position, T CellSize, uint64 Seed)
 	{
-		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		seed ^= hash;
+		return hashValue(gridCell(Position, CellSize), Seed);
 	}
-}}
+}//namespace glm
 
 namespace std
 {
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec1<T, P>>::operator()(glm::tvec1<T, P> const & v) const
 	{
-		hash<T> hasher;
-		return hasher(v.x);
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec2<T, P>>::operator()(glm::tvec2<T, P> const & v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec3<T, P>>::operator()(glm::tvec3<T, P> const & v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec4<T, P>>::operator()(glm::tvec4<T, P> const & v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		glm::detail::hash_combine(seed, hasher(v.w));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tquat<T, P>>::operator()(glm::tquat<T,P> const & q) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(q.x));
-		glm::detail::hash_combine(seed, hasher(q.y));
-		glm::detail::hash_combine(seed, hasher(q.z));
-		glm::detail::hash_combine(seed, hasher(q.w));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(q));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tdualquat<T, P>>::operator()(glm::tdualquat<T, P> const & q) const
 	{
-		size_t seed = 0;
-		hash<glm::tquat<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(q.real));
-		glm::detail::hash_combine(seed, hasher(q.dual));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(q));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat2x2<T, P>>::operator()(glm::tmat2x2<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec2<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat2x3<T, P>>::operator()(glm::tmat2x3<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec3<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat2x4<T, P>>::operator()(glm::tmat2x4<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec4<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat3x2<T, P>>::operator()(glm::tmat3x2<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec2<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat3x3<T, P>>::operator()(glm::tmat3x3<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec3<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat3x4<T, P>>::operator()(glm::tmat3x4<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec4<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat4x2<T,P>>::operator()(glm::tmat4x2<T,P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec2<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat4x3<T,P>>::operator()(glm::tmat4x3<T,P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec3<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat4x4<T,P>>::operator()(glm::tmat4x4<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec4<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 }
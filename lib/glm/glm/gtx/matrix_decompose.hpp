@@ -19,6 +19,7 @@
 #include "../geometric.hpp"
 #include "../gtc/quaternion.hpp"
 #include "../gtc/matrix_transform.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTX_matrix_decompose extension included")
@@ -36,6 +37,23 @@ namespace glm
 		tmat4x4<T, P> const & modelMatrix,
 		tvec3<T, P> & scale, tquat<T, P> & orientation, tvec3<T, P> & translation, tvec3<T, P> & skew, tvec4<T, P> & perspective);
 
+	/// Decomposes an affine model matrix without shear to translations, rotation and scale components.
+	/// Skips the perspective and skew work of decompose: the bottom row of modelMatrix must be (0, 0, 0, 1)
+	/// and its scales non zero, otherwise the results are undefined.
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL void decomposeAffine(
+		tmat4x4<T, P> const & modelMatrix,
+		tvec3<T, P> & scale, tquat<T, P> & orientation, tvec3<T, P> & translation);
+
+	/// Decomposes count affine model matrices without shear, see decomposeAffine.
+	/// With SSE2, float matrices are decomposed 4 at a time, 8 at a time with AVX.
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL void decomposeAffine(
+		tmat4x4<T, P> const * modelMatrices,
+		tvec3<T, P> * scales, tquat<T, P> * orientations, tvec3<T, P> * translations, std::size_t count);
+
 	/// @}
 }//namespace glm
 
@@ -20,6 +20,62 @@ namespace detail
 	{
 		return v * desiredLength / length(v);
 	}
+
+	// Quaternion of the orthonormal matrix of columns Row[0], Row[1] and Row[2]
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> decompose_orientation(tvec3<T, P> const Row[3])
+	{
+		T s, t, x, y, z, w;
+
+		t = Row[0][0] + Row[1][1] + Row[2][2] + static_cast<T>(1);
+
+		// t is 4 * w * w: above 1, w is at least 0.5 and dividing by it is accurate. Otherwise the
+		// largest diagonal element gives a component at least as large
+		if(t > static_cast<T>(1))
+		{
+			s = static_cast<T>(0.5) / sqrt(t);
+			w = static_cast<T>(0.25) / s;
+			x = (Row[1][2] - Row[2][1]) * s;
+			y = (Row[2][0] - Row[0][2]) * s;
+			z = (Row[0][1] - Row[1][0]) * s;
+		}
+		else if(Row[0][0] > Row[1][1] && Row[0][0] > Row[2][2])
+		{ 
+			s = sqrt (static_cast<T>(1) + Row[0][0] - Row[1][1] - Row[2][2]) * static_cast<T>(2); // S=4*qx 
+			x = static_cast<T>(0.25) * s;
+			y = (Row[0][1] + Row[1][0]) / s; 
+			z = (Row[0][2] + Row[2][0]) / s; 
+			w = (Row[1][2] - Row[2][1]) / s;
+		}
+		else if(Row[1][1] > Row[2][2])
+		{ 
+			s = sqrt (static_cast<T>(1) + Row[1][1] - Row[0][0] - Row[2][2]) * static_cast<T>(2); // S=4*qy
+			x = (Row[0][1] + Row[1][0]) / s; 
+			y = static_cast<T>(0.25) * s;
+			z = (Row[1][2] + Row[2][1]) / s; 
+			w = (Row[2][0] - Row[0][2]) / s;
+		}
+		else
+		{ 
+			s = sqrt(static_cast<T>(1) + Row[2][2] - Row[0][0] - Row[1][1]) * static_cast<T>(2); // S=4*qz
+			x = (Row[0][2] + Row[2][0]) / s;
+			y = (Row[1][2] + Row[2][1]) / s; 
+			z = static_cast<T>(0.25) * s;
+			w = (Row[0][1] - Row[1][0]) / s;
+		}
+
+		return tquat<T, P>(w, x, y, z);
+	}
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_decompose_affine
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const * m, tvec3<T, P> * Scale, tquat<T, P> * Orientation, tvec3<T, P> * Translation, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				decomposeAffine(m[i], Scale[i], Orientation[i], Translation[i]);
+		}
+	};
 }//namespace detail
 
 	// Matrix decompose
@@ -147,48 +203,36 @@ namespace detail
 		//     ret.rotateZ = 0;
 		// }
 
-		T s, t, x, y, z, w;
+		Orientation = detail::decompose_orientation(Row);
 
-		t = Row[0][0] + Row[1][1] + Row[2][2] + static_cast<T>(1);
+		return true;
+	}
 
-		if(t > static_cast<T>(1e-4))
-		{
-			s = static_cast<T>(0.5) / sqrt(t);
-			w = static_cast<T>(0.25) / s;
-			x = (Row[2][1] - Row[1][2]) * s;
-			y = (Row[0][2] - Row[2][0]) * s;
-			z = (Row[1][0] - Row[0][1]) * s;
-		}
-		else if(Row[0][0] > Row[1][1] && Row[0][0] > Row[2][2])
-		{ 
-			s = sqrt (static_cast<T>(1) + Row[0][0] - Row[1][1] - Row[2][2]) * static_cast<T>(2); // S=4*qx 
-			x = static_cast<T>(0.25) * s;
-			y = (Row[0][1] + Row[1][0]) / s; 
-			z = (Row[0][2] + Row[2][0]) / s; 
-			w = (Row[2][1] - Row[1][2]) / s;
-		}
-		else if(Row[1][1] > Row[2][2])
-		{ 
-			s = sqrt (static_cast<T>(1) + Row[1][1] - Row[0][0] - Row[2][2]) * static_cast<T>(2); // S=4*qy
-			x = (Row[0][1] + Row[1][0]) / s; 
-			y = static_cast<T>(0.25) * s;
-			z = (Row[1][2] + Row[2][1]) / s; 
-			w = (Row[0][2] - Row[2][0]) / s;
-		}
-		else
-		{ 
-			s = sqrt(static_cast<T>(1) + Row[2][2] - Row[0][0] - Row[1][1]) * static_cast<T>(2); // S=4*qz
-			x = (Row[0][2] + Row[2][0]) / s;
-			y = (Row[1][2] + Row[2][1]) / s; 
-			z = static_cast<T>(0.25) * s;
-			w = (Row[1][0] - Row[0][1]) / s;
-		}
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void decomposeAffine(tmat4x4<T, P> const & ModelMatrix, tvec3<T, P> & Scale, tquat<T, P> & Orientation, tvec3<T, P> & Translation)
+	{
+		tvec3<T, P> Row[3] = {tvec3<T, P>(ModelMatrix[0]), tvec3<T, P>(ModelMatrix[1]), tvec3<T, P>(ModelMatrix[2])};
 
-		Orientation.x = x;
-		Orientation.y = y;
-		Orientation.z = z;
-		Orientation.w = w;
+		Scale = tvec3<T, P>(length(Row[0]), length(Row[1]), length(Row[2]));
 
-		return true;
+		// A coordinate system flip negates the scaling factors, as in decompose
+		if(dot(Row[0], cross(Row[1], Row[2])) < static_cast<T>(0))
+			Scale = -Scale;
+
+		for(length_t i = 0; i < 3; ++i)
+			Row[i] /= Scale[i];
+
+		Orientation = detail::decompose_orientation(Row);
+		Translation = tvec3<T, P>(ModelMatrix[3]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void decomposeAffine(tmat4x4<T, P> const * ModelMatrices, tvec3<T, P> * Scales, tquat<T, P> * Orientations, tvec3<T, P> * Translations, std::size_t Count)
+	{
+		detail::compute_decompose_affine<T, P, detail::is_aligned<P>::value>::call(ModelMatrices, Scales, Orientations, Translations, Count);
 	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "matrix_decompose_simd.inl"
+#endif
@@ -0,0 +1,200 @@
+/// @ref gtx_matrix_decompose
+/// @file glm/gtx/matrix_decompose_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// The matrices are processed in lanes: Row[i][j] holds the component j of the column i of one
+	// matrix per lane. The quaternion case of decompose_orientation is selected per lane and computed
+	// with a single square root: 4 times the largest component of the quaternion.
+
+	GLM_FUNC_QUALIFIER void glm_decompose_affine(glm_vec4 Row[3][3], glm_vec4 Scale[3], glm_vec4 Quat[4])
+	{
+		for(int i = 0; i < 3; ++i)
+			Scale[i] = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Row[i][0], Row[i][0]), _mm_mul_ps(Row[i][1], Row[i][1])), _mm_mul_ps(Row[i][2], Row[i][2])));
+
+		// dot(Row[0], cross(Row[1], Row[2])) < 0 flips the sign of the scales
+		glm_vec4 const Cross0 = _mm_sub_ps(_mm_mul_ps(Row[1][1], Row[2][2]), _mm_mul_ps(Row[2][1], Row[1][2]));
+		glm_vec4 const Cross1 = _mm_sub_ps(_mm_mul_ps(Row[1][2], Row[2][0]), _mm_mul_ps(Row[2][2], Row[1][0]));
+		glm_vec4 const Cross2 = _mm_sub_ps(_mm_mul_ps(Row[1][0], Row[2][1]), _mm_mul_ps(Row[2][0], Row[1][1]));
+		glm_vec4 const Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Row[0][0], Cross0), _mm_mul_ps(Row[0][1], Cross1)), _mm_mul_ps(Row[0][2], Cross2));
+		glm_vec4 const Sign = _mm_and_ps(_mm_cmplt_ps(Det, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+
+		for(int i = 0; i < 3; ++i)
+		{
+			Scale[i] = _mm_xor_ps(Scale[i], Sign);
+			for(int j = 0; j < 3; ++j)
+				Row[i][j] = _mm_div_ps(Row[i][j], Scale[i]);
+		}
+
+		glm_vec4 const One = _mm_set1_ps(1.0f);
+		glm_vec4 const Trace = _mm_add_ps(_mm_add_ps(_mm_add_ps(Row[0][0], Row[1][1]), Row[2][2]), One);
+		glm_vec4 const CaseW = _mm_cmpgt_ps(Trace, One);
+		glm_vec4 const CaseX = _mm_andnot_ps(CaseW, _mm_and_ps(_mm_cmpgt_ps(Row[0][0], Row[1][1]), _mm_cmpgt_ps(Row[0][0], Row[2][2])));
+		glm_vec4 const CaseY = _mm_andnot_ps(_mm_or_ps(CaseW, CaseX), _mm_cmpgt_ps(Row[1][1], Row[2][2]));
+
+		glm_vec4 const RadicandX = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(One, Row[0][0]), Row[1][1]), Row[2][2]);
+		glm_vec4 const RadicandY = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(One, Row[1][1]), Row[0][0]), Row[2][2]);
+		glm_vec4 const RadicandZ = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(One, Row[2][2]), Row[0][0]), Row[1][1]);
+		glm_vec4 const Radicand = glm_vec4_select(CaseW, Trace, glm_vec4_select(CaseX, RadicandX, glm_vec4_select(CaseY, RadicandY, RadicandZ)));
+
+		glm_vec4 const Largest4 = _mm_mul_ps(_mm_sqrt_ps(Radicand), _mm_set1_ps(2.0f));
+		glm_vec4 const Largest = _mm_mul_ps(Largest4, _mm_set1_ps(0.25f));
+		glm_vec4 const Inverse = _mm_div_ps(One, Largest4);
+
+		glm_vec4 const Sub12 = _mm_mul_ps(_mm_sub_ps(Row[1][2], Row[2][1]), Inverse);
+		glm_vec4 const Sub20 = _mm_mul_ps(_mm_sub_ps(Row[2][0], Row[0][2]), Inverse);
+		glm_vec4 const Sub01 = _mm_mul_ps(_mm_sub_ps(Row[0][1], Row[1][0]), Inverse);
+		glm_vec4 const Add01 = _mm_mul_ps(_mm_add_ps(Row[0][1], Row[1][0]), Inverse);
+		glm_vec4 const Add02 = _mm_mul_ps(_mm_add_ps(Row[0][2], Row[2][0]), Inverse);
+		glm_vec4 const Add12 = _mm_mul_ps(_mm_add_ps(Row[1][2], Row[2][1]), Inverse);
+
+		Quat[0] = glm_vec4_select(CaseW, Sub12, glm_vec4_select(CaseX, Largest, glm_vec4_select(CaseY, Add01, Add02)));
+		Quat[1] = glm_vec4_select(CaseW, Sub20, glm_vec4_select(CaseX, Add01, glm_vec4_select(CaseY, Largest, Add12)));
+		Quat[2] = glm_vec4_select(CaseW, Sub01, glm_vec4_select(CaseX, Add02, glm_vec4_select(CaseY, Add12, Largest)));
+		Quat[3] = glm_vec4_select(CaseW, Largest, glm_vec4_select(CaseX, Sub12, glm_vec4_select(CaseY, Sub20, Sub01)));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER void glm_decompose_affine(__m256 Row[3][3], __m256 Scale[3], __m256 Quat[4])
+	{
+		for(int i = 0; i < 3; ++i)
+			Scale[i] = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Row[i][0], Row[i][0]), _mm256_mul_ps(Row[i][1], Row[i][1])), _mm256_mul_ps(Row[i][2], Row[i][2])));
+
+		__m256 const Cross0 = _mm256_sub_ps(_mm256_mul_ps(Row[1][1], Row[2][2]), _mm256_mul_ps(Row[2][1], Row[1][2]));
+		__m256 const Cross1 = _mm256_sub_ps(_mm256_mul_ps(Row[1][2], Row[2][0]), _mm256_mul_ps(Row[2][2], Row[1][0]));
+		__m256 const Cross2 = _mm256_sub_ps(_mm256_mul_ps(Row[1][0], Row[2][1]), _mm256_mul_ps(Row[2][0], Row[1][1]));
+		__m256 const Det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Row[0][0], Cross0), _mm256_mul_ps(Row[0][1], Cross1)), _mm256_mul_ps(Row[0][2], Cross2));
+		__m256 const Sign = _mm256_and_ps(_mm256_cmp_ps(Det, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+
+		for(int i = 0; i < 3; ++i)
+		{
+			Scale[i] = _mm256_xor_ps(Scale[i], Sign);
+			for(int j = 0; j < 3; ++j)
+				Row[i][j] = _mm256_div_ps(Row[i][j], Scale[i]);
+		}
+
+		__m256 const One = _mm256_set1_ps(1.0f);
+		__m256 const Trace = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(Row[0][0], Row[1][1]), Row[2][2]), One);
+		__m256 const CaseW = _mm256_cmp_ps(Trace, One, _CMP_GT_OQ);
+		__m256 const CaseX = _mm256_andnot_ps(CaseW, _mm256_and_ps(_mm256_cmp_ps(Row[0][0], Row[1][1], _CMP_GT_OQ), _mm256_cmp_ps(Row[0][0], Row[2][2], _CMP_GT_OQ)));
+		__m256 const CaseY = _mm256_andnot_ps(_mm256_or_ps(CaseW, CaseX), _mm256_cmp_ps(Row[1][1], Row[2][2], _CMP_GT_OQ));
+
+		__m256 const RadicandX = _mm256_sub_ps(_mm256_sub_ps(_mm256_add_ps(One, Row[0][0]), Row[1][1]), Row[2][2]);
+		__m256 const RadicandY = _mm256_sub_ps(_mm256_sub_ps(_mm256_add_ps(One, Row[1][1]), Row[0][0]), Row[2][2]);
+		__m256 const RadicandZ = _mm256_sub_ps(_mm256_sub_ps(_mm256_add_ps(One, Row[2][2]), Row[0][0]), Row[1][1]);
+		__m256 const Radicand = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_blendv_ps(RadicandZ, RadicandY, CaseY), RadicandX, CaseX), Trace, CaseW);
+
+		__m256 const Largest4 = _mm256_mul_ps(_mm256_sqrt_ps(Radicand), _mm256_set1_ps(2.0f));
+		__m256 const Largest = _mm256_mul_ps(Largest4, _mm256_set1_ps(0.25f));
+		__m256 const Inverse = _mm256_div_ps(One, Largest4);
+
+		__m256 const Sub12 = _mm256_mul_ps(_mm256_sub_ps(Row[1][2], Row[2][1]), Inverse);
+		__m256 const Sub20 = _mm256_mul_ps(_mm256_sub_ps(Row[2][0], Row[0][2]), Inverse);
+		__m256 const Sub01 = _mm256_mul_ps(_mm256_sub_ps(Row[0][1], Row[1][0]), Inverse);
+		__m256 const Add01 = _mm256_mul_ps(_mm256_add_ps(Row[0][1], Row[1][0]), Inverse);
+		__m256 const Add02 = _mm256_mul_ps(_mm256_add_ps(Row[0][2], Row[2][0]), Inverse);
+		__m256 const Add12 = _mm256_mul_ps(_mm256_add_ps(Row[1][2], Row[2][1]), Inverse);
+
+		Quat[0] = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_blendv_ps(Add02, Add01, CaseY), Largest, CaseX), Sub12, CaseW);
+		Quat[1] = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_blendv_ps(Add12, Largest, CaseY), Add01, CaseX), Sub20, CaseW);
+		Quat[2] = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_blendv_ps(Largest, Add12, CaseY), Add02, CaseX), Sub01, CaseW);
+		Quat[3] = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_blendv_ps(Sub01, Sub20, CaseY), Sub12, CaseX), Largest, CaseW);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// Columns 0 to 2 of 4 matrices, transposed to one matrix per lane
+	template <precision P>
+	GLM_FUNC_QUALIFIER void glm_decompose_affine_load(tmat4x4<float, P> const * m, glm_vec4 Row[3][3])
+	{
+		for(length_t i = 0; i < 3; ++i)
+		{
+			glm_vec4 const Columns[4] = {_mm_loadu_ps(&m[0][i][0]), _mm_loadu_ps(&m[1][i][0]), _mm_loadu_ps(&m[2][i][0]), _mm_loadu_ps(&m[3][i][0])};
+			glm_vec4 Lanes[4];
+			glm_mat4_transpose(Columns, Lanes);
+			Row[i][0] = Lanes[0];
+			Row[i][1] = Lanes[1];
+			Row[i][2] = Lanes[2];
+		}
+	}
+
+	// Three floats written per vector, so that the element after the last one isn't touched
+	template <precision P>
+	GLM_FUNC_QUALIFIER void glm_decompose_affine_store(glm_vec4 const Scale[3], glm_vec4 const Quat[4], tmat4x4<float, P> const * m, tvec3<float, P> * s, tquat<float, P> * q, tvec3<float, P> * t)
+	{
+		glm_vec4 const ScaleLanes[4] = {Scale[0], Scale[1], Scale[2], _mm_setzero_ps()};
+		glm_vec4 Scales[4];
+		glm_mat4_transpose(ScaleLanes, Scales);
+
+		glm_vec4 Quats[4];
+		glm_mat4_transpose(Quat, Quats);
+
+		for(int i = 0; i < 4; ++i)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(&s[i].x), Scales[i]);
+			_mm_store_ss(&s[i].z, _mm_movehl_ps(Scales[i], Scales[i]));
+			_mm_storeu_ps(&q[i].x, Quats[i]);
+			t[i] = tvec3<float, P>(m[i][3]);
+		}
+	}
+
+	template <precision P, bool Aligned>
+	struct compute_decompose_affine<float, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const * m, tvec3<float, P> * Scale, tquat<float, P> * Orientation, tvec3<float, P> * Translation, std::size_t count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_vec4 Low[3][3], High[3][3];
+					glm_decompose_affine_load(m + i, Low);
+					glm_decompose_affine_load(m + i + 4, High);
+
+					__m256 Row[3][3];
+					for(int c = 0; c < 3; ++c)
+					for(int r = 0; r < 3; ++r)
+						Row[c][r] = _mm256_insertf128_ps(_mm256_castps128_ps256(Low[c][r]), High[c][r], 1);
+
+					__m256 Scales[3], Quats[4];
+					glm_decompose_affine(Row, Scales, Quats);
+
+					glm_vec4 ScaleLow[3], ScaleHigh[3], QuatLow[4], QuatHigh[4];
+					for(int c = 0; c < 3; ++c)
+					{
+						ScaleLow[c] = _mm256_castps256_ps128(Scales[c]);
+						ScaleHigh[c] = _mm256_extractf128_ps(Scales[c], 1);
+					}
+					for(int c = 0; c < 4; ++c)
+					{
+						QuatLow[c] = _mm256_castps256_ps128(Quats[c]);
+						QuatHigh[c] = _mm256_extractf128_ps(Quats[c], 1);
+					}
+					glm_decompose_affine_store(ScaleLow, QuatLow, m + i, Scale + i, Orientation + i, Translation + i);
+					glm_decompose_affine_store(ScaleHigh, QuatHigh, m + i + 4, Scale + i + 4, Orientation + i + 4, Translation + i + 4);
+				}
+#			endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 Row[3][3];
+				glm_decompose_affine_load(m + i, Row);
+
+				glm_vec4 Scales[3], Quats[4];
+				glm_decompose_affine(Row, Scales, Quats);
+				glm_decompose_affine_store(Scales, Quats, m + i, Scale + i, Orientation + i, Translation + i);
+			}
+
+			for(; i < count; ++i)
+				decomposeAffine(m[i], Scale[i], Orientation[i], Translation[i]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -163,6 +163,51 @@ namespace glm
 		tquat<T, P> const & y,
 		T const & a);
 
+	/// Normalized linear interpolation along the rotation short path.
+	/// Cheapest of the slerp approximations below, with a constant speed only for small angles.
+	/// Largest rotation error against slerp with a in [0, 1]: 0.14 radians, 8 degrees, between
+	/// rotations 180 degrees apart. It falls quickly with the angle, to 0.016 radians at 90 degrees.
+	///
+	/// @see gtx_quaternion
+	template<typename T, precision P>
+	GLM_FUNC_DECL tquat<T, P> nlerp(
+		tquat<T, P> const & x,
+		tquat<T, P> const & y,
+		T const & a);
+
+	/// nlerp with a corrected interpolation parameter: a cubic in a whose coefficient is a
+	/// quadratic in the cosine of the angle, which restores most of the constant speed of slerp.
+	/// Largest rotation error against slerp with a in [0, 1]: 0.0084 radians, 0.5 degree.
+	///
+	/// @see gtx_quaternion
+	template<typename T, precision P>
+	GLM_FUNC_DECL tquat<T, P> correctedNlerp(
+		tquat<T, P> const & x,
+		tquat<T, P> const & y,
+		T const & a);
+
+	/// nlerp with a two term correction of the interpolation parameter.
+	/// Largest rotation error against slerp with a in [0, 1]: 0.00078 radians, 0.045 degree.
+	///
+	/// @see gtx_quaternion
+	template<typename T, precision P>
+	GLM_FUNC_DECL tquat<T, P> accurateNlerp(
+		tquat<T, P> const & x,
+		tquat<T, P> const & y,
+		T const & a);
+
+	/// slerp with polynomial approximations of acos and sin in place of the library calls.
+	/// Largest rotation error against slerp with a in [0, 1]: 4.2e-7 radians with floats, where slerp
+	/// itself is at 3.2e-7, and 1e-7 with doubles.
+	/// Outside of [0, 1] the error grows, slerp should be used to extrapolate.
+	///
+	/// @see gtx_quaternion
+	template<typename T, precision P>
+	GLM_FUNC_DECL tquat<T, P> fastSlerp(
+		tquat<T, P> const & x,
+		tquat<T, P> const & y,
+		T const & a);
+
 	/// Compute the rotation between two vectors.
 	/// param orig vector, needs to be normalized
 	/// param dest vector, needs to be normalized
@@ -172,6 +172,95 @@ namespace glm
 		return glm::normalize(x * (static_cast<T>(1) - a) + (y * a));
 	}
 
+namespace detail
+{
+	// y on the same side of the 4D sphere as x, and the cosine of the angle between them
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> nlerp_short(tquat<T, P> const & x, tquat<T, P> const & y, T & cosTheta)
+	{
+		cosTheta = dot(x, y);
+		if(cosTheta >= static_cast<T>(0))
+			return y;
+		cosTheta = -cosTheta;
+		return -y;
+	}
+
+	// Parameter corrections from Arseny Kapoulkine, "Approximating slerp", 2015
+	template <typename T>
+	GLM_FUNC_QUALIFIER T nlerp_correct(T cosTheta, T a)
+	{
+		T const k = T(0.931872) + cosTheta * (T(-1.25654) + cosTheta * T(0.331442));
+		return a + a * (a - T(0.5)) * (a - T(1)) * k;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T nlerp_correct_accurate(T cosTheta, T a)
+	{
+		T const ca = T(1.0904) + cosTheta * (T(-3.2452) + cosTheta * (T(3.55645) - cosTheta * T(1.43519)));
+		T const cb = T(0.848013) + cosTheta * (T(-1.06021) + cosTheta * T(0.215638));
+		T const h = a - T(0.5);
+		return a + a * h * (a - T(1)) * (ca * h * h + cb);
+	}
+
+	// Abramowitz and Stegun 4.4.46, acos over [0, 1] within 2e-8
+	template <typename T>
+	GLM_FUNC_QUALIFIER T slerp_acos(T x)
+	{
+		T const p = T(1.5707963050) + x * (T(-0.2145988016) + x * (T(0.0889789874) + x * (T(-0.0501743046) + x * (
+			T(0.0308918810) + x * (T(-0.0170881256) + x * (T(0.0066700901) + x * T(-0.0012624911)))))));
+		return sqrt(T(1) - x) * p;
+	}
+
+	// Abramowitz and Stegun 4.3.97, sin over [-pi/2, pi/2] within 2e-9
+	template <typename T>
+	GLM_FUNC_QUALIFIER T slerp_sin(T x)
+	{
+		T const xx = x * x;
+		return x * (T(1) + xx * (T(-0.1666666664) + xx * (T(0.0083333315) + xx * (T(-0.0001984090) + xx * T(0.0000027526)))));
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> nlerp(tquat<T, P> const& x, tquat<T, P> const& y, T const & a)
+	{
+		T cosTheta;
+		tquat<T, P> const z = detail::nlerp_short(x, y, cosTheta);
+		return glm::normalize(x * (static_cast<T>(1) - a) + (z * a));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> correctedNlerp(tquat<T, P> const& x, tquat<T, P> const& y, T const & a)
+	{
+		T cosTheta;
+		tquat<T, P> const z = detail::nlerp_short(x, y, cosTheta);
+		T const t = detail::nlerp_correct(cosTheta, a);
+		return glm::normalize(x * (static_cast<T>(1) - t) + (z * t));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> accurateNlerp(tquat<T, P> const& x, tquat<T, P> const& y, T const & a)
+	{
+		T cosTheta;
+		tquat<T, P> const z = detail::nlerp_short(x, y, cosTheta);
+		T const t = detail::nlerp_correct_accurate(cosTheta, a);
+		return glm::normalize(x * (static_cast<T>(1) - t) + (z * t));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> fastSlerp(tquat<T, P> const& x, tquat<T, P> const& y, T const & a)
+	{
+		T cosTheta;
+		tquat<T, P> const z = detail::nlerp_short(x, y, cosTheta);
+
+		// Same linear fallback as slerp, where sin(angle) comes near 0
+		if(cosTheta > static_cast<T>(1) - epsilon<T>())
+			return x * (static_cast<T>(1) - a) + (z * a);
+
+		T const angle = detail::slerp_acos(cosTheta);
+		T const oneOverSin = static_cast<T>(1) / detail::slerp_sin(angle);
+		return x * (detail::slerp_sin((static_cast<T>(1) - a) * angle) * oneOverSin) + z * (detail::slerp_sin(a * angle) * oneOverSin);
+	}
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tquat<T, P> rotation(tvec3<T, P> const& orig, tvec3<T, P> const& dest)
 	{
@@ -18,6 +18,7 @@
 // Dependency:
 #include "../glm.hpp"
 #include "../gtc/matrix_transform.hpp"
+#include "../gtc/quaternion.hpp"
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTX_transform extension included")
@@ -28,7 +29,7 @@ namespace glm
 	/// @addtogroup gtx_transform
 	/// @{
 
-	/// Transforms a matrix with a translation 4 * 4 matrix created from 3 scalars.
+	/// Builds a translation 4 * 4 matrix created from 3 scalars.
 	/// @see gtc_matrix_transform
 	/// @see gtx_transform
 	template <typename T, precision P>
@@ -43,13 +44,22 @@ namespace glm
 		T angle, 
 		tvec3<T, P> const & v);
 
-	/// Transforms a matrix with a scale 4 * 4 matrix created from a vector of 3 components.
+	/// Builds a scale 4 * 4 matrix created from a vector of 3 components.
 	/// @see gtc_matrix_transform
 	/// @see gtx_transform
 	template <typename T, precision P>
 	GLM_FUNC_DECL tmat4x4<T, P> scale(
 		tvec3<T, P> const & v);
 
+	/// Builds translate(t) * mat4_cast(r) * scale(s), the matrix of a pose, without the intermediate matrices.
+	/// @see gtc_matrix_transform
+	/// @see gtx_transform
+	template <typename T, precision P>
+	GLM_FUNC_DECL tmat4x4<T, P> translateRotateScale(
+		tvec3<T, P> const & t,
+		tquat<T, P> const & r,
+		tvec3<T, P> const & s);
+
 	/// @}
 }// namespace glm
 
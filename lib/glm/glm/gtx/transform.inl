@@ -6,19 +6,35 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> translate(tvec3<T, P> const & v)
 	{
-		return translate(tmat4x4<T, P>(static_cast<T>(1)), v);
+		tmat4x4<T, P> Result(static_cast<T>(1));
+		Result[3] = tvec4<T, P>(v, static_cast<T>(1));
+		return Result;
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> rotate(T angle, tvec3<T, P> const & v)
 	{
-		return rotate(tmat4x4<T, P>(static_cast<T>(1)), angle, v);
+		return detail::compute_rotation<T, P, detail::is_aligned<P>::value>::call(angle, v);
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> scale(tvec3<T, P> const & v)
 	{
-		return scale(tmat4x4<T, P>(static_cast<T>(1)), v);
+		tmat4x4<T, P> Result(static_cast<T>(1));
+		Result[0][0] = v.x;
+		Result[1][1] = v.y;
+		Result[2][2] = v.z;
+		return Result;
 	}
 
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat4x4<T, P> translateRotateScale(tvec3<T, P> const & t, tquat<T, P> const & r, tvec3<T, P> const & s)
+	{
+		tmat4x4<T, P> Result(mat4_cast(r));
+		Result[0] *= s.x;
+		Result[1] *= s.y;
+		Result[2] *= s.z;
+		Result[3] = tvec4<T, P>(t, static_cast<T>(1));
+		return Result;
+	}
 }//namespace glm
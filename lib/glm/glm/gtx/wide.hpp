@@ -0,0 +1,352 @@
+/// @ref gtx_wide
+/// @file glm/gtx/wide.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtx_wide GLM_GTX_wide
+/// @ingroup gtx
+///
+/// @brief Vectors, quaternions and matrices of 4 or 8 lanes, each lane a different element.
+///
+/// floatx4 and floatx8 hold a float per lane. vec3x8, vec4x8, quatx8 and mat4x8 are made of
+/// them, one per component, so that 8 vec3 cross products take the 6 multiplies and 3
+/// subtractions of one, whatever the size of the vector. floatx8 is a 256-bit register with
+/// AVX, two 128-bit ones with SSE2 and a float array otherwise; floatx4 is one 128-bit register.
+/// The 4-lane matrix is tmat4x<floatx4>, as mat4x4 is already taken.
+///
+/// Comparisons return masks, a floatx with all the bits of a lane set where it is true, to be
+/// combined with & and |, and used by select, any, all and laneMask.
+///
+/// Default constructors leave the lanes uninitialized. With AVX a floatx8 needs 32 byte
+/// alignment, which std::allocator only provides from C++17: keep large data sets in float
+/// arrays and go through make_floatx8 and store.
+///
+/// <glm/gtx/wide.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_wide extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_wide
+	/// @{
+
+	/// Four floats, one per lane.
+	/// @see gtx_wide
+	struct floatx4
+	{
+		typedef float value_type;
+		typedef length_t length_type;
+
+		/// Return the count of lanes
+		GLM_FUNC_DECL static length_type length(){return 4;}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 data;
+#		else
+			float data[4];
+#		endif
+
+		GLM_FUNC_DECL floatx4();
+		GLM_FUNC_DECL explicit floatx4(float s);
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_DECL explicit floatx4(glm_vec4 v);
+#		endif
+
+		/// Lane i, for debugging and tests rather than inner loops
+		GLM_FUNC_DECL float operator[](length_type i) const;
+	};
+
+	/// Eight floats, one per lane.
+	/// @see gtx_wide
+	struct floatx8
+	{
+		typedef float value_type;
+		typedef length_t length_type;
+
+		/// Return the count of lanes
+		GLM_FUNC_DECL static length_type length(){return 8;}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 data;
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 data[2];
+#		else
+			float data[8];
+#		endif
+
+		GLM_FUNC_DECL floatx8();
+		GLM_FUNC_DECL explicit floatx8(float s);
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			GLM_FUNC_DECL explicit floatx8(__m256 v);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_DECL floatx8(glm_vec4 lo, glm_vec4 hi);
+#		endif
+
+		/// Lane i, for debugging and tests rather than inner loops
+		GLM_FUNC_DECL float operator[](length_type i) const;
+	};
+
+	template <typename F>
+	struct tvec3x
+	{
+		typedef F value_type;
+		F x, y, z;
+
+		GLM_FUNC_DECL tvec3x();
+		GLM_FUNC_DECL explicit tvec3x(F const & s);
+		GLM_FUNC_DECL tvec3x(F const & x, F const & y, F const & z);
+		/// v in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit tvec3x(tvec3<float, P> const & v);
+	};
+
+	template <typename F>
+	struct tvec4x
+	{
+		typedef F value_type;
+		F x, y, z, w;
+
+		GLM_FUNC_DECL tvec4x();
+		GLM_FUNC_DECL explicit tvec4x(F const & s);
+		GLM_FUNC_DECL tvec4x(F const & x, F const & y, F const & z, F const & w);
+		GLM_FUNC_DECL tvec4x(tvec3x<F> const & v, F const & w);
+		/// v in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit tvec4x(tvec4<float, P> const & v);
+	};
+
+	template <typename F>
+	struct tquatx
+	{
+		typedef F value_type;
+		F x, y, z, w;
+
+		GLM_FUNC_DECL tquatx();
+		/// Same argument order as tquat
+		GLM_FUNC_DECL tquatx(F const & w, F const & x, F const & y, F const & z);
+		/// q in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit tquatx(tquat<float, P> const & q);
+	};
+
+	/// Column major, like tmat4x4
+	template <typename F>
+	struct tmat4x
+	{
+		typedef F value_type;
+		typedef tvec4x<F> col_type;
+
+		GLM_FUNC_DECL tmat4x();
+		GLM_FUNC_DECL tmat4x(col_type const & c0, col_type const & c1, col_type const & c2, col_type const & c3);
+		/// m in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit tmat4x(tmat4x4<float, P> const & m);
+
+		GLM_FUNC_DECL col_type & operator[](length_t i);
+		GLM_FUNC_DECL col_type const & operator[](length_t i) const;
+
+	private:
+		col_type value[4];
+	};
+
+	typedef tvec3x<floatx4> vec3x4;
+	typedef tvec4x<floatx4> vec4x4;
+	typedef tquatx<floatx4> quatx4;
+
+	typedef tvec3x<floatx8> vec3x8;
+	typedef tvec4x<floatx8> vec4x8;
+	typedef tquatx<floatx8> quatx8;
+	typedef tmat4x<floatx8> mat4x8;
+
+	// -- Loads and stores --
+
+	/// Lanes from p[0] to p[3]
+	GLM_FUNC_DECL floatx4 make_floatx4(float const * p);
+
+	/// Lanes from p[0] to p[7]
+	GLM_FUNC_DECL floatx8 make_floatx8(float const * p);
+
+	GLM_FUNC_DECL void store(floatx4 const & v, float * p);
+	GLM_FUNC_DECL void store(floatx8 const & v, float * p);
+
+	/// Lane i from p[i]
+	template <precision P>
+	GLM_FUNC_DECL vec3x4 make_vec3x4(tvec3<float, P> const * p);
+	template <precision P>
+	GLM_FUNC_DECL vec3x8 make_vec3x8(tvec3<float, P> const * p);
+	template <precision P>
+	GLM_FUNC_DECL vec4x4 make_vec4x4(tvec4<float, P> const * p);
+	template <precision P>
+	GLM_FUNC_DECL vec4x8 make_vec4x8(tvec4<float, P> const * p);
+	template <precision P>
+	GLM_FUNC_DECL quatx4 make_quatx4(tquat<float, P> const * p);
+	template <precision P>
+	GLM_FUNC_DECL quatx8 make_quatx8(tquat<float, P> const * p);
+	template <precision P>
+	GLM_FUNC_DECL mat4x8 make_mat4x8(tmat4x4<float, P> const * p);
+
+	/// Lane i to p[i], for every lane
+	template <typename F, precision P>
+	GLM_FUNC_DECL void store(tvec3x<F> const & v, tvec3<float, P> * p);
+	template <typename F, precision P>
+	GLM_FUNC_DECL void store(tvec4x<F> const & v, tvec4<float, P> * p);
+	template <typename F, precision P>
+	GLM_FUNC_DECL void store(tquatx<F> const & q, tquat<float, P> * p);
+	template <typename F, precision P>
+	GLM_FUNC_DECL void store(tmat4x<F> const & m, tmat4x4<float, P> * p);
+
+	// -- Lanes --
+
+	GLM_FUNC_DECL floatx4 operator+(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx4 operator-(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx4 operator*(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx4 operator/(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx4 operator-(floatx4 const & a);
+	/// Bitwise, to combine masks
+	GLM_FUNC_DECL floatx4 operator&(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx4 operator|(floatx4 const & a, floatx4 const & b);
+
+	GLM_FUNC_DECL floatx8 operator+(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator-(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator*(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator/(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator-(floatx8 const & a);
+	/// Bitwise, to combine masks
+	GLM_FUNC_DECL floatx8 operator&(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator|(floatx8 const & a, floatx8 const & b);
+
+	/// a * b + c, fused when the target has FMA
+	GLM_FUNC_DECL floatx4 fma(floatx4 const & a, floatx4 const & b, floatx4 const & c);
+	GLM_FUNC_DECL floatx8 fma(floatx8 const & a, floatx8 const & b, floatx8 const & c);
+
+	GLM_FUNC_DECL floatx4 min(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 min(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx4 max(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 max(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx4 abs(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 abs(floatx8 const & a);
+	GLM_FUNC_DECL floatx4 sqrt(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 sqrt(floatx8 const & a);
+	GLM_FUNC_DECL floatx4 inversesqrt(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 inversesqrt(floatx8 const & a);
+
+	/// Masks of the lanes where the comparison holds
+	GLM_FUNC_DECL floatx4 lessThan(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 lessThan(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx4 lessThanEqual(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 lessThanEqual(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx4 greaterThan(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 greaterThan(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx4 greaterThanEqual(floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 greaterThanEqual(floatx8 const & a, floatx8 const & b);
+
+	/// a where the mask is set, b elsewhere
+	GLM_FUNC_DECL floatx4 select(floatx4 const & mask, floatx4 const & a, floatx4 const & b);
+	GLM_FUNC_DECL floatx8 select(floatx8 const & mask, floatx8 const & a, floatx8 const & b);
+
+	/// Bit i set if lane i of the mask is
+	GLM_FUNC_DECL int laneMask(floatx4 const & mask);
+	GLM_FUNC_DECL int laneMask(floatx8 const & mask);
+	GLM_FUNC_DECL bool any(floatx4 const & mask);
+	GLM_FUNC_DECL bool any(floatx8 const & mask);
+	GLM_FUNC_DECL bool all(floatx4 const & mask);
+	GLM_FUNC_DECL bool all(floatx8 const & mask);
+
+	/// Within 1 ULP, as sin, cos, acos, atan(y, x), exp, log and pow of an aligned vec4. Given
+	/// lowp or aligned_lowp, sin<lowp>(a), the faster kernels within 3.5 ULP; pow has only one.
+	GLM_FUNC_DECL floatx4 sin(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 sin(floatx8 const & a);
+	GLM_FUNC_DECL floatx4 cos(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 cos(floatx8 const & a);
+	/// sin and cos of the same angles, for less than the two
+	GLM_FUNC_DECL void sincos(floatx4 const & a, floatx4 & s, floatx4 & c);
+	GLM_FUNC_DECL void sincos(floatx8 const & a, floatx8 & s, floatx8 & c);
+	GLM_FUNC_DECL floatx4 acos(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 acos(floatx8 const & a);
+	GLM_FUNC_DECL floatx4 atan(floatx4 const & y, floatx4 const & x);
+	GLM_FUNC_DECL floatx8 atan(floatx8 const & y, floatx8 const & x);
+	GLM_FUNC_DECL floatx4 exp(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 exp(floatx8 const & a);
+	GLM_FUNC_DECL floatx4 log(floatx4 const & a);
+	GLM_FUNC_DECL floatx8 log(floatx8 const & a);
+	GLM_FUNC_DECL floatx4 pow(floatx4 const & x, floatx4 const & y);
+	GLM_FUNC_DECL floatx8 pow(floatx8 const & x, floatx8 const & y);
+
+	template <precision P> GLM_FUNC_DECL floatx4 sin(floatx4 const & a);
+	template <precision P> GLM_FUNC_DECL floatx8 sin(floatx8 const & a);
+	template <precision P> GLM_FUNC_DECL floatx4 cos(floatx4 const & a);
+	template <precision P> GLM_FUNC_DECL floatx8 cos(floatx8 const & a);
+	template <precision P> GLM_FUNC_DECL void sincos(floatx4 const & a, floatx4 & s, floatx4 & c);
+	template <precision P> GLM_FUNC_DECL void sincos(floatx8 const & a, floatx8 & s, floatx8 & c);
+	template <precision P> GLM_FUNC_DECL floatx4 acos(floatx4 const & a);
+	template <precision P> GLM_FUNC_DECL floatx8 acos(floatx8 const & a);
+	template <precision P> GLM_FUNC_DECL floatx4 atan(floatx4 const & y, floatx4 const & x);
+	template <precision P> GLM_FUNC_DECL floatx8 atan(floatx8 const & y, floatx8 const & x);
+	template <precision P> GLM_FUNC_DECL floatx4 exp(floatx4 const & a);
+	template <precision P> GLM_FUNC_DECL floatx8 exp(floatx8 const & a);
+	template <precision P> GLM_FUNC_DECL floatx4 log(floatx4 const & a);
+	template <precision P> GLM_FUNC_DECL floatx8 log(floatx8 const & a);
+
+	// -- Vectors --
+
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator+(tvec3x<F> const & a, tvec3x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator-(tvec3x<F> const & a, tvec3x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator*(tvec3x<F> const & a, tvec3x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator*(tvec3x<F> const & v, F const & s);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator*(F const & s, tvec3x<F> const & v);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator/(tvec3x<F> const & v, F const & s);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator-(tvec3x<F> const & v);
+
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator+(tvec4x<F> const & a, tvec4x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator-(tvec4x<F> const & a, tvec4x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator*(tvec4x<F> const & a, tvec4x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator*(tvec4x<F> const & v, F const & s);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator*(F const & s, tvec4x<F> const & v);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator/(tvec4x<F> const & v, F const & s);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator-(tvec4x<F> const & v);
+
+	template <typename F> GLM_FUNC_DECL F dot(tvec3x<F> const & a, tvec3x<F> const & b);
+	template <typename F> GLM_FUNC_DECL F dot(tvec4x<F> const & a, tvec4x<F> const & b);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> cross(tvec3x<F> const & a, tvec3x<F> const & b);
+	template <typename F> GLM_FUNC_DECL F length(tvec3x<F> const & v);
+	template <typename F> GLM_FUNC_DECL F length(tvec4x<F> const & v);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> normalize(tvec3x<F> const & v);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> normalize(tvec4x<F> const & v);
+	/// a + (b - a) * t, per lane
+	template <typename F> GLM_FUNC_DECL tvec3x<F> mix(tvec3x<F> const & a, tvec3x<F> const & b, F const & t);
+	template <typename F> GLM_FUNC_DECL tvec4x<F> mix(tvec4x<F> const & a, tvec4x<F> const & b, F const & t);
+	template <typename F> GLM_FUNC_DECL tvec3x<F> select(F const & mask, tvec3x<F> const & a, tvec3x<F> const & b);
+
+	// -- Quaternions --
+
+	template <typename F> GLM_FUNC_DECL tquatx<F> operator*(tquatx<F> const & p, tquatx<F> const & q);
+	/// v rotated by q
+	template <typename F> GLM_FUNC_DECL tvec3x<F> operator*(tquatx<F> const & q, tvec3x<F> const & v);
+	template <typename F> GLM_FUNC_DECL tquatx<F> operator-(tquatx<F> const & q);
+	template <typename F> GLM_FUNC_DECL F dot(tquatx<F> const & a, tquatx<F> const & b);
+	template <typename F> GLM_FUNC_DECL tquatx<F> conjugate(tquatx<F> const & q);
+	template <typename F> GLM_FUNC_DECL tquatx<F> normalize(tquatx<F> const & q);
+	/// slerp(tquat, tquat, float) in each lane, within the 1 ULP of the acos and sin
+	template <typename F> GLM_FUNC_DECL tquatx<F> slerp(tquatx<F> const & a, tquatx<F> const & b, F const & t);
+	template <typename F> GLM_FUNC_DECL tmat4x<F> mat4_cast(tquatx<F> const & q);
+
+	// -- Matrices --
+
+	template <typename F> GLM_FUNC_DECL tvec4x<F> operator*(tmat4x<F> const & m, tvec4x<F> const & v);
+	template <typename F> GLM_FUNC_DECL tmat4x<F> operator*(tmat4x<F> const & a, tmat4x<F> const & b);
+	/// (m * vec4(v, 1)).xyz, for matrices whose bottom row is 0 0 0 1
+	template <typename F> GLM_FUNC_DECL tvec3x<F> transformPoint(tmat4x<F> const & m, tvec3x<F> const & v);
+
+	/// @}
+}//namespace glm
+
+#include "wide.inl"
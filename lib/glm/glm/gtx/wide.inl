@@ -0,0 +1,939 @@
+/// @ref gtx_wide
+/// @file glm/gtx/wide.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/common.h"
+#	include "../simd/exponential.h"
+#	include "../simd/trigonometric.h"
+#endif
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+#	if !(GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	// Masks of the scalar fallback, a float with every bit set or none
+	GLM_FUNC_QUALIFIER float wide_mask(bool b)
+	{
+		unsigned int const Bits = b ? 0xFFFFFFFFu : 0u;
+		float Result;
+		std::memcpy(&Result, &Bits, sizeof(Result));
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER unsigned int wide_bits(float f)
+	{
+		unsigned int Result;
+		std::memcpy(&Result, &f, sizeof(Result));
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER float wide_float(unsigned int u)
+	{
+		float Result;
+		std::memcpy(&Result, &u, sizeof(Result));
+		return Result;
+	}
+#	endif
+
+	template <typename F>
+	struct compute_wide_load{};
+
+	template <>
+	struct compute_wide_load<floatx4>
+	{
+		GLM_FUNC_QUALIFIER static floatx4 call(float const * p){return make_floatx4(p);}
+	};
+
+	template <>
+	struct compute_wide_load<floatx8>
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(float const * p){return make_floatx8(p);}
+	};
+
+	// Lane i of the result from p[i * stride]
+	template <typename F>
+	GLM_FUNC_QUALIFIER F wide_gather(float const * p, std::size_t stride)
+	{
+		float Lanes[8];
+		for(length_t i = 0; i < F::length(); ++i)
+			Lanes[i] = p[i * stride];
+		return compute_wide_load<F>::call(Lanes);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER void wide_scatter(F const & v, float * p, std::size_t stride)
+	{
+		float Lanes[8];
+		store(v, Lanes);
+		for(length_t i = 0; i < F::length(); ++i)
+			p[i * stride] = Lanes[i];
+	}
+}//namespace detail
+
+	// -- floatx4 --
+
+	GLM_FUNC_QUALIFIER floatx4::floatx4()
+	{}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER floatx4::floatx4(float s) :
+		data(_mm_set1_ps(s))
+	{}
+
+	GLM_FUNC_QUALIFIER floatx4::floatx4(glm_vec4 v) :
+		data(v)
+	{}
+
+	GLM_FUNC_QUALIFIER void store(floatx4 const & v, float * p)
+	{
+		_mm_storeu_ps(p, v.data);
+	}
+
+	GLM_FUNC_QUALIFIER floatx4 operator+(floatx4 const & a, floatx4 const & b){return floatx4(_mm_add_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 operator-(floatx4 const & a, floatx4 const & b){return floatx4(_mm_sub_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 operator*(floatx4 const & a, floatx4 const & b){return floatx4(_mm_mul_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 operator/(floatx4 const & a, floatx4 const & b){return floatx4(_mm_div_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 operator-(floatx4 const & a){return floatx4(_mm_xor_ps(a.data, _mm_set1_ps(-0.0f)));}
+	GLM_FUNC_QUALIFIER floatx4 operator&(floatx4 const & a, floatx4 const & b){return floatx4(_mm_and_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 operator|(floatx4 const & a, floatx4 const & b){return floatx4(_mm_or_ps(a.data, b.data));}
+
+	GLM_FUNC_QUALIFIER floatx4 fma(floatx4 const & a, floatx4 const & b, floatx4 const & c){return floatx4(glm_vec4_fma(a.data, b.data, c.data));}
+	GLM_FUNC_QUALIFIER floatx4 min(floatx4 const & a, floatx4 const & b){return floatx4(_mm_min_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 max(floatx4 const & a, floatx4 const & b){return floatx4(_mm_max_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 abs(floatx4 const & a){return floatx4(glm_vec4_abs(a.data));}
+	GLM_FUNC_QUALIFIER floatx4 sqrt(floatx4 const & a){return floatx4(_mm_sqrt_ps(a.data));}
+	GLM_FUNC_QUALIFIER floatx4 inversesqrt(floatx4 const & a){return floatx4(_mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(a.data)));}
+
+	GLM_FUNC_QUALIFIER floatx4 lessThan(floatx4 const & a, floatx4 const & b){return floatx4(_mm_cmplt_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 lessThanEqual(floatx4 const & a, floatx4 const & b){return floatx4(_mm_cmple_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 greaterThan(floatx4 const & a, floatx4 const & b){return floatx4(_mm_cmpgt_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx4 greaterThanEqual(floatx4 const & a, floatx4 const & b){return floatx4(_mm_cmpge_ps(a.data, b.data));}
+
+	GLM_FUNC_QUALIFIER floatx4 select(floatx4 const & mask, floatx4 const & a, floatx4 const & b)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return floatx4(_mm_blendv_ps(b.data, a.data, mask.data));
+#		else
+			return floatx4(_mm_or_ps(_mm_and_ps(mask.data, a.data), _mm_andnot_ps(mask.data, b.data)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER int laneMask(floatx4 const & mask)
+	{
+		return _mm_movemask_ps(mask.data);
+	}
+#	else
+	GLM_FUNC_QUALIFIER floatx4::floatx4(float s)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			data[i] = s;
+	}
+
+	GLM_FUNC_QUALIFIER void store(floatx4 const & v, float * p)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			p[i] = v.data[i];
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	GLM_FUNC_QUALIFIER float floatx4::operator[](floatx4::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		float Lanes[4];
+		store(*this, Lanes);
+		return Lanes[i];
+	}
+
+	GLM_FUNC_QUALIFIER floatx4 make_floatx4(float const * p)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return floatx4(_mm_loadu_ps(p));
+#		else
+			floatx4 Result;
+			for(length_t i = 0; i < 4; ++i)
+				Result.data[i] = p[i];
+			return Result;
+#		endif
+	}
+
+	// -- floatx8 --
+
+	GLM_FUNC_QUALIFIER floatx8::floatx8()
+	{}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER floatx8::floatx8(float s) :
+		data(_mm256_set1_ps(s))
+	{}
+
+	GLM_FUNC_QUALIFIER floatx8::floatx8(__m256 v) :
+		data(v)
+	{}
+
+	GLM_FUNC_QUALIFIER void store(floatx8 const & v, float * p)
+	{
+		_mm256_storeu_ps(p, v.data);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator+(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_add_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_sub_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 operator*(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_mul_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 operator/(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_div_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & a){return floatx8(_mm256_xor_ps(a.data, _mm256_set1_ps(-0.0f)));}
+	GLM_FUNC_QUALIFIER floatx8 operator&(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_and_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 operator|(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_or_ps(a.data, b.data));}
+
+	GLM_FUNC_QUALIFIER floatx8 fma(floatx8 const & a, floatx8 const & b, floatx8 const & c){return floatx8(glm_vec4x2_fma(a.data, b.data, c.data));}
+	GLM_FUNC_QUALIFIER floatx8 min(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_min_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 max(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_max_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER floatx8 abs(floatx8 const & a){return floatx8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.data));}
+	GLM_FUNC_QUALIFIER floatx8 sqrt(floatx8 const & a){return floatx8(_mm256_sqrt_ps(a.data));}
+	GLM_FUNC_QUALIFIER floatx8 inversesqrt(floatx8 const & a){return floatx8(_mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(a.data)));}
+
+	GLM_FUNC_QUALIFIER floatx8 lessThan(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ));}
+	GLM_FUNC_QUALIFIER floatx8 lessThanEqual(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_cmp_ps(a.data, b.data, _CMP_LE_OQ));}
+	GLM_FUNC_QUALIFIER floatx8 greaterThan(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_cmp_ps(a.data, b.data, _CMP_GT_OQ));}
+	GLM_FUNC_QUALIFIER floatx8 greaterThanEqual(floatx8 const & a, floatx8 const & b){return floatx8(_mm256_cmp_ps(a.data, b.data, _CMP_GE_OQ));}
+
+	GLM_FUNC_QUALIFIER floatx8 select(floatx8 const & mask, floatx8 const & a, floatx8 const & b)
+	{
+		return floatx8(_mm256_blendv_ps(b.data, a.data, mask.data));
+	}
+
+	GLM_FUNC_QUALIFIER int laneMask(floatx8 const & mask)
+	{
+		return _mm256_movemask_ps(mask.data);
+	}
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The lower four lanes in data[0], the upper four in data[1]
+	GLM_FUNC_QUALIFIER floatx8::floatx8(float s)
+	{
+		data[0] = data[1] = _mm_set1_ps(s);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8::floatx8(glm_vec4 lo, glm_vec4 hi)
+	{
+		data[0] = lo;
+		data[1] = hi;
+	}
+
+	GLM_FUNC_QUALIFIER void store(floatx8 const & v, float * p)
+	{
+		_mm_storeu_ps(p, v.data[0]);
+		_mm_storeu_ps(p + 4, v.data[1]);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator+(floatx8 const & a, floatx8 const & b){return floatx8(_mm_add_ps(a.data[0], b.data[0]), _mm_add_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & a, floatx8 const & b){return floatx8(_mm_sub_ps(a.data[0], b.data[0]), _mm_sub_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 operator*(floatx8 const & a, floatx8 const & b){return floatx8(_mm_mul_ps(a.data[0], b.data[0]), _mm_mul_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 operator/(floatx8 const & a, floatx8 const & b){return floatx8(_mm_div_ps(a.data[0], b.data[0]), _mm_div_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & a){return floatx8(_mm_xor_ps(a.data[0], _mm_set1_ps(-0.0f)), _mm_xor_ps(a.data[1], _mm_set1_ps(-0.0f)));}
+	GLM_FUNC_QUALIFIER floatx8 operator&(floatx8 const & a, floatx8 const & b){return floatx8(_mm_and_ps(a.data[0], b.data[0]), _mm_and_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 operator|(floatx8 const & a, floatx8 const & b){return floatx8(_mm_or_ps(a.data[0], b.data[0]), _mm_or_ps(a.data[1], b.data[1]));}
+
+	GLM_FUNC_QUALIFIER floatx8 fma(floatx8 const & a, floatx8 const & b, floatx8 const & c){return floatx8(glm_vec4_fma(a.data[0], b.data[0], c.data[0]), glm_vec4_fma(a.data[1], b.data[1], c.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 min(floatx8 const & a, floatx8 const & b){return floatx8(_mm_min_ps(a.data[0], b.data[0]), _mm_min_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 max(floatx8 const & a, floatx8 const & b){return floatx8(_mm_max_ps(a.data[0], b.data[0]), _mm_max_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 abs(floatx8 const & a){return floatx8(glm_vec4_abs(a.data[0]), glm_vec4_abs(a.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 sqrt(floatx8 const & a){return floatx8(_mm_sqrt_ps(a.data[0]), _mm_sqrt_ps(a.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 inversesqrt(floatx8 const & a){return floatx8(1.0f) / sqrt(a);}
+
+	GLM_FUNC_QUALIFIER floatx8 lessThan(floatx8 const & a, floatx8 const & b){return floatx8(_mm_cmplt_ps(a.data[0], b.data[0]), _mm_cmplt_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 lessThanEqual(floatx8 const & a, floatx8 const & b){return floatx8(_mm_cmple_ps(a.data[0], b.data[0]), _mm_cmple_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 greaterThan(floatx8 const & a, floatx8 const & b){return floatx8(_mm_cmpgt_ps(a.data[0], b.data[0]), _mm_cmpgt_ps(a.data[1], b.data[1]));}
+	GLM_FUNC_QUALIFIER floatx8 greaterThanEqual(floatx8 const & a, floatx8 const & b){return floatx8(_mm_cmpge_ps(a.data[0], b.data[0]), _mm_cmpge_ps(a.data[1], b.data[1]));}
+
+	GLM_FUNC_QUALIFIER floatx8 select(floatx8 const & mask, floatx8 const & a, floatx8 const & b)
+	{
+		return (mask & a) | floatx8(_mm_andnot_ps(mask.data[0], b.data[0]), _mm_andnot_ps(mask.data[1], b.data[1]));
+	}
+
+	GLM_FUNC_QUALIFIER int laneMask(floatx8 const & mask)
+	{
+		return _mm_movemask_ps(mask.data[0]) | (_mm_movemask_ps(mask.data[1]) << 4);
+	}
+#	else
+	GLM_FUNC_QUALIFIER floatx8::floatx8(float s)
+	{
+		for(length_t i = 0; i < 8; ++i)
+			data[i] = s;
+	}
+
+	GLM_FUNC_QUALIFIER void store(floatx8 const & v, float * p)
+	{
+		for(length_t i = 0; i < 8; ++i)
+			p[i] = v.data[i];
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	GLM_FUNC_QUALIFIER float floatx8::operator[](floatx8::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		float Lanes[8];
+		store(*this, Lanes);
+		return Lanes[i];
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 make_floatx8(float const * p)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			return floatx8(_mm256_loadu_ps(p));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return floatx8(_mm_loadu_ps(p), _mm_loadu_ps(p + 4));
+#		else
+			floatx8 Result;
+			for(length_t i = 0; i < 8; ++i)
+				Result.data[i] = p[i];
+			return Result;
+#		endif
+	}
+
+#	if !(GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	// Scalar fallback, the same loops for both lane counts
+#	define GLM_WIDE_FALLBACK(F) \
+	GLM_FUNC_QUALIFIER F operator+(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = a.data[i] + b.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F operator-(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = a.data[i] - b.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F operator*(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = a.data[i] * b.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F operator/(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = a.data[i] / b.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F operator-(F const & a){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = -a.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F operator&(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_float(detail::wide_bits(a.data[i]) & detail::wide_bits(b.data[i])); return r;} \
+	GLM_FUNC_QUALIFIER F operator|(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_float(detail::wide_bits(a.data[i]) | detail::wide_bits(b.data[i])); return r;} \
+	GLM_FUNC_QUALIFIER F fma(F const & a, F const & b, F const & c){return a * b + c;} \
+	GLM_FUNC_QUALIFIER F min(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = b.data[i] < a.data[i] ? b.data[i] : a.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F max(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = a.data[i] < b.data[i] ? b.data[i] : a.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER F abs(F const & a){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = std::abs(a.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER F sqrt(F const & a){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = std::sqrt(a.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER F inversesqrt(F const & a){return F(1.0f) / sqrt(a);} \
+	GLM_FUNC_QUALIFIER F lessThan(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_mask(a.data[i] < b.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER F lessThanEqual(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_mask(a.data[i] <= b.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER F greaterThan(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_mask(a.data[i] > b.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER F greaterThanEqual(F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_mask(a.data[i] >= b.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER F select(F const & mask, F const & a, F const & b){F r; for(length_t i = 0; i < F::length(); ++i) r.data[i] = detail::wide_bits(mask.data[i]) ? a.data[i] : b.data[i]; return r;} \
+	GLM_FUNC_QUALIFIER int laneMask(F const & mask){int r = 0; for(length_t i = 0; i < F::length(); ++i) r |= (detail::wide_bits(mask.data[i]) >> 31) << i; return r;}
+
+	GLM_WIDE_FALLBACK(floatx4)
+	GLM_WIDE_FALLBACK(floatx8)
+#	undef GLM_WIDE_FALLBACK
+#	endif//!(GLM_ARCH & GLM_ARCH_SSE2_BIT)
+
+	GLM_FUNC_QUALIFIER bool any(floatx4 const & mask){return laneMask(mask) != 0;}
+	GLM_FUNC_QUALIFIER bool any(floatx8 const & mask){return laneMask(mask) != 0;}
+	GLM_FUNC_QUALIFIER bool all(floatx4 const & mask){return laneMask(mask) == 0xF;}
+	GLM_FUNC_QUALIFIER bool all(floatx8 const & mask){return laneMask(mask) == 0xFF;}
+
+	// -- Transcendental functions --
+
+namespace detail
+{
+	template <precision P>
+	struct is_wide_lowp
+	{
+		static const bool value = false;
+	};
+
+	template <>
+	struct is_wide_lowp<lowp>
+	{
+		static const bool value = true;
+	};
+
+#	if GLM_HAS_ALIGNED_TYPE
+		template <>
+		struct is_wide_lowp<aligned_lowp>
+		{
+			static const bool value = true;
+		};
+#	endif
+}//namespace detail
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The 128-bit kernels of glm/simd, on each half of a floatx8
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+#	define GLM_WIDE_LO(v) _mm256_castps256_ps128(v.data)
+#	define GLM_WIDE_HI(v) _mm256_extractf128_ps(v.data, 1)
+#	define GLM_WIDE_MAKE(lo, hi) floatx8(_mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1))
+#	else
+#	define GLM_WIDE_LO(v) v.data[0]
+#	define GLM_WIDE_HI(v) v.data[1]
+#	define GLM_WIDE_MAKE(lo, hi) floatx8(lo, hi)
+#	endif
+#	define GLM_WIDE_UNARY(Name, Kernel) \
+	GLM_FUNC_QUALIFIER floatx4 Name(floatx4 const & a){return floatx4(Kernel(a.data));} \
+	GLM_FUNC_QUALIFIER floatx8 Name(floatx8 const & a){return GLM_WIDE_MAKE(Kernel(GLM_WIDE_LO(a)), Kernel(GLM_WIDE_HI(a)));}
+#	define GLM_WIDE_BINARY(Name, Kernel) \
+	GLM_FUNC_QUALIFIER floatx4 Name(floatx4 const & a, floatx4 const & b){return floatx4(Kernel(a.data, b.data));} \
+	GLM_FUNC_QUALIFIER floatx8 Name(floatx8 const & a, floatx8 const & b){return GLM_WIDE_MAKE(Kernel(GLM_WIDE_LO(a), GLM_WIDE_LO(b)), Kernel(GLM_WIDE_HI(a), GLM_WIDE_HI(b)));}
+#	define GLM_WIDE_SINCOS(Name, Kernel) \
+	GLM_FUNC_QUALIFIER void Name(floatx4 const & a, floatx4 & s, floatx4 & c){Kernel(a.data, s.data, c.data);} \
+	GLM_FUNC_QUALIFIER void Name(floatx8 const & a, floatx8 & s, floatx8 & c) \
+	{ \
+		glm_vec4 SinLo, CosLo, SinHi, CosHi; \
+		Kernel(GLM_WIDE_LO(a), SinLo, CosLo); \
+		Kernel(GLM_WIDE_HI(a), SinHi, CosHi); \
+		s = GLM_WIDE_MAKE(SinLo, SinHi); \
+		c = GLM_WIDE_MAKE(CosLo, CosHi); \
+	}
+
+	GLM_WIDE_UNARY(sin, glm_vec4_sin)
+	GLM_WIDE_UNARY(cos, glm_vec4_cos)
+	GLM_WIDE_SINCOS(sincos, glm_vec4_sincos)
+	GLM_WIDE_UNARY(acos, glm_vec4_acos)
+	GLM_WIDE_BINARY(atan, glm_vec4_atan2)
+	GLM_WIDE_UNARY(exp, glm_vec4_exp)
+	GLM_WIDE_UNARY(log, glm_vec4_log)
+
+namespace detail
+{
+	// Without FMA, the double evaluation of glm_vec4_pow is slower than the C library
+	GLM_FUNC_QUALIFIER glm_vec4 wide_pow(glm_vec4 x, glm_vec4 y)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return glm_vec4_pow(x, y);
+#		else
+			return glm_vec4_call_lanes(0xF, x, x, y, static_cast<float(*)(float, float)>(std::pow));
+#		endif
+	}
+
+	GLM_WIDE_UNARY(wide_sin_lowp, glm_vec4_sin_lowp)
+	GLM_WIDE_UNARY(wide_cos_lowp, glm_vec4_cos_lowp)
+	GLM_WIDE_SINCOS(wide_sincos_lowp, glm_vec4_sincos_lowp)
+	GLM_WIDE_UNARY(wide_acos_lowp, glm_vec4_acos_lowp)
+	GLM_WIDE_BINARY(wide_atan_lowp, glm_vec4_atan2_lowp)
+	GLM_WIDE_UNARY(wide_exp_lowp, glm_vec4_exp_lowp)
+	GLM_WIDE_UNARY(wide_log_lowp, glm_vec4_log_lowp)
+}//namespace detail
+
+	GLM_WIDE_BINARY(pow, detail::wide_pow)
+
+#	undef GLM_WIDE_SINCOS
+#	undef GLM_WIDE_BINARY
+#	undef GLM_WIDE_UNARY
+#	undef GLM_WIDE_MAKE
+#	undef GLM_WIDE_HI
+#	undef GLM_WIDE_LO
+#	else
+	// The C library a lane at a time, for both accuracies
+#	define GLM_WIDE_UNARY(Name, Function) \
+	GLM_FUNC_QUALIFIER floatx4 Name(floatx4 const & a){floatx4 r; for(length_t i = 0; i < 4; ++i) r.data[i] = Function(a.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER floatx8 Name(floatx8 const & a){floatx8 r; for(length_t i = 0; i < 8; ++i) r.data[i] = Function(a.data[i]); return r;}
+#	define GLM_WIDE_BINARY(Name, Function) \
+	GLM_FUNC_QUALIFIER floatx4 Name(floatx4 const & a, floatx4 const & b){floatx4 r; for(length_t i = 0; i < 4; ++i) r.data[i] = Function(a.data[i], b.data[i]); return r;} \
+	GLM_FUNC_QUALIFIER floatx8 Name(floatx8 const & a, floatx8 const & b){floatx8 r; for(length_t i = 0; i < 8; ++i) r.data[i] = Function(a.data[i], b.data[i]); return r;}
+#	define GLM_WIDE_SINCOS(Name) \
+	GLM_FUNC_QUALIFIER void Name(floatx4 const & a, floatx4 & s, floatx4 & c){s = glm::sin(a); c = glm::cos(a);} \
+	GLM_FUNC_QUALIFIER void Name(floatx8 const & a, floatx8 & s, floatx8 & c){s = glm::sin(a); c = glm::cos(a);}
+
+	GLM_WIDE_UNARY(sin, std::sin)
+	GLM_WIDE_UNARY(cos, std::cos)
+	GLM_WIDE_SINCOS(sincos)
+	GLM_WIDE_UNARY(acos, std::acos)
+	GLM_WIDE_BINARY(atan, std::atan2)
+	GLM_WIDE_UNARY(exp, std::exp)
+	GLM_WIDE_UNARY(log, std::log)
+	GLM_WIDE_BINARY(pow, std::pow)
+
+namespace detail
+{
+	GLM_WIDE_UNARY(wide_sin_lowp, std::sin)
+	GLM_WIDE_UNARY(wide_cos_lowp, std::cos)
+	GLM_WIDE_SINCOS(wide_sincos_lowp)
+	GLM_WIDE_UNARY(wide_acos_lowp, std::acos)
+	GLM_WIDE_BINARY(wide_atan_lowp, std::atan2)
+	GLM_WIDE_UNARY(wide_exp_lowp, std::exp)
+	GLM_WIDE_UNARY(wide_log_lowp, std::log)
+}//namespace detail
+
+#	undef GLM_WIDE_SINCOS
+#	undef GLM_WIDE_BINARY
+#	undef GLM_WIDE_UNARY
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	define GLM_WIDE_PRECISION(F) \
+	template <precision P> GLM_FUNC_QUALIFIER F sin(F const & a){return detail::is_wide_lowp<P>::value ? detail::wide_sin_lowp(a) : sin(a);} \
+	template <precision P> GLM_FUNC_QUALIFIER F cos(F const & a){return detail::is_wide_lowp<P>::value ? detail::wide_cos_lowp(a) : cos(a);} \
+	template <precision P> GLM_FUNC_QUALIFIER void sincos(F const & a, F & s, F & c){if(detail::is_wide_lowp<P>::value) detail::wide_sincos_lowp(a, s, c); else sincos(a, s, c);} \
+	template <precision P> GLM_FUNC_QUALIFIER F acos(F const & a){return detail::is_wide_lowp<P>::value ? detail::wide_acos_lowp(a) : acos(a);} \
+	template <precision P> GLM_FUNC_QUALIFIER F atan(F const & y, F const & x){return detail::is_wide_lowp<P>::value ? detail::wide_atan_lowp(y, x) : atan(y, x);} \
+	template <precision P> GLM_FUNC_QUALIFIER F exp(F const & a){return detail::is_wide_lowp<P>::value ? detail::wide_exp_lowp(a) : exp(a);} \
+	template <precision P> GLM_FUNC_QUALIFIER F log(F const & a){return detail::is_wide_lowp<P>::value ? detail::wide_log_lowp(a) : log(a);}
+
+	GLM_WIDE_PRECISION(floatx4)
+	GLM_WIDE_PRECISION(floatx8)
+#	undef GLM_WIDE_PRECISION
+
+	// -- Constructors --
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F>::tvec3x()
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F>::tvec3x(F const & s) :
+		x(s), y(s), z(s)
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F>::tvec3x(F const & x, F const & y, F const & z) :
+		x(x), y(y), z(z)
+	{}
+
+	template <typename F>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tvec3x<F>::tvec3x(tvec3<float, P> const & v) :
+		x(v.x), y(v.y), z(v.z)
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F>::tvec4x()
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F>::tvec4x(F const & s) :
+		x(s), y(s), z(s), w(s)
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F>::tvec4x(F const & x, F const & y, F const & z, F const & w) :
+		x(x), y(y), z(z), w(w)
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F>::tvec4x(tvec3x<F> const & v, F const & w) :
+		x(v.x), y(v.y), z(v.z), w(w)
+	{}
+
+	template <typename F>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tvec4x<F>::tvec4x(tvec4<float, P> const & v) :
+		x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F>::tquatx()
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F>::tquatx(F const & w, F const & x, F const & y, F const & z) :
+		x(x), y(y), z(z), w(w)
+	{}
+
+	template <typename F>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tquatx<F>::tquatx(tquat<float, P> const & q) :
+		x(q.x), y(q.y), z(q.z), w(q.w)
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tmat4x<F>::tmat4x()
+	{}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tmat4x<F>::tmat4x(col_type const & c0, col_type const & c1, col_type const & c2, col_type const & c3)
+	{
+		this->value[0] = c0;
+		this->value[1] = c1;
+		this->value[2] = c2;
+		this->value[3] = c3;
+	}
+
+	template <typename F>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tmat4x<F>::tmat4x(tmat4x4<float, P> const & m)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			this->value[i] = col_type(m[i]);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER typename tmat4x<F>::col_type & tmat4x<F>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < 4);
+		return this->value[i];
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER typename tmat4x<F>::col_type const & tmat4x<F>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 4);
+		return this->value[i];
+	}
+
+	// -- Loads and stores --
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER vec3x4 make_vec3x4(tvec3<float, P> const * p)
+	{
+		std::size_t const Stride = sizeof(*p) / sizeof(float);
+		float const * f = &p[0].x;
+		return vec3x4(detail::wide_gather<floatx4>(f, Stride), detail::wide_gather<floatx4>(f + 1, Stride), detail::wide_gather<floatx4>(f + 2, Stride));
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER vec3x8 make_vec3x8(tvec3<float, P> const * p)
+	{
+		std::size_t const Stride = sizeof(*p) / sizeof(float);
+		float const * f = &p[0].x;
+		return vec3x8(detail::wide_gather<floatx8>(f, Stride), detail::wide_gather<floatx8>(f + 1, Stride), detail::wide_gather<floatx8>(f + 2, Stride));
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER vec4x4 make_vec4x4(tvec4<float, P> const * p)
+	{
+		float const * f = &p[0].x;
+		return vec4x4(detail::wide_gather<floatx4>(f, 4), detail::wide_gather<floatx4>(f + 1, 4), detail::wide_gather<floatx4>(f + 2, 4), detail::wide_gather<floatx4>(f + 3, 4));
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER vec4x8 make_vec4x8(tvec4<float, P> const * p)
+	{
+		float const * f = &p[0].x;
+		return vec4x8(detail::wide_gather<floatx8>(f, 4), detail::wide_gather<floatx8>(f + 1, 4), detail::wide_gather<floatx8>(f + 2, 4), detail::wide_gather<floatx8>(f + 3, 4));
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER quatx4 make_quatx4(tquat<float, P> const * p)
+	{
+		float const * f = &p[0].x;
+		return quatx4(detail::wide_gather<floatx4>(f + 3, 4), detail::wide_gather<floatx4>(f, 4), detail::wide_gather<floatx4>(f + 1, 4), detail::wide_gather<floatx4>(f + 2, 4));
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER quatx8 make_quatx8(tquat<float, P> const * p)
+	{
+		float const * f = &p[0].x;
+		return quatx8(detail::wide_gather<floatx8>(f + 3, 4), detail::wide_gather<floatx8>(f, 4), detail::wide_gather<floatx8>(f + 1, 4), detail::wide_gather<floatx8>(f + 2, 4));
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER mat4x8 make_mat4x8(tmat4x4<float, P> const * p)
+	{
+		float const * f = &p[0][0][0];
+		mat4x8 Result;
+		for(length_t c = 0; c < 4; ++c)
+			Result[c] = vec4x8(
+				detail::wide_gather<floatx8>(f + c * 4 + 0, 16),
+				detail::wide_gather<floatx8>(f + c * 4 + 1, 16),
+				detail::wide_gather<floatx8>(f + c * 4 + 2, 16),
+				detail::wide_gather<floatx8>(f + c * 4 + 3, 16));
+		return Result;
+	}
+
+	template <typename F, precision P>
+	GLM_FUNC_QUALIFIER void store(tvec3x<F> const & v, tvec3<float, P> * p)
+	{
+		std::size_t const Stride = sizeof(*p) / sizeof(float);
+		float * f = &p[0].x;
+		detail::wide_scatter(v.x, f, Stride);
+		detail::wide_scatter(v.y, f + 1, Stride);
+		detail::wide_scatter(v.z, f + 2, Stride);
+	}
+
+	template <typename F, precision P>
+	GLM_FUNC_QUALIFIER void store(tvec4x<F> const & v, tvec4<float, P> * p)
+	{
+		float * f = &p[0].x;
+		detail::wide_scatter(v.x, f, 4);
+		detail::wide_scatter(v.y, f + 1, 4);
+		detail::wide_scatter(v.z, f + 2, 4);
+		detail::wide_scatter(v.w, f + 3, 4);
+	}
+
+	template <typename F, precision P>
+	GLM_FUNC_QUALIFIER void store(tquatx<F> const & q, tquat<float, P> * p)
+	{
+		float * f = &p[0].x;
+		detail::wide_scatter(q.x, f, 4);
+		detail::wide_scatter(q.y, f + 1, 4);
+		detail::wide_scatter(q.z, f + 2, 4);
+		detail::wide_scatter(q.w, f + 3, 4);
+	}
+
+	template <typename F, precision P>
+	GLM_FUNC_QUALIFIER void store(tmat4x<F> const & m, tmat4x4<float, P> * p)
+	{
+		float * f = &p[0][0][0];
+		for(length_t c = 0; c < 4; ++c)
+		{
+			detail::wide_scatter(m[c].x, f + c * 4 + 0, 16);
+			detail::wide_scatter(m[c].y, f + c * 4 + 1, 16);
+			detail::wide_scatter(m[c].z, f + c * 4 + 2, 16);
+			detail::wide_scatter(m[c].w, f + c * 4 + 3, 16);
+		}
+	}
+
+	// -- Vectors --
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator+(tvec3x<F> const & a, tvec3x<F> const & b)
+	{
+		return tvec3x<F>(a.x + b.x, a.y + b.y, a.z + b.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator-(tvec3x<F> const & a, tvec3x<F> const & b)
+	{
+		return tvec3x<F>(a.x - b.x, a.y - b.y, a.z - b.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator*(tvec3x<F> const & a, tvec3x<F> const & b)
+	{
+		return tvec3x<F>(a.x * b.x, a.y * b.y, a.z * b.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator*(tvec3x<F> const & v, F const & s)
+	{
+		return tvec3x<F>(v.x * s, v.y * s, v.z * s);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator*(F const & s, tvec3x<F> const & v)
+	{
+		return tvec3x<F>(s * v.x, s * v.y, s * v.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator/(tvec3x<F> const & v, F const & s)
+	{
+		return tvec3x<F>(v.x / s, v.y / s, v.z / s);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator-(tvec3x<F> const & v)
+	{
+		return tvec3x<F>(-v.x, -v.y, -v.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator+(tvec4x<F> const & a, tvec4x<F> const & b)
+	{
+		return tvec4x<F>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator-(tvec4x<F> const & a, tvec4x<F> const & b)
+	{
+		return tvec4x<F>(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator*(tvec4x<F> const & a, tvec4x<F> const & b)
+	{
+		return tvec4x<F>(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator*(tvec4x<F> const & v, F const & s)
+	{
+		return tvec4x<F>(v.x * s, v.y * s, v.z * s, v.w * s);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator*(F const & s, tvec4x<F> const & v)
+	{
+		return tvec4x<F>(s * v.x, s * v.y, s * v.z, s * v.w);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator/(tvec4x<F> const & v, F const & s)
+	{
+		return tvec4x<F>(v.x / s, v.y / s, v.z / s, v.w / s);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator-(tvec4x<F> const & v)
+	{
+		return tvec4x<F>(-v.x, -v.y, -v.z, -v.w);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER F dot(tvec3x<F> const & a, tvec3x<F> const & b)
+	{
+		return fma(a.x, b.x, fma(a.y, b.y, a.z * b.z));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER F dot(tvec4x<F> const & a, tvec4x<F> const & b)
+	{
+		return fma(a.x, b.x, fma(a.y, b.y, fma(a.z, b.z, a.w * b.w)));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> cross(tvec3x<F> const & a, tvec3x<F> const & b)
+	{
+		return tvec3x<F>(
+			a.y * b.z - b.y * a.z,
+			a.z * b.x - b.z * a.x,
+			a.x * b.y - b.x * a.y);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER F length(tvec3x<F> const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER F length(tvec4x<F> const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> normalize(tvec3x<F> const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> normalize(tvec4x<F> const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> mix(tvec3x<F> const & a, tvec3x<F> const & b, F const & t)
+	{
+		return tvec3x<F>(fma(b.x - a.x, t, a.x), fma(b.y - a.y, t, a.y), fma(b.z - a.z, t, a.z));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> mix(tvec4x<F> const & a, tvec4x<F> const & b, F const & t)
+	{
+		return tvec4x<F>(fma(b.x - a.x, t, a.x), fma(b.y - a.y, t, a.y), fma(b.z - a.z, t, a.z), fma(b.w - a.w, t, a.w));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> select(F const & mask, tvec3x<F> const & a, tvec3x<F> const & b)
+	{
+		return tvec3x<F>(select(mask, a.x, b.x), select(mask, a.y, b.y), select(mask, a.z, b.z));
+	}
+
+	// -- Quaternions --
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F> operator*(tquatx<F> const & p, tquatx<F> const & q)
+	{
+		return tquatx<F>(
+			p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z,
+			p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+			p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z,
+			p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> operator*(tquatx<F> const & q, tvec3x<F> const & v)
+	{
+		tvec3x<F> const QuatVector(q.x, q.y, q.z);
+		tvec3x<F> const uv(cross(QuatVector, v));
+		tvec3x<F> const uuv(cross(QuatVector, uv));
+
+		F const Two(2.0f);
+		return v + (uv * q.w + uuv) * Two;
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F> operator-(tquatx<F> const & q)
+	{
+		return tquatx<F>(-q.w, -q.x, -q.y, -q.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER F dot(tquatx<F> const & a, tquatx<F> const & b)
+	{
+		return fma(a.x, b.x, fma(a.y, b.y, fma(a.z, b.z, a.w * b.w)));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F> conjugate(tquatx<F> const & q)
+	{
+		return tquatx<F>(q.w, -q.x, -q.y, -q.z);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F> normalize(tquatx<F> const & q)
+	{
+		F const InvLength = inversesqrt(dot(q, q));
+		return tquatx<F>(q.w * InvLength, q.x * InvLength, q.y * InvLength, q.z * InvLength);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tquatx<F> slerp(tquatx<F> const & a, tquatx<F> const & b, F const & t)
+	{
+		// Take the short way around, negating b where the quaternions are more than 90 degrees apart
+		F const Dot = dot(a, b);
+		F const Negate = lessThan(Dot, F(0.0f));
+		tquatx<F> const z(
+			select(Negate, -b.w, b.w),
+			select(Negate, -b.x, b.x),
+			select(Negate, -b.y, b.y),
+			select(Negate, -b.z, b.z));
+		F const CosTheta = abs(Dot);
+
+		// The lanes close enough to take the linear path may divide by 0 here, they are
+		// replaced below
+		F const Angle = acos(CosTheta);
+		F const Sin0 = sin((F(1.0f) - t) * Angle);
+		F const Sin1 = sin(t * Angle);
+		F const Sin = sin(Angle);
+
+		F const Linear = greaterThan(CosTheta, F(1.0f - epsilon<float>()));
+		return tquatx<F>(
+			select(Linear, fma(z.w - a.w, t, a.w), (Sin0 * a.w + Sin1 * z.w) / Sin),
+			select(Linear, fma(z.x - a.x, t, a.x), (Sin0 * a.x + Sin1 * z.x) / Sin),
+			select(Linear, fma(z.y - a.y, t, a.y), (Sin0 * a.y + Sin1 * z.y) / Sin),
+			select(Linear, fma(z.z - a.z, t, a.z), (Sin0 * a.z + Sin1 * z.z) / Sin));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tmat4x<F> mat4_cast(tquatx<F> const & q)
+	{
+		F const qxx(q.x * q.x);
+		F const qyy(q.y * q.y);
+		F const qzz(q.z * q.z);
+		F const qxz(q.x * q.z);
+		F const qxy(q.x * q.y);
+		F const qyz(q.y * q.z);
+		F const qwx(q.w * q.x);
+		F const qwy(q.w * q.y);
+		F const qwz(q.w * q.z);
+
+		F const Zero(0.0f), One(1.0f), Two(2.0f);
+		return tmat4x<F>(
+			tvec4x<F>(One - Two * (qyy + qzz), Two * (qxy + qwz), Two * (qxz - qwy), Zero),
+			tvec4x<F>(Two * (qxy - qwz), One - Two * (qxx + qzz), Two * (qyz + qwx), Zero),
+			tvec4x<F>(Two * (qxz + qwy), Two * (qyz - qwx), One - Two * (qxx + qyy), Zero),
+			tvec4x<F>(Zero, Zero, Zero, One));
+	}
+
+	// -- Matrices --
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec4x<F> operator*(tmat4x<F> const & m, tvec4x<F> const & v)
+	{
+		return tvec4x<F>(
+			fma(m[0].x, v.x, fma(m[1].x, v.y, fma(m[2].x, v.z, m[3].x * v.w))),
+			fma(m[0].y, v.x, fma(m[1].y, v.y, fma(m[2].y, v.z, m[3].y * v.w))),
+			fma(m[0].z, v.x, fma(m[1].z, v.y, fma(m[2].z, v.z, m[3].z * v.w))),
+			fma(m[0].w, v.x, fma(m[1].w, v.y, fma(m[2].w, v.z, m[3].w * v.w))));
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tmat4x<F> operator*(tmat4x<F> const & a, tmat4x<F> const & b)
+	{
+		return tmat4x<F>(a * b[0], a * b[1], a * b[2], a * b[3]);
+	}
+
+	template <typename F>
+	GLM_FUNC_QUALIFIER tvec3x<F> transformPoint(tmat4x<F> const & m, tvec3x<F> const & v)
+	{
+		return tvec3x<F>(
+			fma(m[0].x, v.x, fma(m[1].x, v.y, fma(m[2].x, v.z, m[3].x))),
+			fma(m[0].y, v.x, fma(m[1].y, v.y, fma(m[2].y, v.z, m[3].y))),
+			fma(m[0].z, v.x, fma(m[1].z, v.y, fma(m[2].z, v.z, m[3].z))));
+	}
+}//namespace glm
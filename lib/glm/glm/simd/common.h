@@ -79,6 +79,142 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 #	endif
 }
 
+// a * b - c
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fms(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_fmsub_ps(a, b, c);
+#	else
+		return glm_vec4_sub(glm_vec4_mul(a, b), c);
+#	endif
+}
+
+// c - a * b
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fnma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_fnmadd_ps(a, b, c);
+#	else
+		return glm_vec4_sub(c, glm_vec4_mul(a, b));
+#	endif
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// The same, on two vec4 at once
+GLM_FUNC_QUALIFIER __m256 glm_vec4x2_fma(__m256 a, __m256 b, __m256 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec4x2_fms(__m256 a, __m256 b, __m256 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_fmsub_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec4x2_fnma(__m256 a, __m256 b, __m256 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_fnmadd_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+#	endif
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_fma(glm_dvec2 a, glm_dvec2 b, glm_dvec2 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_fmadd_pd(a, b, c);
+#	else
+		return _mm_add_pd(_mm_mul_pd(a, b), c);
+#	endif
+}
+
+// c - a * b
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_fnma(glm_dvec2 a, glm_dvec2 b, glm_dvec2 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_fnmadd_pd(a, b, c);
+#	else
+		return _mm_sub_pd(c, _mm_mul_pd(a, b));
+#	endif
+}
+
+// Lanes 0 and 1 of x, and lanes 2 and 3, converted to double
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_lo(glm_vec4 x)
+{
+	return _mm_cvtps_pd(x);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_hi(glm_vec4 x)
+{
+	return _mm_cvtps_pd(_mm_movehl_ps(x, x));
+}
+
+// Back to float, rounded once
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dvec2(glm_dvec2 lo, glm_dvec2 hi)
+{
+	return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+}
+
+// The low 32 bits of each double lane, the 64 bits masks of double comparisons as float masks
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dvec2_bits(glm_dvec2 lo, glm_dvec2 hi)
+{
+	return _mm_shuffle_ps(_mm_castpd_ps(lo), _mm_castpd_ps(hi), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// Where Mask is set, a; elsewhere b
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 Mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, Mask);
+#	else
+		return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_select(glm_dvec2 Mask, glm_dvec2 a, glm_dvec2 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_pd(b, a, Mask);
+#	else
+		return _mm_or_pd(_mm_and_pd(Mask, a), _mm_andnot_pd(Mask, b));
+#	endif
+}
+
+// The lanes of Mask computed again by a scalar function, for the arguments a kernel doesn't cover.
+// Out of line of the kernels: with no lane set, they only pay for a movemask and a branch.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_call_lanes(int Lanes, glm_vec4 Result, glm_vec4 x, float (*Func)(float))
+{
+	float In[4], Out[4];
+	_mm_storeu_ps(In, x);
+	_mm_storeu_ps(Out, Result);
+	for(int i = 0; i < 4; ++i)
+		if(Lanes & (1 << i))
+			Out[i] = Func(In[i]);
+	return _mm_loadu_ps(Out);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_call_lanes(int Lanes, glm_vec4 Result, glm_vec4 x, glm_vec4 y, float (*Func)(float, float))
+{
+	float InX[4], InY[4], Out[4];
+	_mm_storeu_ps(InX, x);
+	_mm_storeu_ps(InY, y);
+	_mm_storeu_ps(Out, Result);
+	for(int i = 0; i < 4; ++i)
+		if(Lanes & (1 << i))
+			Out[i] = Func(InX[i], InY[i]);
+	return _mm_loadu_ps(Out);
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
 {
 	return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
@@ -3,7 +3,8 @@
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
+#include <cmath>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +18,142 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// exp and log come in the two accuracies of glm/simd/trigonometric.h: 1 ULP evaluated in double,
+// _lowp 3.5 ULP in float. pow only has the first: in float, the error of log(x) is multiplied by y.
+// test/core/core_func_exponential.cpp measures the errors.
+
+// e^x. Reduced with x = n * ln(2) + r, |r| <= ln(2) / 2, then the Taylor series to r^8, within
+// 2^-32 there.
+// Clamped to +-160, beyond the range of float results. NaN in, garbage out: the callers restore it.
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_exp(glm_dvec2 x)
+{
+	glm_dvec2 const Round = _mm_set1_pd(6755399441055744.0);
+	glm_dvec2 const c = _mm_max_pd(_mm_set1_pd(-160.0), _mm_min_pd(_mm_set1_pd(160.0), x));
+	glm_dvec2 const t = glm_dvec2_fma(c, _mm_set1_pd(1.44269504088896340736), Round);
+	glm_dvec2 const n = _mm_sub_pd(t, Round);
+	glm_dvec2 r = glm_dvec2_fnma(n, _mm_set1_pd(6.93147180369123816490e-1), c);
+	r = glm_dvec2_fnma(n, _mm_set1_pd(1.90821492927058770002e-10), r);
+	glm_dvec2 p = glm_dvec2_fma(r, _mm_set1_pd(1.0 / 40320.0), _mm_set1_pd(1.0 / 5040.0));
+	p = glm_dvec2_fma(p, r, _mm_set1_pd(1.0 / 720.0));
+	p = glm_dvec2_fma(p, r, _mm_set1_pd(1.0 / 120.0));
+	p = glm_dvec2_fma(p, r, _mm_set1_pd(1.0 / 24.0));
+	p = glm_dvec2_fma(p, r, _mm_set1_pd(1.0 / 6.0));
+	p = glm_dvec2_fma(p, r, _mm_set1_pd(0.5));
+	p = glm_dvec2_fma(p, r, _mm_set1_pd(1.0));
+	glm_dvec2 const e = glm_dvec2_fma(p, r, _mm_set1_pd(1.0));
+
+	// 2^n added to the exponent: n is the difference of the bits of t and Round
+	glm_ivec4 const Scale = _mm_slli_epi64(_mm_sub_epi64(_mm_castpd_si128(t), _mm_castpd_si128(Round)), 52);
+	return _mm_castsi128_pd(_mm_add_epi64(_mm_castpd_si128(e), Scale));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	glm_vec4 const Result = glm_vec4_dvec2(glm_dvec2_exp(glm_dvec2_lo(x)), glm_dvec2_exp(glm_dvec2_hi(x)));
+	return glm_vec4_select(_mm_cmpunord_ps(x, x), x, Result);
+}
+
+// x = 2^e * m, sqrt(1/2) <= m < sqrt(2), for positive normal floats
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_split(glm_vec4 x, glm_vec4 & Exponent)
+{
+	glm_ivec4 const Bits = _mm_add_epi32(_mm_castps_si128(x), _mm_set1_epi32(0x3f800000 - 0x3f3504f3));
+	Exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127)));
+	return _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(Bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f3504f3)));
+}
+
+// log(2^e * m) = e * ln(2) + 2 atanh(s), s = (m - 1) / (m + 1), |s| < 0.172: the series to s^13
+// is within 2^-39
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_log(glm_dvec2 m, glm_dvec2 e)
+{
+	glm_dvec2 const f = _mm_sub_pd(m, _mm_set1_pd(1.0));
+	glm_dvec2 const s = _mm_div_pd(f, _mm_add_pd(f, _mm_set1_pd(2.0)));
+	glm_dvec2 const z = _mm_mul_pd(s, s);
+
+	glm_dvec2 p = glm_dvec2_fma(z, _mm_set1_pd(1.0 / 13.0), _mm_set1_pd(1.0 / 11.0));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(1.0 / 9.0));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(1.0 / 7.0));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(1.0 / 5.0));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(1.0 / 3.0));
+	glm_dvec2 const s2 = _mm_add_pd(s, s);
+	return glm_dvec2_fma(e, _mm_set1_pd(6.93147180559945309417e-1), glm_dvec2_fma(_mm_mul_pd(s2, z), p, s2));
+}
+
+// Lanes that aren't positive normal floats
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_outside(glm_vec4 x)
+{
+	return _mm_or_ps(_mm_cmpnge_ps(x, _mm_set1_ps(1.17549435e-38f)), _mm_cmpgt_ps(x, _mm_set1_ps(3.40282347e+38f)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	glm_vec4 Exponent;
+	glm_vec4 const m = glm_vec4_log_split(x, Exponent);
+	glm_dvec2 const Lo = glm_dvec2_log(glm_dvec2_lo(m), glm_dvec2_lo(Exponent));
+	glm_dvec2 const Hi = glm_dvec2_log(glm_dvec2_hi(m), glm_dvec2_hi(Exponent));
+	glm_vec4 const Result = glm_vec4_dvec2(Lo, Hi);
+	int const Lanes = _mm_movemask_ps(glm_vec4_log_outside(x));
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, x, static_cast<float(*)(float)>(std::log)) : Result;
+}
+
+// exp(y * log(x)) in double, for positive normal x and finite y
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 Exponent;
+	glm_vec4 const m = glm_vec4_log_split(x, Exponent);
+	glm_dvec2 const Lo = glm_dvec2_log(glm_dvec2_lo(m), glm_dvec2_lo(Exponent));
+	glm_dvec2 const Hi = glm_dvec2_log(glm_dvec2_hi(m), glm_dvec2_hi(Exponent));
+	glm_vec4 const Result = glm_vec4_dvec2(
+		glm_dvec2_exp(_mm_mul_pd(glm_dvec2_lo(y), Lo)),
+		glm_dvec2_exp(_mm_mul_pd(glm_dvec2_hi(y), Hi)));
+	glm_vec4 const Outside = _mm_or_ps(glm_vec4_log_outside(x), _mm_cmpnle_ps(glm_vec4_abs(y), _mm_set1_ps(3.40282347e+38f)));
+	int const Lanes = _mm_movemask_ps(Outside);
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, x, y, static_cast<float(*)(float, float)>(std::pow)) : Result;
+}
+
+// Cephes' float exp, for the results that are normal floats
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_lowp(glm_vec4 x)
+{
+	glm_ivec4 const n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const nf = _mm_cvtepi32_ps(n);
+	glm_vec4 r = glm_vec4_fnma(nf, _mm_set1_ps(0.693359375f), x);
+	r = glm_vec4_fnma(nf, _mm_set1_ps(-2.12194440e-4f), r);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	glm_vec4 p = glm_vec4_fma(r, _mm_set1_ps(1.9875691500e-4f), _mm_set1_ps(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.0000001201e-1f));
+	glm_vec4 const e = glm_vec4_fma(p, z, _mm_add_ps(r, _mm_set1_ps(1.0f)));
+	glm_vec4 const Result = _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(e), _mm_slli_epi32(n, 23)));
+
+	glm_vec4 const Outside = _mm_or_ps(_mm_cmpnge_ps(x, _mm_set1_ps(-86.5f)), _mm_cmpgt_ps(x, _mm_set1_ps(88.3f)));
+	int const Lanes = _mm_movemask_ps(Outside);
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, x, static_cast<float(*)(float)>(std::exp)) : Result;
+}
+
+// Cephes' float log
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_lowp(glm_vec4 x)
+{
+	glm_vec4 Exponent;
+	glm_vec4 const f = _mm_sub_ps(glm_vec4_log_split(x, Exponent), _mm_set1_ps(1.0f));
+	glm_vec4 const z = _mm_mul_ps(f, f);
+
+	glm_vec4 p = glm_vec4_fma(f, _mm_set1_ps(7.0376836292e-2f), _mm_set1_ps(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.1676998740e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.4249322787e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(2.0000714765e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(3.3333331174e-1f));
+	glm_vec4 y = _mm_mul_ps(_mm_mul_ps(p, f), z);
+	y = glm_vec4_fma(Exponent, _mm_set1_ps(-2.12194440e-4f), y);
+	y = glm_vec4_fnma(z, _mm_set1_ps(0.5f), y);
+	glm_vec4 const Result = glm_vec4_fma(Exponent, _mm_set1_ps(0.693359375f), _mm_add_ps(f, y));
+
+	int const Lanes = _mm_movemask_ps(glm_vec4_log_outside(x));
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, x, static_cast<float(*)(float)>(std::log)) : Result;
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
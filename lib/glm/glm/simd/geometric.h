@@ -27,7 +27,13 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_distance(glm_vec4 p0, glm_vec4 p1)
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2)
 {
 #	if GLM_ARCH & GLM_ARCH_AVX_BIT
-		return _mm_dp_ps(v1, v2, 0xff);
+		// dpps is 4 uops with a long latency, two permutes and adds are cheaper and sum in the same order
+		glm_vec4 const mul0 = _mm_mul_ps(v1, v2);
+		glm_vec4 const swp0 = _mm_permute_ps(mul0, _MM_SHUFFLE(2, 3, 0, 1));
+		glm_vec4 const add0 = _mm_add_ps(mul0, swp0);
+		glm_vec4 const swp1 = _mm_permute_ps(add0, _MM_SHUFFLE(0, 1, 2, 3));
+		glm_vec4 const add1 = _mm_add_ps(add0, swp1);
+		return add1;
 #	elif GLM_ARCH & GLM_ARCH_SSE3_BIT
 		glm_vec4 const mul0 = _mm_mul_ps(v1, v2);
 		glm_vec4 const hadd0 = _mm_hadd_ps(mul0, mul0);
@@ -68,9 +74,8 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 	glm_vec4 const swp1 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 1, 0, 2));
 	glm_vec4 const swp2 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 0, 2, 1));
 	glm_vec4 const swp3 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 1, 0, 2));
-	glm_vec4 const mul0 = _mm_mul_ps(swp0, swp3);
 	glm_vec4 const mul1 = _mm_mul_ps(swp1, swp2);
-	glm_vec4 const sub0 = _mm_sub_ps(mul0, mul1);
+	glm_vec4 const sub0 = glm_vec4_fms(swp0, swp3, mul1);
 	return sub0;
 }
 
@@ -94,19 +99,16 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(N, I);
-	glm_vec4 const mul0 = _mm_mul_ps(N, dot0);
-	glm_vec4 const mul1 = _mm_mul_ps(mul0, _mm_set1_ps(2.0f));
-	glm_vec4 const sub0 = _mm_sub_ps(I, mul1);
+	glm_vec4 const add0 = _mm_add_ps(dot0, dot0);
+	glm_vec4 const sub0 = glm_vec4_fnma(N, add0, I);
 	return sub0;
 }
 
 GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(N, I);
-	glm_vec4 const mul0 = _mm_mul_ps(eta, eta);
-	glm_vec4 const mul1 = _mm_mul_ps(dot0, dot0);
-	glm_vec4 const sub0 = _mm_sub_ps(_mm_set1_ps(1.0f), mul0);
-	glm_vec4 const sub1 = _mm_sub_ps(_mm_set1_ps(1.0f), mul1);
+	glm_vec4 const sub0 = glm_vec4_fnma(eta, eta, _mm_set1_ps(1.0f));
+	glm_vec4 const sub1 = glm_vec4_fnma(dot0, dot0, _mm_set1_ps(1.0f));
 	glm_vec4 const mul2 = _mm_mul_ps(sub0, sub1);
 	
 	if(_mm_movemask_ps(_mm_cmplt_ss(mul2, _mm_set1_ps(0.0f))) == 0)
@@ -115,8 +117,7 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	glm_vec4 const sqt0 = _mm_sqrt_ps(mul2);
 	glm_vec4 const mad0 = glm_vec4_fma(eta, dot0, sqt0);
 	glm_vec4 const mul4 = _mm_mul_ps(mad0, N);
-	glm_vec4 const mul5 = _mm_mul_ps(eta, I);
-	glm_vec4 const sub2 = _mm_sub_ps(mul5, mul4);
+	glm_vec4 const sub2 = glm_vec4_fms(eta, I, mul4);
 
 	return sub2;
 }
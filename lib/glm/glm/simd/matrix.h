@@ -38,18 +38,46 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
+	// Two independent chains, so the second FMA doesn't wait on the first
 	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
 	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
+	__m128 a0 = glm_vec4_fma(m[1], v1, m0);
+	__m128 a1 = glm_vec4_fma(m[3], v3, m2);
 	__m128 a2 = _mm_add_ps(a0, a1);
 
 	return a2;
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Two products at once, m[i] holding column i of the first matrix in its low half and of
+// the second in its high half, v a vector for each
+GLM_FUNC_QUALIFIER __m256 glm_mat4_mul_vec4_x2(__m256 const m[4], __m256 v)
+{
+	__m256 v0 = _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 v1 = _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 v2 = _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 v3 = _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256 m0 = _mm256_mul_ps(m[0], v0);
+	__m256 m2 = _mm256_mul_ps(m[2], v2);
+	__m256 a0 = glm_vec4x2_fma(m[1], v1, m0);
+	__m256 a1 = glm_vec4x2_fma(m[3], v3, m2);
+	return _mm256_add_ps(a0, a1);
+}
+
+// The product of one matrix with two vectors, one in each half of v
+GLM_FUNC_QUALIFIER __m256 glm_mat4_mul_2vec4(glm_vec4 const m[4], __m256 v)
+{
+	__m256 const c[4] = {
+		_mm256_broadcast_ps(&m[0]),
+		_mm256_broadcast_ps(&m[1]),
+		_mm256_broadcast_ps(&m[2]),
+		_mm256_broadcast_ps(&m[3])};
+	return glm_mat4_mul_vec4_x2(c, v);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 {
 	__m128 i0 = m[0];
@@ -86,12 +114,10 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = glm_vec4_fma(in1[1], e1, m0);
+		__m128 a1 = glm_vec4_fma(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[0] = a2;
@@ -104,12 +130,10 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = glm_vec4_fma(in1[1], e1, m0);
+		__m128 a1 = glm_vec4_fma(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[1] = a2;
@@ -122,12 +146,10 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = glm_vec4_fma(in1[1], e1, m0);
+		__m128 a1 = glm_vec4_fma(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[2] = a2;
@@ -141,18 +163,71 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = glm_vec4_fma(in1[1], e1, m0);
+		__m128 a1 = glm_vec4_fma(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[3] = a2;
 	}
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Two products at once, in1[i], in2[i] and out[i] holding column i of the first product's
+// matrices in their low half and of the second's in their high half
+GLM_FUNC_QUALIFIER void glm_mat4_mul_x2(__m256 const in1[4], __m256 const in2[4], __m256 out[4])
+{
+	__m256 const b0 = in2[0], b1 = in2[1], b2 = in2[2], b3 = in2[3];
+	out[0] = glm_mat4_mul_vec4_x2(in1, b0);
+	out[1] = glm_mat4_mul_vec4_x2(in1, b1);
+	out[2] = glm_mat4_mul_vec4_x2(in1, b2);
+	out[3] = glm_mat4_mul_vec4_x2(in1, b3);
+}
+
+// Double precision product, a column per 256-bit register
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(__m256d const in1[4], double const in2[16], __m256d out[4])
+{
+	for(int i = 0; i < 4; ++i)
+	{
+		__m256d e0 = _mm256_broadcast_sd(&in2[i * 4 + 0]);
+		__m256d e1 = _mm256_broadcast_sd(&in2[i * 4 + 1]);
+		__m256d e2 = _mm256_broadcast_sd(&in2[i * 4 + 2]);
+		__m256d e3 = _mm256_broadcast_sd(&in2[i * 4 + 3]);
+
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		__m256d m0 = _mm256_mul_pd(in1[0], e0);
+		__m256d m2 = _mm256_mul_pd(in1[2], e2);
+		__m256d a0 = _mm256_fmadd_pd(in1[1], e1, m0);
+		__m256d a1 = _mm256_fmadd_pd(in1[3], e3, m2);
+#		else
+		__m256d a0 = _mm256_add_pd(_mm256_mul_pd(in1[0], e0), _mm256_mul_pd(in1[1], e1));
+		__m256d a1 = _mm256_add_pd(_mm256_mul_pd(in1[2], e2), _mm256_mul_pd(in1[3], e3));
+#		endif
+		out[i] = _mm256_add_pd(a0, a1);
+	}
+}
+
+GLM_FUNC_QUALIFIER __m256d glm_dmat4_mul_dvec4(__m256d const m[4], double const v[4])
+{
+	__m256d v0 = _mm256_broadcast_sd(&v[0]);
+	__m256d v1 = _mm256_broadcast_sd(&v[1]);
+	__m256d v2 = _mm256_broadcast_sd(&v[2]);
+	__m256d v3 = _mm256_broadcast_sd(&v[3]);
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	__m256d m0 = _mm256_mul_pd(m[0], v0);
+	__m256d m2 = _mm256_mul_pd(m[2], v2);
+	__m256d a0 = _mm256_fmadd_pd(m[1], v1, m0);
+	__m256d a1 = _mm256_fmadd_pd(m[3], v3, m2);
+#	else
+	__m256d a0 = _mm256_add_pd(_mm256_mul_pd(m[0], v0), _mm256_mul_pd(m[1], v1));
+	__m256d a1 = _mm256_add_pd(_mm256_mul_pd(m[2], v2), _mm256_mul_pd(m[3], v3));
+#	endif
+	return _mm256_add_pd(a0, a1);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 tmp0 = _mm_shuffle_ps(in[0], in[1], 0x44);
@@ -523,9 +598,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
 		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac0 = _mm_sub_ps(Mul00, Mul01);
+		Fac0 = glm_vec4_fms(Swp00, Swp01, Mul01);
 	}
 
 	__m128 Fac1;
@@ -543,9 +617,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
 		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac1 = _mm_sub_ps(Mul00, Mul01);
+		Fac1 = glm_vec4_fms(Swp00, Swp01, Mul01);
 	}
 
 
@@ -564,9 +637,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
 		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac2 = _mm_sub_ps(Mul00, Mul01);
+		Fac2 = glm_vec4_fms(Swp00, Swp01, Mul01);
 	}
 
 	__m128 Fac3;
@@ -584,9 +656,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
 		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac3 = _mm_sub_ps(Mul00, Mul01);
+		Fac3 = glm_vec4_fms(Swp00, Swp01, Mul01);
 	}
 
 	__m128 Fac4;
@@ -604,9 +675,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
 		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac4 = _mm_sub_ps(Mul00, Mul01);
+		Fac4 = glm_vec4_fms(Swp00, Swp01, Mul01);
 	}
 
 	__m128 Fac5;
@@ -624,9 +694,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
 		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac5 = _mm_sub_ps(Mul00, Mul01);
+		Fac5 = glm_vec4_fms(Swp00, Swp01, Mul01);
 	}
 
 	__m128 SignA = _mm_set_ps( 1.0f,-1.0f, 1.0f,-1.0f);
@@ -666,10 +735,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 	// + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
 	// - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
 	__m128 Mul00 = _mm_mul_ps(Vec1, Fac0);
-	__m128 Mul01 = _mm_mul_ps(Vec2, Fac1);
-	__m128 Mul02 = _mm_mul_ps(Vec3, Fac2);
-	__m128 Sub00 = _mm_sub_ps(Mul00, Mul01);
-	__m128 Add00 = _mm_add_ps(Sub00, Mul02);
+	__m128 Sub00 = glm_vec4_fnma(Vec2, Fac1, Mul00);
+	__m128 Add00 = glm_vec4_fma(Vec3, Fac2, Sub00);
 	__m128 Inv0 = _mm_mul_ps(SignB, Add00);
 
 	// col1
@@ -678,10 +745,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 	// - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
 	// + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
 	__m128 Mul03 = _mm_mul_ps(Vec0, Fac0);
-	__m128 Mul04 = _mm_mul_ps(Vec2, Fac3);
-	__m128 Mul05 = _mm_mul_ps(Vec3, Fac4);
-	__m128 Sub01 = _mm_sub_ps(Mul03, Mul04);
-	__m128 Add01 = _mm_add_ps(Sub01, Mul05);
+	__m128 Sub01 = glm_vec4_fnma(Vec2, Fac3, Mul03);
+	__m128 Add01 = glm_vec4_fma(Vec3, Fac4, Sub01);
 	__m128 Inv1 = _mm_mul_ps(SignA, Add01);
 
 	// col2
@@ -690,10 +755,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 	// + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
 	// - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
 	__m128 Mul06 = _mm_mul_ps(Vec0, Fac1);
-	__m128 Mul07 = _mm_mul_ps(Vec1, Fac3);
-	__m128 Mul08 = _mm_mul_ps(Vec3, Fac5);
-	__m128 Sub02 = _mm_sub_ps(Mul06, Mul07);
-	__m128 Add02 = _mm_add_ps(Sub02, Mul08);
+	__m128 Sub02 = glm_vec4_fnma(Vec1, Fac3, Mul06);
+	__m128 Add02 = glm_vec4_fma(Vec3, Fac5, Sub02);
 	__m128 Inv2 = _mm_mul_ps(SignB, Add02);
 
 	// col3
@@ -702,10 +765,8 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 	// - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
 	// + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
 	__m128 Mul09 = _mm_mul_ps(Vec0, Fac2);
-	__m128 Mul10 = _mm_mul_ps(Vec1, Fac4);
-	__m128 Mul11 = _mm_mul_ps(Vec2, Fac5);
-	__m128 Sub03 = _mm_sub_ps(Mul09, Mul10);
-	__m128 Add03 = _mm_add_ps(Sub03, Mul11);
+	__m128 Sub03 = glm_vec4_fnma(Vec1, Fac4, Mul09);
+	__m128 Add03 = glm_vec4_fma(Vec2, Fac5, Sub03);
 	__m128 Inv3 = _mm_mul_ps(SignA, Add03);
 
 	__m128 Row0 = _mm_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
@@ -727,6 +788,217 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 	out[3] = _mm_mul_ps(Inv3, Rcp0);
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Inverts two matrices at once, in[i] and out[i] holding column i of the first matrix in
+// their low half and of the second in their high half. Every shuffle above stays within
+// a 128-bit half, so this is the same sequence on 256-bit registers
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_x2(__m256 const in[4], __m256 out[4])
+{
+	__m256 Fac0;
+	{
+		//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+		//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+		//	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+		//	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+
+		__m256 Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+		__m256 Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(2, 2, 2, 2));
+
+		__m256 Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+		__m256 Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
+
+		__m256 Mul01 = _mm256_mul_ps(Swp02, Swp03);
+		Fac0 = glm_vec4x2_fms(Swp00, Swp01, Mul01);
+	}
+
+	__m256 Fac1;
+	{
+		//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		//	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+		//	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+
+		__m256 Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+		__m256 Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(1, 1, 1, 1));
+
+		__m256 Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
+		__m256 Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
+
+		__m256 Mul01 = _mm256_mul_ps(Swp02, Swp03);
+		Fac1 = glm_vec4x2_fms(Swp00, Swp01, Mul01);
+	}
+
+
+	__m256 Fac2;
+	{
+		//	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		//	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		//	valType SubFactor08 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+		//	valType SubFactor15 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+
+		__m256 Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(2, 2, 2, 2));
+		__m256 Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(1, 1, 1, 1));
+
+		__m256 Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
+		__m256 Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+
+		__m256 Mul01 = _mm256_mul_ps(Swp02, Swp03);
+		Fac2 = glm_vec4x2_fms(Swp00, Swp01, Mul01);
+	}
+
+	__m256 Fac3;
+	{
+		//	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		//	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		//	valType SubFactor09 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+		//	valType SubFactor16 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+
+		__m256 Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+		__m256 Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(0, 0, 0, 0));
+
+		__m256 Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
+
+		__m256 Mul01 = _mm256_mul_ps(Swp02, Swp03);
+		Fac3 = glm_vec4x2_fms(Swp00, Swp01, Mul01);
+	}
+
+	__m256 Fac4;
+	{
+		//	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		//	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		//	valType SubFactor10 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+		//	valType SubFactor17 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+
+		__m256 Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(2, 2, 2, 2));
+		__m256 Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(0, 0, 0, 0));
+
+		__m256 Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+
+		__m256 Mul01 = _mm256_mul_ps(Swp02, Swp03);
+		Fac4 = glm_vec4x2_fms(Swp00, Swp01, Mul01);
+	}
+
+	__m256 Fac5;
+	{
+		//	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+		//	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+		//	valType SubFactor12 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+		//	valType SubFactor18 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+
+		__m256 Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(1, 1, 1, 1));
+		__m256 Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(0, 0, 0, 0));
+
+		__m256 Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
+
+		__m256 Mul01 = _mm256_mul_ps(Swp02, Swp03);
+		Fac5 = glm_vec4x2_fms(Swp00, Swp01, Mul01);
+	}
+
+	__m256 SignA = _mm256_set_ps( 1.0f,-1.0f, 1.0f,-1.0f, 1.0f,-1.0f, 1.0f,-1.0f);
+	__m256 SignB = _mm256_set_ps(-1.0f, 1.0f,-1.0f, 1.0f,-1.0f, 1.0f,-1.0f, 1.0f);
+
+	// m[1][0]
+	// m[0][0]
+	// m[0][0]
+	// m[0][0]
+	__m256 Temp0 = _mm256_shuffle_ps(in[1], in[0], _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 Vec0 = _mm256_shuffle_ps(Temp0, Temp0, _MM_SHUFFLE(2, 2, 2, 0));
+
+	// m[1][1]
+	// m[0][1]
+	// m[0][1]
+	// m[0][1]
+	__m256 Temp1 = _mm256_shuffle_ps(in[1], in[0], _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 Vec1 = _mm256_shuffle_ps(Temp1, Temp1, _MM_SHUFFLE(2, 2, 2, 0));
+
+	// m[1][2]
+	// m[0][2]
+	// m[0][2]
+	// m[0][2]
+	__m256 Temp2 = _mm256_shuffle_ps(in[1], in[0], _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 Vec2 = _mm256_shuffle_ps(Temp2, Temp2, _MM_SHUFFLE(2, 2, 2, 0));
+
+	// m[1][3]
+	// m[0][3]
+	// m[0][3]
+	// m[0][3]
+	__m256 Temp3 = _mm256_shuffle_ps(in[1], in[0], _MM_SHUFFLE(3, 3, 3, 3));
+	__m256 Vec3 = _mm256_shuffle_ps(Temp3, Temp3, _MM_SHUFFLE(2, 2, 2, 0));
+
+	// col0
+	// + (Vec1[0] * Fac0[0] - Vec2[0] * Fac1[0] + Vec3[0] * Fac2[0]),
+	// - (Vec1[1] * Fac0[1] - Vec2[1] * Fac1[1] + Vec3[1] * Fac2[1]),
+	// + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
+	// - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
+	__m256 Mul00 = _mm256_mul_ps(Vec1, Fac0);
+	__m256 Sub00 = glm_vec4x2_fnma(Vec2, Fac1, Mul00);
+	__m256 Add00 = glm_vec4x2_fma(Vec3, Fac2, Sub00);
+	__m256 Inv0 = _mm256_mul_ps(SignB, Add00);
+
+	// col1
+	// - (Vec0[0] * Fac0[0] - Vec2[0] * Fac3[0] + Vec3[0] * Fac4[0]),
+	// + (Vec0[0] * Fac0[1] - Vec2[1] * Fac3[1] + Vec3[1] * Fac4[1]),
+	// - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
+	// + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
+	__m256 Mul03 = _mm256_mul_ps(Vec0, Fac0);
+	__m256 Sub01 = glm_vec4x2_fnma(Vec2, Fac3, Mul03);
+	__m256 Add01 = glm_vec4x2_fma(Vec3, Fac4, Sub01);
+	__m256 Inv1 = _mm256_mul_ps(SignA, Add01);
+
+	// col2
+	// + (Vec0[0] * Fac1[0] - Vec1[0] * Fac3[0] + Vec3[0] * Fac5[0]),
+	// - (Vec0[0] * Fac1[1] - Vec1[1] * Fac3[1] + Vec3[1] * Fac5[1]),
+	// + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
+	// - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
+	__m256 Mul06 = _mm256_mul_ps(Vec0, Fac1);
+	__m256 Sub02 = glm_vec4x2_fnma(Vec1, Fac3, Mul06);
+	__m256 Add02 = glm_vec4x2_fma(Vec3, Fac5, Sub02);
+	__m256 Inv2 = _mm256_mul_ps(SignB, Add02);
+
+	// col3
+	// - (Vec1[0] * Fac2[0] - Vec1[0] * Fac4[0] + Vec2[0] * Fac5[0]),
+	// + (Vec1[0] * Fac2[1] - Vec1[1] * Fac4[1] + Vec2[1] * Fac5[1]),
+	// - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
+	// + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
+	__m256 Mul09 = _mm256_mul_ps(Vec0, Fac2);
+	__m256 Sub03 = glm_vec4x2_fnma(Vec1, Fac4, Mul09);
+	__m256 Add03 = glm_vec4x2_fma(Vec2, Fac5, Sub03);
+	__m256 Inv3 = _mm256_mul_ps(SignA, Add03);
+
+	__m256 Row0 = _mm256_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 Row1 = _mm256_shuffle_ps(Inv2, Inv3, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 Row2 = _mm256_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
+
+	//	valType Determinant = m[0][0] * Inverse[0][0] 
+	//						+ m[0][1] * Inverse[1][0] 
+	//						+ m[0][2] * Inverse[2][0] 
+	//						+ m[0][3] * Inverse[3][0];
+	__m256 Det0 = _mm256_dp_ps(in[0], Row2, 0xff);
+	__m256 Rcp0 = _mm256_div_ps(_mm256_set1_ps(1.0f), Det0);
+
+	//	Inverse /= Determinant;
+	out[0] = _mm256_mul_ps(Inv0, Rcp0);
+	out[1] = _mm256_mul_ps(Inv1, Rcp0);
+	out[2] = _mm256_mul_ps(Inv2, Rcp0);
+	out[3] = _mm256_mul_ps(Inv3, Rcp0);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 GLM_FUNC_QUALIFIER void glm_mat4_inverse_lowp(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 Fac0;
@@ -946,77 +1218,53 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse_lowp(glm_vec4 const in[4], glm_vec4 out
 	out[2] = _mm_mul_ps(Inv2, Rcp0);
 	out[3] = _mm_mul_ps(Inv3, Rcp0);
 }
-/*
-GLM_FUNC_QUALIFIER void glm_mat4_rotate(__m128 const in[4], float Angle, float const v[3], __m128 out[4])
+
+// The three columns of a rotation of an angle of cosine c and sine s around a normalized axis,
+// w lanes 0: out[i] = c * e[i] + (1 - c) * axis[i] * axis + s * cross(axis, e[i])
+GLM_FUNC_QUALIFIER void glm_mat4_rotation(float c, float s, glm_vec4 axis, glm_vec4 out[3])
 {
-	float a = glm::radians(Angle);
-	float c = cos(a);
-	float s = sin(a);
-
-	glm::vec4 AxisA(v[0], v[1], v[2], float(0));
-	__m128 AxisB = _mm_set_ps(AxisA.w, AxisA.z, AxisA.y, AxisA.x);
-	__m128 AxisC = detail::sse_nrm_ps(AxisB);
-
-	__m128 Cos0 = _mm_set_ss(c);
-	__m128 CosA = _mm_shuffle_ps(Cos0, Cos0, _MM_SHUFFLE(0, 0, 0, 0));
-	__m128 Sin0 = _mm_set_ss(s);
-	__m128 SinA = _mm_shuffle_ps(Sin0, Sin0, _MM_SHUFFLE(0, 0, 0, 0));
-
-	// tvec3<T, P> temp = (valType(1) - c) * axis;
-	__m128 Temp0 = _mm_sub_ps(one, CosA);
-	__m128 Temp1 = _mm_mul_ps(Temp0, AxisC);
-	
-	//Rotate[0][0] = c + temp[0] * axis[0];
-	//Rotate[0][1] = 0 + temp[0] * axis[1] + s * axis[2];
-	//Rotate[0][2] = 0 + temp[0] * axis[2] - s * axis[1];
-	__m128 Axis0 = _mm_shuffle_ps(AxisC, AxisC, _MM_SHUFFLE(0, 0, 0, 0));
-	__m128 TmpA0 = _mm_mul_ps(Axis0, AxisC);
-	__m128 CosA0 = _mm_shuffle_ps(Cos0, Cos0, _MM_SHUFFLE(1, 1, 1, 0));
-	__m128 TmpA1 = _mm_add_ps(CosA0, TmpA0);
-	__m128 SinA0 = SinA;//_mm_set_ps(0.0f, s, -s, 0.0f);
-	__m128 TmpA2 = _mm_shuffle_ps(AxisC, AxisC, _MM_SHUFFLE(3, 1, 2, 3));
-	__m128 TmpA3 = _mm_mul_ps(SinA0, TmpA2);
-	__m128 TmpA4 = _mm_add_ps(TmpA1, TmpA3);
-
-	//Rotate[1][0] = 0 + temp[1] * axis[0] - s * axis[2];
-	//Rotate[1][1] = c + temp[1] * axis[1];
-	//Rotate[1][2] = 0 + temp[1] * axis[2] + s * axis[0];
-	__m128 Axis1 = _mm_shuffle_ps(AxisC, AxisC, _MM_SHUFFLE(1, 1, 1, 1));
-	__m128 TmpB0 = _mm_mul_ps(Axis1, AxisC);
-	__m128 CosA1 = _mm_shuffle_ps(Cos0, Cos0, _MM_SHUFFLE(1, 1, 0, 1));
-	__m128 TmpB1 = _mm_add_ps(CosA1, TmpB0);
-	__m128 SinB0 = SinA;//_mm_set_ps(-s, 0.0f, s, 0.0f);
-	__m128 TmpB2 = _mm_shuffle_ps(AxisC, AxisC, _MM_SHUFFLE(3, 0, 3, 2));
-	__m128 TmpB3 = _mm_mul_ps(SinA0, TmpB2);
-	__m128 TmpB4 = _mm_add_ps(TmpB1, TmpB3);
-
-	//Rotate[2][0] = 0 + temp[2] * axis[0] + s * axis[1];
-	//Rotate[2][1] = 0 + temp[2] * axis[1] - s * axis[0];
-	//Rotate[2][2] = c + temp[2] * axis[2];
-	__m128 Axis2 = _mm_shuffle_ps(AxisC, AxisC, _MM_SHUFFLE(2, 2, 2, 2));
-	__m128 TmpC0 = _mm_mul_ps(Axis2, AxisC);
-	__m128 CosA2 = _mm_shuffle_ps(Cos0, Cos0, _MM_SHUFFLE(1, 0, 1, 1));
-	__m128 TmpC1 = _mm_add_ps(CosA2, TmpC0);
-	__m128 SinC0 = SinA;//_mm_set_ps(s, -s, 0.0f, 0.0f);
-	__m128 TmpC2 = _mm_shuffle_ps(AxisC, AxisC, _MM_SHUFFLE(3, 3, 0, 1));
-	__m128 TmpC3 = _mm_mul_ps(SinA0, TmpC2);
-	__m128 TmpC4 = _mm_add_ps(TmpC1, TmpC3);
-
-	__m128 Result[4];
-	Result[0] = TmpA4;
-	Result[1] = TmpB4;
-	Result[2] = TmpC4;
-	Result[3] = _mm_set_ps(1, 0, 0, 0);
-
-	//tmat4x4<valType> Result(uninitialize);
-	//Result[0] = m[0] * Rotate[0][0] + m[1] * Rotate[0][1] + m[2] * Rotate[0][2];
-	//Result[1] = m[0] * Rotate[1][0] + m[1] * Rotate[1][1] + m[2] * Rotate[1][2];
-	//Result[2] = m[0] * Rotate[2][0] + m[1] * Rotate[2][1] + m[2] * Rotate[2][2];
-	//Result[3] = m[3];
-	//return Result;
-	sse_mul_ps(in, Result, out);
+	glm_vec4 const temp = _mm_mul_ps(_mm_set1_ps(1.0f - c), axis);
+	glm_vec4 const sin0 = _mm_mul_ps(_mm_set1_ps(s), axis);
+
+	// (0, s * z, -s * y), (-s * z, 0, s * x), (s * y, -s * x, 0), w of axis being 0
+	glm_vec4 const skew0 = _mm_xor_ps(_mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(3, 1, 2, 3)), _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f));
+	glm_vec4 const skew1 = _mm_xor_ps(_mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(3, 0, 3, 2)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f));
+	glm_vec4 const skew2 = _mm_xor_ps(_mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(3, 3, 0, 1)), _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f));
+
+	out[0] = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(temp, temp, _MM_SHUFFLE(0, 0, 0, 0)), axis), _mm_add_ps(_mm_setr_ps(c, 0.0f, 0.0f, 0.0f), skew0));
+	out[1] = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(temp, temp, _MM_SHUFFLE(1, 1, 1, 1)), axis), _mm_add_ps(_mm_setr_ps(0.0f, c, 0.0f, 0.0f), skew1));
+	out[2] = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(temp, temp, _MM_SHUFFLE(2, 2, 2, 2)), axis), _mm_add_ps(_mm_setr_ps(0.0f, 0.0f, c, 0.0f), skew2));
 }
-*/
+
+// in * rotation, the rotation only touching the first three columns
+GLM_FUNC_QUALIFIER void glm_mat4_rotate(glm_vec4 const in[4], float c, float s, glm_vec4 axis, glm_vec4 out[4])
+{
+	glm_vec4 r[3];
+	glm_mat4_rotation(c, s, axis, r);
+
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const mul0 = _mm_mul_ps(in[0], _mm_shuffle_ps(r[i], r[i], _MM_SHUFFLE(0, 0, 0, 0)));
+		glm_vec4 const mul1 = _mm_mul_ps(in[1], _mm_shuffle_ps(r[i], r[i], _MM_SHUFFLE(1, 1, 1, 1)));
+		glm_vec4 const mul2 = _mm_mul_ps(in[2], _mm_shuffle_ps(r[i], r[i], _MM_SHUFFLE(2, 2, 2, 2)));
+		out[i] = _mm_add_ps(_mm_add_ps(mul0, mul1), mul2);
+	}
+	out[3] = in[3];
+}
+
+// View matrix of the orthonormal basis s, u, b, w lanes 0, placed at eye: the basis vectors are
+// the rows of the rotation, and the translation is the rotated -eye
+GLM_FUNC_QUALIFIER void glm_mat4_lookAt(glm_vec4 eye, glm_vec4 s, glm_vec4 u, glm_vec4 b, glm_vec4 out[4])
+{
+	glm_vec4 const rows[4] = {s, u, b, _mm_setzero_ps()};
+	glm_mat4_transpose(rows, out);
+
+	glm_vec4 const mul0 = _mm_mul_ps(out[0], _mm_shuffle_ps(eye, eye, _MM_SHUFFLE(0, 0, 0, 0)));
+	glm_vec4 const mul1 = _mm_mul_ps(out[1], _mm_shuffle_ps(eye, eye, _MM_SHUFFLE(1, 1, 1, 1)));
+	glm_vec4 const mul2 = _mm_mul_ps(out[2], _mm_shuffle_ps(eye, eye, _MM_SHUFFLE(2, 2, 2, 2)));
+	out[3] = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), _mm_add_ps(_mm_add_ps(mul0, mul1), mul2));
+}
+
 GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r, __m128 out[4])
 {
 	out[0] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0)));
@@ -3,6 +3,358 @@
 
 #pragma once
 
+#include "platform.h"
+#include "matrix.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// clamp(x, minVal, maxVal) as the scalar glm::clamp, which returns minVal for NaN
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_clamp_scalar(glm_vec4 x, glm_vec4 minVal, glm_vec4 maxVal)
+{
+	return _mm_min_ps(_mm_max_ps(x, minVal), maxVal);
+}
+
+// round(x) rounding halfway cases away from zero, as std::round, to 32-bit integers for |x| < 2^31
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_i32(glm_vec4 x)
+{
+	glm_vec4 const abs0 = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+	glm_ivec4 const trc0 = _mm_cvttps_epi32(abs0);
+	glm_vec4 const frc0 = _mm_sub_ps(abs0, _mm_cvtepi32_ps(trc0));
+	glm_ivec4 const rnd0 = _mm_sub_epi32(trc0, _mm_castps_si128(_mm_cmpge_ps(frc0, _mm_set1_ps(0.5f))));
+	glm_ivec4 const sgn0 = _mm_srai_epi32(_mm_castps_si128(x), 31);
+	return _mm_sub_epi32(_mm_xor_si128(rnd0, sgn0), sgn0);
+}
+
+// 16 floats to unorm8: round(clamp(v, 0, 1) * 255)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packUnorm16x8(glm_vec4 const v[4])
+{
+	glm_vec4 const zro0 = _mm_setzero_ps();
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(255.0f);
+
+	glm_ivec4 i[4];
+	for(int c = 0; c < 4; ++c)
+		i[c] = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v[c], zro0, one0), scl0));
+	return _mm_packus_epi16(_mm_packs_epi32(i[0], i[1]), _mm_packs_epi32(i[2], i[3]));
+}
+
+// 16 floats to snorm8: round(clamp(v, -1, 1) * 127)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packSnorm16x8(glm_vec4 const v[4])
+{
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const max0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(127.0f);
+
+	glm_ivec4 i[4];
+	for(int c = 0; c < 4; ++c)
+		i[c] = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v[c], min0, max0), scl0));
+	return _mm_packs_epi16(_mm_packs_epi32(i[0], i[1]), _mm_packs_epi32(i[2], i[3]));
+}
+
+// 8 floats to unorm16: round(clamp(v, 0, 1) * 65535)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packUnorm8x16(glm_vec4 const v[2])
+{
+	glm_vec4 const zro0 = _mm_setzero_ps();
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(65535.0f);
+
+	glm_ivec4 const i0 = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v[0], zro0, one0), scl0));
+	glm_ivec4 const i1 = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v[1], zro0, one0), scl0));
+
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_packus_epi32(i0, i1);
+#	else
+		// Biased into the signed range for the saturating pack, then back
+		glm_ivec4 const bias0 = _mm_set1_epi32(32768);
+		glm_ivec4 const pack0 = _mm_packs_epi32(_mm_sub_epi32(i0, bias0), _mm_sub_epi32(i1, bias0));
+		return _mm_xor_si128(pack0, _mm_set1_epi16(static_cast<short>(0x8000)));
+#	endif
+}
+
+// 8 floats to snorm16: round(clamp(v, -1, 1) * 32767)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packSnorm8x16(glm_vec4 const v[2])
+{
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const max0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(32767.0f);
+
+	glm_ivec4 const i0 = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v[0], min0, max0), scl0));
+	glm_ivec4 const i1 = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v[1], min0, max0), scl0));
+	return _mm_packs_epi32(i0, i1);
+}
+
+// 16 unorm8 to floats: p / 255
+GLM_FUNC_QUALIFIER void glm_unpackUnorm16x8(glm_ivec4 p, glm_vec4 v[4])
+{
+	glm_ivec4 const zro0 = _mm_setzero_si128();
+	glm_vec4 const scl0 = _mm_set1_ps(0.0039215686274509803921568627451f); // 1 / 255
+	glm_ivec4 const lo0 = _mm_unpacklo_epi8(p, zro0);
+	glm_ivec4 const hi0 = _mm_unpackhi_epi8(p, zro0);
+
+	v[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo0, zro0)), scl0);
+	v[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo0, zro0)), scl0);
+	v[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi0, zro0)), scl0);
+	v[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi0, zro0)), scl0);
+}
+
+// 16 snorm8 to floats: clamp(p / 127, -1, 1)
+GLM_FUNC_QUALIFIER void glm_unpackSnorm16x8(glm_ivec4 p, glm_vec4 v[4])
+{
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const max0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(0.00787401574803149606299212598425f); // 1 / 127
+
+	// Sign extension: each value moved to the high half of a wider lane, then shifted back arithmetically
+	glm_ivec4 const lo0 = _mm_srai_epi16(_mm_unpacklo_epi8(p, p), 8);
+	glm_ivec4 const hi0 = _mm_srai_epi16(_mm_unpackhi_epi8(p, p), 8);
+
+	v[0] = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo0, lo0), 16)), scl0), min0, max0);
+	v[1] = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo0, lo0), 16)), scl0), min0, max0);
+	v[2] = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi0, hi0), 16)), scl0), min0, max0);
+	v[3] = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi0, hi0), 16)), scl0), min0, max0);
+}
+
+// 8 unorm16 to floats: p / 65535
+GLM_FUNC_QUALIFIER void glm_unpackUnorm8x16(glm_ivec4 p, glm_vec4 v[2])
+{
+	glm_ivec4 const zro0 = _mm_setzero_si128();
+	glm_vec4 const scl0 = _mm_set1_ps(1.5259021896696421759365224689097e-5f); // 1 / 65535
+
+	v[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(p, zro0)), scl0);
+	v[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(p, zro0)), scl0);
+}
+
+// 8 snorm16 to floats: clamp(p / 32767, -1, 1)
+GLM_FUNC_QUALIFIER void glm_unpackSnorm8x16(glm_ivec4 p, glm_vec4 v[2])
+{
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const max0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(3.0518509475997192297128208258309e-5f); // 1 / 32767
+
+	v[0] = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16)), scl0), min0, max0);
+	v[1] = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(p, p), 16)), scl0), min0, max0);
+}
+
+// 4 floats to halfs in the low 16 bits of each lane, rounded to nearest even. NaNs are made quiet, as F16C does.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packHalf_i32(glm_vec4 v)
+{
+	glm_ivec4 const bits0 = _mm_castps_si128(v);
+	glm_ivec4 const sgn0 = _mm_and_si128(bits0, _mm_set1_epi32(static_cast<int>(0x80000000)));
+	glm_ivec4 const abs0 = _mm_xor_si128(bits0, sgn0);
+
+	// |v| >= 65520 rounds to infinity, NaNs keep the high bits of their payload
+	glm_ivec4 const nan0 = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x7F800000));
+	glm_ivec4 const inf0 = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x477FEFFF));
+	glm_ivec4 const nanBits0 = _mm_or_si128(_mm_set1_epi32(0x7E00), _mm_and_si128(_mm_srli_epi32(abs0, 13), _mm_set1_epi32(0x03FF)));
+	glm_ivec4 const infBits0 = _mm_or_si128(_mm_andnot_si128(nan0, _mm_set1_epi32(0x7C00)), _mm_and_si128(nan0, nanBits0));
+
+	// Below 2^-14 the result is subnormal: adding 0.5 aligns the 10 bits of the mantissa with the bottom of the float and rounds them
+	glm_ivec4 const sub0 = _mm_cmplt_epi32(abs0, _mm_set1_epi32(0x38800000));
+	glm_ivec4 const subBits0 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(abs0), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+
+	// Normal: rebias the exponent, then round to nearest even on the 13 dropped bits
+	glm_ivec4 const odd0 = _mm_and_si128(_mm_srli_epi32(abs0, 13), _mm_set1_epi32(1));
+	glm_ivec4 const nrm0 = _mm_add_epi32(_mm_add_epi32(abs0, _mm_set1_epi32(static_cast<int>(0xC8000FFF))), odd0);
+	glm_ivec4 const nrmBits0 = _mm_srli_epi32(nrm0, 13);
+
+	glm_ivec4 const fin0 = _mm_or_si128(_mm_and_si128(sub0, subBits0), _mm_andnot_si128(sub0, nrmBits0));
+	glm_ivec4 const res0 = _mm_or_si128(_mm_and_si128(inf0, infBits0), _mm_andnot_si128(inf0, fin0));
+	return _mm_or_si128(res0, _mm_srli_epi32(sgn0, 16));
+}
+
+// 4 halfs in the low 16 bits of each lane to floats, exactly. NaNs are made quiet, as F16C does.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackHalf_i32(glm_ivec4 p)
+{
+	glm_ivec4 const abs0 = _mm_and_si128(p, _mm_set1_epi32(0x7FFF));
+	glm_ivec4 const sgn0 = _mm_slli_epi32(_mm_xor_si128(p, abs0), 16);
+
+	// The exponent and mantissa shifted in place and scaled by 2^112 to rebias, which also normalizes subnormals
+	glm_vec4 const scl0 = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(abs0, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+
+	glm_ivec4 const inf0 = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x7BFF));
+	glm_ivec4 const nan0 = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x7C00));
+	glm_ivec4 const exp0 = _mm_or_si128(_mm_and_si128(inf0, _mm_set1_epi32(0x7F800000)), _mm_and_si128(nan0, _mm_set1_epi32(0x00400000)));
+	return _mm_castsi128_ps(_mm_or_si128(_mm_or_si128(_mm_castps_si128(scl0), exp0), sgn0));
+}
+
+// 8 floats to halfs
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packHalf8x16(glm_vec4 const v[2])
+{
+#	if GLM_HAS_F16C
+		return _mm_unpacklo_epi64(_mm_cvtps_ph(v[0], _MM_FROUND_TO_NEAREST_INT), _mm_cvtps_ph(v[1], _MM_FROUND_TO_NEAREST_INT));
+#	else
+		// The halfs are below 2^16 and the sign extended lanes pack without saturation
+		glm_ivec4 const h0 = _mm_srai_epi32(_mm_slli_epi32(glm_vec4_packHalf_i32(v[0]), 16), 16);
+		glm_ivec4 const h1 = _mm_srai_epi32(_mm_slli_epi32(glm_vec4_packHalf_i32(v[1]), 16), 16);
+		return _mm_packs_epi32(h0, h1);
+#	endif
+}
+
+// 8 halfs to floats
+GLM_FUNC_QUALIFIER void glm_unpackHalf8x16(glm_ivec4 p, glm_vec4 v[2])
+{
+#	if GLM_HAS_F16C
+		v[0] = _mm_cvtph_ps(p);
+		v[1] = _mm_cvtph_ps(_mm_unpackhi_epi64(p, p));
+#	else
+		glm_ivec4 const zro0 = _mm_setzero_si128();
+		v[0] = glm_vec4_unpackHalf_i32(_mm_unpacklo_epi16(p, zro0));
+		v[1] = glm_vec4_unpackHalf_i32(_mm_unpackhi_epi16(p, zro0));
+#	endif
+}
+
+// 10_10_10_2 lanes of x, y, z and w, the components already rounded to integers
+GLM_FUNC_QUALIFIER glm_ivec4 glm_pack3x10_1x2(glm_ivec4 x, glm_ivec4 y, glm_ivec4 z, glm_ivec4 w)
+{
+	glm_ivec4 const msk0 = _mm_set1_epi32(0x3FF);
+	glm_ivec4 const xy0 = _mm_or_si128(_mm_and_si128(x, msk0), _mm_slli_epi32(_mm_and_si128(y, msk0), 10));
+	glm_ivec4 const zw0 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(z, msk0), 20), _mm_slli_epi32(w, 30));
+	return _mm_or_si128(xy0, zw0);
+}
+
+// 4 vec4 to 10_10_10_2 snorm: round(clamp(v, -1, 1) * vec4(511, 511, 511, 1))
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packSnorm3x10_1x2(glm_vec4 const v[4])
+{
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const max0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(511.0f);
+
+	glm_vec4 soa[4];
+	glm_mat4_transpose(v, soa);
+	return glm_pack3x10_1x2(
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[0], min0, max0), scl0)),
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[1], min0, max0), scl0)),
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[2], min0, max0), scl0)),
+		glm_vec4_round_i32(glm_vec4_clamp_scalar(soa[3], min0, max0)));
+}
+
+// 4 vec4 to 10_10_10_2 unorm: round(clamp(v, 0, 1) * vec4(1023, 1023, 1023, 3))
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packUnorm3x10_1x2(glm_vec4 const v[4])
+{
+	glm_vec4 const zro0 = _mm_setzero_ps();
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(1023.0f);
+
+	glm_vec4 soa[4];
+	glm_mat4_transpose(v, soa);
+	return glm_pack3x10_1x2(
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[0], zro0, one0), scl0)),
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[1], zro0, one0), scl0)),
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[2], zro0, one0), scl0)),
+		glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(soa[3], zro0, one0), _mm_set1_ps(3.0f))));
+}
+
+// 4 10_10_10_2 snorm to vec4: clamp(p / vec4(511, 511, 511, 1), -1, 1)
+GLM_FUNC_QUALIFIER void glm_unpackSnorm3x10_1x2(glm_ivec4 p, glm_vec4 v[4])
+{
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const max0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(511.0f);
+
+	glm_vec4 soa[4];
+	soa[0] = glm_vec4_clamp_scalar(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 22), 22)), scl0), min0, max0);
+	soa[1] = glm_vec4_clamp_scalar(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 12), 22)), scl0), min0, max0);
+	soa[2] = glm_vec4_clamp_scalar(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 2), 22)), scl0), min0, max0);
+	soa[3] = glm_vec4_clamp_scalar(_mm_cvtepi32_ps(_mm_srai_epi32(p, 30)), min0, max0);
+	glm_mat4_transpose(soa, v);
+}
+
+// 4 10_10_10_2 unorm to vec4: p * vec4(1 / 1023, 1 / 1023, 1 / 1023, 1 / 3)
+GLM_FUNC_QUALIFIER void glm_unpackUnorm3x10_1x2(glm_ivec4 p, glm_vec4 v[4])
+{
+	glm_ivec4 const msk0 = _mm_set1_epi32(0x3FF);
+	glm_vec4 const scl0 = _mm_set1_ps(1.0f / 1023.f);
+
+	glm_vec4 soa[4];
+	soa[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, msk0)), scl0);
+	soa[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 10), msk0)), scl0);
+	soa[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 20), msk0)), scl0);
+	soa[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(p, 30)), _mm_set1_ps(1.0f / 3.f));
+	glm_mat4_transpose(soa, v);
+}
+
+// 4 vec3 stored contiguously, 12 floats, to one register per component
+GLM_FUNC_QUALIFIER void glm_vec3x4_load_soa(float const * in, glm_vec4 & x, glm_vec4 & y, glm_vec4 & z)
+{
+	glm_vec4 const a = _mm_loadu_ps(in + 0); // x0 y0 z0 x1
+	glm_vec4 const b = _mm_loadu_ps(in + 4); // y1 z1 x2 y2
+	glm_vec4 const c = _mm_loadu_ps(in + 8); // z2 x3 y3 z3
+
+	x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2)), _MM_SHUFFLE(3, 0, 3, 0));
+	y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// One register per component to 4 vec3 stored contiguously, 12 floats
+GLM_FUNC_QUALIFIER void glm_vec3x4_store_soa(float * out, glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 soa[4];
+	soa[0] = x;
+	soa[1] = y;
+	soa[2] = z;
+	soa[3] = _mm_setzero_ps();
+
+	glm_vec4 r[4];
+	glm_mat4_transpose(soa, r);
+
+	_mm_storeu_ps(out + 0, _mm_shuffle_ps(r[0], _mm_shuffle_ps(r[0], r[1], _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0)));
+	_mm_storeu_ps(out + 4, _mm_shuffle_ps(r[1], r[2], _MM_SHUFFLE(1, 0, 2, 1)));
+	_mm_storeu_ps(out + 8, _mm_shuffle_ps(_mm_shuffle_ps(r[2], r[3], _MM_SHUFFLE(0, 0, 2, 2)), r[3], _MM_SHUFFLE(2, 1, 2, 0)));
+}
+
+// x >= 0 ? 1 : -1 applied to a: the sign of a flipped where x is negative
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mul_signNotZero(glm_vec4 a, glm_vec4 x)
+{
+	return _mm_xor_ps(a, _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_set1_ps(-0.0f)));
+}
+
+// Octahedral projection of 4 directions given by components, folded on the lower hemisphere, as snorm16 pairs
+GLM_FUNC_QUALIFIER glm_ivec4 glm_packOctahedral2x16(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 const abs0 = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+
+	glm_vec4 const sum0 = _mm_add_ps(_mm_add_ps(_mm_and_ps(x, abs0), _mm_and_ps(y, abs0)), _mm_and_ps(z, abs0));
+	glm_vec4 const u0 = _mm_div_ps(x, sum0);
+	glm_vec4 const v0 = _mm_div_ps(y, sum0);
+	glm_vec4 const w0 = _mm_div_ps(z, sum0);
+
+	glm_vec4 const fu0 = glm_vec4_mul_signNotZero(_mm_sub_ps(one0, _mm_and_ps(v0, abs0)), u0);
+	glm_vec4 const fv0 = glm_vec4_mul_signNotZero(_mm_sub_ps(one0, _mm_and_ps(u0, abs0)), v0);
+	glm_vec4 const up0 = _mm_cmpge_ps(w0, _mm_setzero_ps());
+	glm_vec4 const u1 = _mm_or_ps(_mm_and_ps(up0, u0), _mm_andnot_ps(up0, fu0));
+	glm_vec4 const v1 = _mm_or_ps(_mm_and_ps(up0, v0), _mm_andnot_ps(up0, fv0));
+
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(32767.0f);
+	glm_ivec4 const iu0 = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(u1, min0, one0), scl0));
+	glm_ivec4 const iv0 = glm_vec4_round_i32(_mm_mul_ps(glm_vec4_clamp_scalar(v1, min0, one0), scl0));
+	return _mm_or_si128(_mm_and_si128(iu0, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(iv0, 16));
+}
+
+// 4 octahedral snorm16 pairs to unit directions, one register per component
+GLM_FUNC_QUALIFIER void glm_unpackOctahedral2x16(glm_ivec4 p, glm_vec4 & x, glm_vec4 & y, glm_vec4 & z)
+{
+	glm_vec4 const abs0 = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	glm_vec4 const min0 = _mm_set1_ps(-1.0f);
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const scl0 = _mm_set1_ps(3.0518509475997192297128208258309e-5f); // 1 / 32767
+
+	glm_vec4 const u0 = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 16), 16)), scl0), min0, one0);
+	glm_vec4 const v0 = glm_vec4_clamp_scalar(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(p, 16)), scl0), min0, one0);
+	glm_vec4 const w0 = _mm_sub_ps(_mm_sub_ps(one0, _mm_and_ps(u0, abs0)), _mm_and_ps(v0, abs0));
+
+	glm_vec4 const fu0 = glm_vec4_mul_signNotZero(_mm_sub_ps(one0, _mm_and_ps(v0, abs0)), u0);
+	glm_vec4 const fv0 = glm_vec4_mul_signNotZero(_mm_sub_ps(one0, _mm_and_ps(u0, abs0)), v0);
+	glm_vec4 const dn0 = _mm_cmplt_ps(w0, _mm_setzero_ps());
+	glm_vec4 const u1 = _mm_or_ps(_mm_andnot_ps(dn0, u0), _mm_and_ps(dn0, fu0));
+	glm_vec4 const v1 = _mm_or_ps(_mm_andnot_ps(dn0, v0), _mm_and_ps(dn0, fv0));
+
+	glm_vec4 const dot0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(u1, u1), _mm_mul_ps(v1, v1)), _mm_mul_ps(w0, w0));
+	glm_vec4 const inv0 = _mm_div_ps(one0, _mm_sqrt_ps(dot0));
+	x = _mm_mul_ps(u1, inv0);
+	y = _mm_mul_ps(v1, inv0);
+	z = _mm_mul_ps(w0, inv0);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -440,6 +440,7 @@
 	typedef __m128		glm_vec4;
 	typedef __m128i		glm_ivec4;
 	typedef __m128i		glm_uvec4;
+	typedef __m128d		glm_dvec2;
 #endif
 
 #if GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -3,7 +3,285 @@
 
 #pragma once
 
+#include "common.h"
+#include <cmath>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Each function comes in two accuracies, as an error bound over every float argument:
+// - without suffix, 1 ULP. The reduction and the polynomials are evaluated in double, rounded to
+//   float once: the measured error is 0.5 ULP and a hair.
+// - _lowp, 3.5 ULP. Cephes' float polynomials.
+// Arguments outside of the domain of a kernel, huge angles, infinities and NaNs, are computed by
+// the C library one lane at a time. test/core/core_func_trigonometric.cpp measures the errors.
+
+// -- sin, cos --
+
+// x - n * pi / 2, n the nearest integer to x * 2 / pi, returned in the low 32 bits of the lanes
+// of Quadrant. pi / 2 is split in parts of 33 bits: for |x| < 2^20 the products by n are exact.
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_reduce_pio2(glm_dvec2 x, glm_dvec2 & Quadrant)
+{
+	glm_dvec2 const Round = _mm_set1_pd(6755399441055744.0);
+	Quadrant = glm_dvec2_fma(x, _mm_set1_pd(0.636619772367581382433), Round);
+	glm_dvec2 const n = _mm_sub_pd(Quadrant, Round);
+	glm_dvec2 r = glm_dvec2_fnma(n, _mm_set1_pd(1.57079632673412561417), x);
+	r = glm_dvec2_fnma(n, _mm_set1_pd(6.07710050630396597660e-11), r);
+	return glm_dvec2_fnma(n, _mm_set1_pd(2.02226624871116645580e-21), r);
+}
+
+// sin and cos of |r| <= pi / 4, Cephes double coefficients without the last term. sin is
+// r * (1 + z * s) rather than r + r * z * s, which would turn -0 into +0
+GLM_FUNC_QUALIFIER void glm_dvec2_sincos_reduced(glm_dvec2 r, glm_dvec2 & Sin, glm_dvec2 & Cos)
+{
+	glm_dvec2 const z = _mm_mul_pd(r, r);
+
+	glm_dvec2 s = glm_dvec2_fma(z, _mm_set1_pd(-2.50507477628578072866e-8), _mm_set1_pd(2.75573136213857245213e-6));
+	s = glm_dvec2_fma(s, z, _mm_set1_pd(-1.98412698295895385996e-4));
+	s = glm_dvec2_fma(s, z, _mm_set1_pd(8.33333333332211858878e-3));
+	s = glm_dvec2_fma(s, z, _mm_set1_pd(-1.66666666666666307295e-1));
+	Sin = _mm_mul_pd(r, glm_dvec2_fma(z, s, _mm_set1_pd(1.0)));
+
+	glm_dvec2 c = glm_dvec2_fma(z, _mm_set1_pd(2.08757008419747316778e-9), _mm_set1_pd(-2.75573141792967388112e-7));
+	c = glm_dvec2_fma(c, z, _mm_set1_pd(2.48015872888517045348e-5));
+	c = glm_dvec2_fma(c, z, _mm_set1_pd(-1.38888888888730564116e-3));
+	c = glm_dvec2_fma(c, z, _mm_set1_pd(4.16666666666665929218e-2));
+	Cos = glm_dvec2_fma(_mm_mul_pd(z, z), c, glm_dvec2_fnma(z, _mm_set1_pd(0.5), _mm_set1_pd(1.0)));
+}
+
+// sin(x) and cos(x) from the sin and cos of the reduced argument: the quadrant swaps and negates them
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_quadrant(glm_vec4 SinR, glm_vec4 CosR, glm_ivec4 Quadrant, glm_vec4 & Sin, glm_vec4 & Cos)
+{
+	glm_ivec4 const One = _mm_set1_epi32(1);
+	glm_ivec4 const Two = _mm_set1_epi32(2);
+	glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Quadrant, One), One));
+	glm_vec4 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(Quadrant, Two), 30));
+	glm_vec4 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(Quadrant, One), Two), 30));
+	Sin = _mm_xor_ps(glm_vec4_select(Swap, CosR, SinR), SinSign);
+	Cos = _mm_xor_ps(glm_vec4_select(Swap, SinR, CosR), CosSign);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_kernel(glm_vec4 x, glm_vec4 & Sin, glm_vec4 & Cos)
+{
+	glm_dvec2 QuadrantLo, QuadrantHi, SinLo, SinHi, CosLo, CosHi;
+	glm_dvec2_sincos_reduced(glm_dvec2_reduce_pio2(glm_dvec2_lo(x), QuadrantLo), SinLo, CosLo);
+	glm_dvec2_sincos_reduced(glm_dvec2_reduce_pio2(glm_dvec2_hi(x), QuadrantHi), SinHi, CosHi);
+	glm_ivec4 const Quadrant = _mm_castps_si128(glm_vec4_dvec2_bits(QuadrantLo, QuadrantHi));
+	glm_vec4_sincos_quadrant(glm_vec4_dvec2(SinLo, SinHi), glm_vec4_dvec2(CosLo, CosHi), Quadrant, Sin, Cos);
+}
+
+// Reduced in double too: in float, the rounding of the products by n is relative to x rather
+// than to the result, hundreds of ULP next to the zeros of sin and cos
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_kernel_lowp(glm_vec4 x, glm_vec4 & Sin, glm_vec4 & Cos)
+{
+	glm_dvec2 QuadrantLo, QuadrantHi;
+	glm_dvec2 const Lo = glm_dvec2_reduce_pio2(glm_dvec2_lo(x), QuadrantLo);
+	glm_dvec2 const Hi = glm_dvec2_reduce_pio2(glm_dvec2_hi(x), QuadrantHi);
+	glm_ivec4 const Quadrant = _mm_castps_si128(glm_vec4_dvec2_bits(QuadrantLo, QuadrantHi));
+	glm_vec4 const r = glm_vec4_dvec2(Lo, Hi);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	glm_vec4 s = glm_vec4_fma(z, _mm_set1_ps(-1.9515295891e-4f), _mm_set1_ps(8.3321608736e-3f));
+	s = glm_vec4_fma(s, z, _mm_set1_ps(-1.6666654611e-1f));
+	// The sign of r, lost by -0 + +0, kept by or-ing it back: sin(r) and r have the same sign
+	glm_vec4 const SinR = _mm_or_ps(glm_vec4_fma(_mm_mul_ps(r, z), s, r), _mm_and_ps(r, _mm_set1_ps(-0.0f)));
+
+	glm_vec4 c = glm_vec4_fma(z, _mm_set1_ps(2.443315711809948e-5f), _mm_set1_ps(-1.388731625493765e-3f));
+	c = glm_vec4_fma(c, z, _mm_set1_ps(4.166664568298827e-2f));
+	glm_vec4 const CosR = glm_vec4_fma(_mm_mul_ps(z, z), c, glm_vec4_fnma(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+
+	glm_vec4_sincos_quadrant(SinR, CosR, Quadrant, Sin, Cos);
+}
+
+// Lanes beyond these, or NaN, go to the C library
+GLM_FUNC_QUALIFIER int glm_vec4_sincos_outside(glm_vec4 x, float Max)
+{
+	return _mm_movemask_ps(_mm_cmpnle_ps(glm_vec4_abs(x), _mm_set1_ps(Max)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 Sin, Cos;
+	glm_vec4_sincos_kernel(x, Sin, Cos);
+	int const Lanes = glm_vec4_sincos_outside(x, 1048576.0f);
+	return Lanes ? glm_vec4_call_lanes(Lanes, Sin, x, static_cast<float(*)(float)>(std::sin)) : Sin;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 Sin, Cos;
+	glm_vec4_sincos_kernel(x, Sin, Cos);
+	int const Lanes = glm_vec4_sincos_outside(x, 1048576.0f);
+	return Lanes ? glm_vec4_call_lanes(Lanes, Cos, x, static_cast<float(*)(float)>(std::cos)) : Cos;
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4 & Sin, glm_vec4 & Cos)
+{
+	glm_vec4_sincos_kernel(x, Sin, Cos);
+	int const Lanes = glm_vec4_sincos_outside(x, 1048576.0f);
+	if(Lanes)
+	{
+		Sin = glm_vec4_call_lanes(Lanes, Sin, x, static_cast<float(*)(float)>(std::sin));
+		Cos = glm_vec4_call_lanes(Lanes, Cos, x, static_cast<float(*)(float)>(std::cos));
+	}
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_lowp(glm_vec4 x)
+{
+	glm_vec4 Sin, Cos;
+	glm_vec4_sincos_kernel_lowp(x, Sin, Cos);
+	int const Lanes = glm_vec4_sincos_outside(x, 1048576.0f);
+	return Lanes ? glm_vec4_call_lanes(Lanes, Sin, x, static_cast<float(*)(float)>(std::sin)) : Sin;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_lowp(glm_vec4 x)
+{
+	glm_vec4 Sin, Cos;
+	glm_vec4_sincos_kernel_lowp(x, Sin, Cos);
+	int const Lanes = glm_vec4_sincos_outside(x, 1048576.0f);
+	return Lanes ? glm_vec4_call_lanes(Lanes, Cos, x, static_cast<float(*)(float)>(std::cos)) : Cos;
+}
 
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_lowp(glm_vec4 x, glm_vec4 & Sin, glm_vec4 & Cos)
+{
+	glm_vec4_sincos_kernel_lowp(x, Sin, Cos);
+	int const Lanes = glm_vec4_sincos_outside(x, 1048576.0f);
+	if(Lanes)
+	{
+		Sin = glm_vec4_call_lanes(Lanes, Sin, x, static_cast<float(*)(float)>(std::sin));
+		Cos = glm_vec4_call_lanes(Lanes, Cos, x, static_cast<float(*)(float)>(std::cos));
+	}
+}
+
+// -- atan2, acos --
+
+// atan2(y, x) for y >= 0. The ratio of the smaller to the larger magnitude is reduced below 0.66
+// with atan(a) = pi / 4 + atan((a - 1) / (a + 1)), then Cephes' double rational. NaN when both
+// are 0 or infinite, NaN arguments aren't always propagated.
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_atan2_positive(glm_dvec2 y, glm_dvec2 x)
+{
+	glm_dvec2 const Abs = _mm_castsi128_pd(_mm_set_epi32(0x7FFFFFFF, -1, 0x7FFFFFFF, -1));
+	glm_dvec2 const ax = _mm_and_pd(x, Abs);
+	glm_dvec2 const Min = _mm_min_pd(ax, y);
+	glm_dvec2 const Max = _mm_max_pd(ax, y);
+	glm_dvec2 const Big = _mm_cmpgt_pd(Min, _mm_mul_pd(Max, _mm_set1_pd(0.66)));
+	glm_dvec2 const t = _mm_div_pd(
+		glm_dvec2_select(Big, _mm_sub_pd(Min, Max), Min),
+		glm_dvec2_select(Big, _mm_add_pd(Min, Max), Max));
+	glm_dvec2 const z = _mm_mul_pd(t, t);
+
+	glm_dvec2 p = glm_dvec2_fma(z, _mm_set1_pd(-8.750608600031904122785e-1), _mm_set1_pd(-1.615753718733365076637e1));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(-7.500855792314704667340e1));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(-1.228866684490136173410e2));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(-6.485021904942025371773e1));
+	glm_dvec2 q = _mm_add_pd(z, _mm_set1_pd(2.485846490142306297962e1));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(1.650270098316988542046e2));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(4.328810604912902668951e2));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(4.853903996359136964868e2));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(1.945506571482613964425e2));
+
+	glm_dvec2 r = glm_dvec2_fma(_mm_mul_pd(t, z), _mm_div_pd(p, q), t);
+	r = _mm_add_pd(r, _mm_and_pd(Big, _mm_set1_pd(0.785398163397448309616)));
+	r = glm_dvec2_select(_mm_cmpgt_pd(y, ax), _mm_sub_pd(_mm_set1_pd(1.57079632679489661923), r), r);
+	return glm_dvec2_select(_mm_cmplt_pd(x, _mm_setzero_pd()), _mm_sub_pd(_mm_set1_pd(3.14159265358979323846), r), r);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const SignY = _mm_and_ps(y, _mm_set1_ps(-0.0f));
+	glm_vec4 const ay = glm_vec4_abs(y);
+	glm_dvec2 const Lo = glm_dvec2_atan2_positive(glm_dvec2_lo(ay), glm_dvec2_lo(x));
+	glm_dvec2 const Hi = glm_dvec2_atan2_positive(glm_dvec2_hi(ay), glm_dvec2_hi(x));
+	glm_vec4 const Result = _mm_or_ps(glm_vec4_dvec2(Lo, Hi), SignY);
+	glm_vec4 const Undefined = glm_vec4_dvec2_bits(_mm_cmpunord_pd(Lo, Lo), _mm_cmpunord_pd(Hi, Hi));
+	int const Lanes = _mm_movemask_ps(_mm_or_ps(Undefined, _mm_cmpunord_ps(y, x)));
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, y, x, static_cast<float(*)(float, float)>(std::atan2)) : Result;
+}
+
+// acos(x) = 2 asin(sqrt((1 - x) / 2)) above 0.5, pi / 2 - asin(x) below, with Cephes' double
+// rational for asin
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_acos(glm_dvec2 x)
+{
+	glm_dvec2 const Abs = _mm_castsi128_pd(_mm_set_epi32(0x7FFFFFFF, -1, 0x7FFFFFFF, -1));
+	glm_dvec2 const Sign = _mm_andnot_pd(Abs, x);
+	glm_dvec2 const ax = _mm_and_pd(x, Abs);
+	glm_dvec2 const Big = _mm_cmpgt_pd(ax, _mm_set1_pd(0.5));
+	glm_dvec2 const z = glm_dvec2_select(Big, _mm_mul_pd(_mm_sub_pd(_mm_set1_pd(1.0), ax), _mm_set1_pd(0.5)), _mm_mul_pd(x, x));
+	glm_dvec2 const s = glm_dvec2_select(Big, _mm_sqrt_pd(z), ax);
+
+	glm_dvec2 p = glm_dvec2_fma(z, _mm_set1_pd(4.253011369004428248960e-3), _mm_set1_pd(-6.019598008014123785661e-1));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(5.444622390564711410273e0));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(-1.626247967210700244449e1));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(1.956261983317594739197e1));
+	p = glm_dvec2_fma(p, z, _mm_set1_pd(-8.198089802484824371615e0));
+	glm_dvec2 q = _mm_add_pd(z, _mm_set1_pd(-1.474091372988853791896e1));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(7.049610280856842141659e1));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(-1.471791292232726029859e2));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(1.395105614657485689735e2));
+	q = glm_dvec2_fma(q, z, _mm_set1_pd(-4.918853881490881290097e1));
+	glm_dvec2 const Asin = glm_dvec2_fma(_mm_mul_pd(s, z), _mm_div_pd(p, q), s);
+
+	glm_dvec2 const Twice = _mm_add_pd(Asin, Asin);
+	glm_dvec2 const Large = glm_dvec2_select(_mm_cmplt_pd(x, _mm_setzero_pd()), _mm_sub_pd(_mm_set1_pd(3.14159265358979323846), Twice), Twice);
+	glm_dvec2 const Small = _mm_sub_pd(_mm_set1_pd(1.57079632679489661923), _mm_xor_pd(Asin, Sign));
+	return glm_dvec2_select(Big, Large, Small);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_acos(glm_vec4 x)
+{
+	glm_vec4 const Result = glm_vec4_dvec2(glm_dvec2_acos(glm_dvec2_lo(x)), glm_dvec2_acos(glm_dvec2_hi(x)));
+	int const Lanes = _mm_movemask_ps(_mm_cmpnle_ps(glm_vec4_abs(x), _mm_set1_ps(1.0f)));
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, x, static_cast<float(*)(float)>(std::acos)) : Result;
+}
+
+// The same reduction in float, below tan(pi / 8), and Cephes' float polynomial
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2_lowp(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const SignY = _mm_and_ps(y, _mm_set1_ps(-0.0f));
+	glm_vec4 const ay = glm_vec4_abs(y);
+	glm_vec4 const ax = glm_vec4_abs(x);
+	glm_vec4 const Min = _mm_min_ps(ax, ay);
+	glm_vec4 const Max = _mm_max_ps(ax, ay);
+	glm_vec4 const Big = _mm_cmpgt_ps(Min, _mm_mul_ps(Max, _mm_set1_ps(0.414213562f)));
+	glm_vec4 const t = _mm_div_ps(
+		glm_vec4_select(Big, _mm_sub_ps(Min, Max), Min),
+		glm_vec4_select(Big, _mm_add_ps(Min, Max), Max));
+	glm_vec4 const z = _mm_mul_ps(t, t);
+
+	glm_vec4 p = glm_vec4_fma(z, _mm_set1_ps(8.05374449538e-2f), _mm_set1_ps(-1.38776856032e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.99777106478e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 r = glm_vec4_fma(_mm_mul_ps(t, z), p, t);
+	r = _mm_add_ps(r, _mm_and_ps(Big, _mm_set1_ps(0.785398163f)));
+	r = glm_vec4_select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(1.570796327f), r), r);
+	r = glm_vec4_select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(3.141592654f), r), r);
+
+	glm_vec4 const Result = _mm_or_ps(r, SignY);
+	int const Lanes = _mm_movemask_ps(_mm_or_ps(_mm_cmpunord_ps(t, t), _mm_cmpunord_ps(y, x)));
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, y, x, static_cast<float(*)(float, float)>(std::atan2)) : Result;
+}
+
+// Cephes' float asin: acos(x) = 2 asin(sqrt((1 - x) / 2)) above 0.5, pi / 2 - asin(x) below
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_acos_lowp(glm_vec4 x)
+{
+	glm_vec4 const Sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+	glm_vec4 const ax = glm_vec4_abs(x);
+	glm_vec4 const Big = _mm_cmpgt_ps(ax, _mm_set1_ps(0.5f));
+	glm_vec4 const z = glm_vec4_select(Big, _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), ax), _mm_set1_ps(0.5f)), _mm_mul_ps(x, x));
+	glm_vec4 const s = glm_vec4_select(Big, _mm_sqrt_ps(z), ax);
+
+	glm_vec4 p = glm_vec4_fma(z, _mm_set1_ps(4.2163199048e-2f), _mm_set1_ps(2.4181311049e-2f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(4.5470025998e-2f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(7.4953002686e-2f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.6666752422e-1f));
+	glm_vec4 const Asin = glm_vec4_fma(_mm_mul_ps(s, z), p, s);
+
+	glm_vec4 const Twice = _mm_add_ps(Asin, Asin);
+	glm_vec4 const Large = glm_vec4_select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(3.141592654f), Twice), Twice);
+	glm_vec4 const Small = _mm_sub_ps(_mm_set1_ps(1.570796327f), _mm_xor_ps(Asin, Sign));
+	glm_vec4 const Result = glm_vec4_select(Big, Large, Small);
+
+	int const Lanes = _mm_movemask_ps(_mm_cmpnle_ps(ax, _mm_set1_ps(1.0f)));
+	return Lanes ? glm_vec4_call_lanes(Lanes, Result, x, static_cast<float(*)(float)>(std::acos)) : Result;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
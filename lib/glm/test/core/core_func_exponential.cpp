@@ -2,6 +2,11 @@
 #include <glm/exponential.hpp>
 #include <glm/gtc/ulp.hpp>
 #include <glm/gtc/vec1.hpp>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <vector>
 
 int test_pow()
 {
@@ -112,6 +117,182 @@ int test_inversesqrt()
 	return Error;
 }
 
+namespace ulp
+{
+	// Distance from r to the exact result, in units of the last place of the float result
+	double error(float r, double Exact)
+	{
+		if(glm::isnan(Exact))
+			return glm::isnan(r) ? 0.0 : 1e9;
+		if(glm::isinf(static_cast<float>(Exact)))
+			return r == static_cast<float>(Exact) ? 0.0 : 1e9;
+
+		int Exponent = 0;
+		std::frexp(Exact, &Exponent);
+		double const Unit = std::ldexp(1.0, glm::max(Exponent - 24, -149));
+		return std::fabs(static_cast<double>(r) - Exact) / Unit;
+	}
+
+	// x from Min to Max, linearly or geometrically
+	template <glm::precision P>
+	glm::tvec4<float, P> sample(int i, int Count, float Min, float Max, bool Geometric)
+	{
+		glm::tvec4<float, P> Result;
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			double const t = (i + k + 0.5) / Count;
+			Result[k] = static_cast<float>(Geometric ? Min * std::pow(static_cast<double>(Max) / Min, t) : Min + (Max - Min) * t);
+		}
+		return Result;
+	}
+
+	template <glm::precision P>
+	double max_error(glm::tvec4<float, P> (*Func)(glm::tvec4<float, P> const &), double (*Exact)(double), float Min, float Max, bool Geometric)
+	{
+		int const Count = 1 << 16;
+		double Result = 0.0;
+		for(int i = 0; i < Count; i += 4)
+		{
+			glm::tvec4<float, P> const x = sample<P>(i, Count, Min, Max, Geometric);
+			glm::tvec4<float, P> const r = Func(x);
+			for(glm::length_t k = 0; k < 4; ++k)
+				Result = glm::max(Result, error(r[k], Exact(x[k])));
+		}
+		return Result;
+	}
+
+	// Bases from 1e-6 to 1e6, exponents that keep the result a normal float
+	template <glm::precision P>
+	double max_error_pow()
+	{
+		int const Count = 1 << 16;
+		double Result = 0.0;
+		for(int i = 0; i < Count; i += 4)
+		{
+			glm::tvec4<float, P> const x = sample<P>(i, Count, 1e-6f, 1e6f, true);
+			glm::tvec4<float, P> y;
+			for(glm::length_t k = 0; k < 4; ++k)
+				y[k] = static_cast<float>(((i + k) * 7919 % 2001) - 1000) / 1000.0f * static_cast<float>(80.0 / glm::max(std::fabs(std::log(static_cast<double>(x[k]))), 1.0));
+
+			glm::tvec4<float, P> const r = glm::pow(x, y);
+			for(glm::length_t k = 0; k < 4; ++k)
+				Result = glm::max(Result, error(r[k], std::pow(static_cast<double>(x[k]), static_cast<double>(y[k]))));
+		}
+		return Result;
+	}
+}//namespace ulp
+
+// The largest error of exp, log and pow
+template <glm::precision P>
+double max_error(char const * Name)
+{
+	double const Exp = ulp::max_error<P>(glm::exp, std::exp, -104.0f, 89.0f, false);
+	double const Log = glm::max(
+		ulp::max_error<P>(glm::log, std::log, 1e-45f, 3e38f, true),
+		ulp::max_error<P>(glm::log, std::log, 0.5f, 2.0f, false));
+	double const Pow = ulp::max_error_pow<P>();
+
+	std::printf("%s max ULP: exp %.2f, log %.2f, pow %.2f\n", Name, Exp, Log, Pow);
+
+	return glm::max(Exp, glm::max(Log, Pow));
+}
+
+// Only the vector code has a bound, the C library is only reported
+int test_accuracy()
+{
+	int Error = 0;
+
+	max_error<glm::highp>("C library");
+#	if GLM_HAS_ALIGNED_TYPE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+		Error += max_error<glm::aligned_highp>("aligned_highp") <= 1.0 ? 0 : 1;
+		Error += max_error<glm::aligned_lowp>("aligned_lowp") <= 3.5 ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_special()
+{
+	typedef glm::tvec4<float, P> vec4;
+
+	int Error = 0;
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+
+	vec4 const Exp = glm::exp(vec4(-Inf, Inf, NaN, 0.0f));
+	Error += Exp.x == 0.0f && Exp.y == Inf && glm::isnan(Exp.z) && Exp.w == 1.0f ? 0 : 1;
+
+	// Overflow, underflow to zero and to a denormal
+	vec4 const ExpRange = glm::exp(vec4(100.0f, -200.0f, -100.0f, 88.5f));
+	Error += ExpRange.x == Inf && ExpRange.y == 0.0f ? 0 : 1;
+	Error += ulp::error(ExpRange.z, std::exp(-100.0)) <= 1.0 ? 0 : 1;
+	Error += ulp::error(ExpRange.w, std::exp(88.5)) <= 1.0 ? 0 : 1;
+
+	vec4 const Log = glm::log(vec4(0.0f, -1.0f, Inf, NaN));
+	Error += Log.x == -Inf && glm::isnan(Log.y) && Log.z == Inf && glm::isnan(Log.w) ? 0 : 1;
+
+	vec4 const LogDenormal = glm::log(vec4(1e-40f, 1.0f, 1.4e-45f, 2.0f));
+	Error += ulp::error(LogDenormal.x, std::log(static_cast<double>(1e-40f))) <= 1.0 ? 0 : 1;
+	Error += LogDenormal.y == 0.0f ? 0 : 1;
+	Error += ulp::error(LogDenormal.z, std::log(static_cast<double>(1.4e-45f))) <= 1.0 ? 0 : 1;
+
+	// Negative bases with integer exponents, zeros and infinities
+	vec4 const Pow = glm::pow(vec4(-2.0f, -2.0f, -2.0f, 0.0f), vec4(3.0f, 2.0f, 0.5f, 0.0f));
+	Error += Pow.x == -8.0f && Pow.y == 4.0f && glm::isnan(Pow.z) && Pow.w == 1.0f ? 0 : 1;
+
+	vec4 const PowInf = glm::pow(vec4(2.0f, 0.5f, 1.0f, Inf), vec4(-Inf, Inf, NaN, -1.0f));
+	Error += PowInf.x == 0.0f && PowInf.y == 0.0f && PowInf.z == 1.0f && PowInf.w == 0.0f ? 0 : 1;
+
+	vec4 const PowExact = glm::pow(vec4(2.0f, 10.0f, 4.0f, 3.0f), vec4(10.0f, 3.0f, 0.5f, 0.0f));
+	Error += PowExact.x == 1024.0f && PowExact.y == 1000.0f && PowExact.z == 2.0f && PowExact.w == 1.0f ? 0 : 1;
+
+	return Error;
+}
+
+template <glm::precision P>
+double perf_rate(int Function)
+{
+	typedef glm::tvec4<float, P> vec4;
+
+	std::size_t const Count = 1 << 14;
+	std::vector<vec4> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = vec4(0.5f) + vec4(0.0f, 5.0f, 10.0f, 15.0f) * static_cast<float>(i) / static_cast<float>(Count);
+
+	std::clock_t const Start = std::clock();
+	for(int n = 0; n < 16; ++n)
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		switch(Function)
+		{
+		case 0: Out[i] = glm::exp(In[i]); break;
+		case 1: Out[i] = glm::log(In[i]); break;
+		default: Out[i] = glm::pow(In[i], In[Count - 1 - i]); break;
+		}
+	}
+	std::clock_t const Time = std::clock() - Start;
+
+	return double(Count * 16) * CLOCKS_PER_SEC / (double(Time + 1) * 1000000.0) + (glm::isnan(Out[Count / 2].x) ? 1.0 : 0.0);
+}
+
+int perf_throughput()
+{
+	char const * Names[] = {"exp", "log", "pow"};
+	for(int f = 0; f < 3; ++f)
+	{
+#		if GLM_HAS_ALIGNED_TYPE
+			std::printf("%s Mvec4/s: C library %.1f, aligned_highp %.1f, aligned_lowp %.1f\n",
+				Names[f], perf_rate<glm::highp>(f), perf_rate<glm::aligned_highp>(f), perf_rate<glm::aligned_lowp>(f));
+#		else
+			std::printf("%s Mvec4/s: C library %.1f\n", Names[f], perf_rate<glm::highp>(f));
+#		endif
+	}
+
+	return 0;
+}
+
 int main()
 {
 	int Error(0);
@@ -123,6 +304,13 @@ int main()
 	Error += test_log2();
 	Error += test_sqrt();
 	Error += test_inversesqrt();
+	Error += test_accuracy();
+	Error += test_special<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_special<glm::aligned_highp>();
+		Error += test_special<glm::aligned_lowp>();
+#	endif
+	Error += perf_throughput();
 
 	return Error;
 }
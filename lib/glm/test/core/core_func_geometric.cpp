@@ -2,6 +2,10 @@
 #include <glm/vector_relational.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/vec1.hpp>
+#include <glm/simd/geometric.h>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
 #include <limits>
 
 namespace length
@@ -175,6 +179,103 @@ namespace refract
 	}
 }//namespace refract
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+// The kernels of glm/simd/geometric.h that have FMA variants, against scalar code
+namespace simd_kernel
+{
+	std::size_t const Size = 256;
+
+	static float A[Size][4];
+	static float B[Size][4];
+
+	void init()
+	{
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			float Length = 0.0f;
+			for(int k = 0; k < 4; ++k)
+			{
+				A[i][k] = static_cast<float>((i * 4 + k) % 13) * 0.25f - 1.5f;
+				B[i][k] = static_cast<float>((i * 4 + k) % 7) * 0.5f - 0.75f;
+				Length += B[i][k] * B[i][k];
+			}
+
+			// Unit normals, so that chained reflections keep their length
+			for(int k = 0; k < 4; ++k)
+				B[i][k] /= std::sqrt(Length);
+		}
+	}
+
+	int check(float const* Values, float const* Expected, int Count, float Epsilon)
+	{
+		int Error = 0;
+		for(int i = 0; i < Count; ++i)
+			Error += std::abs(Values[i] - Expected[i]) <= Epsilon ? 0 : 1;
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		init();
+
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			float const* a = A[i];
+			float const* b = B[i];
+			float Result[4];
+
+			float const Cross[4] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0], 0.0f};
+			_mm_storeu_ps(Result, glm_vec4_cross(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+			Error += check(Result, Cross, 3, 0.0001f);
+
+			float const Dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+			float const Reflect[4] = {a[0] - 2.0f * Dot * b[0], a[1] - 2.0f * Dot * b[1], a[2] - 2.0f * Dot * b[2], a[3] - 2.0f * Dot * b[3]};
+			_mm_storeu_ps(Result, glm_vec4_reflect(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+			Error += check(Result, Reflect, 4, 0.0001f);
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Laps)
+	{
+		init();
+
+		static glm_vec4 In0[Size], In1[Size], Out[Size];
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			In0[i] = _mm_loadu_ps(A[i]);
+			In1[i] = _mm_loadu_ps(B[i]);
+		}
+
+		float Sum = 0.0f;
+
+		std::clock_t StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+		for(std::size_t i = 0; i < Size; ++i)
+			Out[i] = glm_vec4_cross(In0[i], In1[(i + Lap) % Size]);
+		std::clock_t EndTime = std::clock();
+		Sum += _mm_cvtss_f32(Out[Size / 2]);
+		std::printf("glm_vec4_cross: %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+
+		// Each reflection depends on the last, this one measures latency
+		glm_vec4 Ray = In0[0];
+		StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+		for(std::size_t i = 0; i < Size; ++i)
+			Ray = glm_vec4_reflect(Ray, In1[i]);
+		EndTime = std::clock();
+		Sum += _mm_cvtss_f32(Ray);
+		std::printf("glm_vec4_reflect, chained: %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+
+		std::printf("simd kernels checksum: %f\n", Sum);
+		return 0;
+	}
+}//namespace simd_kernel
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 int main()
 {
 	int Error(0);
@@ -187,6 +288,12 @@ int main()
 	Error += faceforward::test();
 	Error += reflect::test();
 	Error += refract::test();
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	Error += simd_kernel::test();
+#		ifdef NDEBUG
+	Error += simd_kernel::perf(16384);
+#		endif//NDEBUG
+#	endif
 
 	return Error;
 }
@@ -2,7 +2,10 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/ulp.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/simd/matrix.h>
 #include <vector>
+#include <cmath>
+#include <cstring>
 #include <ctime>
 #include <cstdio>
 
@@ -253,6 +256,259 @@ int test_inverse_perf(std::size_t Count, std::size_t Instance, char const * Mess
 	return 0;
 }
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+// The kernels of glm/simd/matrix.h, on whichever instruction set this is built for. Inputs and
+// results go through plain float arrays so the checks don't depend on the vector types
+namespace simd_kernel
+{
+	std::size_t const Size = 256;
+
+	static float Mats[Size][16];
+	static float Vecs[Size][4];
+
+	void init()
+	{
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			// A well conditioned matrix: a scaled rotation about z plus a translation and some shear
+			float const a = static_cast<float>(i) * 0.05f;
+			float const s = 1.0f + static_cast<float>(i % 7) * 0.125f;
+			float const m[16] = {
+				s * std::cos(a), s * std::sin(a), 0.0f, 0.0f,
+				-s * std::sin(a), s * std::cos(a), 0.1f, 0.0f,
+				0.2f, 0.0f, s, 0.0f,
+				static_cast<float>(i % 5), 1.0f, -2.0f, 1.0f};
+			std::memcpy(Mats[i], m, sizeof(m));
+			for(int k = 0; k < 4; ++k)
+				Vecs[i][k] = static_cast<float>((i * 4 + k) % 11) * 0.25f - 1.0f;
+		}
+	}
+
+	void load(float const* m, glm_vec4 Out[4])
+	{
+		for(int c = 0; c < 4; ++c)
+			Out[c] = _mm_loadu_ps(m + c * 4);
+	}
+
+	void store(glm_vec4 const In[4], float* m)
+	{
+		for(int c = 0; c < 4; ++c)
+			_mm_storeu_ps(m + c * 4, In[c]);
+	}
+
+	void ref_mul(float const* a, float const* b, float* r)
+	{
+		for(int c = 0; c < 4; ++c)
+		for(int l = 0; l < 4; ++l)
+			r[c * 4 + l] = a[0 * 4 + l] * b[c * 4 + 0] + a[1 * 4 + l] * b[c * 4 + 1] + a[2 * 4 + l] * b[c * 4 + 2] + a[3 * 4 + l] * b[c * 4 + 3];
+	}
+
+	void ref_mul_vec4(float const* m, float const* v, float* r)
+	{
+		for(int l = 0; l < 4; ++l)
+			r[l] = m[0 * 4 + l] * v[0] + m[1 * 4 + l] * v[1] + m[2 * 4 + l] * v[2] + m[3 * 4 + l] * v[3];
+	}
+
+	int check(float const* Values, float const* Expected, int Count, float Epsilon)
+	{
+		int Error = 0;
+		for(int i = 0; i < Count; ++i)
+			Error += std::abs(Values[i] - Expected[i]) <= Epsilon ? 0 : 1;
+		return Error > 0 ? 1 : 0;
+	}
+
+	// Inverses are checked by multiplying back to the identity
+	int check_inverse(float const* m, float const* Inverse)
+	{
+		float const Identity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+		float Product[16];
+		ref_mul(m, Inverse, Product);
+		return check(Product, Identity, 16, 0.0001f);
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		init();
+
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			float const* A = Mats[i];
+			float const* B = Mats[(i * 7 + 3) % Size];
+			float const* V = Vecs[i];
+
+			glm_vec4 a[4], b[4], r[4];
+			load(A, a);
+			load(B, b);
+
+			float Expected[16], Result[16];
+			ref_mul(A, B, Expected);
+			glm_mat4_mul(a, b, r);
+			store(r, Result);
+			Error += check(Result, Expected, 16, 0.0001f);
+
+			// The result may alias the right operand, as in m = n * m
+			glm_mat4_mul(a, b, b);
+			store(b, Result);
+			Error += check(Result, Expected, 16, 0.0001f);
+
+			ref_mul_vec4(A, V, Expected);
+			_mm_storeu_ps(Result, glm_mat4_mul_vec4(a, _mm_loadu_ps(V)));
+			Error += check(Result, Expected, 4, 0.0001f);
+
+			glm_mat4_inverse(a, r);
+			store(r, Result);
+			Error += check_inverse(A, Result);
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				float const* V2 = Vecs[(i + 1) % Size];
+				float Pair[8];
+				std::memcpy(Pair, V, sizeof(float) * 4);
+				std::memcpy(Pair + 4, V2, sizeof(float) * 4);
+				_mm256_storeu_ps(Pair, glm_mat4_mul_2vec4(a, _mm256_loadu_ps(Pair)));
+				ref_mul_vec4(A, V, Expected);
+				ref_mul_vec4(A, V2, Expected + 4);
+				Error += check(Pair, Expected, 8, 0.0001f);
+			}
+
+			{
+				float const* C = Mats[(i * 5 + 1) % Size];
+				__m256 In1[4], In2[4], Out[4];
+				for(int c = 0; c < 4; ++c)
+				{
+					In1[c] = _mm256_setr_m128(_mm_loadu_ps(A + c * 4), _mm_loadu_ps(B + c * 4));
+					In2[c] = _mm256_setr_m128(_mm_loadu_ps(B + c * 4), _mm_loadu_ps(C + c * 4));
+				}
+				glm_mat4_mul_x2(In1, In2, Out);
+
+				float ExpectedAB[16], ExpectedBC[16], ResultAB[16], ResultBC[16];
+				ref_mul(A, B, ExpectedAB);
+				ref_mul(B, C, ExpectedBC);
+				for(int c = 0; c < 4; ++c)
+				{
+					_mm_storeu_ps(ResultAB + c * 4, _mm256_castps256_ps128(Out[c]));
+					_mm_storeu_ps(ResultBC + c * 4, _mm256_extractf128_ps(Out[c], 1));
+				}
+				Error += check(ResultAB, ExpectedAB, 16, 0.0001f);
+				Error += check(ResultBC, ExpectedBC, 16, 0.0001f);
+			}
+
+			{
+				__m256 In[4], Out[4];
+				for(int c = 0; c < 4; ++c)
+					In[c] = _mm256_setr_m128(_mm_loadu_ps(A + c * 4), _mm_loadu_ps(B + c * 4));
+				glm_mat4_inverse_x2(In, Out);
+
+				float InverseA[16], InverseB[16];
+				for(int c = 0; c < 4; ++c)
+				{
+					_mm_storeu_ps(InverseA + c * 4, _mm256_castps256_ps128(Out[c]));
+					_mm_storeu_ps(InverseB + c * 4, _mm256_extractf128_ps(Out[c], 1));
+				}
+				Error += check_inverse(A, InverseA);
+				Error += check_inverse(B, InverseB);
+			}
+
+			{
+				double DA[16], DB[16], DExpected[16], DResult[16];
+				for(int k = 0; k < 16; ++k)
+				{
+					DA[k] = A[k];
+					DB[k] = B[k];
+				}
+				for(int c = 0; c < 4; ++c)
+				for(int l = 0; l < 4; ++l)
+					DExpected[c * 4 + l] = DA[0 * 4 + l] * DB[c * 4 + 0] + DA[1 * 4 + l] * DB[c * 4 + 1] + DA[2 * 4 + l] * DB[c * 4 + 2] + DA[3 * 4 + l] * DB[c * 4 + 3];
+
+				__m256d da[4], dr[4];
+				for(int c = 0; c < 4; ++c)
+					da[c] = _mm256_loadu_pd(DA + c * 4);
+				glm_dmat4_mul(da, DB, dr);
+				for(int c = 0; c < 4; ++c)
+					_mm256_storeu_pd(DResult + c * 4, dr[c]);
+
+				int Failed = 0;
+				for(int k = 0; k < 16; ++k)
+					Failed += std::abs(DResult[k] - DExpected[k]) <= 1e-12 ? 0 : 1;
+				Error += Failed > 0 ? 1 : 0;
+			}
+#			endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+		}
+
+		return Error;
+	}
+
+	// Each kernel over an L1 resident set, so the timings measure the kernel rather than memory
+	int perf(std::size_t Laps)
+	{
+		init();
+
+		static glm_vec4 In[Size][4];
+		static glm_vec4 Out[Size][4];
+		for(std::size_t i = 0; i < Size; ++i)
+			load(Mats[i], In[i]);
+
+		float Sum = 0.0f;
+
+		std::clock_t StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+		for(std::size_t i = 0; i < Size; ++i)
+			glm_mat4_mul(In[i], In[(i + 1) % Size], Out[i]);
+		std::clock_t EndTime = std::clock();
+		Sum += _mm_cvtss_f32(Out[Size / 2][3]);
+		std::printf("glm_mat4_mul: %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+
+		StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+		for(std::size_t i = 0; i < Size; ++i)
+		for(int c = 0; c < 4; ++c)
+			Out[i][c] = glm_mat4_mul_vec4(In[i], In[(i + 1) % Size][c]);
+		EndTime = std::clock();
+		Sum += _mm_cvtss_f32(Out[Size / 2][3]);
+		std::printf("glm_mat4_mul_vec4 x4: %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+
+		StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps / 4; ++Lap)
+		for(std::size_t i = 0; i < Size; ++i)
+			glm_mat4_inverse(In[i], Out[i]);
+		EndTime = std::clock();
+		Sum += _mm_cvtss_f32(Out[Size / 2][3]);
+		std::printf("glm_mat4_inverse: %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		{
+			static __m256 In2[Size / 2][4];
+			static __m256 Out2[Size / 2][4];
+			for(std::size_t i = 0; i < Size / 2; ++i)
+			for(int c = 0; c < 4; ++c)
+				In2[i][c] = _mm256_setr_m128(In[i * 2][c], In[i * 2 + 1][c]);
+
+			StartTime = std::clock();
+			for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+			for(std::size_t i = 0; i < Size / 2; ++i)
+				glm_mat4_mul_x2(In2[i], In2[(i + 1) % (Size / 2)], Out2[i]);
+			EndTime = std::clock();
+			Sum += _mm256_cvtss_f32(Out2[Size / 4][3]);
+			std::printf("glm_mat4_mul_x2 (per 2): %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+
+			StartTime = std::clock();
+			for(std::size_t Lap = 0; Lap < Laps / 4; ++Lap)
+			for(std::size_t i = 0; i < Size / 2; ++i)
+				glm_mat4_inverse_x2(In2[i], Out2[i]);
+			EndTime = std::clock();
+			Sum += _mm256_cvtss_f32(Out2[Size / 4][3]);
+			std::printf("glm_mat4_inverse_x2 (per 2): %lu\n", static_cast<unsigned long>(EndTime - StartTime));
+		}
+#		endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+		std::printf("simd kernels checksum: %f\n", Sum);
+		return 0;
+	}
+}//namespace simd_kernel
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 int main()
 {
 	int Error(0);
@@ -262,6 +518,9 @@ int main()
 	Error += test_determinant();
 	Error += test_inverse();
 	Error += test_inverse_simd();
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	Error += simd_kernel::test();
+#	endif
 
 #	ifdef NDEBUG
 	std::size_t const Samples(1000);
@@ -270,6 +529,9 @@ int main()
 		Error += test_inverse_perf<glm::vec3, glm::mat4>(Samples, i, "mat4");
 		Error += test_inverse_perf<glm::dvec3, glm::dmat4>(Samples, i, "dmat4");
 	}
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	Error += simd_kernel::perf(4096);
+#	endif
 #	endif//NDEBUG
 
 	return Error;
@@ -1,10 +1,278 @@
 #include <glm/trigonometric.hpp>
+#include <glm/common.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <vector>
 
-int main()
+namespace ulp
+{
+	// Distance from r to the exact result, in units of the last place of the float result
+	double error(float r, double Exact)
+	{
+		if(glm::isnan(Exact))
+			return glm::isnan(r) ? 0.0 : 1e9;
+		if(glm::isinf(static_cast<float>(Exact)))
+			return r == static_cast<float>(Exact) ? 0.0 : 1e9;
+
+		int Exponent = 0;
+		std::frexp(Exact, &Exponent);
+		double const Unit = std::ldexp(1.0, glm::max(Exponent - 24, -149));
+		return std::fabs(static_cast<double>(r) - Exact) / Unit;
+	}
+
+	bool negative_zero(float f)
+	{
+		glm::uint Bits;
+		std::memcpy(&Bits, &f, sizeof(Bits));
+		return Bits == 0x80000000u;
+	}
+
+	template <glm::precision P>
+	double max_error(glm::tvec4<float, P> (*Func)(glm::tvec4<float, P> const &), double (*Exact)(double), float Min, float Max, int Count)
+	{
+		double Result = 0.0;
+		for(int i = 0; i < Count; i += 4)
+		{
+			glm::tvec4<float, P> x;
+			for(glm::length_t k = 0; k < 4; ++k)
+				x[k] = Min + (Max - Min) * (static_cast<float>(i + k) + 0.5f) / static_cast<float>(Count);
+
+			glm::tvec4<float, P> const r = Func(x);
+			for(glm::length_t k = 0; k < 4; ++k)
+				Result = glm::max(Result, error(r[k], Exact(x[k])));
+		}
+		return Result;
+	}
+
+	// sincos against sin and cos, which have their own bound: the same results are expected, bit for bit
+	template <glm::precision P>
+	int sincos_mismatches(float Min, float Max, int Count)
+	{
+		int Result = 0;
+		for(int i = 0; i < Count; i += 4)
+		{
+			glm::tvec4<float, P> x;
+			for(glm::length_t k = 0; k < 4; ++k)
+				x[k] = Min + (Max - Min) * (static_cast<float>(i + k) + 0.5f) / static_cast<float>(Count);
+
+			glm::tvec4<float, P> s, c;
+			glm::sincos(x, s, c);
+			glm::tvec4<float, P> const Sin = glm::sin(x);
+			glm::tvec4<float, P> const Cos = glm::cos(x);
+			Result += std::memcmp(&s[0], &Sin[0], sizeof(float) * 4) == 0 ? 0 : 1;
+			Result += std::memcmp(&c[0], &Cos[0], sizeof(float) * 4) == 0 ? 0 : 1;
+		}
+		return Result;
+	}
+
+	// Around the circle, with radii from 1e-30 to 1e30
+	template <glm::precision P>
+	double max_error_atan(int Count)
+	{
+		double Result = 0.0;
+		for(int i = 0; i < Count; i += 4)
+		{
+			glm::tvec4<float, P> y, x;
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				double const Angle = -glm::pi<double>() + glm::two_pi<double>() * (i + k + 0.5) / Count;
+				double const Radius = std::pow(10.0, static_cast<double>((i + k) % 61) - 30.0);
+				y[k] = static_cast<float>(Radius * std::sin(Angle));
+				x[k] = static_cast<float>(Radius * std::cos(Angle));
+			}
+
+			glm::tvec4<float, P> const r = glm::atan(y, x);
+			for(glm::length_t k = 0; k < 4; ++k)
+				Result = glm::max(Result, error(r[k], std::atan2(static_cast<double>(y[k]), static_cast<double>(x[k]))));
+		}
+		return Result;
+	}
+}//namespace ulp
+
+// The largest error of sin, cos, acos and atan2
+template <glm::precision P>
+double max_error(char const * Name)
+{
+	int const Count = 1 << 16;
+
+	double const Sin = glm::max(
+		ulp::max_error<P>(glm::sin, std::sin, -100.0f, 100.0f, Count),
+		ulp::max_error<P>(glm::sin, std::sin, -100000.0f, 100000.0f, Count));
+	double const Cos = glm::max(
+		ulp::max_error<P>(glm::cos, std::cos, -100.0f, 100.0f, Count),
+		ulp::max_error<P>(glm::cos, std::cos, -100000.0f, 100000.0f, Count));
+	double const Acos = ulp::max_error<P>(glm::acos, std::acos, -1.0f, 1.0f, Count);
+	double const Atan = ulp::max_error_atan<P>(Count);
+
+	// sincos has the bound of sin and cos when it matches them
+	int const SinCos = ulp::sincos_mismatches<P>(-100.0f, 100.0f, Count) + ulp::sincos_mismatches<P>(-100000.0f, 100000.0f, Count);
+
+	std::printf("%s max ULP: sin %.2f, cos %.2f, acos %.2f, atan2 %.2f; sincos %s sin and cos\n",
+		Name, Sin, Cos, Acos, Atan, SinCos == 0 ? "matches" : "differs from");
+
+	return SinCos == 0 ? glm::max(glm::max(Sin, Cos), glm::max(Acos, Atan)) : 1e9;
+}
+
+// Only the vector code has a bound, the C library is only reported
+int test_accuracy()
+{
+	int Error = 0;
+
+	max_error<glm::highp>("C library");
+#	if GLM_HAS_ALIGNED_TYPE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+		Error += max_error<glm::aligned_highp>("aligned_highp") <= 1.0 ? 0 : 1;
+		Error += max_error<glm::aligned_lowp>("aligned_lowp") <= 3.5 ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_special()
+{
+	typedef glm::tvec4<float, P> vec4;
+
+	int Error = 0;
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	float const Pi = glm::pi<float>();
+
+	// Signed zeros kept, sin of infinities and NaN is NaN
+	vec4 const Sin = glm::sin(vec4(0.0f, -0.0f, Inf, NaN));
+	Error += Sin.x == 0.0f && !ulp::negative_zero(Sin.x) ? 0 : 1;
+	Error += ulp::negative_zero(Sin.y) ? 0 : 1;
+	Error += glm::isnan(Sin.z) && glm::isnan(Sin.w) ? 0 : 1;
+
+	vec4 const Cos = glm::cos(vec4(0.0f, -0.0f, -Inf, NaN));
+	Error += Cos.x == 1.0f && Cos.y == 1.0f ? 0 : 1;
+	Error += glm::isnan(Cos.z) && glm::isnan(Cos.w) ? 0 : 1;
+
+	// Beyond the range reduction of the vector code, the result of the C library
+	vec4 const Huge(1e30f, -3e38f, 12345678.0f, 1e7f);
+	vec4 const SinHuge = glm::sin(Huge);
+	vec4 const CosHuge = glm::cos(Huge);
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		Error += ulp::error(SinHuge[i], std::sin(static_cast<double>(Huge[i]))) <= 1.0 ? 0 : 1;
+		Error += ulp::error(CosHuge[i], std::cos(static_cast<double>(Huge[i]))) <= 1.0 ? 0 : 1;
+	}
+
+	// sincos goes to the C library for the same lanes, and may write over its argument
+	vec4 SinCosHuge(Huge), CosHugeOut;
+	glm::sincos(SinCosHuge, SinCosHuge, CosHugeOut);
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		Error += SinCosHuge[i] == SinHuge[i] ? 0 : 1;
+		Error += CosHugeOut[i] == CosHuge[i] ? 0 : 1;
+	}
+
+	vec4 SinSpecial, CosSpecial(0.0f, -0.0f, Inf, NaN);
+	glm::sincos(CosSpecial, SinSpecial, CosSpecial);
+	Error += SinSpecial.x == 0.0f && !ulp::negative_zero(SinSpecial.x) && ulp::negative_zero(SinSpecial.y) ? 0 : 1;
+	Error += CosSpecial.x == 1.0f && CosSpecial.y == 1.0f ? 0 : 1;
+	Error += glm::isnan(SinSpecial.z) && glm::isnan(SinSpecial.w) && glm::isnan(CosSpecial.z) && glm::isnan(CosSpecial.w) ? 0 : 1;
+
+	vec4 const Acos = glm::acos(vec4(1.0f, -1.0f, 1.5f, NaN));
+	Error += Acos.x == 0.0f ? 0 : 1;
+	Error += Acos.y == Pi ? 0 : 1;
+	Error += glm::isnan(Acos.z) && glm::isnan(Acos.w) ? 0 : 1;
+
+	vec4 const Atan = glm::atan(vec4(0.0f, -0.0f, 0.0f, 1.0f), vec4(-0.0f, -1.0f, 0.0f, 0.0f));
+	Error += Atan.x == Pi ? 0 : 1;
+	Error += Atan.y == -Pi ? 0 : 1;
+	Error += Atan.z == 0.0f && !ulp::negative_zero(Atan.z) ? 0 : 1;
+	Error += Atan.w == glm::half_pi<float>() ? 0 : 1;
+
+	vec4 const AtanInf = glm::atan(vec4(Inf, Inf, -Inf, NaN), vec4(Inf, 1.0f, -Inf, 1.0f));
+	Error += AtanInf.x == glm::quarter_pi<float>() ? 0 : 1;
+	Error += AtanInf.y == glm::half_pi<float>() ? 0 : 1;
+	Error += AtanInf.z == -3.0f * glm::quarter_pi<float>() ? 0 : 1;
+	Error += glm::isnan(AtanInf.w) ? 0 : 1;
+
+	return Error;
+}
+
+template <glm::precision P>
+double perf_rate(int Function)
+{
+	typedef glm::tvec4<float, P> vec4;
+
+	std::size_t const Count = 1 << 14;
+	std::vector<vec4> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = vec4(-10.0f) + vec4(0.0f, 5.0f, 10.0f, 15.0f) * static_cast<float>(i) / static_cast<float>(Count);
+
+	std::clock_t const Start = std::clock();
+	for(int n = 0; n < 16; ++n)
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		switch(Function)
+		{
+		case 0: Out[i] = glm::sin(In[i]); break;
+		case 1: Out[i] = glm::cos(In[i]); break;
+		case 2: Out[i] = glm::acos(In[i] * 0.09f); break;
+		case 3: Out[i] = glm::atan(In[i], In[Count - 1 - i]); break;
+		default: glm::sincos(In[i], Out[i], Out[Count - 1 - i]); break;
+		}
+	}
+	std::clock_t const Time = std::clock() - Start;
+
+	return double(Count * 16) * CLOCKS_PER_SEC / (double(Time + 1) * 1000000.0) + (glm::isnan(Out[Count / 2].x) ? 1.0 : 0.0);
+}
+
+int perf_throughput()
+{
+	char const * Names[] = {"sin", "cos", "acos", "atan2", "sincos"};
+	for(int f = 0; f < 5; ++f)
+	{
+#		if GLM_HAS_ALIGNED_TYPE
+			std::printf("%s Mvec4/s: C library %.1f, aligned_highp %.1f, aligned_lowp %.1f\n",
+				Names[f], perf_rate<glm::highp>(f), perf_rate<glm::aligned_highp>(f), perf_rate<glm::aligned_lowp>(f));
+#		else
+			std::printf("%s Mvec4/s: C library %.1f\n", Names[f], perf_rate<glm::highp>(f));
+#		endif
+	}
+
+	return 0;
+}
+
+int test_scalar()
 {
 	int Error = 0;
 
+	float s = 0.0f, c = 0.0f;
+	glm::sincos(1.0f, s, c);
+	Error += s == std::sin(1.0f) && c == std::cos(1.0f) ? 0 : 1;
+
+	double ds = 0.0, dc = 0.0;
+	glm::sincos(-2.0, ds, dc);
+	Error += ds == std::sin(-2.0) && dc == std::cos(-2.0) ? 0 : 1;
+
+	glm::dvec3 const Angles(0.0, 1.0, -3.0);
+	glm::dvec3 dvs, dvc;
+	glm::sincos(Angles, dvs, dvc);
+	Error += dvs == glm::sin(Angles) && dvc == glm::cos(Angles) ? 0 : 1;
 
 	return Error;
 }
 
+int main()
+{
+	int Error = 0;
+
+	Error += test_scalar();
+	Error += test_accuracy();
+	Error += test_special<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_special<glm::aligned_highp>();
+		Error += test_special<glm::aligned_lowp>();
+#	endif
+	Error += perf_throughput();
+
+	return Error;
+}
@@ -1,4 +1,5 @@
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/type_ptr.hpp>
 #include <glm/matrix.hpp>
 #include <glm/mat2x2.hpp>
 #include <glm/mat2x3.hpp>
@@ -9,7 +10,10 @@
 #include <glm/mat4x2.hpp>
 #include <glm/mat4x3.hpp>
 #include <glm/mat4x4.hpp>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <vector>
 
 
@@ -242,11 +246,216 @@ int test_ctr()
 	return Error;
 }
 
+int test_constexpr()
+{
+#if GLM_HAS_CONSTEXPR_CXX14
+	constexpr glm::mat4 A(2.0f);
+	constexpr glm::mat4 B(
+		glm::vec4(1, 0, 0, 0),
+		glm::vec4(0, 1, 0, 0),
+		glm::vec4(0, 0, 1, 0),
+		glm::vec4(1, 2, 3, 1));
+	static_assert(A[2][2] == 2.0f && A[2][1] == 0.0f, "GLM: Failed constexpr");
+
+	// Products only have a compile time path where the SIMD code can be bypassed
+#	if GLM_HAS_IS_CONSTANT_EVALUATED || GLM_ARCH == GLM_ARCH_PURE
+		constexpr glm::mat4 C = B * A;
+		static_assert(C[3][1] == 4.0f && C[1][1] == 2.0f, "GLM: Failed constexpr");
+
+		constexpr glm::vec4 D = C * glm::vec4(1.0f);
+		static_assert(D == glm::vec4(4.0f, 6.0f, 8.0f, 2.0f), "GLM: Failed constexpr");
+
+		constexpr glm::vec4 E = glm::vec4(1.0f) * B;
+		static_assert(E.w == 7.0f, "GLM: Failed constexpr");
+
+		constexpr glm::mat3 F = glm::mat3(glm::dmat4(B) * glm::dmat4(0.5));
+		static_assert(F[0][0] == 0.5f && F[2][2] == 0.5f, "GLM: Failed constexpr");
+#	endif
+#endif//GLM_HAS_CONSTEXPR_CXX14
+
+	return 0;
+}
+
+namespace mul
+{
+	// Reference products on plain arrays. Matrices and vectors are moved in and out with
+	// memcpy so the reference doesn't depend on the code it checks
+	template <typename T>
+	void ref_mat4_mul(T const * m1, T const * m2, T * Result)
+	{
+		for(int c = 0; c < 4; ++c)
+		for(int r = 0; r < 4; ++r)
+			Result[c * 4 + r] = m1[r] * m2[c * 4] + m1[4 + r] * m2[c * 4 + 1] + m1[8 + r] * m2[c * 4 + 2] + m1[12 + r] * m2[c * 4 + 3];
+	}
+
+	template <typename T>
+	void ref_mat4_mul_vec4(T const * m, T const * v, T * Result)
+	{
+		for(int r = 0; r < 4; ++r)
+			Result[r] = m[r] * v[0] + m[4 + r] * v[1] + m[8 + r] * v[2] + m[12 + r] * v[3];
+	}
+
+	template <typename T>
+	void ref_vec4_mul_mat4(T const * v, T const * m, T * Result)
+	{
+		for(int c = 0; c < 4; ++c)
+			Result[c] = m[c * 4] * v[0] + m[c * 4 + 1] * v[1] + m[c * 4 + 2] * v[2] + m[c * 4 + 3] * v[3];
+	}
+
+	template <typename T>
+	int check(T const * Values, T const * Expected, int Count, T Epsilon)
+	{
+		int Error = 0;
+		for(int i = 0; i < Count; ++i)
+			Error += std::abs(Values[i] - Expected[i]) <= Epsilon ? 0 : 1;
+		return Error;
+	}
+
+	template <typename T, glm::precision P>
+	int entry()
+	{
+		typedef glm::tmat4x4<T, P> mat_type;
+		typedef glm::tvec4<T, P> vec_type;
+
+		int Error = 0;
+
+		T const Epsilon = static_cast<T>(0.001);
+
+		T a[16], b[16], v[4] = {static_cast<T>(1), static_cast<T>(-2), static_cast<T>(3), static_cast<T>(0.5)};
+		for(int i = 0; i < 16; ++i)
+		{
+			a[i] = static_cast<T>(i + 1) * static_cast<T>(0.5) - static_cast<T>(i % 4);
+			b[i] = static_cast<T>(i + 1) * static_cast<T>(-0.25) + static_cast<T>(i % 3);
+		}
+
+		mat_type A(glm::uninitialize), B(glm::uninitialize);
+		vec_type V(glm::uninitialize);
+		std::memcpy(&A, a, sizeof(a));
+		std::memcpy(&B, b, sizeof(b));
+		std::memcpy(&V, v, sizeof(v));
+
+		T Expected[16], Values[16];
+
+		ref_mat4_mul(a, b, Expected);
+		mat_type const AB = A * B;
+		std::memcpy(Values, &AB, sizeof(Values));
+		Error += check(Values, Expected, 16, Epsilon);
+
+		mat_type C(A);
+		C *= B;
+		std::memcpy(Values, &C, sizeof(Values));
+		Error += check(Values, Expected, 16, Epsilon);
+
+		ref_mat4_mul_vec4(a, v, Expected);
+		vec_type const AV = A * V;
+		std::memcpy(Values, &AV, sizeof(AV));
+		Error += check(Values, Expected, 4, Epsilon);
+
+		ref_vec4_mul_mat4(v, a, Expected);
+		vec_type const VA = V * A;
+		std::memcpy(Values, &VA, sizeof(VA));
+		Error += check(Values, Expected, 4, Epsilon);
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += entry<float, glm::lowp>();
+		Error += entry<float, glm::mediump>();
+		Error += entry<float, glm::highp>();
+		Error += entry<double, glm::highp>();
+#		if GLM_HAS_ALIGNED_TYPE
+			Error += entry<float, glm::aligned_lowp>();
+			Error += entry<float, glm::aligned_mediump>();
+			Error += entry<float, glm::aligned_highp>();
+#		endif
+
+		return Error;
+	}
+
+	// Products over a cache resident set of rigid transforms, so the timings are about the
+	// arithmetic: a dependent chain, the way a skeleton or camera concatenates transforms,
+	// then independent products
+	template <typename T, glm::precision P>
+	int perf(std::size_t Count, char const * Message)
+	{
+		typedef glm::tmat4x4<T, P> mat_type;
+		typedef glm::tvec4<T, P> vec_type;
+
+		std::size_t const Size = 256;
+
+		std::vector<T> Values(Size * 16);
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			T const a = static_cast<T>(i) * static_cast<T>(0.0174533);
+			T const b = static_cast<T>(i % 97) * static_cast<T>(0.05);
+			T const ca = std::cos(a), sa = std::sin(a), cb = std::cos(b), sb = std::sin(b);
+			T const RotZ[16] = {ca, sa, 0, 0, -sa, ca, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+			T const RotX[16] = {1, 0, 0, 0, 0, cb, sb, 0, 0, -sb, cb, 0, static_cast<T>(0.1), 0, static_cast<T>(-0.2), 1};
+			ref_mat4_mul(RotZ, RotX, &Values[i * 16]);
+		}
+		std::vector<mat_type> Inputs(Size);
+		for(std::size_t i = 0; i < Size; ++i)
+			std::memcpy(glm::value_ptr(Inputs[i]), &Values[i * 16], sizeof(mat_type));
+		std::vector<mat_type> Outputs(Size);
+		std::vector<vec_type> Points(Size, vec_type(static_cast<T>(1)));
+
+		T Ref[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+		T Tmp[16];
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			ref_mat4_mul(Ref, &Values[i * 16], Tmp);
+			std::memcpy(Ref, Tmp, sizeof(Ref));
+		}
+
+		mat_type Mat(static_cast<T>(1));
+		std::clock_t StartTime = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Mat = Mat * Inputs[i % Size];
+		std::clock_t const ChainTime = std::clock() - StartTime;
+
+		StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Outputs[i] = Inputs[i] * Inputs[(i + j) % Size];
+		std::clock_t const MatTime = std::clock() - StartTime;
+
+		StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Points[i] = Inputs[(i + j) % Size] * Points[i];
+		std::clock_t const VecTime = std::clock() - StartTime;
+
+		// Count is a multiple of Size, so the chain went around the set a whole number of times.
+		// Only check the first lap, the long chain drifts
+		mat_type First(static_cast<T>(1));
+		for(std::size_t i = 0; i < Size; ++i)
+			First = First * Inputs[i];
+		std::memcpy(Tmp, &First, sizeof(Tmp));
+		int const Error = check(Tmp, Ref, 16, static_cast<T>(0.001));
+
+		printf("%s: %d products, mat4 * mat4 chained %ld clocks, independent %ld clocks, mat4 * vec4 %ld clocks (%f %f %f)\n",
+			Message, static_cast<int>(Count), static_cast<long>(ChainTime), static_cast<long>(MatTime), static_cast<long>(VecTime),
+			static_cast<double>(Mat[3][3]), static_cast<double>(Outputs[Size - 1][0][0]), static_cast<double>(Points[0][0]));
+
+		return Error;
+	}
+}//namespace mul
+
 int perf_mul()
 {
 	int Error = 0;
 
+	std::size_t const Count = 256 * 8192;
 
+	Error += mul::perf<float, glm::highp>(Count, "packed float");
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += mul::perf<float, glm::aligned_highp>(Count, "aligned float");
+#	endif
+	Error += mul::perf<double, glm::highp>(Count, "double");
 
 	return Error;
 }
@@ -321,6 +530,8 @@ int main()
 	Error += test_operators();
 	Error += test_inverse();
 	Error += test_size();
+	Error += test_constexpr();
+	Error += mul::test();
 
 	Error += perf_mul();
 
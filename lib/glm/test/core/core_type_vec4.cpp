@@ -389,6 +389,26 @@ int test_operator_increment()
 	return Error;
 }
 
+int test_vec4_constexpr()
+{
+#	if GLM_HAS_CONSTEXPR_CXX14
+		constexpr glm::vec4 A(1, 2, 3, 4);
+		constexpr glm::vec4 B = A * 2.0f + glm::vec4(1.0f);
+		static_assert(B.w == 9.0f && B[2] == 7.0f, "GLM: Failed constexpr");
+
+		constexpr glm::vec4 C = -(B - A) / glm::vec4(2.0f);
+		static_assert(C == glm::vec4(-1.0f, -1.5f, -2.0f, -2.5f), "GLM: Failed constexpr");
+
+		constexpr glm::ivec4 D = (glm::ivec4(1, 2, 3, 4) << 1) & glm::ivec4(6);
+		static_assert(D == glm::ivec4(2, 4, 6, 0), "GLM: Failed constexpr");
+
+		constexpr glm::dvec4 E = glm::dvec4(A) * glm::dvec4(0.5);
+		static_assert(E.x == 0.5 && E[3] == 2.0, "GLM: Failed constexpr");
+#	endif//GLM_HAS_CONSTEXPR_CXX14
+
+	return 0;
+}
+
 struct AoS
 {
 	glm::vec4 A;
@@ -558,6 +578,7 @@ int main()
 	Error += test_vec4_swizzle_partial();
 	Error += test_vec4_simd();
 	Error += test_operator_increment();
+	Error += test_vec4_constexpr();
 	Error += heap::test();
 
 	return Error;
@@ -1,5 +1,19 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+template <typename T, glm::precision P, glm::precision Q>
+bool close(glm::tmat4x4<T, P> const & a, glm::tmat4x4<T, Q> const & b, T Epsilon)
+{
+	for(glm::length_t i = 0; i < 4; ++i)
+		if(!glm::all(glm::epsilonEqual(glm::tvec4<T, P>(b[i]), a[i], Epsilon)))
+			return false;
+	return true;
+}
 
 int test_perspective()
 {
@@ -41,6 +55,107 @@ int test_translate()
 	return Error;
 }
 
+template <glm::precision P>
+int test_rotate()
+{
+	typedef glm::tmat4x4<float, P> mat4;
+	typedef glm::tvec3<float, P> vec3;
+
+	int Error = 0;
+
+	mat4 const M(glm::translate(glm::scale(mat4(1.0f), vec3(1, 2, 3)), vec3(4, 5, 6)));
+	float const Angles[] = {0.0f, 0.5f, -1.25f, 3.0f};
+	vec3 const Axes[] = {vec3(1, 0, 0), vec3(0, 0, 2), vec3(1, 2, 3), vec3(-0.5f, 0.25f, 1)};
+	for(std::size_t i = 0; i < sizeof(Angles) / sizeof(Angles[0]); ++i)
+	for(std::size_t j = 0; j < sizeof(Axes) / sizeof(Axes[0]); ++j)
+	{
+		Error += close(glm::rotate(M, Angles[i], Axes[j]), glm::rotate_slow(M, Angles[i], Axes[j]), 0.0001f) ? 0 : 1;
+		Error += glm::rotate(M, Angles[i], Axes[j])[3] == M[3] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_lookAt()
+{
+	typedef glm::tvec3<float, P> vec3;
+
+	int Error = 0;
+
+	vec3 const Eyes[] = {vec3(0, 0, 5), vec3(3, 2, 1), vec3(-4, 1, -2)};
+	vec3 const Centers[] = {vec3(0), vec3(1, 1, -3)};
+	vec3 const Up(0, 1, 0);
+	for(std::size_t i = 0; i < sizeof(Eyes) / sizeof(Eyes[0]); ++i)
+	for(std::size_t j = 0; j < sizeof(Centers) / sizeof(Centers[0]); ++j)
+	{
+		glm::dvec3 const Eye(Eyes[i]);
+		glm::dvec3 const Center(Centers[j]);
+		Error += close(glm::lookAtRH(Eyes[i], Centers[j], Up), glm::mat4(glm::lookAtRH(Eye, Center, glm::dvec3(Up))), 0.0001f) ? 0 : 1;
+		Error += close(glm::lookAtLH(Eyes[i], Centers[j], Up), glm::mat4(glm::lookAtLH(Eye, Center, glm::dvec3(Up))), 0.0001f) ? 0 : 1;
+
+		// The eye is at the origin of the view space
+		glm::tvec4<float, P> const Origin = glm::lookAt(Eyes[i], Centers[j], Up) * glm::tvec4<float, P>(Eyes[i], 1.0f);
+		Error += glm::all(glm::epsilonEqual(Origin, glm::tvec4<float, P>(0, 0, 0, 1), 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_constexpr()
+{
+#	if GLM_HAS_CONSTEXPR_CXX14
+		constexpr glm::mat4 Translate = glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3));
+		static_assert(Translate[3] == glm::vec4(1, 2, 3, 1), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 Scale = glm::scale(Translate, glm::vec3(2.0f));
+		static_assert(Scale[1][1] == 2.0f && Scale[3][2] == 3.0f, "GLM: Failed constexpr");
+
+		constexpr glm::mat4 Ortho = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, 0.0f, 2.0f);
+		static_assert(Ortho[2][2] == -1.0f && Ortho[3][2] == -1.0f, "GLM: Failed constexpr");
+
+		constexpr glm::dmat4 Frustum = glm::frustum(-1.0, 1.0, -1.0, 1.0, 1.0, 3.0);
+		static_assert(Frustum[0][0] == 1.0 && Frustum[2][3] == -1.0, "GLM: Failed constexpr");
+
+		constexpr glm::mat4 Perspective = glm::perspective(glm::pi<float>() * 0.25f, 4.0f / 3.0f, 0.1f, 100.0f);
+		static_assert(Perspective[2][3] == -1.0f, "GLM: Failed constexpr");
+#	endif//GLM_HAS_CONSTEXPR_CXX14
+
+	return 0;
+}
+
+int perf_builders()
+{
+	std::size_t const Count = 1 << 20;
+
+	std::vector<glm::vec3> Vectors(64);
+	for(std::size_t i = 0; i < Vectors.size(); ++i)
+		Vectors[i] = glm::vec3(static_cast<float>(i % 7) - 3.0f, static_cast<float>(i % 5) + 1.0f, static_cast<float>(i % 3) - 1.5f);
+
+	glm::mat4 Rotate(1.0f);
+	std::clock_t const StartRotate = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Rotate = glm::rotate(Rotate, 0.001f * static_cast<float>(i & 63), Vectors[i & 63]);
+	std::clock_t const TimeRotate = std::clock() - StartRotate;
+
+	glm::mat4 RotateSlow(1.0f);
+	std::clock_t const StartRotateSlow = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		RotateSlow = glm::rotate_slow(RotateSlow, 0.001f * static_cast<float>(i & 63), Vectors[i & 63]);
+	std::clock_t const TimeRotateSlow = std::clock() - StartRotateSlow;
+
+	glm::mat4 View(0.0f);
+	std::clock_t const StartLookAt = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		View += glm::lookAt(Vectors[i & 63], Vectors[(i + 1) & 63], glm::vec3(0, 0, 1));
+	std::clock_t const TimeLookAt = std::clock() - StartLookAt;
+
+	std::printf("%d rotate: %d clocks, rotate_slow: %d clocks, lookAt: %d clocks\n",
+		static_cast<int>(Count), static_cast<int>(TimeRotate), static_cast<int>(TimeRotateSlow), static_cast<int>(TimeLookAt));
+
+	return glm::isnan(Rotate[0].x) || glm::isnan(RotateSlow[0].x) || glm::isnan(View[0].x) ? 1 : 0;
+}
+
 int main()
 {
 	int Error = 0;
@@ -49,6 +164,14 @@ int main()
 	Error += test_tweakedInfinitePerspective();
 	Error += test_pick();
 	Error += test_perspective();
+	Error += test_constexpr();
+	Error += test_rotate<glm::highp>();
+	Error += test_lookAt<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_rotate<glm::aligned_highp>();
+		Error += test_lookAt<glm::aligned_highp>();
+#	endif
+	Error += perf_builders();
 
 	return Error;
 }
@@ -1,6 +1,13 @@
 #include <glm/gtc/noise.hpp>
 #include <gli/gli.hpp>
 #include <gli/gtx/loader.hpp>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+#if GLM_HAS_CXX11_STL
+#	include <chrono>
+#endif
 
 std::size_t const Size = 64;
 
@@ -172,6 +179,246 @@ int test_perlin_pedioric()
 	return 0;
 }
 
+int myrand()
+{
+	static int holdrand = 1;
+	return (((holdrand = holdrand * 214013L + 2531011L) >> 16) & 0x7fff);
+}
+
+float myfrand() // returns values from -1 to 1 inclusive
+{
+	return float(double(myrand()) / double( 0x7ffff )) * 2.0f - 1.0f;
+}
+
+bool bitEqual(float a, float b)
+{
+	return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+// Random points at several scales, lattice points and negative zeros, in a count that leaves a partial batch
+template <typename vecType>
+std::vector<vecType> batch_points()
+{
+	std::vector<vecType> Points;
+	float const Scales[] = {1.0f, 8.0f, 300.0f};
+	for(std::size_t i = 0; i < 1000; ++i)
+	{
+		vecType Point;
+		for(glm::length_t c = 0; c < Point.length(); ++c)
+			Point[c] = myfrand() * Scales[i % 3];
+		Points.push_back(Point);
+	}
+	for(int i = -12; i <= 12; ++i)
+	{
+		vecType Point(-0.0f);
+		for(glm::length_t c = 0; c < Point.length(); ++c)
+			Point[c] = i % 2 ? float(i * (c + 1)) * 0.5f : -0.0f;
+		Points.push_back(Point);
+	}
+	return Points;
+}
+
+template <typename vecType>
+int test_batch_vec()
+{
+	int Error = 0;
+
+	std::vector<vecType> const Points = batch_points<vecType>();
+	std::vector<float> Result(Points.size());
+
+	glm::perlin(&Points[0], &Result[0], Points.size());
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += bitEqual(Result[i], glm::perlin(Points[i])) ? 0 : 1;
+
+	glm::simplex(&Points[0], &Result[0], Points.size());
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += bitEqual(Result[i], glm::simplex(Points[i])) ? 0 : 1;
+
+	glm::fbm(&Points[0], &Result[0], Points.size(), 5, 2.0f, 0.5f);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += bitEqual(Result[i], glm::fbm(Points[i], 5, 2.0f, 0.5f)) ? 0 : 1;
+
+	// A single octave is the noise itself
+	glm::fbm(&Points[0], &Result[0], Points.size(), 1, 2.0f, 0.5f);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += bitEqual(Result[i], glm::simplex(Points[i])) ? 0 : 1;
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_batch()
+{
+	int Error = 0;
+
+	Error += test_batch_vec<glm::tvec2<float, P> >();
+	Error += test_batch_vec<glm::tvec3<float, P> >();
+	Error += test_batch_vec<glm::tvec4<float, P> >();
+
+	return Error;
+}
+
+int test_batch_dvec()
+{
+	int Error = 0;
+
+	std::vector<glm::dvec3> Points(7);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Points[i] = glm::dvec3(myfrand(), myfrand(), myfrand()) * 4.0;
+
+	std::vector<double> Result(Points.size());
+	glm::simplex(&Points[0], &Result[0], Points.size());
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += Result[i] == glm::simplex(Points[i]) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename ivecType>
+int gridCount(ivecType const & Size)
+{
+	int Count = 1;
+	for(glm::length_t c = 0; c < Size.length(); ++c)
+		Count *= Size[c];
+	return Count;
+}
+
+// Grids against the batch functions on the same points, with partial chunks and more threads than rows
+template <typename vecType, typename ivecType>
+int test_grid_vec(ivecType const & Size)
+{
+	int Error = 0;
+
+	vecType Origin, Step;
+	for(glm::length_t c = 0; c < Origin.length(); ++c)
+	{
+		Origin[c] = myfrand() * 8.0f;
+		Step[c] = 0.01f + (myfrand() + 1.0f) * 0.1f;
+	}
+
+	std::vector<vecType> Points;
+	for(int i = 0, Count = gridCount(Size); i < Count; ++i)
+	{
+		vecType Point;
+		for(glm::length_t c = 0, Index = i; c < Point.length(); ++c)
+		{
+			Point[c] = Origin[c] + Step[c] * static_cast<float>(Index % Size[c]);
+			Index /= Size[c];
+		}
+		Points.push_back(Point);
+	}
+
+	std::vector<float> Batch(Points.size());
+	std::vector<float> Grid(Points.size());
+	unsigned int const Threads[] = {1, 3, 0, 1000};
+	for(std::size_t t = 0; t < sizeof(Threads) / sizeof(Threads[0]); ++t)
+	{
+		glm::perlin(&Points[0], &Batch[0], Points.size());
+		glm::perlinGrid(Origin, Step, Size, &Grid[0], Threads[t]);
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Error += bitEqual(Grid[i], Batch[i]) ? 0 : 1;
+
+		glm::simplex(&Points[0], &Batch[0], Points.size());
+		glm::simplexGrid(Origin, Step, Size, &Grid[0], Threads[t]);
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Error += bitEqual(Grid[i], Batch[i]) ? 0 : 1;
+
+		glm::fbm(&Points[0], &Batch[0], Points.size(), 5, 2.0f, 0.5f);
+		glm::fbmGrid(Origin, Step, Size, &Grid[0], Threads[t], 5, 2.0f, 0.5f);
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Error += bitEqual(Grid[i], Batch[i]) ? 0 : 1;
+	}
+
+	// An empty grid writes nothing
+	ivecType Empty(Size);
+	Empty[Empty.length() - 1] = 0;
+	float Canary = 1.0f;
+	glm::simplexGrid(Origin, Step, Empty, &Canary, 0);
+	Error += Canary == 1.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_grid()
+{
+	int Error = 0;
+
+	Error += test_grid_vec<glm::vec2>(glm::ivec2(300, 7));
+	Error += test_grid_vec<glm::vec3>(glm::ivec3(37, 6, 5));
+	Error += test_grid_vec<glm::vec4>(glm::ivec4(9, 4, 3, 2));
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_grid_vec<glm::tvec4<float, glm::aligned_highp> >(glm::tvec4<int, glm::aligned_highp>(9, 4, 3, 2));
+#	endif
+
+	return Error;
+}
+
+// Million of samples per second for the scalar and the batch functions
+template <typename vecType>
+int perf_batch(char const * Name)
+{
+	std::size_t const Count = 1 << 16;
+
+	std::vector<vecType> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < Points[i].length(); ++c)
+			Points[i][c] = myfrand() * 16.0f;
+	std::vector<float> Result(Count);
+
+	double Rates[6];
+	float Sum = 0.0f;
+	for(int n = 0; n < 3; ++n)
+	{
+		std::clock_t const StartScalar = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = n == 0 ? glm::perlin(Points[i]) : n == 1 ? glm::simplex(Points[i]) : glm::fbm(Points[i], 4, 2.0f, 0.5f);
+		std::clock_t const TimeScalar = std::clock() - StartScalar;
+		Sum += Result[Count / 2];
+
+		std::clock_t const StartBatch = std::clock();
+		if(n == 0)
+			glm::perlin(&Points[0], &Result[0], Count);
+		else if(n == 1)
+			glm::simplex(&Points[0], &Result[0], Count);
+		else
+			glm::fbm(&Points[0], &Result[0], Count, 4, 2.0f, 0.5f);
+		std::clock_t const TimeBatch = std::clock() - StartBatch;
+		Sum += Result[Count / 2];
+
+		Rates[n * 2 + 0] = double(Count) * CLOCKS_PER_SEC / (double(TimeScalar + 1) * 1000000.0);
+		Rates[n * 2 + 1] = double(Count) * CLOCKS_PER_SEC / (double(TimeBatch + 1) * 1000000.0);
+	}
+
+	std::printf("%s Msamples/s: perlin %.1f, batch %.1f; simplex %.1f, batch %.1f; 4 octaves fbm %.1f, batch %.1f\n",
+		Name, Rates[0], Rates[1], Rates[2], Rates[3], Rates[4], Rates[5]);
+
+	return glm::isnan(Sum) ? 1 : 0;
+}
+
+#if GLM_HAS_CXX11_STL
+// Million of samples per second of the 4 octaves fbm of a grid, on one thread and on all of them
+template <typename vecType, typename ivecType>
+int perf_grid(char const * Name, ivecType const & Size)
+{
+	std::vector<float> Result(static_cast<std::size_t>(gridCount(Size)));
+
+	double Rates[2];
+	unsigned int const Threads[] = {1, 0};
+	for(int n = 0; n < 2; ++n)
+	{
+		std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+		glm::fbmGrid(vecType(0.0f), vecType(1.0f / 64.0f), Size, &Result[0], Threads[n], 4, 2.0f, 0.5f);
+		std::chrono::duration<double> const Time = std::chrono::steady_clock::now() - Start;
+		Rates[n] = double(Result.size()) / (Time.count() * 1000000.0);
+	}
+
+	std::printf("%s grid Msamples/s, 4 octaves fbm: 1 thread %.1f, %u threads %.1f\n",
+		Name, Rates[0], std::thread::hardware_concurrency(), Rates[1]);
+
+	return glm::isnan(Result[Result.size() / 2]) ? 1 : 0;
+}
+#endif//GLM_HAS_CXX11_STL
+
 int main()
 {
 	int Error = 0;
@@ -179,6 +426,20 @@ int main()
 	Error += test_simplex();
 	Error += test_perlin();
 	Error += test_perlin_pedioric();
+	Error += test_batch<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_batch<glm::aligned_highp>();
+#	endif
+	Error += test_batch_dvec();
+	Error += test_grid();
+	Error += perf_batch<glm::vec2>("2D");
+	Error += perf_batch<glm::vec3>("3D");
+	Error += perf_batch<glm::vec4>("4D");
+#	if GLM_HAS_CXX11_STL
+		Error += perf_grid<glm::vec2>("2D", glm::ivec2(1024, 1024));
+		Error += perf_grid<glm::vec3>("3D", glm::ivec3(128, 128, 64));
+		Error += perf_grid<glm::vec4>("4D", glm::ivec4(64, 64, 32, 8));
+#	endif
 
 	return Error;
 }
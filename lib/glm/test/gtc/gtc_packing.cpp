@@ -1,6 +1,9 @@
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
 #include <vector>
 
 void print_bits(float const & s)
@@ -642,6 +645,377 @@ int test_packUnorm2x3_1x2()
 	return Error;
 }
 
+int myrand()
+{
+	static int holdrand = 1;
+	return (((holdrand = holdrand * 214013L + 2531011L) >> 16) & 0x7fff);
+}
+
+float myfrand() // returns values from -1 to 1 inclusive
+{
+	return float(double(myrand()) / double( 0x7ffff )) * 2.0f - 1.0f;
+}
+
+bool bitEqual(float a, float b)
+{
+	return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+// Random values around the normalized range, the values halfway between two codes and the special cases.
+// 1037 values, so that the SIMD loops leave a remainder.
+std::vector<float> array_values(float Scale)
+{
+	std::vector<float> Values;
+	for(int i = 0; i < 900; ++i)
+		Values.push_back(myfrand() * 1.2f);
+	for(int i = -16; i < 16; ++i)
+		Values.push_back((static_cast<float>(i) + 0.5f) / Scale);
+	Values.push_back(0.0f);
+	Values.push_back(-0.0f);
+	Values.push_back(1.0f);
+	Values.push_back(-1.0f);
+	Values.push_back(std::numeric_limits<float>::infinity());
+	Values.push_back(-std::numeric_limits<float>::infinity());
+	Values.push_back(std::numeric_limits<float>::quiet_NaN());
+	Values.push_back(1e30f);
+	Values.push_back(-1e30f);
+	while(Values.size() < 1037)
+		Values.push_back(myfrand());
+	return Values;
+}
+
+int test_array_norm()
+{
+	int Error = 0;
+
+	{
+		std::vector<float> const In = array_values(255.0f);
+		std::vector<glm::uint8> Packed(In.size());
+		glm::packUnorm(&In[0], &Packed[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += Packed[i] == glm::packUnorm1x8(In[i]) ? 0 : 1;
+
+		std::vector<float> Out(In.size());
+		glm::unpackUnorm(&Packed[0], &Out[0], Packed.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			if(!glm::isnan(In[i]))
+				Error += glm::abs(Out[i] - glm::clamp(In[i], 0.0f, 1.0f)) <= 0.5f / 255.0f + 1e-6f ? 0 : 1;
+	}
+
+	{
+		std::vector<float> const In = array_values(127.0f);
+		std::vector<glm::int8> Packed(In.size());
+		glm::packSnorm(&In[0], &Packed[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += static_cast<glm::uint8>(Packed[i]) == glm::packSnorm1x8(In[i]) ? 0 : 1;
+
+		std::vector<float> Out(In.size());
+		glm::unpackSnorm(&Packed[0], &Out[0], Packed.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			if(!glm::isnan(In[i]))
+				Error += glm::abs(Out[i] - glm::clamp(In[i], -1.0f, 1.0f)) <= 0.5f / 127.0f + 1e-6f ? 0 : 1;
+	}
+
+	{
+		std::vector<float> const In = array_values(65535.0f);
+		std::vector<glm::uint16> Packed(In.size());
+		glm::packUnorm(&In[0], &Packed[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += Packed[i] == glm::packUnorm1x16(In[i]) ? 0 : 1;
+	}
+
+	{
+		std::vector<float> const In = array_values(32767.0f);
+		std::vector<glm::int16> Packed(In.size());
+		glm::packSnorm(&In[0], &Packed[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += static_cast<glm::uint16>(Packed[i]) == glm::packSnorm1x16(In[i]) ? 0 : 1;
+	}
+
+	// Every code
+	{
+		std::vector<glm::uint16> Codes(65536);
+		for(std::size_t i = 0; i < Codes.size(); ++i)
+			Codes[i] = static_cast<glm::uint16>(i);
+
+		std::vector<float> Out(Codes.size());
+		glm::unpackUnorm(&Codes[0], &Out[0], Codes.size());
+		for(std::size_t i = 0; i < Codes.size(); ++i)
+			Error += bitEqual(Out[i], glm::unpackUnorm1x16(Codes[i])) ? 0 : 1;
+
+		glm::unpackSnorm(reinterpret_cast<glm::int16 const*>(&Codes[0]), &Out[0], Codes.size());
+		for(std::size_t i = 0; i < Codes.size(); ++i)
+			Error += bitEqual(Out[i], glm::unpackSnorm1x16(Codes[i])) ? 0 : 1;
+
+		std::vector<glm::uint16> Repacked(Codes.size());
+		glm::unpackUnorm(&Codes[0], &Out[0], Codes.size());
+		glm::packUnorm(&Out[0], &Repacked[0], Out.size());
+		Error += Repacked == Codes ? 0 : 1;
+
+		std::vector<glm::uint8> Bytes(256);
+		for(std::size_t i = 0; i < Bytes.size(); ++i)
+			Bytes[i] = static_cast<glm::uint8>(i);
+
+		glm::unpackUnorm(&Bytes[0], &Out[0], Bytes.size());
+		for(std::size_t i = 0; i < Bytes.size(); ++i)
+			Error += bitEqual(Out[i], glm::unpackUnorm1x8(Bytes[i])) ? 0 : 1;
+
+		glm::unpackSnorm(reinterpret_cast<glm::int8 const*>(&Bytes[0]), &Out[0], Bytes.size());
+		for(std::size_t i = 0; i < Bytes.size(); ++i)
+			Error += bitEqual(Out[i], glm::unpackSnorm1x8(Bytes[i])) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_array_half()
+{
+	int Error = 0;
+
+	// Every half: exact conversion, NaNs made quiet, and back to the same bits
+	{
+		std::vector<glm::uint16> Halfs(65536);
+		for(std::size_t i = 0; i < Halfs.size(); ++i)
+			Halfs[i] = static_cast<glm::uint16>(i);
+
+		std::vector<float> Floats(Halfs.size());
+		glm::unpackHalf(&Halfs[0], &Floats[0], Halfs.size());
+
+		std::vector<glm::uint16> Repacked(Halfs.size());
+		glm::packHalf(&Floats[0], &Repacked[0], Floats.size());
+
+		for(std::size_t i = 0; i < Halfs.size(); ++i)
+		{
+			bool const IsNaN = (Halfs[i] & 0x7fff) > 0x7c00;
+			if(IsNaN)
+			{
+				Error += glm::isnan(Floats[i]) ? 0 : 1;
+				Error += Repacked[i] == (Halfs[i] | 0x0200) ? 0 : 1;
+			}
+			else
+			{
+				Error += bitEqual(Floats[i], glm::unpackHalf1x16(Halfs[i])) ? 0 : 1;
+				Error += Repacked[i] == Halfs[i] ? 0 : 1;
+			}
+
+			// The elements left to the scalar path give the same results
+			float One = 0;
+			glm::unpackHalf(&Halfs[i], &One, 1);
+			Error += bitEqual(One, Floats[i]) ? 0 : 1;
+		}
+	}
+
+	// Floats of every magnitude: the same as packHalf1x16, except halfway cases rounded to even
+	{
+		std::vector<float> In;
+		for(int i = 0; i < 4000; ++i)
+		{
+			glm::uint32 const Bits = (static_cast<glm::uint32>(myrand()) << 17) ^ (static_cast<glm::uint32>(myrand()) << 2) ^ static_cast<glm::uint32>(myrand());
+			float Value = 0;
+			std::memcpy(&Value, &Bits, sizeof(Value));
+			In.push_back(Value);
+			In.push_back(myfrand() * 70000.0f);
+		}
+		In.push_back(1.0f + 1.0f / 2048.0f); // halfway between 1 and the next half
+		In.push_back(1.0f + 3.0f / 2048.0f);
+		In.push_back(65504.0f);
+		In.push_back(65519.0f);
+		In.push_back(65520.0f);
+		In.push_back(5.9604645e-8f); // smallest subnormal half
+		In.push_back(2.9802322e-8f); // half of it
+		In.push_back(-0.0f);
+
+		std::vector<glm::uint16> Packed(In.size());
+		glm::packHalf(&In[0], &Packed[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+		{
+			glm::uint16 One = 0;
+			glm::packHalf(&In[i], &One, 1);
+			Error += One == Packed[i] ? 0 : 1;
+
+			if(glm::isnan(In[i]))
+				continue;
+
+			glm::uint16 const Scalar = glm::packHalf1x16(In[i]);
+			Error += Packed[i] == Scalar || (Packed[i] + 1 == Scalar && (Packed[i] & 1) == 0) ? 0 : 1;
+		}
+
+		std::size_t const Last = In.size() - 8;
+		Error += Packed[Last + 0] == 0x3c00 ? 0 : 1;
+		Error += Packed[Last + 1] == 0x3c02 ? 0 : 1;
+		Error += Packed[Last + 2] == 0x7bff ? 0 : 1;
+		Error += Packed[Last + 3] == 0x7bff ? 0 : 1;
+		Error += Packed[Last + 4] == 0x7c00 ? 0 : 1;
+		Error += Packed[Last + 5] == 0x0001 ? 0 : 1;
+		Error += Packed[Last + 6] == 0x0000 ? 0 : 1;
+		Error += Packed[Last + 7] == 0x8000 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_array_3x10_1x2()
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> In;
+	for(std::size_t i = 0; i < 1023; ++i)
+		In.push_back(glm::vec4(myfrand(), myfrand(), myfrand(), myfrand()) * 1.1f);
+	In.push_back(glm::vec4(0.5f / 511.0f, -0.5f / 511.0f, 0.5f / 1023.0f, 0.5f));
+	In.push_back(glm::vec4(std::numeric_limits<float>::quiet_NaN(), -0.0f, 1.0f, -1.0f));
+
+	std::vector<glm::uint32> Packed(In.size());
+	glm::packSnorm3x10_1x2(&In[0], &Packed[0], In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += Packed[i] == glm::packSnorm3x10_1x2(In[i]) ? 0 : 1;
+
+	glm::packUnorm3x10_1x2(&In[0], &Packed[0], In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += Packed[i] == glm::packUnorm3x10_1x2(In[i]) ? 0 : 1;
+
+	std::vector<glm::uint32> Codes;
+	for(std::size_t i = 0; i < 1027; ++i)
+		Codes.push_back((static_cast<glm::uint32>(myrand()) << 17) ^ (static_cast<glm::uint32>(myrand()) << 2) ^ static_cast<glm::uint32>(myrand()));
+
+	std::vector<glm::vec4> Out(Codes.size());
+	glm::unpackSnorm3x10_1x2(&Codes[0], &Out[0], Codes.size());
+	for(std::size_t i = 0; i < Codes.size(); ++i)
+	{
+		glm::vec4 const Scalar = glm::unpackSnorm3x10_1x2(Codes[i]);
+		for(glm::length_t c = 0; c < 4; ++c)
+			Error += bitEqual(Out[i][c], Scalar[c]) ? 0 : 1;
+	}
+
+	glm::unpackUnorm3x10_1x2(&Codes[0], &Out[0], Codes.size());
+	for(std::size_t i = 0; i < Codes.size(); ++i)
+	{
+		glm::vec4 const Scalar = glm::unpackUnorm3x10_1x2(Codes[i]);
+		for(glm::length_t c = 0; c < 4; ++c)
+			Error += bitEqual(Out[i][c], Scalar[c]) ? 0 : 1;
+	}
+
+	// Round trip
+	Packed.resize(Out.size());
+	glm::packUnorm3x10_1x2(&Out[0], &Packed[0], Out.size());
+	for(std::size_t i = 0; i < Codes.size(); ++i)
+		Error += Packed[i] == Codes[i] ? 0 : 1;
+
+	return Error;
+}
+
+int test_Octahedral2x16()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> In;
+	for(std::size_t i = 0; i < 1021; ++i)
+	{
+		glm::vec3 const Direction(myfrand(), myfrand(), myfrand());
+		In.push_back(glm::length(Direction) > 0.01f ? glm::normalize(Direction) : glm::vec3(0, 0, 1));
+	}
+	In.push_back(glm::vec3(0, 0, 1));
+	In.push_back(glm::vec3(0, 0, -1));
+	In.push_back(glm::vec3(1, 0, 0));
+	In.push_back(glm::vec3(0, -1, 0));
+	In.push_back(glm::normalize(glm::vec3(-1, -1, -1)));
+	In.push_back(glm::normalize(glm::vec3(1, -0.0f, -1)));
+
+	std::vector<glm::uint32> Packed(In.size());
+	glm::packOctahedral2x16(&In[0], &Packed[0], In.size());
+
+	std::vector<glm::vec3> Out(In.size());
+	glm::unpackOctahedral2x16(&Packed[0], &Out[0], Packed.size());
+
+	for(std::size_t i = 0; i < In.size(); ++i)
+	{
+		Error += Packed[i] == glm::packOctahedral2x16(In[i]) ? 0 : 1;
+		Error += glm::distance(glm::unpackOctahedral2x16(glm::packOctahedral2x16(In[i] * 3.0f)), In[i]) < 1e-4f ? 0 : 1;
+
+		glm::vec3 const Scalar = glm::unpackOctahedral2x16(Packed[i]);
+		Error += glm::all(glm::epsilonEqual(Out[i], Scalar, 1e-6f)) ? 0 : 1;
+		Error += glm::distance(Out[i], In[i]) < 1e-4f ? 0 : 1;
+		Error += glm::abs(glm::length(Out[i]) - 1.0f) < 1e-6f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename inType, typename outType, typename arrayFunc, typename scalarFunc>
+void perf_array(char const * Name, std::vector<inType> const & In, arrayFunc Array, scalarFunc Scalar)
+{
+	std::vector<outType> Out(In.size());
+	double const Bytes = static_cast<double>(In.size() * (sizeof(inType) + sizeof(outType)));
+
+	std::clock_t const StartScalar = std::clock();
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Out[i] = Scalar(In[i]);
+	std::clock_t const TimeScalar = std::clock() - StartScalar;
+
+	std::clock_t const StartArray = std::clock();
+	Array(&In[0], &Out[0], In.size());
+	std::clock_t const TimeArray = std::clock() - StartArray;
+
+	double const ScalarGBs = Bytes / (static_cast<double>(glm::max<std::clock_t>(TimeScalar, 1)) / CLOCKS_PER_SEC) / 1e9;
+	double const ArrayGBs = Bytes / (static_cast<double>(glm::max<std::clock_t>(TimeArray, 1)) / CLOCKS_PER_SEC) / 1e9;
+	std::printf("%s GB/s: per element %.2f, array %.2f\n", Name, ScalarGBs, ArrayGBs);
+}
+
+glm::uint8 perf_packUnorm8(float v){return glm::packUnorm1x8(v);}
+float perf_unpackUnorm8(glm::uint8 p){return glm::unpackUnorm1x8(p);}
+glm::int16 perf_packSnorm16(float v){return static_cast<glm::int16>(glm::packSnorm1x16(v));}
+glm::uint16 perf_packHalf(float v){return glm::packHalf1x16(v);}
+float perf_unpackHalf(glm::uint16 p){return glm::unpackHalf1x16(p);}
+glm::uint32 perf_packSnorm3x10_1x2(glm::vec4 const & v){return glm::packSnorm3x10_1x2(v);}
+glm::vec4 perf_unpackSnorm3x10_1x2(glm::uint32 p){return glm::unpackSnorm3x10_1x2(p);}
+glm::uint32 perf_packOctahedral(glm::vec3 const & v){return glm::packOctahedral2x16(v);}
+glm::vec3 perf_unpackOctahedral(glm::uint32 p){return glm::unpackOctahedral2x16(p);}
+
+void array_packUnorm8(float const * v, glm::uint8 * p, std::size_t Count){glm::packUnorm(v, p, Count);}
+void array_unpackUnorm8(glm::uint8 const * p, float * v, std::size_t Count){glm::unpackUnorm(p, v, Count);}
+void array_packSnorm16(float const * v, glm::int16 * p, std::size_t Count){glm::packSnorm(v, p, Count);}
+void array_packHalf(float const * v, glm::uint16 * p, std::size_t Count){glm::packHalf(v, p, Count);}
+void array_unpackHalf(glm::uint16 const * p, float * v, std::size_t Count){glm::unpackHalf(p, v, Count);}
+void array_packSnorm3x10_1x2(glm::vec4 const * v, glm::uint32 * p, std::size_t Count){glm::packSnorm3x10_1x2(v, p, Count);}
+void array_unpackSnorm3x10_1x2(glm::uint32 const * p, glm::vec4 * v, std::size_t Count){glm::unpackSnorm3x10_1x2(p, v, Count);}
+void array_packOctahedral(glm::vec3 const * v, glm::uint32 * p, std::size_t Count){glm::packOctahedral2x16(v, p, Count);}
+void array_unpackOctahedral(glm::uint32 const * p, glm::vec3 * v, std::size_t Count){glm::unpackOctahedral2x16(p, v, Count);}
+
+int perf_array_packing()
+{
+	std::size_t const Count = 1 << 22;
+
+	std::vector<float> Floats(Count);
+	std::vector<glm::uint8> Bytes(Count);
+	std::vector<glm::uint16> Halfs(Count);
+	std::vector<glm::vec4> Vec4s(Count / 4);
+	std::vector<glm::vec3> Vec3s(Count / 4);
+	std::vector<glm::uint32> Words(Count / 4);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Floats[i] = myfrand();
+		Bytes[i] = static_cast<glm::uint8>(myrand());
+		Halfs[i] = glm::packHalf1x16(Floats[i] * 100.0f);
+	}
+	for(std::size_t i = 0; i < Count / 4; ++i)
+	{
+		Vec4s[i] = glm::vec4(Floats[i * 4], Floats[i * 4 + 1], Floats[i * 4 + 2], Floats[i * 4 + 3]);
+		Vec3s[i] = glm::normalize(glm::vec3(Vec4s[i]) + glm::vec3(0.0f, 0.0f, 0.01f));
+		Words[i] = glm::packOctahedral2x16(Vec3s[i]);
+	}
+
+	perf_array<float, glm::uint8>("packUnorm 8", Floats, array_packUnorm8, perf_packUnorm8);
+	perf_array<glm::uint8, float>("unpackUnorm 8", Bytes, array_unpackUnorm8, perf_unpackUnorm8);
+	perf_array<float, glm::int16>("packSnorm 16", Floats, array_packSnorm16, perf_packSnorm16);
+	perf_array<float, glm::uint16>("packHalf", Floats, array_packHalf, perf_packHalf);
+	perf_array<glm::uint16, float>("unpackHalf", Halfs, array_unpackHalf, perf_unpackHalf);
+	perf_array<glm::vec4, glm::uint32>("packSnorm3x10_1x2", Vec4s, array_packSnorm3x10_1x2, perf_packSnorm3x10_1x2);
+	perf_array<glm::uint32, glm::vec4>("unpackSnorm3x10_1x2", Words, array_unpackSnorm3x10_1x2, perf_unpackSnorm3x10_1x2);
+	perf_array<glm::vec3, glm::uint32>("packOctahedral2x16", Vec3s, array_packOctahedral, perf_packOctahedral);
+	perf_array<glm::uint32, glm::vec3>("unpackOctahedral2x16", Words, array_unpackOctahedral, perf_unpackOctahedral);
+
+	return 0;
+}
+
 int main()
 {
 	int Error = 0;
@@ -681,5 +1055,11 @@ int main()
 	Error += test_Half1x16();
 	Error += test_Half4x16();
 
+	Error += test_array_norm();
+	Error += test_array_half();
+	Error += test_array_3x10_1x2();
+	Error += test_Octahedral2x16();
+	Error += perf_array_packing();
+
 	return Error;
 }
@@ -1,6 +1,8 @@
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
 #include <vector>
 
 int test_quat_angle()
@@ -291,6 +293,28 @@ int test_quat_ctr()
 	return Error;
 }
 
+int test_quat_constexpr()
+{
+#	if GLM_HAS_CONSTEXPR_CXX14
+		constexpr glm::quat A(1, 0, 0, 0);
+		constexpr glm::quat B = A * A + A * 0.5f;
+		static_assert(B.w == 1.5f && B.x == 0.0f, "GLM: Failed constexpr");
+
+		constexpr glm::quat C = glm::conjugate(glm::quat(0, 1, 0, 0)) * glm::quat(0, 1, 0, 0);
+		static_assert(C.w == 1.0f && C.x == 0.0f, "GLM: Failed constexpr");
+
+		constexpr float D = glm::dot(B, glm::inverse(glm::quat(2, 0, 0, 0)));
+		static_assert(D == 0.75f, "GLM: Failed constexpr");
+
+#		if GLM_HAS_IS_CONSTANT_EVALUATED || GLM_ARCH == GLM_ARCH_PURE
+			constexpr glm::vec3 E = glm::quat(0, 0, 0, 1) * glm::vec3(1, 2, 3);
+			static_assert(E == glm::vec3(-1.0f, -2.0f, 3.0f), "GLM: Failed constexpr");
+#		endif
+#	endif//GLM_HAS_CONSTEXPR_CXX14
+
+	return 0;
+}
+
 int test_size()
 {
 	int Error = 0;
@@ -305,6 +329,177 @@ int test_size()
 	return Error;
 }
 
+// Float quaternions take the SIMD paths when the target has SSE2, double ones the scalar templates
+namespace simd
+{
+	bool close(double Value, double Expected)
+	{
+		return glm::abs(Value - Expected) <= 1e-5 * (1.0 + glm::abs(Expected));
+	}
+
+	template <glm::precision P>
+	int check(glm::tquat<float, P> const & q, glm::dquat const & Expected)
+	{
+		return close(q.x, Expected.x) && close(q.y, Expected.y) && close(q.z, Expected.z) && close(q.w, Expected.w) ? 0 : 1;
+	}
+
+	template <glm::precision P>
+	glm::tquat<float, P> quat(std::size_t i)
+	{
+		float const f = static_cast<float>(i);
+		return glm::tquat<float, P>(glm::cos(f * 0.37f), glm::sin(f * 0.37f) * 0.8f, glm::cos(f * 1.3f) * 0.6f, glm::sin(f * 0.71f) * 0.4f);
+	}
+
+	template <glm::precision P>
+	glm::dquat dquat(glm::tquat<float, P> const & q)
+	{
+		return glm::dquat(q.w, q.x, q.y, q.z);
+	}
+
+	template <glm::precision P>
+	int test()
+	{
+		typedef glm::tquat<float, P> quat_type;
+		int Error = 0;
+
+		for(std::size_t i = 0; i < 64; ++i)
+		{
+			quat_type const a = quat<P>(i);
+			quat_type b = quat<P>(i * 5 + 3);
+			// Equal, opposite and nearly equal, for every branch of mix and slerp
+			if(i % 8 == 1)
+				b = a;
+			if(i % 8 == 2)
+				b = -a;
+			if(i % 8 == 3)
+				b = quat_type(a.w, a.x + 1e-5f, a.y, a.z);
+			float const t = static_cast<float>(i % 9) / 8.0f;
+			glm::dquat const da = dquat(a), db = dquat(b);
+
+			Error += check(glm::normalize(a), glm::normalize(da));
+			Error += check(glm::slerp(a, b, t), glm::slerp(da, db, static_cast<double>(t)));
+			// mix takes the long way, skip the pairs where acos is badly conditioned
+			if(glm::abs(glm::dot(da, db)) < 0.999 * glm::length(da) * glm::length(db))
+				Error += check(glm::mix(a, b, t), glm::mix(da, db, static_cast<double>(t)));
+
+			quat_type const n = glm::normalize(a);
+			glm::dquat const dn = dquat(n);
+
+			glm::vec3 const v(static_cast<float>(i) - 30.0f, 2.0f, static_cast<float>(i % 7));
+			glm::tvec3<float, P> const r = n * glm::tvec3<float, P>(v);
+			glm::dvec3 const dr = dn * glm::dvec3(v);
+			Error += close(r.x, dr.x) && close(r.y, dr.y) && close(r.z, dr.z) ? 0 : 1;
+
+			glm::tmat3x3<float, P> const m3 = glm::mat3_cast(n);
+			glm::tmat4x4<float, P> const m4 = glm::mat4_cast(n);
+			glm::dmat4 const dm4 = glm::mat4_cast(dn);
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Error += close(m4[c][j], dm4[c][j]) ? 0 : 1;
+				if(c < 3 && j < 3)
+					Error += m3[c][j] == m4[c][j] ? 0 : 1;
+			}
+
+			// Round trip, up to the sign of the quaternion
+			quat_type const q3 = glm::quat_cast(m3);
+			quat_type const q4 = glm::quat_cast(m4);
+			glm::dquat const Expected = glm::dot(dquat(q3), dn) < 0.0 ? -dn : dn;
+			Error += check(q3, Expected);
+			Error += check(q4, Expected);
+		}
+
+		// The zero quaternion normalizes to the identity
+		quat_type const Zero(0, 0, 0, 0);
+		Error += glm::normalize(Zero) == quat_type(1, 0, 0, 0) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Operations over a cache resident set of rotations, so that the timings are about the arithmetic
+	template <typename T, glm::precision P>
+	int perf(std::size_t Count, char const * Message)
+	{
+		typedef glm::tquat<T, P> quat_type;
+		typedef glm::tvec3<T, P> vec_type;
+
+		std::size_t const Size = 256;
+		std::vector<quat_type> Inputs(Size), Outputs(Size);
+		std::vector<vec_type> Points(Size, vec_type(static_cast<T>(1)));
+		std::vector<glm::tmat4x4<T, P> > Matrices(Size);
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			glm::tquat<float, P> const q = quat<P>(i);
+			Inputs[i] = quat_type(static_cast<T>(q.w), static_cast<T>(q.x), static_cast<T>(q.y), static_cast<T>(q.z));
+		}
+
+		std::clock_t StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Outputs[i] = glm::normalize(Inputs[(i + j) % Size]);
+		std::clock_t const NormalizeTime = std::clock() - StartTime;
+		Inputs.swap(Outputs);
+
+		StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Outputs[i] = glm::slerp(Inputs[i], Inputs[(i + j + 1) % Size], static_cast<T>(0.3));
+		std::clock_t const SlerpTime = std::clock() - StartTime;
+
+		StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Points[i] = Inputs[(i + j) % Size] * Points[i];
+		std::clock_t const RotateTime = std::clock() - StartTime;
+
+		StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Matrices[i] = glm::mat4_cast(Inputs[(i + j) % Size]);
+		std::clock_t const CastTime = std::clock() - StartTime;
+
+		StartTime = std::clock();
+		for(std::size_t j = 0; j < Count; j += Size)
+		for(std::size_t i = 0; i < Size; ++i)
+			Outputs[i] = glm::quat_cast(Matrices[(i + j) % Size]);
+		std::clock_t const QuatCastTime = std::clock() - StartTime;
+
+		std::printf("%s: %d each, normalize %ld, slerp %ld, quat * vec3 %ld, mat4_cast %ld, quat_cast %ld clocks (%f %f)\n",
+			Message, static_cast<int>(Count), static_cast<long>(NormalizeTime), static_cast<long>(SlerpTime),
+			static_cast<long>(RotateTime), static_cast<long>(CastTime), static_cast<long>(QuatCastTime),
+			static_cast<double>(Outputs[Size - 1].w), static_cast<double>(Points[0].x));
+
+		return 0;
+	}
+}//namespace simd
+
+int test_quat_simd()
+{
+	int Error = 0;
+
+	Error += simd::test<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += simd::test<glm::aligned_highp>();
+#	endif
+
+	return Error;
+}
+
+int perf_quat()
+{
+	int Error = 0;
+
+	std::size_t const Count = 256 * 4096;
+
+	Error += simd::perf<float, glm::highp>(Count, "packed float");
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += simd::perf<float, glm::aligned_highp>(Count, "aligned float");
+#	endif
+	Error += simd::perf<double, glm::highp>(Count, "double");
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -321,7 +516,10 @@ int main()
 	Error += test_quat_normalize();
 	Error += test_quat_euler();
 	Error += test_quat_slerp();
+	Error += test_quat_constexpr();
 	Error += test_size();
+	Error += test_quat_simd();
+	Error += perf_quat();
 
 	return Error;
 }
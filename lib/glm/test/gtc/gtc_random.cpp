@@ -1,8 +1,16 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
 #endif
+#if GLM_HAS_THREAD_LOCAL && GLM_HAS_CXX11_STL
+#	include <thread>
+#	include <chrono>
+#endif
 
 std::size_t const TestSamples = 10000;
 
@@ -320,6 +328,483 @@ int test_ballRand()
 
 	return Error;
 }
+// Outputs of the reference implementations of xoshiro256** and pcg32
+int test_engines()
+{
+	int Error = 0;
+
+	{
+		glm::xoshiro256 e;
+		e.s[0] = 1;
+		e.s[1] = 2;
+		e.s[2] = 3;
+		e.s[3] = 4;
+		Error += e() == 0x0000000000002d00ull ? 0 : 1;
+		Error += e() == 0x0000000000000000ull ? 0 : 1;
+		Error += e() == 0x000000005a007080ull ? 0 : 1;
+		Error += e() == 0x10e0000000009d80ull ? 0 : 1;
+
+		e.jump();
+		Error += e() == 0x986a928c99a10251ull ? 0 : 1;
+	}
+
+	{
+		glm::xoshiro256 e(0);
+		Error += e() == 0x99ec5f36cb75f2b4ull ? 0 : 1;
+		Error += e() == 0xbf6e1f784956452aull ? 0 : 1;
+
+		glm::xoshiro256 f(1);
+		Error += f() != 0x99ec5f36cb75f2b4ull ? 0 : 1;
+	}
+
+	{
+		glm::pcg32 e(42, 54);
+		Error += e() == 0xa15c02b7u ? 0 : 1;
+		Error += e() == 0x7b47f409u ? 0 : 1;
+		Error += e() == 0xba1d3330u ? 0 : 1;
+		Error += e() == 0x83d2f293u ? 0 : 1;
+		Error += e() == 0xbfa4784bu ? 0 : 1;
+		Error += e() == 0xcbed606eu ? 0 : 1;
+
+		glm::pcg32 f(42, 54);
+		f.advance(4);
+		Error += f() == 0xbfa4784bu ? 0 : 1;
+
+		glm::pcg32 g(42, 54);
+		for(int i = 0; i < 1000; ++i)
+			g();
+		glm::pcg32 h(42, 54);
+		h.advance(1000);
+		Error += g() == h() ? 0 : 1;
+
+		glm::pcg32 Other(42, 55);
+		glm::pcg32 Same(42, 54);
+		Error += Other() != Same() ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Pearson's chi-squared of Count draws over Bins equally likely bins, within 6 standard deviations of its mean
+static bool chi_squared_ok(std::vector<std::size_t> const & Histogram, std::size_t Count)
+{
+	double const Bins = static_cast<double>(Histogram.size());
+	double const Expected = static_cast<double>(Count) / Bins;
+
+	double Chi2 = 0.0;
+	for(std::size_t i = 0; i < Histogram.size(); ++i)
+		Chi2 += (static_cast<double>(Histogram[i]) - Expected) * (static_cast<double>(Histogram[i]) - Expected) / Expected;
+
+	double const Freedom = Bins - 1.0;
+	return std::abs(Chi2 - Freedom) < 6.0 * std::sqrt(2.0 * Freedom);
+}
+
+template <typename Engine>
+int test_engine_quality(Engine & e)
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 20;
+
+	// Uniform bytes, and pairs of successive nibbles
+	{
+		std::vector<std::size_t> Bytes(256, 0);
+		std::vector<std::size_t> Pairs(256, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint64 const a = static_cast<glm::uint64>(e());
+			glm::uint64 const b = static_cast<glm::uint64>(e());
+			++Bytes[static_cast<std::size_t>(a & 0xff)];
+			++Pairs[static_cast<std::size_t>(((a >> 8) & 0x0f) | ((b >> 4) & 0xf0))];
+		}
+		Error += chi_squared_ok(Bytes, Count) ? 0 : 1;
+		Error += chi_squared_ok(Pairs, Count) ? 0 : 1;
+	}
+
+	// Integers over a range that is not a power of two, which a modulo would bias
+	{
+		std::vector<std::size_t> Histogram(7, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+			++Histogram[static_cast<std::size_t>(glm::linearRand(e, 3, 9) - 3)];
+		Error += chi_squared_ok(Histogram, Count) ? 0 : 1;
+
+		std::vector<std::size_t> Histogram64(7, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+			++Histogram64[static_cast<std::size_t>(glm::linearRand(e, glm::int64(-3), glm::int64(3)) + 3)];
+		Error += chi_squared_ok(Histogram64, Count) ? 0 : 1;
+	}
+
+	// Full ranges
+	{
+		glm::uint32 Or = 0, And = ~0u;
+		glm::int8 Min = 0, Max = 0;
+		for(std::size_t i = 0; i < 4096; ++i)
+		{
+			glm::uint32 const a = glm::linearRand(e, glm::uint32(0), ~glm::uint32(0));
+			Or |= a;
+			And &= a;
+
+			glm::int8 const b = glm::linearRand(e, glm::int8(-128), glm::int8(127));
+			Min = glm::min(Min, b);
+			Max = glm::max(Max, b);
+		}
+		Error += Or == ~0u && And == 0u ? 0 : 1;
+		Error += Min == -128 && Max == 127 ? 0 : 1;
+	}
+
+	// Moments and serial correlation of uniform doubles
+	{
+		double Sum = 0.0, Sum2 = 0.0, SumLag = 0.0;
+		double Last = glm::linearRand(e, 0.0, 1.0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const u = glm::linearRand(e, 0.0, 1.0);
+			Sum += u;
+			Sum2 += u * u;
+			SumLag += (u - 0.5) * (Last - 0.5);
+			Last = u;
+		}
+		double const N = static_cast<double>(Count);
+		Error += std::abs(Sum / N - 0.5) < 6.0 * std::sqrt(1.0 / 12.0 / N) ? 0 : 1;
+		Error += std::abs(Sum2 / N - Sum / N * Sum / N - 1.0 / 12.0) < 0.001 ? 0 : 1;
+		Error += std::abs(SumLag / N * 12.0) < 6.0 / std::sqrt(N) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_quality()
+{
+	int Error = 0;
+
+	glm::xoshiro256 a(12345);
+	Error += test_engine_quality(a);
+
+	glm::pcg32 b(12345, 1);
+	Error += test_engine_quality(b);
+
+	return Error;
+}
+
+// Mean and variance of Count gaussian samples
+template <typename T>
+static bool gauss_ok(T const * Samples, std::size_t Count, double Mean, double Deviation)
+{
+	double Sum = 0.0, Sum2 = 0.0, Sum4 = 0.0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const x = (static_cast<double>(Samples[i]) - Mean) / Deviation;
+		Sum += x;
+		Sum2 += x * x;
+		Sum4 += x * x * x * x;
+	}
+	double const N = static_cast<double>(Count);
+	bool const MeanOk = std::abs(Sum / N) < 6.0 / std::sqrt(N);
+	bool const VarianceOk = std::abs(Sum2 / N - 1.0) < 6.0 * std::sqrt(2.0 / N);
+	bool const KurtosisOk = std::abs(Sum4 / N - 3.0) < 6.0 * std::sqrt(96.0 / N);
+	return MeanOk && VarianceOk && KurtosisOk;
+}
+
+template <typename T>
+int test_array_distributions()
+{
+	int Error = 0;
+
+	std::size_t const Count = (1 << 18) + 5;
+	glm::xoshiro256 e(7);
+
+	{
+		std::vector<T> Out(Count);
+		glm::linearRand(e, T(-2), T(6), &Out[0], Count);
+
+		std::vector<std::size_t> Histogram(64, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Out[i] >= T(-2) && Out[i] < T(6) ? 0 : 1;
+			++Histogram[static_cast<std::size_t>((Out[i] + T(2)) * T(8))];
+		}
+		Error += chi_squared_ok(Histogram, Count) ? 0 : 1;
+	}
+
+	{
+		std::vector<T> Out(Count);
+		glm::gaussRand(e, T(3), T(2), &Out[0], Count);
+		Error += gauss_ok(&Out[0], Count, 3.0, 2.0) ? 0 : 1;
+
+		std::vector<T> Scalar(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Scalar[i] = glm::gaussRand(e, T(3), T(2));
+		Error += gauss_ok(&Scalar[0], Count, 3.0, 2.0) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::tvec2<T, glm::defaultp> > Out(Count);
+		glm::circularRand(e, T(2), &Out[0], Count);
+
+		std::vector<std::size_t> Histogram(64, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::abs(glm::length(Out[i]) - T(2)) < T(1e-5) ? 0 : 1;
+			T const a = std::atan2(Out[i].y, Out[i].x) + T(3.14159265358979323846);
+			++Histogram[glm::min(static_cast<std::size_t>(a / T(6.283185307179586476925286766559) * T(64)), std::size_t(63))];
+		}
+		Error += chi_squared_ok(Histogram, Count) ? 0 : 1;
+	}
+
+	// Uniform on the sphere: z and the angle around z are uniform, by Archimedes' hat-box theorem
+	{
+		std::vector<glm::tvec3<T, glm::defaultp> > Out(Count);
+		glm::sphericalRand(e, T(3), &Out[0], Count);
+
+		std::vector<std::size_t> Heights(32, 0);
+		std::vector<std::size_t> Angles(32, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::abs(glm::length(Out[i]) - T(3)) < T(1e-5) ? 0 : 1;
+			++Heights[glm::min(static_cast<std::size_t>((Out[i].z / T(3) + T(1)) * T(16)), std::size_t(31))];
+			T const a = std::atan2(Out[i].y, Out[i].x) + T(3.14159265358979323846);
+			++Angles[glm::min(static_cast<std::size_t>(a / T(6.283185307179586476925286766559) * T(32)), std::size_t(31))];
+		}
+		Error += chi_squared_ok(Heights, Count) ? 0 : 1;
+		Error += chi_squared_ok(Angles, Count) ? 0 : 1;
+	}
+
+	// Uniform in the disk and the ball: rings and shells of equal area and volume are equally likely
+	{
+		std::vector<glm::tvec2<T, glm::defaultp> > Out(Count);
+		glm::diskRand(e, T(2), &Out[0], Count);
+
+		std::vector<std::size_t> Rings(32, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const r = glm::length(Out[i]) / T(2);
+			Error += r <= T(1) ? 0 : 1;
+			++Rings[glm::min(static_cast<std::size_t>(r * r * T(32)), std::size_t(31))];
+		}
+		Error += chi_squared_ok(Rings, Count) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::tvec3<T, glm::defaultp> > Out(Count);
+		glm::ballRand(e, T(2), &Out[0], Count);
+
+		std::vector<std::size_t> Shells(32, 0);
+		glm::tvec3<double, glm::defaultp> Sum(0.0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const r = glm::length(Out[i]) / T(2);
+			Error += r <= T(1) ? 0 : 1;
+			++Shells[glm::min(static_cast<std::size_t>(r * r * r * T(32)), std::size_t(31))];
+			Sum += glm::tvec3<double, glm::defaultp>(Out[i]);
+		}
+		Error += chi_squared_ok(Shells, Count) ? 0 : 1;
+		Error += glm::length(Sum / static_cast<double>(Count)) < 0.02 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Filling an array in pieces or at once draws the same samples from the same seed
+template <typename T>
+int test_array_tail()
+{
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count < 40; ++Count)
+	{
+		std::vector<T> A(Count + 1, T(-1)), B(64);
+		glm::xoshiro256 e(Count), f(Count);
+		glm::gaussRand(e, T(0), T(1), &A[0], Count);
+		glm::gaussRand(f, T(0), T(1), &B[0], B.size());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += A[i] == B[i] ? 0 : 1;
+		Error += A[Count] == T(-1) ? 0 : 1;
+
+		std::vector<glm::tvec3<T, glm::defaultp> > C(Count + 1, glm::tvec3<T, glm::defaultp>(T(-1))), D(64);
+		glm::xoshiro256 g(Count), h(Count);
+		glm::sphericalRand(g, T(1), &C[0], Count);
+		glm::sphericalRand(h, T(1), &D[0], D.size());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(C[i], D[i])) ? 0 : 1;
+		Error += glm::all(glm::equal(C[Count], glm::tvec3<T, glm::defaultp>(T(-1)))) ? 0 : 1;
+
+		std::vector<glm::tvec3<T, glm::defaultp> > E(Count + 1, glm::tvec3<T, glm::defaultp>(T(-1))), F(64);
+		glm::xoshiro256 k(Count), l(Count);
+		glm::ballRand(k, T(1), &E[0], Count);
+		glm::ballRand(l, T(1), &F[0], F.size());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(E[i], F[i])) ? 0 : 1;
+		Error += glm::all(glm::equal(E[Count], glm::tvec3<T, glm::defaultp>(T(-1)))) ? 0 : 1;
+	}
+
+	// The array functions take any engine
+	{
+		glm::pcg32 e(3, 4);
+		std::vector<glm::tvec2<T, glm::defaultp> > Out(1000);
+		glm::diskRand(e, T(1), &Out[0], Out.size());
+		for(std::size_t i = 0; i < Out.size(); ++i)
+			Error += glm::length(Out[i]) <= T(1) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#if GLM_HAS_THREAD_LOCAL && GLM_HAS_CXX11_STL
+static void thread_samples(glm::uint64 * Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::randomEngine()();
+}
+
+// Each thread draws from its own engine
+int test_threads()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1024;
+	std::vector<glm::uint64> A(Count), B(Count);
+	std::thread ThreadA(thread_samples, &A[0], Count);
+	std::thread ThreadB(thread_samples, &B[0], Count);
+	ThreadA.join();
+	ThreadB.join();
+
+	std::size_t Same = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Same += A[i] == B[i] ? 1 : 0;
+	Error += Same == 0 ? 0 : 1;
+
+	Error += &glm::randomEngine() == &glm::randomEngine() ? 0 : 1;
+
+	return Error;
+}
+
+static void thread_linearRand(float * Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::linearRand(0.0f, 1.0f);
+}
+
+static void thread_gaussRand_array(float * Out, std::size_t Count)
+{
+	glm::gaussRand(glm::randomEngine(), 0.0f, 1.0f, Out, Count);
+}
+
+static double perf_threads(char const * Name, void (*Func)(float *, std::size_t), std::size_t Threads, std::vector<float> & Out)
+{
+	std::size_t const Count = Out.size() / Threads;
+
+	std::chrono::high_resolution_clock::time_point const Begin = std::chrono::high_resolution_clock::now();
+	std::vector<std::thread> Workers;
+	for(std::size_t t = 0; t < Threads; ++t)
+		Workers.push_back(std::thread(Func, &Out[t * Count], Count));
+	for(std::size_t t = 0; t < Threads; ++t)
+		Workers[t].join();
+	std::chrono::high_resolution_clock::time_point const End = std::chrono::high_resolution_clock::now();
+
+	double const Seconds = std::chrono::duration<double>(End - Begin).count();
+	double const Rate = static_cast<double>(Count * Threads) / Seconds / 1e6;
+	std::printf("%s, %d threads: %.1f Msamples/s\n", Name, static_cast<int>(Threads), Rate);
+	return Rate;
+}
+#endif
+
+// linearRand(0.0f, 1.0f) as it was built on std::rand, one byte per call
+static float rand_linearRand()
+{
+	glm::uint32 x = 0;
+	for(int i = 0; i < 4; ++i)
+		x = (x << 8) | static_cast<glm::uint32>(std::rand() % 255);
+	return static_cast<float>(x) / static_cast<float>(0xffffffffu);
+}
+
+int perf_random()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 22;
+	std::vector<float> Out(Count);
+	std::vector<glm::vec3> Out3(Count);
+
+	float Sum = 0.0f;
+
+	std::clock_t const TimeRand0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = rand_linearRand();
+	std::clock_t const TimeRand1 = std::clock();
+
+	std::clock_t const TimeScalar0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::linearRand(0.0f, 1.0f);
+	std::clock_t const TimeScalar1 = std::clock();
+	Sum += Out[Count / 2];
+
+	glm::xoshiro256 e(1);
+	std::clock_t const TimeArray0 = std::clock();
+	glm::linearRand(e, 0.0f, 1.0f, &Out[0], Count);
+	std::clock_t const TimeArray1 = std::clock();
+	Sum += Out[Count / 2];
+
+	std::clock_t const TimeGaussScalar0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::gaussRand(e, 0.0f, 1.0f);
+	std::clock_t const TimeGaussScalar1 = std::clock();
+	Sum += Out[Count / 2];
+
+	std::clock_t const TimeGaussArray0 = std::clock();
+	glm::gaussRand(e, 0.0f, 1.0f, &Out[0], Count);
+	std::clock_t const TimeGaussArray1 = std::clock();
+	Sum += Out[Count / 2];
+
+	std::clock_t const TimeSphereScalar0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out3[i] = glm::sphericalRand(e, 1.0f);
+	std::clock_t const TimeSphereScalar1 = std::clock();
+	Sum += Out3[Count / 2].x;
+
+	std::clock_t const TimeSphereArray0 = std::clock();
+	glm::sphericalRand(e, 1.0f, &Out3[0], Count);
+	std::clock_t const TimeSphereArray1 = std::clock();
+	Sum += Out3[Count / 2].x;
+
+	std::clock_t const TimeBallScalar0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out3[i] = glm::ballRand(e, 1.0f);
+	std::clock_t const TimeBallScalar1 = std::clock();
+	Sum += Out3[Count / 2].x;
+
+	std::clock_t const TimeBallArray0 = std::clock();
+	glm::ballRand(e, 1.0f, &Out3[0], Count);
+	std::clock_t const TimeBallArray1 = std::clock();
+	Sum += Out3[Count / 2].x;
+
+	double const Samples = static_cast<double>(Count) / 1e6;
+	std::printf("linearRand on std::rand: %.1f Msamples/s\n", Samples / (static_cast<double>(TimeRand1 - TimeRand0) / CLOCKS_PER_SEC));
+	std::printf("linearRand: %.1f Msamples/s, array %.1f Msamples/s\n",
+		Samples / (static_cast<double>(TimeScalar1 - TimeScalar0) / CLOCKS_PER_SEC),
+		Samples / (static_cast<double>(TimeArray1 - TimeArray0) / CLOCKS_PER_SEC));
+	std::printf("gaussRand: %.1f Msamples/s, array %.1f Msamples/s\n",
+		Samples / (static_cast<double>(TimeGaussScalar1 - TimeGaussScalar0) / CLOCKS_PER_SEC),
+		Samples / (static_cast<double>(TimeGaussArray1 - TimeGaussArray0) / CLOCKS_PER_SEC));
+	std::printf("sphericalRand: %.1f Msamples/s, array %.1f Msamples/s\n",
+		Samples / (static_cast<double>(TimeSphereScalar1 - TimeSphereScalar0) / CLOCKS_PER_SEC),
+		Samples / (static_cast<double>(TimeSphereArray1 - TimeSphereArray0) / CLOCKS_PER_SEC));
+	std::printf("ballRand: %.1f Msamples/s, array %.1f Msamples/s\n",
+		Samples / (static_cast<double>(TimeBallScalar1 - TimeBallScalar0) / CLOCKS_PER_SEC),
+		Samples / (static_cast<double>(TimeBallArray1 - TimeBallArray0) / CLOCKS_PER_SEC));
+
+#	if GLM_HAS_THREAD_LOCAL && GLM_HAS_CXX11_STL
+		std::size_t const MaxThreads = glm::max(std::thread::hardware_concurrency(), 4u);
+		for(std::size_t Threads = 1; Threads <= MaxThreads; Threads *= 2)
+		{
+			perf_threads("linearRand", thread_linearRand, Threads, Out);
+			perf_threads("gaussRand array", thread_gaussRand_array, Threads, Out);
+		}
+#	endif
+
+	Error += Sum != 0.0f ? 0 : 1;
+
+	return Error;
+}
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -370,6 +855,16 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_engines();
+	Error += test_quality();
+	Error += test_array_distributions<float>();
+	Error += test_array_distributions<double>();
+	Error += test_array_tail<float>();
+	Error += test_array_tail<double>();
+#	if GLM_HAS_THREAD_LOCAL && GLM_HAS_CXX11_STL
+		Error += test_threads();
+#	endif
+	Error += perf_random();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
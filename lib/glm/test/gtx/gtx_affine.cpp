@@ -0,0 +1,246 @@
+#include <glm/gtx/affine.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+int myrand()
+{
+	static int holdrand = 1;
+	return (((holdrand = holdrand * 214013L + 2531011L) >> 16) & 0x7fff);
+}
+
+float myfrand() // returns values from -1 to 1 inclusive
+{
+	return float(double(myrand()) / double( 0x7ffff )) * 2.0f - 1.0f;
+}
+
+// A rotation, a non uniform scale and a translation
+glm::mat4 random_transform()
+{
+	glm::vec3 const Axis = glm::normalize(glm::vec3(myfrand(), myfrand(), 1.0f));
+	glm::vec3 const Scale(1.0f + myfrand() * 0.5f, 1.0f + myfrand() * 0.5f, 1.0f + myfrand() * 0.5f);
+	glm::mat4 const Translation = glm::translate(glm::mat4(1.0f), glm::vec3(myfrand(), myfrand(), myfrand()) * 4.0f);
+	return glm::scale(glm::rotate(Translation, myfrand() * 3.0f, Axis), Scale);
+}
+
+glm::mat4 random_rigid()
+{
+	glm::vec3 const Axis = glm::normalize(glm::vec3(myfrand(), 1.0f, myfrand()));
+	glm::mat4 const Translation = glm::translate(glm::mat4(1.0f), glm::vec3(myfrand(), myfrand(), myfrand()) * 4.0f);
+	return glm::rotate(Translation, myfrand() * 3.0f, Axis);
+}
+
+bool close(glm::mat4 const & a, glm::mat4 const & b, float Epsilon)
+{
+	for(glm::length_t i = 0; i < 4; ++i)
+		if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+			return false;
+	return true;
+}
+
+int test_ctr()
+{
+	int Error = 0;
+
+	glm::affine const A;
+	Error += A == glm::affine(1.0f) ? 0 : 1;
+	Error += glm::mat4_cast(A) == glm::mat4(1.0f) ? 0 : 1;
+
+	glm::mat3 const Linear(1, 2, 3, 4, 5, 6, 7, 8, 9);
+	glm::vec3 const Translation(10, 11, 12);
+	glm::affine const B(Linear, Translation);
+	Error += B[0] == glm::vec4(1, 4, 7, 10) ? 0 : 1;
+	Error += B[1] == glm::vec4(2, 5, 8, 11) ? 0 : 1;
+	Error += B[2] == glm::vec4(3, 6, 9, 12) ? 0 : 1;
+
+	glm::mat4 const M = glm::mat4_cast(B);
+	Error += M == glm::mat4(glm::vec4(1, 2, 3, 0), glm::vec4(4, 5, 6, 0), glm::vec4(7, 8, 9, 0), glm::vec4(10, 11, 12, 1)) ? 0 : 1;
+	Error += glm::affine(M) == B ? 0 : 1;
+	Error += glm::affine_cast(glm::mat4x3_cast(B)) == B ? 0 : 1;
+	Error += glm::mat4x3_cast(B)[3] == Translation ? 0 : 1;
+
+	glm::daffine const C(B);
+	Error += glm::affine(C) == B ? 0 : 1;
+	Error += C != glm::daffine() ? 0 : 1;
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_ops()
+{
+	typedef glm::taffine<float, P> affine;
+	typedef glm::tvec3<float, P> vec3;
+	typedef glm::tvec4<float, P> vec4;
+
+	int Error = 0;
+
+	for(int i = 0; i < 64; ++i)
+	{
+		glm::mat4 const MA = random_transform();
+		glm::mat4 const MB = random_transform();
+		glm::mat4 const MR = random_rigid();
+		affine const A(glm::affine_cast(MA));
+		affine const B(glm::affine_cast(MB));
+		affine const R(glm::affine_cast(MR));
+
+		Error += close(glm::mat4_cast(glm::affine(A * B)), MA * MB, 0.0001f) ? 0 : 1;
+
+		affine C(A);
+		C *= B;
+		Error += C == A * B ? 0 : 1;
+
+		Error += close(glm::mat4_cast(glm::affine(glm::inverse(A))), glm::inverse(MA), 0.0001f) ? 0 : 1;
+		Error += close(glm::mat4_cast(glm::affine(glm::inverseRigid(R))), glm::inverse(MR), 0.0001f) ? 0 : 1;
+		Error += close(glm::mat4_cast(glm::affine(A * glm::inverse(A))), glm::mat4(1.0f), 0.0001f) ? 0 : 1;
+
+		glm::vec4 const Point(myfrand(), myfrand(), myfrand(), 1.0f);
+		glm::vec4 const Vector(myfrand(), myfrand(), myfrand(), 0.0f);
+		Error += glm::all(glm::epsilonEqual(glm::vec3(glm::transformPoint(A, vec3(Point))), glm::vec3(MA * Point), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::vec3(glm::transformVector(A, vec3(Vector))), glm::vec3(MA * Vector), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::vec3(A * vec4(Point)), glm::vec3(MA * Point), 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_transform_points()
+{
+	typedef glm::taffine<float, P> affine;
+	typedef glm::tvec3<float, P> vec3;
+
+	int Error = 0;
+
+	affine const A(glm::affine_cast(random_transform()));
+	std::vector<vec3> In(37);
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = vec3(myfrand(), myfrand(), myfrand());
+
+	std::vector<vec3> Out(In.size());
+	glm::transformPoints(A, &In[0], &Out[0], In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += glm::all(glm::epsilonEqual(glm::vec3(Out[i]), glm::vec3(glm::transformPoint(A, In[i])), 0.0001f)) ? 0 : 1;
+
+	// In place
+	glm::transformPoints(A, &In[0], &In[0], In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += In[i] == Out[i] ? 0 : 1;
+
+	return Error;
+}
+
+int test_local_to_world()
+{
+	int Error = 0;
+
+	int const Parents[] = {-1, 0, 1, 0, 3, -1, 5};
+	std::size_t const Count = sizeof(Parents) / sizeof(Parents[0]);
+
+	std::vector<glm::mat4> Matrices(Count);
+	std::vector<glm::affine> Local(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Matrices[i] = random_transform();
+		Local[i] = glm::affine_cast(Matrices[i]);
+	}
+
+	std::vector<glm::affine> World(Count);
+	glm::localToWorld(&Local[0], Parents, &World[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat4 Expected = Matrices[i];
+		for(int p = Parents[i]; p >= 0; p = Parents[p])
+			Expected = Matrices[p] * Expected;
+		Error += close(glm::mat4_cast(World[i]), Expected, 0.001f) ? 0 : 1;
+	}
+
+	// In place
+	glm::localToWorld(&Local[0], Parents, &Local[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Local[i] == World[i] ? 0 : 1;
+
+	return Error;
+}
+
+int test_size()
+{
+	int Error = 0;
+
+	Error += 48 == sizeof(glm::affine) ? 0 : 1;
+	Error += 96 == sizeof(glm::daffine) ? 0 : 1;
+	Error += glm::affine::length() == 3 ? 0 : 1;
+
+	return Error;
+}
+
+int perf_affine_ops()
+{
+	std::size_t const Count = 1 << 20;
+
+	std::vector<glm::mat4> Matrices(64);
+	std::vector<glm::affine> Affines(64);
+	for(std::size_t i = 0; i < Matrices.size(); ++i)
+	{
+		Matrices[i] = random_rigid();
+		Affines[i] = glm::affine_cast(Matrices[i]);
+	}
+
+	glm::mat4 ChainMatrix(1.0f);
+	std::clock_t const StartMulMatrix = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		ChainMatrix = Matrices[i & 63] * ChainMatrix;
+	std::clock_t const TimeMulMatrix = std::clock() - StartMulMatrix;
+
+	glm::affine ChainAffine;
+	std::clock_t const StartMulAffine = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		ChainAffine = Affines[i & 63] * ChainAffine;
+	std::clock_t const TimeMulAffine = std::clock() - StartMulAffine;
+
+	glm::mat4 SumMatrix(0.0f);
+	std::clock_t const StartInverseMatrix = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumMatrix += glm::inverse(Matrices[i & 63]);
+	std::clock_t const TimeInverseMatrix = std::clock() - StartInverseMatrix;
+
+	glm::vec4 SumAffine(0.0f);
+	std::clock_t const StartInverseAffine = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumAffine += glm::inverse(Affines[i & 63])[i % 3];
+	std::clock_t const TimeInverseAffine = std::clock() - StartInverseAffine;
+
+	glm::vec4 SumRigid(0.0f);
+	std::clock_t const StartInverseRigid = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumRigid += glm::inverseRigid(Affines[i & 63])[i % 3];
+	std::clock_t const TimeInverseRigid = std::clock() - StartInverseRigid;
+
+	std::printf("%d chained products: mat4 %d clocks, affine %d clocks\n",
+		static_cast<int>(Count), static_cast<int>(TimeMulMatrix), static_cast<int>(TimeMulAffine));
+	std::printf("%d inverses: mat4 %d clocks, affine %d clocks, rigid affine %d clocks\n",
+		static_cast<int>(Count), static_cast<int>(TimeInverseMatrix), static_cast<int>(TimeInverseAffine), static_cast<int>(TimeInverseRigid));
+
+	return glm::isnan(ChainMatrix[0].x) || glm::isnan(ChainAffine[0].x) || glm::isnan(SumMatrix[0].x) || glm::isnan(SumAffine.x) || glm::isnan(SumRigid.x) ? 1 : 0;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_ctr();
+	Error += test_ops<glm::highp>();
+	Error += test_transform_points<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_ops<glm::aligned_highp>();
+		Error += test_transform_points<glm::aligned_highp>();
+#	endif
+	Error += test_local_to_world();
+	Error += test_size();
+	Error += perf_affine_ops();
+
+	return Error;
+}
@@ -0,0 +1,427 @@
+#include <glm/gtx/batch.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+// References are computed in double from the raw floats, never through the types under test
+namespace
+{
+	std::size_t const Counts[] = {0, 1, 3, 5, 7, 8, 9, 17, 33, 1000};
+	std::size_t const CountCount = sizeof(Counts) / sizeof(Counts[0]);
+
+	// Enough elements for the output to be streamed
+	std::size_t const StreamCount = GLM_BATCH_STREAM_THRESHOLD / (3 * sizeof(float)) + 5;
+
+	void fill(std::vector<float> & Data, unsigned Seed)
+	{
+		for(std::size_t i = 0; i < Data.size(); ++i)
+			Data[i] = static_cast<float>((i * 7 + Seed * 13) % 29) * 0.25f - 3.5f;
+	}
+
+	bool close(double Value, double Expected)
+	{
+		return std::abs(Value - Expected) <= 1e-4 * (1.0 + std::abs(Expected));
+	}
+
+	glm::mat4 affine()
+	{
+		glm::mat4 const R = glm::rotate(glm::mat4(1.0f), 0.7f, glm::vec3(0.3f, 1.0f, -0.2f));
+		return glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(1.5f, -2.0f, 3.0f)) * R, glm::vec3(2.0f, 0.5f, 1.5f));
+	}
+
+	glm::mat4 projective()
+	{
+		// Far from the z = 0 plane of the test data so that w doesn't come near 0
+		return glm::perspective(0.8f, 1.3f, 0.1f, 100.0f) * glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -20.0f));
+	}
+
+	void reference(float const * m, float W, bool Divide, float const * v, double * r)
+	{
+		double w = W;
+		for(int i = 0; i < 3; ++i)
+			r[i] = double(m[i]) * v[0] + double(m[4 + i]) * v[1] + double(m[8 + i]) * v[2] + double(m[12 + i]) * w;
+		if(Divide)
+		{
+			double const d = double(m[3]) * v[0] + double(m[7]) * v[1] + double(m[11]) * v[2] + double(m[15]) * w;
+			for(int i = 0; i < 3; ++i)
+				r[i] /= d;
+		}
+	}
+}//namespace
+
+namespace transform
+{
+	// Offset is in floats, so that the arrays start at every alignment
+	int test_points(glm::mat4 const & M, bool Divide, std::size_t Count, std::size_t Offset, bool InPlace)
+	{
+		std::vector<float> In(Count * 3 + 8), Out(Count * 3 + 8, 0.0f);
+		fill(In, static_cast<unsigned>(Count));
+		std::vector<float> const Copy(In);
+
+		float const * m = &M[0][0];
+		glm::vec3 const * Src = reinterpret_cast<glm::vec3 const *>(&In[Offset]);
+		glm::vec3 * Dst = reinterpret_cast<glm::vec3 *>(InPlace ? &In[Offset] : &Out[Offset]);
+		glm::transformPoints(M, Src, Dst, Count);
+
+		float const * Result = reinterpret_cast<float const *>(Dst);
+		int Error = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double r[3];
+			reference(m, 1.0f, Divide, &Copy[Offset + i * 3], r);
+			for(int k = 0; k < 3; ++k)
+				Error += close(Result[i * 3 + k], r[k]) ? 0 : 1;
+		}
+		// Nothing written past the end
+		Error += (InPlace ? In[Offset + Count * 3] == Copy[Offset + Count * 3] : Out[Offset + Count * 3] == 0.0f) ? 0 : 1;
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test_vectors(std::size_t Count, std::size_t Offset)
+	{
+		glm::mat4 const M = affine();
+		std::vector<float> In(Count * 4 + 8), Out(Count * 4 + 8);
+		fill(In, static_cast<unsigned>(Count) + 1);
+
+		float const * m = &M[0][0];
+		glm::transformVectors(M, reinterpret_cast<glm::vec3 const *>(&In[Offset]), reinterpret_cast<glm::vec3 *>(&Out[Offset]), Count);
+
+		int Error = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double r[3];
+			reference(m, 0.0f, false, &In[Offset + i * 3], r);
+			for(int k = 0; k < 3; ++k)
+				Error += close(Out[Offset + i * 3 + k], r[k]) ? 0 : 1;
+		}
+
+		glm::transformVectors(M, reinterpret_cast<glm::vec4 const *>(&In[Offset]), reinterpret_cast<glm::vec4 *>(&Out[Offset]), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const * v = &In[Offset + i * 4];
+			for(int k = 0; k < 4; ++k)
+			{
+				double const r = double(m[k]) * v[0] + double(m[4 + k]) * v[1] + double(m[8 + k]) * v[2] + double(m[12 + k]) * v[3];
+				Error += close(Out[Offset + i * 4 + k], r) ? 0 : 1;
+			}
+		}
+
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test_soa(glm::mat4 const & M, bool Divide, std::size_t Count, std::size_t Offset)
+	{
+		std::vector<float> In(Count * 3 + 24), Out(Count * 3 + 24);
+		fill(In, static_cast<unsigned>(Count) + 2);
+
+		// The three outputs at different alignments from each other
+		float const * InX = &In[Offset];
+		float const * InY = InX + Count + 1;
+		float const * InZ = InY + Count + 2;
+		float * OutX = &Out[Offset];
+		float * OutY = OutX + Count + 3;
+		float * OutZ = OutY + Count + 4;
+
+		float const * m = &M[0][0];
+		int Error = 0;
+
+		glm::transformPoints(M, InX, InY, InZ, OutX, OutY, OutZ, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const v[3] = {InX[i], InY[i], InZ[i]};
+			double r[3];
+			reference(m, 1.0f, Divide, v, r);
+			Error += close(OutX[i], r[0]) && close(OutY[i], r[1]) && close(OutZ[i], r[2]) ? 0 : 1;
+		}
+
+		glm::transformVectors(M, InX, InY, InZ, OutX, OutY, OutZ, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const v[3] = {InX[i], InY[i], InZ[i]};
+			double r[3];
+			reference(m, 0.0f, false, v, r);
+			Error += close(OutX[i], r[0]) && close(OutY[i], r[1]) && close(OutZ[i], r[2]) ? 0 : 1;
+		}
+
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test_double()
+	{
+		glm::dmat4 const M(glm::perspective(0.8, 1.3, 0.1, 100.0));
+		double const * m = &M[0][0];
+		std::size_t const Count = 17;
+		std::vector<double> Points(Count * 3), Result(Count * 3);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Points[i * 3 + 0] = double(i) * 0.5;
+			Points[i * 3 + 1] = 1.0 - double(i);
+			Points[i * 3 + 2] = -10.0 - double(i);
+		}
+		glm::transformPoints(M, reinterpret_cast<glm::dvec3 const *>(&Points[0]), reinterpret_cast<glm::dvec3 *>(&Result[0]), Count);
+
+		int Error = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const * v = &Points[i * 3];
+			double const w = m[3] * v[0] + m[7] * v[1] + m[11] * v[2] + m[15];
+			for(int k = 0; k < 3; ++k)
+				Error += close(Result[i * 3 + k], (m[k] * v[0] + m[4 + k] * v[1] + m[8 + k] * v[2] + m[12 + k]) / w) ? 0 : 1;
+		}
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t c = 0; c < CountCount; ++c)
+		for(std::size_t Offset = 0; Offset < 8; ++Offset)
+		{
+			Error += test_points(affine(), false, Counts[c], Offset, false);
+			Error += test_points(projective(), true, Counts[c], Offset, false);
+			Error += test_points(affine(), false, Counts[c], Offset, true);
+			Error += test_vectors(Counts[c], Offset);
+			Error += test_soa(affine(), false, Counts[c], Offset);
+			Error += test_soa(projective(), true, Counts[c], Offset);
+		}
+
+		Error += test_points(affine(), false, StreamCount, 0, false);
+		Error += test_points(affine(), false, StreamCount, 1, false);
+		Error += test_soa(projective(), true, StreamCount, 0);
+		Error += test_double();
+
+		return Error;
+	}
+}//namespace transform
+
+namespace multiply
+{
+	int test(std::size_t Count, std::size_t Offset)
+	{
+		std::vector<float> A(Count * 16 + 4), B(Count * 16 + 4), Out(Count * 16 + 4);
+		fill(A, 3);
+		fill(B, 5);
+
+		glm::mat4 const * MatA = reinterpret_cast<glm::mat4 const *>(&A[Offset]);
+		glm::mat4 const * MatB = reinterpret_cast<glm::mat4 const *>(&B[Offset]);
+		glm::mat4 * MatOut = reinterpret_cast<glm::mat4 *>(&Out[Offset]);
+
+		int Error = 0;
+
+		glm::multiplyMatrices(MatA, MatB, MatOut, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		for(int c = 0; c < 4; ++c)
+		for(int r = 0; r < 4; ++r)
+		{
+			double Sum = 0.0;
+			for(int k = 0; k < 4; ++k)
+				Sum += double(A[Offset + i * 16 + k * 4 + r]) * B[Offset + i * 16 + c * 4 + k];
+			Error += close(Out[Offset + i * 16 + c * 4 + r], Sum) ? 0 : 1;
+		}
+
+		if(Count > 0)
+		{
+			// A single parent, in place
+			std::vector<float> const Copy(B);
+			glm::mat4 * InOut = reinterpret_cast<glm::mat4 *>(&B[Offset]);
+			glm::multiplyMatrices(MatA[0], InOut, InOut, Count);
+			for(std::size_t i = 0; i < Count; ++i)
+			for(int c = 0; c < 4; ++c)
+			for(int r = 0; r < 4; ++r)
+			{
+				double Sum = 0.0;
+				for(int k = 0; k < 4; ++k)
+					Sum += double(A[Offset + k * 4 + r]) * Copy[Offset + i * 16 + c * 4 + k];
+				Error += close(B[Offset + i * 16 + c * 4 + r], Sum) ? 0 : 1;
+			}
+		}
+
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test_double()
+	{
+		std::size_t const Count = 5;
+		std::vector<double> A(Count * 16), B(Count * 16), Out(Count * 16);
+		for(std::size_t i = 0; i < A.size(); ++i)
+		{
+			A[i] = static_cast<double>(i % 11) * 0.5 - 2.0;
+			B[i] = static_cast<double>(i % 7) * 0.25 + 1.0;
+		}
+		glm::multiplyMatrices(reinterpret_cast<glm::dmat4 const *>(&A[0]), reinterpret_cast<glm::dmat4 const *>(&B[0]), reinterpret_cast<glm::dmat4 *>(&Out[0]), Count);
+
+		int Error = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		for(int c = 0; c < 4; ++c)
+		for(int r = 0; r < 4; ++r)
+		{
+			double Sum = 0.0;
+			for(int k = 0; k < 4; ++k)
+				Sum += A[i * 16 + k * 4 + r] * B[i * 16 + c * 4 + k];
+			Error += close(Out[i * 16 + c * 4 + r], Sum) ? 0 : 1;
+		}
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t c = 0; c < CountCount; ++c)
+		{
+			Error += test(Counts[c], 0);
+			Error += test(Counts[c], 1);
+			Error += test(Counts[c], 4);
+		}
+		Error += test(GLM_BATCH_STREAM_THRESHOLD / 64 + 1, 0);
+		Error += test_double();
+
+		return Error;
+	}
+}//namespace multiply
+
+namespace normalize
+{
+	int check(float const * Result, float const * In, int Size)
+	{
+		double Length = 0.0;
+		for(int k = 0; k < Size; ++k)
+			Length += double(In[k]) * In[k];
+		Length = std::sqrt(Length);
+
+		int Error = 0;
+		for(int k = 0; k < Size; ++k)
+			Error += close(Result[k], In[k] / Length) ? 0 : 1;
+		return Error;
+	}
+
+	int test(std::size_t Count, std::size_t Offset)
+	{
+		std::vector<float> In(Count * 4 + 24), Out(Count * 4 + 24);
+		fill(In, 11);
+		// No zero vectors
+		for(std::size_t i = 0; i < In.size(); i += 3)
+			In[i] += 0.125f;
+
+		int Error = 0;
+
+		glm::normalizeVectors(reinterpret_cast<glm::vec3 const *>(&In[Offset]), reinterpret_cast<glm::vec3 *>(&Out[Offset]), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += check(&Out[Offset + i * 3], &In[Offset + i * 3], 3);
+
+		glm::normalizeVectors(reinterpret_cast<glm::vec4 const *>(&In[Offset]), reinterpret_cast<glm::vec4 *>(&Out[Offset]), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += check(&Out[Offset + i * 4], &In[Offset + i * 4], 4);
+
+		float const * InX = &In[Offset];
+		float const * InY = InX + Count + 1;
+		float const * InZ = InY + Count + 2;
+		float * OutX = &Out[Offset];
+		float * OutY = OutX + Count + 1;
+		float * OutZ = OutY + Count + 2;
+		glm::normalizeVectors(InX, InY, InZ, OutX, OutY, OutZ, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const v[3] = {InX[i], InY[i], InZ[i]};
+			float const r[3] = {OutX[i], OutY[i], OutZ[i]};
+			Error += check(r, v, 3);
+		}
+
+		return Error > 0 ? 1 : 0;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t c = 0; c < CountCount; ++c)
+		for(std::size_t Offset = 0; Offset < 8; ++Offset)
+			Error += test(Counts[c], Offset);
+		Error += test(StreamCount, 0);
+
+		return Error;
+	}
+}//namespace normalize
+
+namespace perf
+{
+	double gbps(std::size_t Bytes, std::clock_t Ticks)
+	{
+		double const Seconds = static_cast<double>(Ticks) / CLOCKS_PER_SEC;
+		return Seconds > 0.0 ? static_cast<double>(Bytes) / Seconds * 1e-9 : 0.0;
+	}
+
+	// GB/s read and written, from L1 sized arrays to ones that only fit in DRAM on most machines
+	int test()
+	{
+		std::size_t const Sizes[] = {1 << 10, 1 << 14, 1 << 18, 1 << 22};
+		std::size_t const Work = std::size_t(1) << 25;
+		glm::mat4 const M = affine();
+
+		std::printf("transformPoints, GB/s (stream threshold %lu bytes)\n", static_cast<unsigned long>(GLM_BATCH_STREAM_THRESHOLD));
+		std::printf("%10s %10s %10s %10s %10s\n", "points", "scalar", "aos", "soa", "mat4 mul");
+
+		float Sum = 0.0f;
+		for(std::size_t s = 0; s < sizeof(Sizes) / sizeof(Sizes[0]); ++s)
+		{
+			std::size_t const Count = Sizes[s];
+			std::size_t const Laps = Work / Count > 0 ? Work / Count : 1;
+			std::size_t const Bytes = Count * Laps * 2 * sizeof(glm::vec3);
+
+			std::vector<glm::vec3> In(Count, glm::vec3(1.0f, 2.0f, 3.0f)), Out(Count);
+			std::vector<float> X(Count, 1.0f), Y(Count, 2.0f), Z(Count, 3.0f), OutX(Count), OutY(Count), OutZ(Count);
+
+			std::clock_t StartTime = std::clock();
+			for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::vec3(M * glm::vec4(In[i], 1.0f));
+			std::clock_t const Scalar = std::clock() - StartTime;
+			Sum += Out[Count / 2].x;
+
+			StartTime = std::clock();
+			for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+				glm::transformPoints(M, &In[0], &Out[0], Count);
+			std::clock_t const AoS = std::clock() - StartTime;
+			Sum += Out[Count / 2].x;
+
+			StartTime = std::clock();
+			for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+				glm::transformPoints(M, &X[0], &Y[0], &Z[0], &OutX[0], &OutY[0], &OutZ[0], Count);
+			std::clock_t const SoA = std::clock() - StartTime;
+			Sum += OutX[Count / 2];
+
+			// As many matrix bytes as point bytes
+			std::size_t const Matrices = Count * sizeof(glm::vec3) / sizeof(glm::mat4);
+			std::vector<glm::mat4> A(Matrices, M), B(Matrices, M), C(Matrices);
+			StartTime = std::clock();
+			for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+				glm::multiplyMatrices(&A[0], &B[0], &C[0], Matrices);
+			std::clock_t const Mat = std::clock() - StartTime;
+			Sum += C[Matrices / 2][0][0];
+
+			std::printf("%10lu %10.2f %10.2f %10.2f %10.2f\n", static_cast<unsigned long>(Count),
+				gbps(Bytes, Scalar), gbps(Bytes, AoS), gbps(Bytes, SoA), gbps(Matrices * Laps * 3 * sizeof(glm::mat4), Mat));
+		}
+		std::printf("checksum: %f\n", Sum);
+
+		return 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error(0);
+
+	Error += transform::test();
+	Error += multiply::test();
+	Error += normalize::test();
+#	ifdef NDEBUG
+	Error += perf::test();
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -3,6 +3,9 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <glm/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
 #if GLM_HAS_TRIVIAL_QUERIES
 #	include <type_traits>
 #endif
@@ -188,6 +191,263 @@ int test_size()
 	return Error;
 }
 
+namespace simd
+{
+	// Checked against the double precision scalar code
+	template <typename T, glm::precision P>
+	bool close(glm::tdualquat<T, P> const & a, glm::ddualquat const & b, double Epsilon)
+	{
+		for(int i = 0; i < 4; ++i)
+		{
+			if(glm::abs(static_cast<double>(a.real[i]) - b.real[i]) > Epsilon || glm::abs(static_cast<double>(a.dual[i]) - b.dual[i]) > Epsilon)
+				return false;
+		}
+		return true;
+	}
+
+	template <glm::precision P>
+	glm::tdualquat<float, P> make(glm::ddualquat const & q)
+	{
+		return glm::tdualquat<float, P>(
+			glm::tquat<float, P>(static_cast<float>(q.real.w), static_cast<float>(q.real.x), static_cast<float>(q.real.y), static_cast<float>(q.real.z)),
+			glm::tquat<float, P>(static_cast<float>(q.dual.w), static_cast<float>(q.dual.x), static_cast<float>(q.dual.y), static_cast<float>(q.dual.z)));
+	}
+
+	glm::ddualquat random_dualquat()
+	{
+		glm::dquat const Rotation = glm::angleAxis(static_cast<double>(myfrand()) * 3.0, glm::normalize(glm::dvec3(myfrand(), myfrand(), myfrand()) + glm::dvec3(0.1)));
+		return glm::ddualquat(Rotation, glm::dvec3(myfrand() * 10.0f, myfrand() * 10.0f, myfrand() * 10.0f));
+	}
+
+	template <glm::precision P>
+	int test()
+	{
+		typedef glm::tdualquat<float, P> dualquat;
+		typedef glm::tvec3<float, P> vec3;
+
+		int Error = 0;
+		double const Epsilon = 1e-4;
+
+		for(int i = 0; i < 100; ++i)
+		{
+			glm::ddualquat const A = random_dualquat();
+			glm::ddualquat const B = random_dualquat();
+			dualquat const a = make<P>(A);
+			dualquat const b = make<P>(B);
+
+			Error += close(a * b, A * B, Epsilon) ? 0 : 1;
+			Error += close(glm::normalize(a * 3.0f), glm::normalize(A * 3.0), Epsilon) ? 0 : 1;
+
+			glm::dvec3 const V(myfrand() * 4.0f, myfrand() * 4.0f, myfrand() * 4.0f);
+			glm::dvec3 const R = A * V;
+			vec3 const r = a * vec3(V);
+			Error += glm::all(glm::epsilonEqual(glm::dvec3(r), R, Epsilon)) ? 0 : 1;
+
+			// From a rotation and a translation, and from the equivalent matrix
+			glm::tquat<float, P> const Rotation = a.real;
+			vec3 const Translation(myfrand() * 10.0f, myfrand() * 10.0f, myfrand() * 10.0f);
+			glm::tmat4x4<float, P> Matrix = glm::mat4_cast(Rotation);
+			Matrix[3] = glm::tvec4<float, P>(Translation, 1.0f);
+			glm::ddualquat const C = glm::ddualquat(glm::dquat(Rotation), glm::dvec3(Translation));
+			dualquat FromRT[1];
+			glm::dualquat_cast(&Rotation, &Translation, FromRT, 1);
+			Error += close(FromRT[0], C, Epsilon) ? 0 : 1;
+
+			dualquat const FromMatrix = glm::dualquat_cast(Matrix);
+			glm::tvec4<float, P> const Point(vec3(V), 1.0f);
+			Error += glm::all(glm::epsilonEqual(glm::tvec3<float, P>(Matrix * Point), FromMatrix * vec3(V), 1e-4f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace simd
+
+int test_dualquat_simd()
+{
+	int Error = 0;
+
+	Error += simd::test<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += simd::test<glm::aligned_highp>();
+#	endif
+
+	return Error;
+}
+
+int test_blend()
+{
+	int Error = 0;
+	float const Epsilon = 0.0001f;
+
+	glm::dualquat const A = simd::make<glm::highp>(simd::random_dualquat());
+	glm::dualquat const B = simd::make<glm::highp>(simd::random_dualquat());
+
+	// Two inputs: the normalized lerp
+	{
+		glm::dualquat const Inputs[] = {A, B};
+		float const Weights[] = {0.7f, 0.3f};
+		glm::dualquat const Blend = glm::linearBlend(Inputs, Weights, 2);
+		glm::dualquat const Lerp = glm::normalize(glm::lerp(A, B, 0.3f));
+		Error += glm::all(glm::epsilonEqual(Blend.real, Lerp.real, Epsilon)) && glm::all(glm::epsilonEqual(Blend.dual, Lerp.dual, Epsilon)) ? 0 : 1;
+	}
+
+	// Antipodality: -A is the same transformation as A and doesn't cancel it out
+	{
+		glm::dualquat const Inputs[] = {A, -A, A};
+		float const Weights[] = {0.25f, 0.5f, 0.25f};
+		glm::dualquat const Blend = glm::linearBlend(Inputs, Weights, 3);
+		Error += glm::all(glm::epsilonEqual(Blend.real, A.real, Epsilon)) && glm::all(glm::epsilonEqual(Blend.dual, A.dual, Epsilon)) ? 0 : 1;
+	}
+
+	// Palette blending, vertex by vertex
+	{
+		std::vector<glm::dualquat> Palette;
+		for(int i = 0; i < 8; ++i)
+			Palette.push_back(simd::make<glm::highp>(simd::random_dualquat()));
+
+		std::size_t const Count = 16;
+		std::size_t const Influences = 3;
+		std::vector<unsigned short> Joints(Count * Influences);
+		std::vector<float> Weights(Count * Influences);
+		for(std::size_t i = 0; i < Joints.size(); ++i)
+		{
+			Joints[i] = static_cast<unsigned short>(myrand() % 8);
+			Weights[i] = static_cast<float>(i % Influences + 1) / 6.0f;
+		}
+
+		std::vector<glm::dualquat> Out(Count);
+		glm::linearBlend(&Palette[0], &Joints[0], &Weights[0], Influences, &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::dualquat Inputs[Influences];
+			for(std::size_t j = 0; j < Influences; ++j)
+				Inputs[j] = Palette[Joints[i * Influences + j]];
+			glm::dualquat const Blend = glm::linearBlend(Inputs, &Weights[i * Influences], Influences);
+			Error += Blend == Out[i] ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(Out[i].real), 1.0f, Epsilon) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int test_transform_points()
+{
+	int Error = 0;
+
+	glm::dualquat const Q = glm::normalize(simd::make<glm::highp>(simd::random_dualquat()));
+
+	std::vector<glm::vec3> Points;
+	for(int i = 0; i < 33; ++i)
+		Points.push_back(glm::vec3(myfrand() * 4.0f, myfrand() * 5.0f, myfrand() * 3.0f));
+
+	std::vector<glm::vec3> Out(Points.size());
+	glm::transformPoints(Q, &Points[0], &Out[0], Points.size());
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += glm::all(glm::epsilonEqual(Out[i], Q * Points[i], 0.0001f)) ? 0 : 1;
+
+	// In place
+	glm::transformPoints(Q, &Points[0], &Points[0], Points.size());
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Error += Points[i] == Out[i] ? 0 : 1;
+
+	return Error;
+}
+
+// Skinning a mesh: linear blending of matrices against dual quaternions
+int perf_skinning()
+{
+	std::size_t const Joints = 64;
+	std::size_t const Influences = 4;
+	std::size_t const Count = 1 << 16;
+	int const Frames = 8;
+
+	std::vector<glm::mat4> Matrices(Joints);
+	std::vector<glm::dualquat> Palette(Joints);
+	for(std::size_t i = 0; i < Joints; ++i)
+	{
+		glm::quat const Rotation = glm::angleAxis(myfrand() * 3.0f, glm::normalize(glm::vec3(myfrand(), myfrand(), 1.0f)));
+		glm::vec3 const Translation(myfrand(), myfrand(), myfrand());
+		Matrices[i] = glm::translate(glm::mat4(1.0f), Translation) * glm::mat4_cast(Rotation);
+	}
+
+	std::vector<unsigned char> Indices(Count * Influences);
+	std::vector<float> Weights(Count * Influences);
+	std::vector<glm::vec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		for(std::size_t j = 0; j < Influences; ++j)
+		{
+			Indices[i * Influences + j] = static_cast<unsigned char>(myrand() % Joints);
+			Weights[i * Influences + j] = 0.25f;
+		}
+		Points[i] = glm::vec3(myfrand(), myfrand(), myfrand());
+	}
+
+	std::vector<glm::vec3> OutMatrix(Count);
+	std::clock_t const StartMatrix = std::clock();
+	for(int f = 0; f < Frames; ++f)
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat4 m = Matrices[Indices[i * Influences]] * Weights[i * Influences];
+		for(std::size_t j = 1; j < Influences; ++j)
+			m += Matrices[Indices[i * Influences + j]] * Weights[i * Influences + j];
+		OutMatrix[i] = glm::vec3(m * glm::vec4(Points[i], 1.0f));
+	}
+	std::clock_t const TimeMatrix = std::clock() - StartMatrix;
+
+	std::vector<glm::dualquat> Blended(Count);
+	std::vector<glm::vec3> OutDualquat(Count);
+	std::clock_t const StartDualquat = std::clock();
+	for(int f = 0; f < Frames; ++f)
+	{
+		glm::dualquat_cast(&Matrices[0], &Palette[0], Joints);
+		glm::linearBlend(&Palette[0], &Indices[0], &Weights[0], Influences, &Blended[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			OutDualquat[i] = Blended[i] * Points[i];
+	}
+	std::clock_t const TimeDualquat = std::clock() - StartDualquat;
+
+	std::printf("Skinning %d vertices, %d influences: matrices %d clocks, dual quaternions %d clocks\n",
+		static_cast<int>(Count * Frames), static_cast<int>(Influences), static_cast<int>(TimeMatrix), static_cast<int>(TimeDualquat));
+
+	// Same rotations and translations, both are close when the joints are blended with one weight
+	int Error = 0;
+	glm::dualquat const One[] = {Palette[0]};
+	float const Weight[] = {1.0f};
+	glm::vec3 const Point = glm::linearBlend(One, Weight, 1) * Points[0];
+	Error += glm::all(glm::epsilonEqual(Point, glm::vec3(Matrices[0] * glm::vec4(Points[0], 1.0f)), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_dualquat_ops()
+{
+	std::size_t const Count = 1 << 20;
+
+	std::vector<glm::dualquat> Inputs(64);
+	for(std::size_t i = 0; i < Inputs.size(); ++i)
+		Inputs[i] = simd::make<glm::highp>(simd::random_dualquat());
+
+	glm::dualquat Product;
+	std::clock_t const StartMul = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Product = glm::normalize(Product * Inputs[i & 63]);
+	std::clock_t const TimeMul = std::clock() - StartMul;
+
+	glm::vec3 Point(1.0f, 2.0f, 3.0f);
+	std::clock_t const StartVec = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Point = Inputs[i & 63] * Point * 0.5f;
+	std::clock_t const TimeVec = std::clock() - StartVec;
+
+	std::printf("%d normalize(dualquat * dualquat): %d clocks, dualquat * vec3: %d clocks\n",
+		static_cast<int>(Count), static_cast<int>(TimeMul), static_cast<int>(TimeVec));
+
+	return glm::isnan(Product.real.w) || glm::isnan(Point.x) ? 1 : 0;
+}
+
 int main()
 {
 	int Error = 0;
@@ -198,6 +458,11 @@ int main()
 	Error += test_inverse();
 	Error += test_mul();
 	Error += test_size();
+	Error += test_dualquat_simd();
+	Error += test_blend();
+	Error += test_transform_points();
+	Error += perf_skinning();
+	Error += perf_dualquat_ops();
 
 	return Error;
 }
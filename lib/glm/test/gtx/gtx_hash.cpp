@@ -0,0 +1,613 @@
+#include <glm/glm.hpp>
+
+#if GLM_HAS_CXX11_STL
+#include <glm/gtx/hash.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	// std::hash of glm vectors as it was: hash_combine over std::hash<float>
+	void old_hash_combine(std::size_t & seed, std::size_t hash)
+	{
+		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		seed ^= hash;
+	}
+
+	struct old_hash
+	{
+		std::size_t operator()(glm::vec3 const & v) const
+		{
+			std::size_t seed = 0;
+			std::hash<float> hasher;
+			old_hash_combine(seed, hasher(v.x));
+			old_hash_combine(seed, hasher(v.y));
+			old_hash_combine(seed, hasher(v.z));
+			return seed;
+		}
+	};
+
+	struct vertex
+	{
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec2 TexCoord;
+
+		bool operator==(vertex const & v) const
+		{
+			return Position == v.Position && Normal == v.Normal && TexCoord == v.TexCoord;
+		}
+	};
+
+	struct vertex_hash
+	{
+		std::size_t operator()(vertex const & v) const
+		{
+			return static_cast<std::size_t>(glm::hashValue(v.TexCoord, glm::hashValue(v.Normal, glm::hashValue(v.Position))));
+		}
+	};
+
+	struct vertex_old_hash
+	{
+		std::size_t operator()(vertex const & v) const
+		{
+			std::size_t seed = 0;
+			std::hash<float> hasher;
+			old_hash_combine(seed, hasher(v.Position.x));
+			old_hash_combine(seed, hasher(v.Position.y));
+			old_hash_combine(seed, hasher(v.Position.z));
+			old_hash_combine(seed, hasher(v.Normal.x));
+			old_hash_combine(seed, hasher(v.Normal.y));
+			old_hash_combine(seed, hasher(v.Normal.z));
+			old_hash_combine(seed, hasher(v.TexCoord.x));
+			old_hash_combine(seed, hasher(v.TexCoord.y));
+			return seed;
+		}
+	};
+
+	float quantize(float x)
+	{
+		return std::floor(x * 1024.0f + 0.5f) / 1024.0f;
+	}
+
+	std::size_t const TorusU = 256;
+	std::size_t const TorusV = 128;
+
+	// A torus as exported: a triangle soup with positions, normals and texture coordinates on a 1/1024 grid,
+	// duplicated on every triangle that shares them.
+	std::vector<vertex> torus_soup()
+	{
+		std::vector<vertex> Grid((TorusU + 1) * (TorusV + 1));
+		for(std::size_t j = 0; j <= TorusV; ++j)
+		for(std::size_t i = 0; i <= TorusU; ++i)
+		{
+			float const u = static_cast<float>(i) / static_cast<float>(TorusU);
+			float const v = static_cast<float>(j) / static_cast<float>(TorusV);
+			float const a = u * 6.283185307f;
+			float const b = v * 6.283185307f;
+			glm::vec3 const Normal(std::cos(a) * std::cos(b), std::sin(a) * std::cos(b), std::sin(b));
+			glm::vec3 const Position = glm::vec3(std::cos(a), std::sin(a), 0.0f) + Normal * 0.25f;
+
+			vertex & Vertex = Grid[j * (TorusU + 1) + i];
+			Vertex.Position = glm::vec3(quantize(Position.x), quantize(Position.y), quantize(Position.z));
+			Vertex.Normal = glm::vec3(quantize(Normal.x), quantize(Normal.y), quantize(Normal.z));
+			Vertex.TexCoord = glm::vec2(quantize(u), quantize(v));
+		}
+
+		std::vector<vertex> Soup;
+		Soup.reserve(TorusU * TorusV * 6);
+		for(std::size_t j = 0; j < TorusV; ++j)
+		for(std::size_t i = 0; i < TorusU; ++i)
+		{
+			std::size_t const i00 = j * (TorusU + 1) + i;
+			std::size_t const i10 = i00 + 1;
+			std::size_t const i01 = i00 + TorusU + 1;
+			std::size_t const i11 = i01 + 1;
+			std::size_t const Indices[] = {i00, i10, i11, i00, i11, i01};
+			for(std::size_t k = 0; k < 6; ++k)
+				Soup.push_back(Grid[Indices[k]]);
+		}
+		return Soup;
+	}
+
+	// A vertex of the COLLADA meshes of Falcon, whose attributes are a position, a normal and sometimes a color
+	struct mesh_vertex
+	{
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec3 Color;
+
+		bool operator==(mesh_vertex const & v) const
+		{
+			return Position == v.Position && Normal == v.Normal && Color == v.Color;
+		}
+	};
+
+	struct mesh_vertex_hash
+	{
+		std::size_t operator()(mesh_vertex const & v) const
+		{
+			return static_cast<std::size_t>(glm::hashValue(v.Color, glm::hashValue(v.Normal, glm::hashValue(v.Position))));
+		}
+	};
+
+	struct mesh_vertex_old_hash
+	{
+		std::size_t operator()(mesh_vertex const & v) const
+		{
+			std::size_t seed = 0;
+			std::hash<float> hasher;
+			for(glm::length_t i = 0; i < 3; ++i)
+			{
+				old_hash_combine(seed, hasher(v.Position[i]));
+				old_hash_combine(seed, hasher(v.Normal[i]));
+				old_hash_combine(seed, hasher(v.Color[i]));
+			}
+			return seed;
+		}
+	};
+
+	// Text between Begin and the following End in Text from Offset, Offset then pointing after End
+	bool element(std::string const & Text, std::string::size_type & Offset, char const * Begin, char const * End, std::string & Result)
+	{
+		std::string::size_type const First = Text.find(Begin, Offset);
+		if(First == std::string::npos)
+			return false;
+		std::string::size_type const Last = Text.find(End, First);
+		if(Last == std::string::npos)
+			return false;
+		Result = Text.substr(First + std::strlen(Begin), Last - First - std::strlen(Begin));
+		Offset = Last + std::strlen(End);
+		return true;
+	}
+
+	std::string attribute(std::string const & Tag, char const * Name)
+	{
+		std::string const Key = std::string(Name) + "=\"";
+		std::string::size_type const First = Tag.find(Key);
+		if(First == std::string::npos)
+			return std::string();
+		std::string::size_type const Last = Tag.find('"', First + Key.size());
+		return Tag.substr(First + Key.size(), Last - First - Key.size());
+	}
+
+	template <typename T>
+	std::vector<T> numbers(std::string const & Text)
+	{
+		std::vector<T> Result;
+		std::istringstream Stream(Text);
+		for(T Value; Stream >> Value;)
+			Result.push_back(Value);
+		return Result;
+	}
+
+	// The triangle soup of the first polylist of a COLLADA file, polygons being split in fans
+	std::vector<mesh_vertex> mesh_soup(char const * Path)
+	{
+		std::ifstream File(Path);
+		std::stringstream Buffer;
+		Buffer << File.rdbuf();
+		std::string const Text = Buffer.str();
+
+		// Float arrays by id, three floats per position, normal or color
+		std::map<std::string, std::vector<float> > Arrays;
+		std::string Tag;
+		for(std::string::size_type Offset = 0; element(Text, Offset, "<float_array", ">", Tag);)
+		{
+			std::string Values;
+			element(Text, Offset, "", "</float_array>", Values);
+			Arrays["#" + attribute(Tag, "id")] = numbers<float>(Values);
+		}
+
+		std::vector<mesh_vertex> Soup;
+		std::string::size_type Offset = 0;
+		std::string Vertices, Polylist;
+		if(!element(Text, Offset, "<vertices", "</vertices>", Vertices) || !element(Text, Offset, "<polylist", "</polylist>", Polylist))
+			return Soup;
+		std::string const PositionSource = attribute(Vertices.substr(Vertices.find("<input")), "source") + "-array";
+
+		// Attribute arrays of the polylist inputs by offset, positions going through <vertices>
+		std::vector<float> const * Attributes[3] = {0, 0, 0};
+		std::size_t Offsets[3] = {0, 0, 0};
+		std::size_t Stride = 0;
+		std::string Input;
+		for(std::string::size_type InputOffset = 0; element(Polylist, InputOffset, "<input", "/>", Input);)
+		{
+			std::string const Semantic = attribute(Input, "semantic");
+			std::size_t const InputIndex = Semantic == "VERTEX" ? 0 : Semantic == "NORMAL" ? 1 : Semantic == "COLOR" ? 2 : 3;
+			std::size_t const InputStride = std::strtoul(attribute(Input, "offset").c_str(), 0, 10);
+			Stride = glm::max(Stride, InputStride + 1);
+			if(InputIndex == 3)
+				continue;
+			Attributes[InputIndex] = &Arrays[InputIndex == 0 ? PositionSource : attribute(Input, "source") + "-array"];
+			Offsets[InputIndex] = InputStride;
+		}
+
+		std::string VCount, P;
+		std::string::size_type PolylistOffset = 0;
+		element(Polylist, PolylistOffset, "<vcount>", "</vcount>", VCount);
+		element(Polylist, PolylistOffset, "<p>", "</p>", P);
+		std::vector<std::size_t> const Counts = numbers<std::size_t>(VCount);
+		std::vector<std::size_t> const Indices = numbers<std::size_t>(P);
+
+		std::vector<mesh_vertex> Polygon;
+		for(std::size_t i = 0, Corner = 0; i < Counts.size(); ++i)
+		{
+			Polygon.clear();
+			for(std::size_t k = 0; k < Counts[i]; ++k, ++Corner)
+			{
+				mesh_vertex Vertex;
+				glm::vec3 * Members[3] = {&Vertex.Position, &Vertex.Normal, &Vertex.Color};
+				for(std::size_t a = 0; a < 3; ++a)
+				{
+					*Members[a] = glm::vec3(0.0f);
+					if(Attributes[a])
+						*Members[a] = glm::vec3(
+							(*Attributes[a])[Indices[Corner * Stride + Offsets[a]] * 3 + 0],
+							(*Attributes[a])[Indices[Corner * Stride + Offsets[a]] * 3 + 1],
+							(*Attributes[a])[Indices[Corner * Stride + Offsets[a]] * 3 + 2]);
+				}
+				Polygon.push_back(Vertex);
+			}
+			for(std::size_t k = 2; k < Polygon.size(); ++k)
+			{
+				Soup.push_back(Polygon[0]);
+				Soup.push_back(Polygon[k - 1]);
+				Soup.push_back(Polygon[k]);
+			}
+		}
+		return Soup;
+	}
+
+	// Pearson's chi-squared of the low bits of the hashes as buckets, within 6 standard deviations of its mean
+	bool buckets_ok(std::vector<std::size_t> const & Hashes, std::size_t Bits, std::size_t & MaxLoad)
+	{
+		std::vector<std::size_t> Buckets(std::size_t(1) << Bits, 0);
+		for(std::size_t i = 0; i < Hashes.size(); ++i)
+			++Buckets[Hashes[i] & (Buckets.size() - 1)];
+
+		double const Expected = static_cast<double>(Hashes.size()) / static_cast<double>(Buckets.size());
+		double Chi2 = 0.0;
+		MaxLoad = 0;
+		for(std::size_t i = 0; i < Buckets.size(); ++i)
+		{
+			Chi2 += (static_cast<double>(Buckets[i]) - Expected) * (static_cast<double>(Buckets[i]) - Expected) / Expected;
+			MaxLoad = glm::max(MaxLoad, Buckets[i]);
+		}
+
+		double const Freedom = static_cast<double>(Buckets.size() - 1);
+		return std::abs(Chi2 - Freedom) < 6.0 * std::sqrt(2.0 * Freedom);
+	}
+
+	std::size_t distinct(std::vector<std::size_t> const & Hashes)
+	{
+		return std::unordered_set<std::size_t>(Hashes.begin(), Hashes.end()).size();
+	}
+}//namespace
+
+// Equal values hash equal, -0.0 and 0.0 or NaNs of any payload included
+int test_equal()
+{
+	int Error = 0;
+
+	float const NegZero = -0.0f;
+	Error += glm::hashValue(NegZero) == glm::hashValue(0.0f) ? 0 : 1;
+	Error += glm::hashValue(-0.0) == glm::hashValue(0.0) ? 0 : 1;
+	Error += glm::hashValue(glm::vec3(1.0f, -0.0f, 2.0f)) == glm::hashValue(glm::vec3(1.0f, 0.0f, 2.0f)) ? 0 : 1;
+	Error += std::hash<glm::vec2>()(glm::vec2(-0.0f)) == std::hash<glm::vec2>()(glm::vec2(0.0f)) ? 0 : 1;
+
+	float const QuietNaN = std::numeric_limits<float>::quiet_NaN();
+	glm::uint32 const PayloadBits = 0xffc01234u;
+	float PayloadNaN;
+	std::memcpy(&PayloadNaN, &PayloadBits, sizeof(PayloadNaN));
+	Error += glm::hashValue(QuietNaN) == glm::hashValue(PayloadNaN) ? 0 : 1;
+	Error += glm::hashValue(glm::vec2(QuietNaN, 1.0f)) == glm::hashValue(glm::vec2(-PayloadNaN, 1.0f)) ? 0 : 1;
+	Error += glm::hashValue(std::numeric_limits<double>::quiet_NaN()) == glm::hashValue(-std::numeric_limits<double>::quiet_NaN()) ? 0 : 1;
+
+	std::unordered_map<glm::vec3, int> Map;
+	Map[glm::vec3(0.0f, 1.0f, 2.0f)] = 1;
+	Error += Map.count(glm::vec3(-0.0f, 1.0f, 2.0f)) == 1 ? 0 : 1;
+
+	Error += std::hash<glm::vec4>()(glm::vec4(1, 2, 3, 4)) == static_cast<std::size_t>(glm::hashValue(glm::vec4(1, 2, 3, 4))) ? 0 : 1;
+	Error += std::hash<glm::mat3>()(glm::mat3(2)) == static_cast<std::size_t>(glm::hashValue(glm::mat3(2))) ? 0 : 1;
+
+	return Error;
+}
+
+// Values that differ hash differently, whatever their type
+int test_distinct()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> Hashes;
+	Hashes.push_back(glm::hashValue(glm::vec2(1.0f, 2.0f)));
+	Hashes.push_back(glm::hashValue(glm::vec2(2.0f, 1.0f)));
+	Hashes.push_back(glm::hashValue(glm::vec3(1.0f, 2.0f, 0.0f)));
+	Hashes.push_back(glm::hashValue(glm::vec3(1.0f, 2.0f, 3.0f)));
+	Hashes.push_back(glm::hashValue(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f)));
+	Hashes.push_back(glm::hashValue(glm::dvec3(1.0, 2.0, 3.0)));
+	Hashes.push_back(glm::hashValue(glm::ivec3(1, 2, 3)));
+	Hashes.push_back(glm::hashValue(glm::ivec3(-1, 2, 3)));
+	Hashes.push_back(glm::hashValue(glm::u8vec4(1, 2, 3, 4)));
+	Hashes.push_back(glm::hashValue(glm::i64vec2(1, 2)));
+	Hashes.push_back(glm::hashValue(glm::quat(1.0f, 0.0f, 0.0f, 0.0f)));
+	Hashes.push_back(glm::hashValue(glm::quat(0.0f, 1.0f, 0.0f, 0.0f)));
+	Hashes.push_back(glm::hashValue(glm::dualquat(glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f))));
+	Hashes.push_back(glm::hashValue(glm::dualquat(glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f))));
+	Hashes.push_back(glm::hashValue(glm::mat2(1.0f)));
+	Hashes.push_back(glm::hashValue(glm::mat3(1.0f)));
+	Hashes.push_back(glm::hashValue(glm::mat4(1.0f)));
+	Hashes.push_back(glm::hashValue(glm::mat4x3(1.0f)));
+	Hashes.push_back(glm::hashValue(glm::vec3(1.0f, 2.0f, 3.0f), 1));
+	Hashes.push_back(glm::hashValue(glm::vec3(1.0f, 2.0f, 3.0f), glm::hashValue(1.0f)));
+	Error += distinct(Hashes) == Hashes.size() ? 0 : 1;
+
+	// Chaining hashes the sequence
+	Error += glm::hashValue(2.0f, glm::hashValue(1.0f)) != glm::hashValue(1.0f, glm::hashValue(2.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+int test_array()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Data(1003);
+	for(std::size_t i = 0; i < Data.size(); ++i)
+		Data[i] = glm::vec3(static_cast<float>(i % 17), static_cast<float>(i % 31) * 0.5f, static_cast<float>(i) * 0.25f);
+
+	std::vector<glm::uint64> Hashes(Data.size());
+	glm::hashValue(&Data[0], &Hashes[0], Data.size(), 7);
+	for(std::size_t i = 0; i < Data.size(); ++i)
+		Error += Hashes[i] == glm::hashValue(Data[i], 7) ? 0 : 1;
+
+	glm::uint64 const Range = glm::hashRange(&Data[0], Data.size());
+	Error += Range == glm::hashRange(&Data[0], Data.size()) ? 0 : 1;
+	Error += Range != glm::hashRange(&Data[0], Data.size() - 1) ? 0 : 1;
+	Error += Range != glm::hashRange(&Data[0], Data.size(), 1) ? 0 : 1;
+
+	// A change anywhere changes the hash, -0.0 for 0.0 excepted
+	std::vector<std::size_t> Changed;
+	for(std::size_t i = 0; i < Data.size(); i += 97)
+	{
+		std::vector<glm::vec3> Copy(Data);
+		Copy[i].y += 1.0f;
+		Changed.push_back(glm::hashRange(&Copy[0], Copy.size()));
+	}
+	Changed.push_back(Range);
+	Error += distinct(Changed) == Changed.size() ? 0 : 1;
+
+	std::vector<glm::vec3> Zero(Data);
+	Zero[0].x = -0.0f;
+	Error += glm::hashRange(&Zero[0], Zero.size()) == Range ? 0 : 1;
+
+	std::vector<float> Scalars(7, 1.0f);
+	Error += glm::hashRange(&Scalars[0], Scalars.size()) != glm::hashRange(&Scalars[0], Scalars.size() - 1) ? 0 : 1;
+
+	return Error;
+}
+
+int test_grid()
+{
+	int Error = 0;
+
+	Error += glm::gridCell(glm::vec3(0.5f, -0.5f, 2.5f), 1.0f) == glm::ivec3(0, -1, 2) ? 0 : 1;
+	Error += glm::gridCell(glm::vec3(-0.0f, -2.0f, 1.0f), 2.0f) == glm::ivec3(0, -1, 0) ? 0 : 1;
+	Error += glm::gridCell(glm::dvec2(10.0, -10.01), 10.0) == glm::ivec2(1, -2) ? 0 : 1;
+
+	Error += glm::gridHash(glm::vec3(0.1f, 0.2f, 0.3f), 0.5f) == glm::gridHash(glm::vec3(0.4f, 0.0f, 0.49f), 0.5f) ? 0 : 1;
+	Error += glm::gridHash(glm::vec3(0.1f, 0.2f, 0.3f), 0.5f) != glm::gridHash(glm::vec3(0.6f, 0.2f, 0.3f), 0.5f) ? 0 : 1;
+	Error += glm::gridHash(glm::vec3(0.1f, 0.2f, 0.3f), 0.5f) == glm::hashValue(glm::ivec3(0)) ? 0 : 1;
+
+	// Cells of a lattice fill the buckets of a power of two table evenly
+	std::vector<std::size_t> Hashes;
+	for(int z = -32; z < 32; ++z)
+	for(int y = -32; y < 32; ++y)
+	for(int x = -32; x < 32; ++x)
+		Hashes.push_back(static_cast<std::size_t>(glm::gridHash(glm::vec3(x, y, z) * 0.1f + 0.05f, 0.1f)));
+	Error += distinct(Hashes) == Hashes.size() ? 0 : 1;
+
+	std::size_t MaxLoad = 0;
+	Error += buckets_ok(Hashes, 16, MaxLoad) ? 0 : 1;
+
+	return Error;
+}
+
+// Welds the vertices of a triangle soup with the new and the old hash, reporting collisions, bucket loads and time
+template <typename vertexType, typename hashType, typename oldHashType>
+int weld(char const * Name, std::vector<vertexType> const & Soup, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::unordered_map<vertexType, glm::uint32, hashType> New;
+	std::vector<glm::uint32> IndicesNew(Soup.size());
+	std::clock_t const TimeNew0 = std::clock();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	{
+		New.clear();
+		for(std::size_t i = 0; i < Soup.size(); ++i)
+			IndicesNew[i] = New.insert(std::make_pair(Soup[i], static_cast<glm::uint32>(New.size()))).first->second;
+	}
+	std::clock_t const TimeNew1 = std::clock();
+
+	std::unordered_map<vertexType, glm::uint32, oldHashType> Old;
+	std::vector<glm::uint32> IndicesOld(Soup.size());
+	std::clock_t const TimeOld0 = std::clock();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	{
+		Old.clear();
+		for(std::size_t i = 0; i < Soup.size(); ++i)
+			IndicesOld[i] = Old.insert(std::make_pair(Soup[i], static_cast<glm::uint32>(Old.size()))).first->second;
+	}
+	std::clock_t const TimeOld1 = std::clock();
+
+	Error += New.size() == Old.size() ? 0 : 1;
+	Error += IndicesNew == IndicesOld ? 0 : 1;
+
+	std::vector<std::size_t> HashesNew, HashesOld, PositionsNew, PositionsOld;
+	std::unordered_set<glm::vec3, std::hash<glm::vec3> > Positions;
+	for(typename std::unordered_map<vertexType, glm::uint32, hashType>::const_iterator it = New.begin(); it != New.end(); ++it)
+	{
+		HashesNew.push_back(hashType()(it->first));
+		HashesOld.push_back(oldHashType()(it->first));
+		if(Positions.insert(it->first.Position).second)
+		{
+			PositionsNew.push_back(std::hash<glm::vec3>()(it->first.Position));
+			PositionsOld.push_back(old_hash()(it->first.Position));
+		}
+	}
+
+	Error += distinct(HashesNew) == HashesNew.size() ? 0 : 1;
+	Error += distinct(PositionsNew) == PositionsNew.size() ? 0 : 1;
+
+	// Buckets holding 5 keys or more on average, for the chi-squared test to hold
+	std::size_t VertexBits = 1, PositionBits = 1;
+	while((std::size_t(10) << VertexBits) <= HashesNew.size())
+		++VertexBits;
+	while((std::size_t(10) << PositionBits) <= PositionsNew.size())
+		++PositionBits;
+
+	std::size_t MaxLoadNew = 0, MaxLoadOld = 0, MaxLoadPositionsNew = 0, MaxLoadPositionsOld = 0;
+	Error += buckets_ok(HashesNew, VertexBits, MaxLoadNew) ? 0 : 1;
+	buckets_ok(HashesOld, VertexBits, MaxLoadOld);
+	Error += buckets_ok(PositionsNew, PositionBits, MaxLoadPositionsNew) ? 0 : 1;
+	buckets_ok(PositionsOld, PositionBits, MaxLoadPositionsOld);
+
+	std::printf("%s: weld %d vertices into %d: %.3f ms, old hash %.3f ms\n",
+		Name, static_cast<int>(Soup.size()), static_cast<int>(New.size()),
+		static_cast<double>(TimeNew1 - TimeNew0) * 1000.0 / CLOCKS_PER_SEC / static_cast<double>(Repeat),
+		static_cast<double>(TimeOld1 - TimeOld0) * 1000.0 / CLOCKS_PER_SEC / static_cast<double>(Repeat));
+	std::printf("%s: vertices: %d distinct hashes of %d, max bucket load %d of %d buckets, old hash %d distinct, max load %d\n",
+		Name, static_cast<int>(distinct(HashesNew)), static_cast<int>(HashesNew.size()), static_cast<int>(MaxLoadNew), 1 << VertexBits,
+		static_cast<int>(distinct(HashesOld)), static_cast<int>(MaxLoadOld));
+	std::printf("%s: positions: %d distinct hashes of %d, max bucket load %d of %d buckets, old hash %d distinct, max load %d\n",
+		Name, static_cast<int>(distinct(PositionsNew)), static_cast<int>(PositionsNew.size()), static_cast<int>(MaxLoadPositionsNew), 1 << PositionBits,
+		static_cast<int>(distinct(PositionsOld)), static_cast<int>(MaxLoadPositionsOld));
+
+	return Error;
+}
+
+int test_weld()
+{
+	int Error = 0;
+
+	std::vector<vertex> const Soup = torus_soup();
+	std::size_t const Unique = (TorusU + 1) * (TorusV + 1);
+
+	std::unordered_set<vertex, vertex_hash> Vertices(Soup.begin(), Soup.end());
+	Error += Vertices.size() == Unique ? 0 : 1;
+	Error += weld<vertex, vertex_hash, vertex_old_hash>("Torus", Soup, 1);
+
+	return Error;
+}
+
+// Welds the meshes given on the command line, the COLLADA files of Falcon when run by ctest
+int test_weld_meshes(int argc, char* argv[], std::vector<glm::vec3> & Positions)
+{
+	int Error = 0;
+
+	std::vector<mesh_vertex> All;
+	for(int i = 1; i < argc; ++i)
+	{
+		std::vector<mesh_vertex> const Soup = mesh_soup(argv[i]);
+		Error += Soup.empty() ? 1 : 0;
+		if(Soup.empty())
+			continue;
+
+		char const * Name = std::strrchr(argv[i], '/') ? std::strrchr(argv[i], '/') + 1 : argv[i];
+		Error += weld<mesh_vertex, mesh_vertex_hash, mesh_vertex_old_hash>(Name, Soup, 64);
+		All.insert(All.end(), Soup.begin(), Soup.end());
+	}
+
+	if(argc > 2)
+		Error += weld<mesh_vertex, mesh_vertex_hash, mesh_vertex_old_hash>("All meshes", All, 64);
+
+	for(std::size_t i = 0; i < All.size(); ++i)
+		Positions.push_back(All[i].Position);
+
+	return Error;
+}
+
+// Hashes of the vertex positions of a triangle soup, repeated over about 3 million positions
+int perf_hash(char const * Name, std::vector<glm::vec3> const & Positions)
+{
+	int Error = 0;
+
+	std::size_t const Repeat = (std::size_t(3) << 20) / Positions.size() + 1;
+	std::size_t Sum = 0;
+
+	std::clock_t const TimeOld0 = std::clock();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Sum += old_hash()(Positions[i]);
+	std::clock_t const TimeOld1 = std::clock();
+
+	std::clock_t const TimeNew0 = std::clock();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Sum += std::hash<glm::vec3>()(Positions[i]);
+	std::clock_t const TimeNew1 = std::clock();
+
+	std::vector<glm::uint64> Hashes(Positions.size());
+	std::clock_t const TimeArray0 = std::clock();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::hashValue(&Positions[0], &Hashes[0], Positions.size());
+	std::clock_t const TimeArray1 = std::clock();
+	Sum += static_cast<std::size_t>(Hashes[Hashes.size() / 2]);
+
+	std::clock_t const TimeRange0 = std::clock();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		Sum += static_cast<std::size_t>(glm::hashRange(&Positions[0], Positions.size(), r));
+	std::clock_t const TimeRange1 = std::clock();
+
+	double const Count = static_cast<double>(Positions.size() * Repeat) / 1e6;
+	std::printf("%s vec3 hashes: old %.1f M/s, std::hash %.1f M/s, array %.1f M/s, hashRange %.2f GB/s\n",
+		Name, Count / (static_cast<double>(TimeOld1 - TimeOld0) / CLOCKS_PER_SEC),
+		Count / (static_cast<double>(TimeNew1 - TimeNew0) / CLOCKS_PER_SEC),
+		Count / (static_cast<double>(TimeArray1 - TimeArray0) / CLOCKS_PER_SEC),
+		Count * sizeof(glm::vec3) / 1e3 / (static_cast<double>(TimeRange1 - TimeRange0) / CLOCKS_PER_SEC));
+
+	Error += Sum != 0 ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_CXX11_STL
+
+int main(int argc, char* argv[])
+{
+	int Error = 0;
+
+#	if GLM_HAS_CXX11_STL
+		Error += test_equal();
+		Error += test_distinct();
+		Error += test_array();
+		Error += test_grid();
+		Error += test_weld();
+
+		std::vector<vertex> const Torus = torus_soup();
+		std::vector<glm::vec3> TorusPositions(Torus.size());
+		for(std::size_t i = 0; i < Torus.size(); ++i)
+			TorusPositions[i] = Torus[i].Position;
+		Error += perf_hash("Torus", TorusPositions);
+
+		std::vector<glm::vec3> MeshPositions;
+		Error += test_weld_meshes(argc, argv, MeshPositions);
+		if(!MeshPositions.empty())
+			Error += perf_hash("Meshes", MeshPositions);
+#	else
+		(void)argc;
+		(void)argv;
+#	endif
+
+	return Error;
+}
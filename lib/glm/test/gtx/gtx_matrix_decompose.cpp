@@ -1,6 +1,41 @@
 #include <glm/gtx/matrix_decompose.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
 
-int main()
+int myrand()
+{
+	static int holdrand = 1;
+	return (((holdrand = holdrand * 214013L + 2531011L) >> 16) & 0x7fff);
+}
+
+float myfrand() // returns values from -1 to 1 inclusive
+{
+	return float(double(myrand()) / double( 0x7ffff )) * 2.0f - 1.0f;
+}
+
+// Rotations up to a half turn, so that every case of the quaternion extraction is covered
+glm::quat random_rotation()
+{
+	return glm::angleAxis(myfrand() * 3.14f, glm::normalize(glm::vec3(myfrand(), myfrand(), myfrand() + 2.0f * static_cast<float>(myrand() % 2) - 1.0f)));
+}
+
+glm::vec3 random_scale()
+{
+	glm::vec3 const Scale(1.0f + myfrand() * 0.5f, 1.0f + myfrand() * 0.5f, 1.0f + myfrand() * 0.5f);
+	return myrand() % 4 ? Scale : -Scale;
+}
+
+// q and -q are the same rotation
+template <glm::precision P>
+bool same_rotation(glm::tquat<float, P> const & a, glm::quat const & b, float Epsilon)
+{
+	return glm::abs(glm::abs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w) - 1.0f) < Epsilon;
+}
+
+int test_decompose()
 {
 	int Error(0);
 
@@ -12,7 +47,138 @@ int main()
 	glm::vec3 Skew(1);
 	glm::vec4 Perspective(1);
 
-	glm::decompose(Matrix, Scale, Orientation, Translation, Skew, Perspective);
+	Error += glm::decompose(Matrix, Scale, Orientation, Translation, Skew, Perspective) ? 0 : 1;
+	Error += Scale == glm::vec3(1) && Translation == glm::vec3(0) && Skew == glm::vec3(0) && Perspective == glm::vec4(0, 0, 0, 1) ? 0 : 1;
+
+	// The orientation is the rotation of the matrix, not its inverse
+	for(int i = 0; i < 16; ++i)
+	{
+		glm::quat const Rotation = random_rotation();
+		glm::decompose(glm::mat4_cast(Rotation), Scale, Orientation, Translation, Skew, Perspective);
+		Error += same_rotation(Orientation, Rotation, 0.0001f) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Orientation * glm::vec3(1, 2, 3), Rotation * glm::vec3(1, 2, 3), 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_decomposeAffine()
+{
+	int Error(0);
+
+	for(int i = 0; i < 256; ++i)
+	{
+		glm::vec3 const Scale = random_scale();
+		glm::quat const Rotation = random_rotation();
+		glm::vec3 const Translation(myfrand() * 10.0f, myfrand() * 10.0f, myfrand() * 10.0f);
+		glm::mat4 const Matrix = glm::translate(glm::mat4(1.0f), Translation) * glm::mat4_cast(Rotation) * glm::scale(glm::mat4(1.0f), Scale);
+
+		glm::vec3 ScaleA, TranslationA, ScaleB, TranslationB, Skew;
+		glm::quat OrientationA, OrientationB;
+		glm::vec4 Perspective;
+		glm::decomposeAffine(Matrix, ScaleA, OrientationA, TranslationA);
+		glm::decompose(Matrix, ScaleB, OrientationB, TranslationB, Skew, Perspective);
+
+		Error += glm::all(glm::epsilonEqual(ScaleA, ScaleB, 0.0001f)) ? 0 : 1;
+		Error += same_rotation(OrientationA, OrientationB, 0.0001f) ? 0 : 1;
+		Error += TranslationA == TranslationB ? 0 : 1;
+
+		glm::mat4 const Recomposed = glm::translate(glm::mat4(1.0f), TranslationA) * glm::mat4_cast(OrientationA) * glm::scale(glm::mat4(1.0f), ScaleA);
+		for(glm::length_t j = 0; j < 4; ++j)
+			Error += glm::all(glm::epsilonEqual(Recomposed[j], Matrix[j], 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <glm::precision P>
+int test_decomposeAffine_batch()
+{
+	typedef glm::tmat4x4<float, P> mat4;
+	typedef glm::tvec3<float, P> vec3;
+	typedef glm::tquat<float, P> quat;
+
+	int Error(0);
+
+	// Not a multiple of 4 or 8, so that the remainder is decomposed one matrix at a time
+	std::size_t const Count = 37;
+
+	std::vector<mat4> Matrices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat4 const Matrix = glm::translate(glm::mat4(1.0f), glm::vec3(myfrand(), myfrand(), myfrand())) * glm::mat4_cast(random_rotation()) * glm::scale(glm::mat4(1.0f), random_scale());
+		Matrices[i] = mat4(Matrix);
+	}
+
+	std::vector<vec3> Scales(Count + 1, vec3(7.0f)), Translations(Count + 1, vec3(7.0f));
+	std::vector<quat> Orientations(Count);
+	glm::decomposeAffine(&Matrices[0], &Scales[0], &Orientations[0], &Translations[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 Scale, Translation;
+		glm::quat Orientation;
+		glm::decomposeAffine(glm::mat4(Matrices[i]), Scale, Orientation, Translation);
+
+		Error += glm::all(glm::epsilonEqual(glm::vec3(Scales[i]), Scale, 0.0001f)) ? 0 : 1;
+		Error += same_rotation(Orientations[i], Orientation, 0.0001f) ? 0 : 1;
+		Error += glm::vec3(Translations[i]) == Translation ? 0 : 1;
+	}
+
+	// Nothing is written past the last element
+	Error += Scales[Count] == vec3(7.0f) && Translations[Count] == vec3(7.0f) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_decompose()
+{
+	std::size_t const Count = 1 << 16;
+	int const Frames = 8;
+
+	std::vector<glm::mat4> Matrices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Matrices[i] = glm::translate(glm::mat4(1.0f), glm::vec3(myfrand(), myfrand(), myfrand())) * glm::mat4_cast(random_rotation()) * glm::scale(glm::mat4(1.0f), random_scale());
+
+	std::vector<glm::vec3> Scales(Count), Translations(Count);
+	std::vector<glm::quat> Orientations(Count);
+	glm::vec3 Skew;
+	glm::vec4 Perspective;
+
+	std::clock_t const StartDecompose = std::clock();
+	for(int f = 0; f < Frames; ++f)
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::decompose(Matrices[i], Scales[i], Orientations[i], Translations[i], Skew, Perspective);
+	std::clock_t const TimeDecompose = std::clock() - StartDecompose;
+
+	std::clock_t const StartAffine = std::clock();
+	for(int f = 0; f < Frames; ++f)
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::decomposeAffine(Matrices[i], Scales[i], Orientations[i], Translations[i]);
+	std::clock_t const TimeAffine = std::clock() - StartAffine;
+
+	std::clock_t const StartBatch = std::clock();
+	for(int f = 0; f < Frames; ++f)
+		glm::decomposeAffine(&Matrices[0], &Scales[0], &Orientations[0], &Translations[0], Count);
+	std::clock_t const TimeBatch = std::clock() - StartBatch;
+
+	std::printf("Decomposing %d matrices: decompose %d clocks, decomposeAffine %d clocks, batched decomposeAffine %d clocks\n",
+		static_cast<int>(Count * Frames), static_cast<int>(TimeDecompose), static_cast<int>(TimeAffine), static_cast<int>(TimeBatch));
+
+	return glm::isnan(Scales[0].x) || glm::isnan(Orientations[0].w) ? 1 : 0;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_decompose();
+	Error += test_decomposeAffine();
+	Error += test_decomposeAffine_batch<glm::highp>();
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_decomposeAffine_batch<glm::aligned_highp>();
+#	endif
+	Error += perf_decompose();
 
 	return Error;
 }
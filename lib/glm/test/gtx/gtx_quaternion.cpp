@@ -5,6 +5,9 @@
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtx/compatibility.hpp>
 #include <glm/ext.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
 
 int test_quat_fastMix()
 {
@@ -89,6 +92,136 @@ int test_log()
 	return Error;
 }
 
+namespace interpolation
+{
+	// Rotation angle between a and the rotation b, 4 asin(chord / 2) stays accurate for tiny angles
+	double angle_between(glm::quat const & a, glm::dquat const & b)
+	{
+		glm::dquat const q(glm::normalize(glm::dquat(a.w, a.x, a.y, a.z)));
+		double const s = glm::dot(q, b) < 0.0 ? -1.0 : 1.0;
+		glm::dvec4 const d(q.x - s * b.x, q.y - s * b.y, q.z - s * b.z, q.w - s * b.w);
+		return 4.0 * glm::asin(glm::min(glm::length(d) * 0.5, 1.0));
+	}
+
+	// Pairs spanning every angle between x and y, y on either side of x on the 4D sphere
+	std::vector<glm::quat> make_pairs()
+	{
+		std::vector<glm::quat> Pairs;
+		int const Steps = 90;
+		for(int i = 0; i <= Steps; ++i)
+		{
+			float const Angle = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(Steps);
+			glm::quat const X = glm::angleAxis(0.3f * static_cast<float>(i), glm::normalize(glm::vec3(1, 2, 3)));
+			glm::quat const R = glm::angleAxis(Angle, glm::normalize(glm::vec3(-2.f, 0.5f, 1.f + static_cast<float>(i % 7))));
+			Pairs.push_back(X);
+			Pairs.push_back(X * R);
+		}
+		return Pairs;
+	}
+
+	template <typename F>
+	double max_error(F Func)
+	{
+		std::vector<glm::quat> const Pairs = make_pairs();
+		double Max = 0.0;
+		for(std::size_t i = 0; i < Pairs.size(); i += 2)
+		{
+			glm::dquat const X(Pairs[i].w, Pairs[i].x, Pairs[i].y, Pairs[i].z);
+			glm::dquat const Y(Pairs[i + 1].w, Pairs[i + 1].x, Pairs[i + 1].y, Pairs[i + 1].z);
+			for(int j = 0; j <= 64; ++j)
+			{
+				float const a = static_cast<float>(j) / 64.f;
+				glm::dquat const Ref = glm::slerp(X, Y, static_cast<double>(a));
+				Max = glm::max(Max, angle_between(Func(Pairs[i], Pairs[i + 1], a), Ref));
+			}
+		}
+		return Max;
+	}
+
+	glm::quat call_slerp(glm::quat const & x, glm::quat const & y, float a){return glm::slerp(x, y, a);}
+	glm::quat call_nlerp(glm::quat const & x, glm::quat const & y, float a){return glm::nlerp(x, y, a);}
+	glm::quat call_correctedNlerp(glm::quat const & x, glm::quat const & y, float a){return glm::correctedNlerp(x, y, a);}
+	glm::quat call_accurateNlerp(glm::quat const & x, glm::quat const & y, float a){return glm::accurateNlerp(x, y, a);}
+	glm::quat call_fastSlerp(glm::quat const & x, glm::quat const & y, float a){return glm::fastSlerp(x, y, a);}
+
+	int test()
+	{
+		int Error = 0;
+
+		// Bounds documented in gtx/quaternion.hpp, with some margin for float rounding
+		double const Slerp = max_error(call_slerp);
+		double const Nlerp = max_error(call_nlerp);
+		double const Corrected = max_error(call_correctedNlerp);
+		double const Accurate = max_error(call_accurateNlerp);
+		double const Fast = max_error(call_fastSlerp);
+
+		std::printf("max rotation error (radians): slerp %g, nlerp %g, correctedNlerp %g, accurateNlerp %g, fastSlerp %g\n",
+			Slerp, Nlerp, Corrected, Accurate, Fast);
+
+		Error += Nlerp < 0.15 ? 0 : 1;
+		Error += Corrected < 0.0085 ? 0 : 1;
+		Error += Accurate < 0.0008 ? 0 : 1;
+		Error += Fast < 1e-6 ? 0 : 1;
+
+		// Ordered as advertised
+		Error += Nlerp > Corrected && Corrected > Accurate && Accurate > Fast ? 0 : 1;
+
+		// End points
+		glm::quat const A = glm::angleAxis(0.4f, glm::normalize(glm::vec3(1, 1, 0)));
+		glm::quat const B = glm::angleAxis(2.5f, glm::normalize(glm::vec3(0, 1, 1)));
+		Error += glm::all(glm::epsilonEqual(glm::correctedNlerp(A, B, 0.0f), A, 1e-6f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::accurateNlerp(A, B, 1.0f), B, 1e-6f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::fastSlerp(A, B, 1.0f), B, 1e-6f)) ? 0 : 1;
+
+		// Shortest path: -B is the same rotation as B
+		Error += glm::all(glm::epsilonEqual(glm::nlerp(A, -B, 0.5f), glm::nlerp(A, B, 0.5f), 1e-6f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::fastSlerp(A, -B, 0.3f), glm::slerp(A, B, 0.3f), 1e-6f)) ? 0 : 1;
+
+		// Identical inputs take the linear fallback
+		Error += glm::all(glm::epsilonEqual(glm::fastSlerp(A, A, 0.7f), A, 1e-6f)) ? 0 : 1;
+
+		// In double precision the polynomials are good to about 1e-7
+		glm::dquat const DA(A.w, A.x, A.y, A.z);
+		glm::dquat const DB(B.w, B.x, B.y, B.z);
+		glm::dquat const DC = glm::fastSlerp(DA, DB, 0.35);
+		glm::dquat const DD = glm::slerp(DA, DB, 0.35);
+		Error += glm::all(glm::epsilonEqual(DC, DD, 1e-6)) ? 0 : 1;
+
+		return Error;
+	}
+
+	template <typename F>
+	std::clock_t time(F Func, std::vector<glm::quat> const & Pairs, std::vector<glm::quat> & Out)
+	{
+		std::size_t const Count = Out.size();
+		std::clock_t const Start = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = Func(Pairs[(i * 2) % Pairs.size()], Pairs[(i * 2) % Pairs.size() + 1], static_cast<float>(i & 255) / 255.f);
+		return std::clock() - Start;
+	}
+
+	int perf()
+	{
+		std::vector<glm::quat> const Pairs = make_pairs();
+		std::vector<glm::quat> Out(1 << 20);
+
+		std::clock_t const Slerp = time(call_slerp, Pairs, Out);
+		std::clock_t const Nlerp = time(call_nlerp, Pairs, Out);
+		std::clock_t const Corrected = time(call_correctedNlerp, Pairs, Out);
+		std::clock_t const Accurate = time(call_accurateNlerp, Pairs, Out);
+		std::clock_t const Fast = time(call_fastSlerp, Pairs, Out);
+
+		std::printf("%d interpolations: slerp %d, nlerp %d, correctedNlerp %d, accurateNlerp %d, fastSlerp %d clocks\n",
+			static_cast<int>(Out.size()), static_cast<int>(Slerp), static_cast<int>(Nlerp),
+			static_cast<int>(Corrected), static_cast<int>(Accurate), static_cast<int>(Fast));
+
+		int Error = 0;
+		for(std::size_t i = 0; i < Out.size(); ++i)
+			Error += glm::isnan(Out[i].w) ? 1 : 0;
+		return Error;
+	}
+}//namespace interpolation
+
 int main()
 {
 	int Error = 0;
@@ -97,6 +230,8 @@ int main()
 	Error += test_rotation();
 	Error += test_quat_fastMix();
 	Error += test_quat_shortMix();
+	Error += interpolation::test();
+	Error += interpolation::perf();
 
 	return Error;
 }
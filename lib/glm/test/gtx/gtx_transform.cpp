@@ -0,0 +1,102 @@
+#include <glm/gtx/transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/vector_relational.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+bool close(glm::mat4 const & a, glm::mat4 const & b, float Epsilon)
+{
+	for(glm::length_t i = 0; i < 4; ++i)
+		if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+			return false;
+	return true;
+}
+
+int test_builders()
+{
+	int Error = 0;
+
+	glm::vec3 const v(1, -2, 3);
+	glm::mat4 const Identity(1.0f);
+
+	Error += glm::translate(v) == glm::translate(Identity, v) ? 0 : 1;
+	Error += glm::scale(v) == glm::scale(Identity, v) ? 0 : 1;
+	Error += close(glm::rotate(0.75f, v), glm::rotate(Identity, 0.75f, v), 0.0001f) ? 0 : 1;
+	Error += glm::translate(glm::dvec3(v)) == glm::translate(glm::dmat4(1.0), glm::dvec3(v)) ? 0 : 1;
+	Error += glm::rotate(0.75, glm::dvec3(v)) == glm::rotate(glm::dmat4(1.0), 0.75, glm::dvec3(v)) ? 0 : 1;
+
+	return Error;
+}
+
+int test_translateRotateScale()
+{
+	int Error = 0;
+
+	glm::vec3 const t(1, -2, 3);
+	glm::quat const r = glm::angleAxis(0.75f, glm::normalize(glm::vec3(1, 2, 3)));
+	glm::vec3 const s(2, 0.5f, 3);
+
+	glm::mat4 const Expected = glm::translate(t) * glm::mat4_cast(r) * glm::scale(s);
+	Error += close(glm::translateRotateScale(t, r, s), Expected, 0.0001f) ? 0 : 1;
+
+	glm::dmat4 const ExpectedD = glm::translate(glm::dvec3(t)) * glm::mat4_cast(glm::dquat(r)) * glm::scale(glm::dvec3(s));
+	Error += close(glm::mat4(glm::translateRotateScale(glm::dvec3(t), glm::dquat(r), glm::dvec3(s))), glm::mat4(ExpectedD), 0.0001f) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_builders()
+{
+	std::size_t const Count = 1 << 20;
+
+	std::vector<glm::vec3> Vectors(64);
+	std::vector<glm::quat> Rotations(64);
+	for(std::size_t i = 0; i < Vectors.size(); ++i)
+	{
+		Vectors[i] = glm::vec3(static_cast<float>(i % 7) - 3.0f, static_cast<float>(i % 5) + 1.0f, static_cast<float>(i % 3) - 1.5f);
+		Rotations[i] = glm::angleAxis(0.1f * static_cast<float>(i), glm::normalize(Vectors[i]));
+	}
+
+	glm::mat4 SumIdentity(0.0f);
+	std::clock_t const StartIdentity = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumIdentity += glm::rotate(glm::mat4(1.0f), 0.001f * static_cast<float>(i & 63), Vectors[i & 63]);
+	std::clock_t const TimeIdentity = std::clock() - StartIdentity;
+
+	glm::mat4 SumRotation(0.0f);
+	std::clock_t const StartRotation = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumRotation += glm::rotate(0.001f * static_cast<float>(i & 63), Vectors[i & 63]);
+	std::clock_t const TimeRotation = std::clock() - StartRotation;
+
+	glm::mat4 SumProducts(0.0f);
+	std::clock_t const StartProducts = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumProducts += glm::translate(Vectors[i & 63]) * glm::mat4_cast(Rotations[i & 63]) * glm::scale(Vectors[(i + 1) & 63]);
+	std::clock_t const TimeProducts = std::clock() - StartProducts;
+
+	glm::mat4 SumTRS(0.0f);
+	std::clock_t const StartTRS = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		SumTRS += glm::translateRotateScale(Vectors[i & 63], Rotations[i & 63], Vectors[(i + 1) & 63]);
+	std::clock_t const TimeTRS = std::clock() - StartTRS;
+
+	std::printf("%d rotate(mat4(1), a, v): %d clocks, rotate(a, v): %d clocks\n",
+		static_cast<int>(Count), static_cast<int>(TimeIdentity), static_cast<int>(TimeRotation));
+	std::printf("%d T * R * S products: %d clocks, translateRotateScale: %d clocks\n",
+		static_cast<int>(Count), static_cast<int>(TimeProducts), static_cast<int>(TimeTRS));
+
+	return glm::isnan(SumIdentity[0].x) || glm::isnan(SumRotation[0].x) || glm::isnan(SumProducts[0].x) || glm::isnan(SumTRS[0].x) ? 1 : 0;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_builders();
+	Error += test_translateRotateScale();
+	Error += perf_builders();
+
+	return Error;
+}
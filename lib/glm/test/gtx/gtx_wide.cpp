@@ -0,0 +1,655 @@
+#include <glm/gtx/wide.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+// Every lane is checked against the same computation on its own, in double from the raw floats
+namespace
+{
+	template <typename F>
+	struct wide;
+
+	template <>
+	struct wide<glm::floatx4>
+	{
+		static glm::floatx4 load(float const * p){return glm::make_floatx4(p);}
+		static glm::vec3x4 load(glm::vec3 const * p){return glm::make_vec3x4(p);}
+		static glm::vec4x4 load(glm::vec4 const * p){return glm::make_vec4x4(p);}
+		static glm::quatx4 load(glm::quat const * p){return glm::make_quatx4(p);}
+	};
+
+	template <>
+	struct wide<glm::floatx8>
+	{
+		static glm::floatx8 load(float const * p){return glm::make_floatx8(p);}
+		static glm::vec3x8 load(glm::vec3 const * p){return glm::make_vec3x8(p);}
+		static glm::vec4x8 load(glm::vec4 const * p){return glm::make_vec4x8(p);}
+		static glm::quatx8 load(glm::quat const * p){return glm::make_quatx8(p);}
+	};
+
+	void fill(std::vector<float> & Data, unsigned Seed)
+	{
+		for(std::size_t i = 0; i < Data.size(); ++i)
+			Data[i] = static_cast<float>((i * 7 + Seed * 13) % 29) * 0.25f - 3.5f;
+	}
+
+	bool close(double Value, double Expected)
+	{
+		return std::abs(Value - Expected) <= 1e-5 * (1.0 + std::abs(Expected));
+	}
+
+	template <typename F>
+	int check(F const & Value, double const * Expected)
+	{
+		int Error = 0;
+		for(glm::length_t i = 0; i < F::length(); ++i)
+			Error += close(Value[i], Expected[i]) ? 0 : 1;
+		return Error;
+	}
+}//namespace
+
+namespace lanes
+{
+	template <typename F>
+	int test()
+	{
+		int Error = 0;
+		glm::length_t const Lanes = F::length();
+
+		std::vector<float> A(8), B(8), C(8);
+		fill(A, 1);
+		fill(B, 2);
+		fill(C, 3);
+		F const a = wide<F>::load(&A[0]), b = wide<F>::load(&B[0]), c = wide<F>::load(&C[0]);
+
+		std::vector<float> Stored(8, 0.0f);
+		glm::store(a, &Stored[0]);
+		for(glm::length_t i = 0; i < Lanes; ++i)
+			Error += Stored[i] == A[i] && a[i] == A[i] ? 0 : 1;
+
+		double Sum[8], Product[8], Quotient[8], Fma[8], Neg[8], Min[8], Max[8], Abs[8], Sqrt[8], Broadcast[8];
+		int Less = 0, Greater = 0, Equal = 0;
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			Sum[i] = double(A[i]) + B[i];
+			Product[i] = double(A[i]) * B[i];
+			Quotient[i] = double(A[i]) / (B[i] == 0.0f ? 1.0f : B[i]);
+			Fma[i] = double(A[i]) * B[i] + C[i];
+			Neg[i] = -double(A[i]);
+			Min[i] = A[i] < B[i] ? A[i] : B[i];
+			Max[i] = A[i] < B[i] ? B[i] : A[i];
+			Abs[i] = std::abs(double(A[i]));
+			Sqrt[i] = std::sqrt(std::abs(double(A[i])));
+			Broadcast[i] = 1.5;
+			Less |= (A[i] < B[i] ? 1 : 0) << i;
+			Greater |= (A[i] > B[i] ? 1 : 0) << i;
+			Equal |= (A[i] == A[i] ? 1 : 0) << i;
+		}
+
+		std::vector<float> Divisor(B);
+		for(std::size_t i = 0; i < Divisor.size(); ++i)
+			Divisor[i] = Divisor[i] == 0.0f ? 1.0f : Divisor[i];
+
+		Error += check(a + b, Sum);
+		Error += check(a * b, Product);
+		Error += check(a / wide<F>::load(&Divisor[0]), Quotient);
+		Error += check(glm::fma(a, b, c), Fma);
+		Error += check(-a, Neg);
+		Error += check(glm::min(a, b), Min);
+		Error += check(glm::max(a, b), Max);
+		Error += check(glm::abs(a), Abs);
+		Error += check(glm::sqrt(glm::abs(a)), Sqrt);
+		Error += check(F(1.5f), Broadcast);
+
+		Error += glm::laneMask(glm::lessThan(a, b)) == Less ? 0 : 1;
+		Error += glm::laneMask(glm::greaterThan(a, b)) == Greater ? 0 : 1;
+		Error += glm::laneMask(glm::lessThanEqual(a, b)) == (Less | (~Greater & Equal)) ? 0 : 1;
+		Error += glm::laneMask(glm::greaterThanEqual(a, a)) == Equal ? 0 : 1;
+		Error += glm::laneMask(glm::lessThan(a, b) | glm::greaterThan(a, b)) == (Less | Greater) ? 0 : 1;
+		Error += glm::laneMask(glm::lessThan(a, b) & glm::greaterThan(a, b)) == 0 ? 0 : 1;
+		Error += glm::all(glm::lessThanEqual(a, a)) ? 0 : 1;
+		Error += glm::any(glm::lessThan(a, a)) ? 1 : 0;
+		Error += glm::any(glm::lessThan(a, b)) == (Less != 0) ? 0 : 1;
+
+		F const Selected = glm::select(glm::lessThan(a, b), a, b);
+		Error += check(Selected, Min);
+
+		return Error;
+	}
+
+	// Both accuracies are far within the tolerance of close
+	template <typename F, glm::precision P>
+	int test_transcendental()
+	{
+		int Error = 0;
+		glm::length_t const Lanes = F::length();
+
+		std::vector<float> A(8), B(8), Positive(8);
+		fill(A, 1);
+		fill(B, 2);
+		for(glm::length_t i = 0; i < Lanes; ++i)
+			Positive[i] = std::abs(A[i]) + 0.25f;
+		F const a = wide<F>::load(&A[0]), b = wide<F>::load(&B[0]), p = wide<F>::load(&Positive[0]);
+
+		double Sin[8], Cos[8], Acos[8], Atan[8], Exp[8], Log[8], Pow[8];
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			Sin[i] = std::sin(double(A[i]));
+			Cos[i] = std::cos(double(A[i]));
+			Acos[i] = std::acos(double(A[i] * 0.25f));
+			Atan[i] = std::atan2(double(A[i]), double(B[i]));
+			Exp[i] = std::exp(double(A[i]));
+			Log[i] = std::log(double(Positive[i]));
+			Pow[i] = std::pow(double(Positive[i]), double(B[i]));
+		}
+
+		F s, c;
+		glm::sincos<P>(a, s, c);
+		Error += check(s, Sin);
+		Error += check(c, Cos);
+		Error += check(glm::sin<P>(a), Sin);
+		Error += check(glm::cos<P>(a), Cos);
+		Error += check(glm::acos<P>(a * F(0.25f)), Acos);
+		Error += check(glm::atan<P>(a, b), Atan);
+		Error += check(glm::exp<P>(a), Exp);
+		Error += check(glm::log<P>(p), Log);
+
+		glm::sincos(a, s, c);
+		Error += check(s, Sin);
+		Error += check(c, Cos);
+		Error += check(glm::sin(a), Sin);
+		Error += check(glm::acos(a * F(0.25f)), Acos);
+		Error += check(glm::atan(a, b), Atan);
+		Error += check(glm::log(p), Log);
+		Error += check(glm::pow(p, b), Pow);
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+		Error += test<glm::floatx4>();
+		Error += test<glm::floatx8>();
+		Error += test_transcendental<glm::floatx4, glm::highp>();
+		Error += test_transcendental<glm::floatx8, glm::highp>();
+		Error += test_transcendental<glm::floatx4, glm::lowp>();
+		Error += test_transcendental<glm::floatx8, glm::lowp>();
+		return Error;
+	}
+}//namespace lanes
+
+namespace vector
+{
+	template <typename F>
+	int test()
+	{
+		int Error = 0;
+		glm::length_t const Lanes = F::length();
+
+		std::vector<float> A(8 * 4), B(8 * 4), T(8);
+		fill(A, 4);
+		fill(B, 5);
+		for(std::size_t i = 0; i < T.size(); ++i)
+			T[i] = static_cast<float>(i) / 7.0f;
+		// Not a zero vector, for normalize
+		A[0] = A[1] = 1.0f;
+
+		glm::vec3 const * A3 = reinterpret_cast<glm::vec3 const *>(&A[0]);
+		glm::vec3 const * B3 = reinterpret_cast<glm::vec3 const *>(&B[0]);
+		glm::tvec3x<F> const a = wide<F>::load(A3), b = wide<F>::load(B3);
+		F const t = wide<F>::load(&T[0]);
+
+		double Dot[8], Length[8], Cross[3][8], Normalized[3][8], Mix[3][8], Sum[3][8], Scaled[3][8];
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			double const ax = A[i * 3 + 0], ay = A[i * 3 + 1], az = A[i * 3 + 2];
+			double const bx = B[i * 3 + 0], by = B[i * 3 + 1], bz = B[i * 3 + 2];
+			Dot[i] = ax * bx + ay * by + az * bz;
+			Length[i] = std::sqrt(ax * ax + ay * ay + az * az);
+			Cross[0][i] = ay * bz - by * az;
+			Cross[1][i] = az * bx - bz * ax;
+			Cross[2][i] = ax * by - bx * ay;
+			Normalized[0][i] = ax / Length[i];
+			Normalized[1][i] = ay / Length[i];
+			Normalized[2][i] = az / Length[i];
+			Mix[0][i] = ax + (bx - ax) * T[i];
+			Mix[1][i] = ay + (by - ay) * T[i];
+			Mix[2][i] = az + (bz - az) * T[i];
+			Sum[0][i] = ax + bx;
+			Sum[1][i] = ay + by;
+			Sum[2][i] = az + bz;
+			Scaled[0][i] = (ax - bx) * T[i];
+			Scaled[1][i] = (ay - by) * T[i];
+			Scaled[2][i] = (az - bz) * T[i];
+		}
+
+		Error += check(glm::dot(a, b), Dot);
+		Error += check(glm::length(a), Length);
+
+		glm::tvec3x<F> const Results[] = {glm::cross(a, b), glm::normalize(a), glm::mix(a, b, t), a + b, (a - b) * t};
+		double const (*Expected[])[8] = {Cross, Normalized, Mix, Sum, Scaled};
+		for(std::size_t r = 0; r < sizeof(Results) / sizeof(Results[0]); ++r)
+		{
+			Error += check(Results[r].x, Expected[r][0]);
+			Error += check(Results[r].y, Expected[r][1]);
+			Error += check(Results[r].z, Expected[r][2]);
+		}
+
+		// Round trip through the AoS layout
+		std::vector<float> Out(8 * 3, 0.0f);
+		glm::store(a, reinterpret_cast<glm::vec3 *>(&Out[0]));
+		for(glm::length_t i = 0; i < Lanes * 3; ++i)
+			Error += Out[i] == A[i] ? 0 : 1;
+
+		glm::vec4 const * A4 = reinterpret_cast<glm::vec4 const *>(&A[0]);
+		glm::tvec4x<F> const a4 = wide<F>::load(A4);
+		std::vector<float> Out4(8 * 4, 0.0f);
+		glm::store(glm::normalize(a4), reinterpret_cast<glm::vec4 *>(&Out4[0]));
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			double SquaredLength = 0.0;
+			for(int j = 0; j < 4; ++j)
+				SquaredLength += double(A[i * 4 + j]) * A[i * 4 + j];
+			for(int j = 0; j < 4; ++j)
+				Error += close(Out4[i * 4 + j], A[i * 4 + j] / std::sqrt(SquaredLength)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+		Error += test<glm::floatx4>();
+		Error += test<glm::floatx8>();
+		return Error;
+	}
+}//namespace vector
+
+namespace quaternion
+{
+	bool close(glm::quat const & a, glm::quat const & b)
+	{
+		return ::close(a.x, b.x) && ::close(a.y, b.y) && ::close(a.z, b.z) && ::close(a.w, b.w);
+	}
+
+	template <typename F>
+	int test()
+	{
+		int Error = 0;
+		glm::length_t const Lanes = F::length();
+
+		// Pairs from opposite hemispheres, nearly equal and exactly equal, to cover each slerp path
+		std::vector<glm::quat> P(8), Q(8);
+		std::vector<glm::vec3> V(8);
+		std::vector<float> T(8);
+		for(glm::length_t i = 0; i < 8; ++i)
+		{
+			P[i] = glm::angleAxis(0.3f * static_cast<float>(i) - 1.0f, glm::normalize(glm::vec3(1.0f, static_cast<float>(i), 2.0f)));
+			Q[i] = glm::angleAxis(1.7f - 0.4f * static_cast<float>(i), glm::normalize(glm::vec3(-1.0f, 0.5f, static_cast<float>(i) - 3.0f)));
+			V[i] = glm::vec3(static_cast<float>(i) - 4.0f, 1.0f, 0.5f * static_cast<float>(i));
+			T[i] = static_cast<float>(i) / 7.0f;
+		}
+		Q[1] = -Q[1];
+		Q[2] = P[2];
+		Q[3] = glm::normalize(glm::quat(P[3].w, P[3].x + 1e-4f, P[3].y, P[3].z));
+
+		glm::tquatx<F> const p = wide<F>::load(&P[0]), q = wide<F>::load(&Q[0]);
+		glm::tvec3x<F> const v = wide<F>::load(&V[0]);
+		F const t = wide<F>::load(&T[0]);
+
+		std::vector<glm::quat> Product(8), Slerp(8), Normalized(8), Conjugate(8);
+		std::vector<glm::vec3> Rotated(8);
+		std::vector<glm::mat4> Matrix(8);
+		glm::store(p * q, &Product[0]);
+		glm::store(glm::slerp(p, q, t), &Slerp[0]);
+		glm::store(glm::normalize(p), &Normalized[0]);
+		glm::store(glm::conjugate(p), &Conjugate[0]);
+		glm::store(p * v, &Rotated[0]);
+
+		glm::tmat4x<F> const m = glm::mat4_cast(p);
+		for(glm::length_t c = 0; c < 4; ++c)
+		{
+			std::vector<glm::vec4> Column(8);
+			glm::store(m[c], &Column[0]);
+			for(glm::length_t i = 0; i < Lanes; ++i)
+				Matrix[i][c] = Column[i];
+		}
+
+		F const Dot = glm::dot(p, q);
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			Error += close(Product[i], P[i] * Q[i]) ? 0 : 1;
+			Error += close(Slerp[i], glm::slerp(P[i], Q[i], T[i])) ? 0 : 1;
+			Error += close(Normalized[i], glm::normalize(P[i])) ? 0 : 1;
+			Error += close(Conjugate[i], glm::conjugate(P[i])) ? 0 : 1;
+			Error += ::close(Dot[i], glm::dot(P[i], Q[i])) ? 0 : 1;
+
+			glm::vec3 const r = P[i] * V[i];
+			Error += ::close(Rotated[i].x, r.x) && ::close(Rotated[i].y, r.y) && ::close(Rotated[i].z, r.z) ? 0 : 1;
+
+			glm::mat4 const Expected = glm::mat4_cast(P[i]);
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+				Error += ::close(Matrix[i][c][r], Expected[c][r]) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+		Error += test<glm::floatx4>();
+		Error += test<glm::floatx8>();
+		return Error;
+	}
+}//namespace quaternion
+
+namespace matrix
+{
+	template <typename F>
+	int test()
+	{
+		int Error = 0;
+		glm::length_t const Lanes = F::length();
+
+		// Lane i of column c of a is A[(i * 4 + c) * 4 + r]: 8 column major matrices
+		std::vector<float> A(8 * 16), B(8 * 16), V(8 * 4);
+		fill(A, 6);
+		fill(B, 7);
+		fill(V, 8);
+
+		glm::mat4 const * A16 = reinterpret_cast<glm::mat4 const *>(&A[0]);
+		glm::mat4 const * B16 = reinterpret_cast<glm::mat4 const *>(&B[0]);
+		glm::tmat4x<F> a, b;
+		for(glm::length_t c = 0; c < 4; ++c)
+		{
+			std::vector<glm::vec4> ColumnA(8), ColumnB(8);
+			for(glm::length_t i = 0; i < 8; ++i)
+			{
+				ColumnA[i] = A16[i][c];
+				ColumnB[i] = B16[i][c];
+			}
+			a[c] = wide<F>::load(&ColumnA[0]);
+			b[c] = wide<F>::load(&ColumnB[0]);
+		}
+		glm::tvec4x<F> const v = wide<F>::load(reinterpret_cast<glm::vec4 const *>(&V[0]));
+		glm::tvec3x<F> const p(v.x, v.y, v.z);
+
+		glm::tmat4x<F> const ab = a * b;
+		glm::tvec4x<F> const av = a * v;
+		glm::tvec3x<F> const ap = glm::transformPoint(a, p);
+
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			float const * Ma = &A[i * 16];
+			float const * Mb = &B[i * 16];
+			float const * Vi = &V[i * 4];
+			for(int r = 0; r < 4; ++r)
+			{
+				double Expected = 0.0, Point = r < 3 ? Ma[12 + r] : 0.0;
+				for(int k = 0; k < 4; ++k)
+					Expected += double(Ma[k * 4 + r]) * Vi[k];
+				for(int k = 0; k < 3; ++k)
+					Point += double(Ma[k * 4 + r]) * Vi[k];
+				float const Lane[] = {av.x[i], av.y[i], av.z[i], av.w[i]};
+				Error += ::close(Lane[r], Expected) ? 0 : 1;
+				if(r < 3)
+				{
+					float const PointLane[] = {ap.x[i], ap.y[i], ap.z[i]};
+					Error += ::close(PointLane[r], Point) ? 0 : 1;
+				}
+
+				for(int c = 0; c < 4; ++c)
+				{
+					double Product = 0.0;
+					for(int k = 0; k < 4; ++k)
+						Product += double(Ma[k * 4 + r]) * Mb[c * 4 + k];
+					float const Column[] = {ab[c].x[i], ab[c].y[i], ab[c].z[i], ab[c].w[i]};
+					Error += ::close(Column[r], Product) ? 0 : 1;
+				}
+			}
+		}
+
+		return Error;
+	}
+
+	int test_load_store()
+	{
+		int Error = 0;
+
+		std::vector<float> A(8 * 16), Out(8 * 16, 0.0f);
+		fill(A, 9);
+		glm::mat4x8 const m = glm::make_mat4x8(reinterpret_cast<glm::mat4 const *>(&A[0]));
+		glm::store(m, reinterpret_cast<glm::mat4 *>(&Out[0]));
+		for(std::size_t i = 0; i < A.size(); ++i)
+			Error += Out[i] == A[i] ? 0 : 1;
+
+		// A matrix broadcast to every lane
+		glm::mat4 const M = reinterpret_cast<glm::mat4 const *>(&A[0])[1];
+		glm::mat4x8 const Broadcast(M);
+		for(glm::length_t i = 0; i < 8; ++i)
+			Error += Broadcast[3].y[i] == M[3].y ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+		Error += test<glm::floatx4>();
+		Error += test<glm::floatx8>();
+		Error += test_load_store();
+		return Error;
+	}
+}//namespace matrix
+
+namespace perf
+{
+	// Small enough to stay in L2, so that the arithmetic is measured rather than the memory
+	std::size_t const Count = 1 << 12;
+	std::size_t const Laps = 1 << 11;
+
+	struct data
+	{
+		std::vector<glm::vec3> A, B, Out;
+		std::vector<glm::quat> P, Q, OutQ;
+		std::vector<float> T;
+		// The same values as SoA
+		std::vector<float> Ax, Ay, Az, Bx, By, Bz, Ox, Oy, Oz, Pw, Px, Py, Pz, Qw, Qx, Qy, Qz, Ow;
+
+		data() :
+			A(Count), B(Count), Out(Count), P(Count), Q(Count), OutQ(Count), T(Count),
+			Ax(Count), Ay(Count), Az(Count), Bx(Count), By(Count), Bz(Count), Ox(Count), Oy(Count), Oz(Count),
+			Pw(Count), Px(Count), Py(Count), Pz(Count), Qw(Count), Qx(Count), Qy(Count), Qz(Count), Ow(Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float const f = static_cast<float>(i % 97) * 0.1f;
+				A[i] = glm::vec3(f - 3.0f, 1.0f + f * 0.5f, 2.0f - f);
+				B[i] = glm::vec3(0.5f, f - 4.0f, f * 0.25f + 1.0f);
+				P[i] = glm::angleAxis(f, glm::normalize(glm::vec3(1.0f, f, 2.0f)));
+				Q[i] = glm::angleAxis(1.0f - f, glm::normalize(glm::vec3(-1.0f, 0.5f, f)));
+				T[i] = static_cast<float>(i % 13) / 12.0f;
+				Ax[i] = A[i].x; Ay[i] = A[i].y; Az[i] = A[i].z;
+				Bx[i] = B[i].x; By[i] = B[i].y; Bz[i] = B[i].z;
+				Pw[i] = P[i].w; Px[i] = P[i].x; Py[i] = P[i].y; Pz[i] = P[i].z;
+				Qw[i] = Q[i].w; Qx[i] = Q[i].x; Qy[i] = Q[i].y; Qz[i] = Q[i].z;
+			}
+		}
+	};
+
+	template <typename F>
+	struct kernel
+	{
+		static glm::tvec3x<F> load3(float const * x, float const * y, float const * z, std::size_t i)
+		{
+			return glm::tvec3x<F>(wide<F>::load(x + i), wide<F>::load(y + i), wide<F>::load(z + i));
+		}
+
+		static glm::tquatx<F> loadq(float const * w, float const * x, float const * y, float const * z, std::size_t i)
+		{
+			return glm::tquatx<F>(wide<F>::load(w + i), wide<F>::load(x + i), wide<F>::load(y + i), wide<F>::load(z + i));
+		}
+
+		static void store3(glm::tvec3x<F> const & v, data & d, std::size_t i)
+		{
+			glm::store(v.x, &d.Ox[i]);
+			glm::store(v.y, &d.Oy[i]);
+			glm::store(v.z, &d.Oz[i]);
+		}
+
+		static void normal(data & d)
+		{
+			for(std::size_t i = 0; i < Count; i += F::length())
+				store3(glm::normalize(glm::cross(load3(&d.Ax[0], &d.Ay[0], &d.Az[0], i), load3(&d.Bx[0], &d.By[0], &d.Bz[0], i))), d, i);
+		}
+
+		static void rotate(data & d)
+		{
+			for(std::size_t i = 0; i < Count; i += F::length())
+				store3(loadq(&d.Pw[0], &d.Px[0], &d.Py[0], &d.Pz[0], i) * load3(&d.Ax[0], &d.Ay[0], &d.Az[0], i), d, i);
+		}
+
+		// Bounding spheres at A, radius Bx, against the planes (Q.xyz, Q.w) of 6 frustums at a time
+		static int cull(data & d)
+		{
+			int Visible = 0;
+			for(std::size_t i = 0; i < Count; i += F::length())
+			{
+				glm::tvec3x<F> const Center = load3(&d.Ax[0], &d.Ay[0], &d.Az[0], i);
+				F const Radius = -glm::abs(wide<F>::load(&d.Bx[0] + i));
+				F Inside = glm::lessThanEqual(Radius, Radius);
+				for(std::size_t Plane = 0; Plane < 6; ++Plane)
+				{
+					glm::tvec3x<F> const Normal(glm::vec3(d.Q[Plane].x, d.Q[Plane].y, d.Q[Plane].z));
+					Inside = Inside & glm::greaterThanEqual(glm::dot(Normal, Center) + F(d.Q[Plane].w), Radius);
+				}
+				int Mask = glm::laneMask(Inside);
+				for(; Mask; Mask &= Mask - 1)
+					++Visible;
+			}
+			return Visible;
+		}
+
+		static void slerp(data & d)
+		{
+			for(std::size_t i = 0; i < Count; i += F::length())
+			{
+				glm::tquatx<F> const r = glm::slerp(
+					loadq(&d.Pw[0], &d.Px[0], &d.Py[0], &d.Pz[0], i),
+					loadq(&d.Qw[0], &d.Qx[0], &d.Qy[0], &d.Qz[0], i),
+					wide<F>::load(&d.T[0] + i));
+				glm::store(r.w, &d.Ow[i]);
+				glm::store(r.x, &d.Ox[i]);
+				glm::store(r.y, &d.Oy[i]);
+				glm::store(r.z, &d.Oz[i]);
+			}
+		}
+	};
+
+	struct aos
+	{
+		static void normal(data & d)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				d.Out[i] = glm::normalize(glm::cross(d.A[i], d.B[i]));
+		}
+
+		static void rotate(data & d)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				d.Out[i] = d.P[i] * d.A[i];
+		}
+
+		static int cull(data & d)
+		{
+			int Visible = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				bool Inside = true;
+				for(std::size_t Plane = 0; Plane < 6; ++Plane)
+					Inside = Inside && glm::dot(glm::vec3(d.Q[Plane].x, d.Q[Plane].y, d.Q[Plane].z), d.A[i]) + d.Q[Plane].w >= -glm::abs(d.B[i].x);
+				Visible += Inside ? 1 : 0;
+			}
+			return Visible;
+		}
+
+		static void slerp(data & d)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				d.OutQ[i] = glm::slerp(d.P[i], d.Q[i], d.T[i]);
+		}
+	};
+
+	double nanoseconds(std::clock_t Ticks)
+	{
+		return static_cast<double>(Ticks) / CLOCKS_PER_SEC * 1e9 / static_cast<double>(Count * Laps);
+	}
+
+	template <typename K>
+	void run(data & d, double * Time, int & Visible)
+	{
+		std::clock_t StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+			K::normal(d);
+		Time[0] = nanoseconds(std::clock() - StartTime);
+
+		StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+			K::rotate(d);
+		Time[1] = nanoseconds(std::clock() - StartTime);
+
+		StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+			Visible += K::cull(d);
+		Time[2] = nanoseconds(std::clock() - StartTime);
+
+		StartTime = std::clock();
+		for(std::size_t Lap = 0; Lap < Laps; ++Lap)
+			K::slerp(d);
+		Time[3] = nanoseconds(std::clock() - StartTime);
+	}
+
+	int test()
+	{
+		int Error = 0;
+		data d;
+
+		double Time[3][4];
+		int Visible[3] = {0, 0, 0};
+		run<aos>(d, Time[0], Visible[0]);
+		run<kernel<glm::floatx4> >(d, Time[1], Visible[1]);
+		run<kernel<glm::floatx8> >(d, Time[2], Visible[2]);
+
+		char const * Names[] = {"normalize(cross)", "quat * vec3", "sphere culling", "slerp"};
+		std::printf("%d elements, ns per element and speedup over the vec3 path\n", static_cast<int>(Count));
+		std::printf("%18s %10s %10s %10s %8s %8s\n", "", "vec3", "x4", "x8", "x4", "x8");
+		for(int i = 0; i < 4; ++i)
+			std::printf("%18s %10.3f %10.3f %10.3f %8.2f %8.2f\n", Names[i],
+				Time[0][i], Time[1][i], Time[2][i], Time[0][i] / Time[1][i], Time[0][i] / Time[2][i]);
+		std::printf("visible: %d %d %d, checksum: %f\n", Visible[0], Visible[1], Visible[2], d.Out[Count / 2].x + d.Ox[Count / 2] + d.OutQ[Count / 3].w + d.Ow[Count / 3]);
+
+		return Error;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error(0);
+
+	Error += lanes::test();
+	Error += vector::test();
+	Error += quaternion::test();
+	Error += matrix::test();
+#	ifdef NDEBUG
+	Error += perf::test();
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,734 @@
+/// Microbenchmarks of the glm/simd/*.h kernels and of the core operations built on them.
+///
+/// The same source is built once per instruction set (see CMakeLists.txt), each executable
+/// labels its results with the GLM_ARCH it was compiled for. Usage:
+///
+///	perf-simd-<arch> [--baseline FILE] [--threshold RATIO] [--record FILE] [--filter TEXT]
+///
+///	--baseline: compare with the ns/op stored for this instruction set, and fail when a
+///	            benchmark is slower than its baseline times RATIO, 1.5 by default. The
+///	            speedup over the 'pure' baseline is printed when there is one.
+///	--record:   write this run into FILE as the baseline of this instruction set, keeping
+///	            the lines of the other ones.
+///	--filter:   only run the benchmarks whose name contains TEXT.
+///
+/// Baselines are only meaningful on the machine that recorded them.
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include <glm/simd/common.h>
+#	include <glm/simd/exponential.h>
+#	include <glm/simd/geometric.h>
+#	include <glm/simd/integer.h>
+#	include <glm/simd/matrix.h>
+#	include <glm/simd/trigonometric.h>
+#endif
+
+// A named namespace: with internal linkage, the compiler would see that the outputs are never
+// read and drop the loops
+namespace perf
+{
+	// Elements per pass, small enough that every input and output stays in L1
+	std::size_t const WorkingSet = 256;
+
+#	if GLM_HAS_ALIGNED_TYPE
+		typedef glm::tvec3<float, glm::aligned_highp> vec3;
+		typedef glm::tvec4<float, glm::aligned_highp> vec4;
+		typedef glm::tvec4<int, glm::aligned_highp> ivec4;
+		typedef glm::tvec4<double, glm::aligned_highp> dvec4;
+		typedef glm::tmat4x4<float, glm::aligned_highp> mat4;
+		typedef glm::tmat4x4<double, glm::aligned_highp> dmat4;
+		typedef glm::tquat<float, glm::aligned_highp> quat;
+		typedef glm::tvec4<float, glm::aligned_lowp> lowp_vec4;
+#	else
+		typedef glm::vec3 vec3;
+		typedef glm::vec4 vec4;
+		typedef glm::ivec4 ivec4;
+		typedef glm::dvec4 dvec4;
+		typedef glm::mat4 mat4;
+		typedef glm::dmat4 dmat4;
+		typedef glm::quat quat;
+		typedef glm::lowp_vec4 lowp_vec4;
+#	endif
+
+	vec3 InVec3A[WorkingSet], InVec3B[WorkingSet], OutVec3[WorkingSet];
+	vec4 InVec4A[WorkingSet], InVec4B[WorkingSet], InVec4C[WorkingSet], OutVec4[WorkingSet];
+	ivec4 InIVec4[WorkingSet], OutIVec4[WorkingSet];
+	glm::bvec4 OutBVec4[WorkingSet];
+	float OutFloat[WorkingSet];
+	dvec4 InDVec4[WorkingSet], OutDVec4[WorkingSet];
+	mat4 InMat4A[WorkingSet], InMat4B[WorkingSet], OutMat4[WorkingSet];
+	dmat4 InDMat4A[WorkingSet], InDMat4B[WorkingSet], OutDMat4[WorkingSet];
+	quat InQuatA[WorkingSet], InQuatB[WorkingSet], OutQuat[WorkingSet];
+	lowp_vec4 InLowpA[WorkingSet], InLowpB[WorkingSet], InLowpC[WorkingSet], OutLowp[WorkingSet];
+	glm::vec4 InPack[WorkingSet], OutPack[WorkingSet];
+	glm::uint32 InPack32[WorkingSet], OutPack32[WorkingSet];
+	glm::uint64 InPack64[WorkingSet], OutPack64[WorkingSet];
+
+	float random_float(float Min, float Max)
+	{
+		return Min + (Max - Min) * static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+	}
+
+	vec4 random_vec4(float Min, float Max)
+	{
+		return vec4(random_float(Min, Max), random_float(Min, Max), random_float(Min, Max), random_float(Min, Max));
+	}
+
+	mat4 random_mat4()
+	{
+		mat4 Result(1.0f);
+		for(int c = 0; c < 4; ++c)
+			Result[c] += random_vec4(-0.5f, 0.5f);
+		return Result;
+	}
+
+	void init_core()
+	{
+		for(std::size_t i = 0; i < WorkingSet; ++i)
+		{
+			InVec3A[i] = vec3(random_vec4(-10.f, 10.f));
+			InVec3B[i] = vec3(random_vec4(-10.f, 10.f));
+			InVec4A[i] = random_vec4(-10.f, 10.f);
+			InVec4B[i] = random_vec4(0.5f, 10.f);
+			InVec4C[i] = random_vec4(0.f, 1.f);
+			InIVec4[i] = ivec4(random_vec4(-1000.f, 1000.f));
+			InDVec4[i] = dvec4(random_vec4(-10.f, 10.f));
+			InMat4A[i] = random_mat4();
+			InMat4B[i] = random_mat4();
+			InDMat4A[i] = dmat4(random_mat4());
+			InDMat4B[i] = dmat4(random_mat4());
+			InQuatA[i] = glm::normalize(quat(random_float(-1.f, 1.f), random_float(-1.f, 1.f), random_float(-1.f, 1.f), random_float(-1.f, 1.f)));
+			InQuatB[i] = glm::normalize(quat(random_float(-1.f, 1.f), random_float(-1.f, 1.f), random_float(-1.f, 1.f), random_float(-1.f, 1.f)));
+			InPack[i] = glm::vec4(random_vec4(-1.f, 1.f));
+			InPack32[i] = static_cast<glm::uint32>(std::rand());
+			InPack64[i] = (static_cast<glm::uint64>(std::rand()) << 32) | static_cast<glm::uint64>(std::rand());
+			InLowpA[i] = lowp_vec4(InVec4A[i]);
+			InLowpB[i] = lowp_vec4(InVec4B[i]);
+			InLowpC[i] = lowp_vec4(InVec4C[i]);
+		}
+	}
+
+#	define GLM_PERF_LOOP(Name, Statement) \
+		void Name() \
+		{ \
+			for(std::size_t i = 0; i < WorkingSet; ++i) \
+				Statement; \
+		}
+
+	// -- Core operations, in every build --
+
+	GLM_PERF_LOOP(core_vec4_add, OutVec4[i] = InVec4A[i] + InVec4B[i])
+	GLM_PERF_LOOP(core_vec4_mul, OutVec4[i] = InVec4A[i] * InVec4B[i])
+	GLM_PERF_LOOP(core_vec4_div, OutVec4[i] = InVec4A[i] / InVec4B[i])
+	GLM_PERF_LOOP(core_vec4_abs, OutVec4[i] = glm::abs(InVec4A[i]))
+	GLM_PERF_LOOP(core_ivec4_abs, OutIVec4[i] = glm::abs(InIVec4[i]))
+	GLM_PERF_LOOP(core_vec4_sign, OutVec4[i] = glm::sign(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_floor, OutVec4[i] = glm::floor(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_ceil, OutVec4[i] = glm::ceil(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_round, OutVec4[i] = glm::round(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_roundEven, OutVec4[i] = glm::roundEven(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_trunc, OutVec4[i] = glm::trunc(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_fract, OutVec4[i] = glm::fract(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_mod, OutVec4[i] = glm::mod(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_min, OutVec4[i] = glm::min(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_max, OutVec4[i] = glm::max(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_clamp, OutVec4[i] = glm::clamp(InVec4A[i], -InVec4B[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_mix, OutVec4[i] = glm::mix(InVec4A[i], InVec4B[i], InVec4C[i]))
+	GLM_PERF_LOOP(core_vec4_step, OutVec4[i] = glm::step(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_smoothstep, OutVec4[i] = glm::smoothstep(-InVec4B[i], InVec4B[i], InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_isnan, OutBVec4[i] = glm::isnan(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_isinf, OutBVec4[i] = glm::isinf(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_sqrt, OutVec4[i] = glm::sqrt(InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_inversesqrt, OutVec4[i] = glm::inversesqrt(InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_sin, OutVec4[i] = glm::sin(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_cos, OutVec4[i] = glm::cos(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_acos, OutVec4[i] = glm::acos(InVec4C[i]))
+	GLM_PERF_LOOP(core_vec4_atan2, OutVec4[i] = glm::atan(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_exp, OutVec4[i] = glm::exp(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_log, OutVec4[i] = glm::log(InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_pow, OutVec4[i] = glm::pow(InVec4B[i], InVec4A[i]))
+	GLM_PERF_LOOP(core_lowp_vec4_sin, OutLowp[i] = glm::sin(InLowpA[i]))
+	GLM_PERF_LOOP(core_lowp_vec4_cos, OutLowp[i] = glm::cos(InLowpA[i]))
+	GLM_PERF_LOOP(core_lowp_vec4_acos, OutLowp[i] = glm::acos(InLowpC[i]))
+	GLM_PERF_LOOP(core_lowp_vec4_atan2, OutLowp[i] = glm::atan(InLowpA[i], InLowpB[i]))
+	GLM_PERF_LOOP(core_lowp_vec4_exp, OutLowp[i] = glm::exp(InLowpA[i]))
+	GLM_PERF_LOOP(core_lowp_vec4_log, OutLowp[i] = glm::log(InLowpB[i]))
+	GLM_PERF_LOOP(core_vec4_dot, OutFloat[i] = glm::dot(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_length, OutFloat[i] = glm::length(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_distance, OutFloat[i] = glm::distance(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_vec4_normalize, OutVec4[i] = glm::normalize(InVec4A[i]))
+	GLM_PERF_LOOP(core_vec4_reflect, OutVec4[i] = glm::reflect(InVec4A[i], InVec4C[i]))
+	GLM_PERF_LOOP(core_vec4_refract, OutVec4[i] = glm::refract(InVec4A[i], InVec4C[i], 0.9f))
+	GLM_PERF_LOOP(core_vec4_faceforward, OutVec4[i] = glm::faceforward(InVec4A[i], InVec4B[i], InVec4C[i]))
+	GLM_PERF_LOOP(core_vec3_cross, OutVec3[i] = glm::cross(InVec3A[i], InVec3B[i]))
+	GLM_PERF_LOOP(core_mat4_add, OutMat4[i] = InMat4A[i] + InMat4B[i])
+	GLM_PERF_LOOP(core_mat4_sub, OutMat4[i] = InMat4A[i] - InMat4B[i])
+	GLM_PERF_LOOP(core_mat4_mul, OutMat4[i] = InMat4A[i] * InMat4B[i])
+	GLM_PERF_LOOP(core_mat4_mul_vec4, OutVec4[i] = InMat4A[i] * InVec4A[i])
+	GLM_PERF_LOOP(core_vec4_mul_mat4, OutVec4[i] = InVec4A[i] * InMat4A[i])
+	GLM_PERF_LOOP(core_mat4_matrixCompMult, OutMat4[i] = glm::matrixCompMult(InMat4A[i], InMat4B[i]))
+	GLM_PERF_LOOP(core_mat4_outerProduct, OutMat4[i] = glm::outerProduct(InVec4A[i], InVec4B[i]))
+	GLM_PERF_LOOP(core_mat4_transpose, OutMat4[i] = glm::transpose(InMat4A[i]))
+	GLM_PERF_LOOP(core_mat4_determinant, OutFloat[i] = glm::determinant(InMat4A[i]))
+	GLM_PERF_LOOP(core_mat4_inverse, OutMat4[i] = glm::inverse(InMat4A[i]))
+	GLM_PERF_LOOP(core_dmat4_mul, OutDMat4[i] = InDMat4A[i] * InDMat4B[i])
+	GLM_PERF_LOOP(core_dmat4_mul_dvec4, OutDVec4[i] = InDMat4A[i] * InDVec4[i])
+	GLM_PERF_LOOP(core_quat_mul, OutQuat[i] = InQuatA[i] * InQuatB[i])
+	GLM_PERF_LOOP(core_quat_mul_vec3, OutVec3[i] = InQuatA[i] * InVec3A[i])
+	GLM_PERF_LOOP(core_quat_normalize, OutQuat[i] = glm::normalize(InQuatA[i]))
+	GLM_PERF_LOOP(core_quat_slerp, OutQuat[i] = glm::slerp(InQuatA[i], InQuatB[i], 0.3f))
+	GLM_PERF_LOOP(core_quat_mat4_cast, OutMat4[i] = glm::mat4_cast(InQuatA[i]))
+	GLM_PERF_LOOP(core_quat_cast, OutQuat[i] = glm::quat_cast(InMat4A[i]))
+	GLM_PERF_LOOP(core_packUnorm4x8, OutPack32[i] = glm::packUnorm4x8(InPack[i]))
+	GLM_PERF_LOOP(core_unpackUnorm4x8, OutPack[i] = glm::unpackUnorm4x8(InPack32[i]))
+	GLM_PERF_LOOP(core_packSnorm4x8, OutPack32[i] = glm::packSnorm4x8(InPack[i]))
+	GLM_PERF_LOOP(core_unpackSnorm4x8, OutPack[i] = glm::unpackSnorm4x8(InPack32[i]))
+	GLM_PERF_LOOP(core_packHalf4x16, OutPack64[i] = glm::packHalf4x16(InPack[i]))
+	GLM_PERF_LOOP(core_unpackHalf4x16, OutPack[i] = glm::unpackHalf4x16(InPack64[i]))
+
+	// -- The kernels of glm/simd/*.h, in SSE2 and later builds --
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		glm_vec4 SimdA[WorkingSet], SimdB[WorkingSet], SimdC[WorkingSet], SimdOut[WorkingSet], SimdOutB[WorkingSet];
+		glm_ivec4 SimdInt[WorkingSet], SimdIntOut[WorkingSet];
+		glm_vec4 SimdMatA[WorkingSet][4], SimdMatB[WorkingSet][4], SimdMatOut[WorkingSet][4];
+
+		void init_simd()
+		{
+			for(std::size_t i = 0; i < WorkingSet; ++i)
+			{
+				SimdA[i] = InVec4A[i].data;
+				SimdB[i] = InVec4B[i].data;
+				SimdC[i] = InVec4C[i].data;
+				SimdInt[i] = InIVec4[i].data;
+				for(int c = 0; c < 4; ++c)
+				{
+					SimdMatA[i][c] = InMat4A[i][c].data;
+					SimdMatB[i][c] = InMat4B[i][c].data;
+				}
+			}
+		}
+
+		GLM_PERF_LOOP(simd_vec4_add, SimdOut[i] = glm_vec4_add(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec1_add, SimdOut[i] = glm_vec1_add(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_sub, SimdOut[i] = glm_vec4_sub(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec1_sub, SimdOut[i] = glm_vec1_sub(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_mul, SimdOut[i] = glm_vec4_mul(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec1_mul, SimdOut[i] = glm_vec1_mul(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_div, SimdOut[i] = glm_vec4_div(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec1_div, SimdOut[i] = glm_vec1_div(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_div_lowp, SimdOut[i] = glm_vec4_div_lowp(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_swizzle_xyzw, SimdOut[i] = glm_vec4_swizzle_xyzw(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec1_fma, SimdOut[i] = glm_vec1_fma(SimdA[i], SimdB[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_fma, SimdOut[i] = glm_vec4_fma(SimdA[i], SimdB[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_fms, SimdOut[i] = glm_vec4_fms(SimdA[i], SimdB[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_fnma, SimdOut[i] = glm_vec4_fnma(SimdA[i], SimdB[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_abs, SimdOut[i] = glm_vec4_abs(SimdA[i]))
+		GLM_PERF_LOOP(simd_ivec4_abs, SimdIntOut[i] = glm_ivec4_abs(SimdInt[i]))
+		GLM_PERF_LOOP(simd_vec4_inf, SimdOut[i] = glm_vec4_inf(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_nan, SimdOut[i] = glm_vec4_nan(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_sign, SimdOut[i] = glm_vec4_sign(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_round, SimdOut[i] = glm_vec4_round(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_floor, SimdOut[i] = glm_vec4_floor(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_roundEven, SimdOut[i] = glm_vec4_roundEven(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_ceil, SimdOut[i] = glm_vec4_ceil(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_fract, SimdOut[i] = glm_vec4_fract(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_mod, SimdOut[i] = glm_vec4_mod(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_clamp, SimdOut[i] = glm_vec4_clamp(SimdA[i], SimdC[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_mix, SimdOut[i] = glm_vec4_mix(SimdA[i], SimdB[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_step, SimdOut[i] = glm_vec4_step(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_smoothstep, SimdOut[i] = glm_vec4_smoothstep(SimdC[i], SimdB[i], SimdA[i]))
+		GLM_PERF_LOOP(simd_vec1_sqrt_lowp, SimdOut[i] = glm_vec1_sqrt_lowp(SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_sqrt_lowp, SimdOut[i] = glm_vec4_sqrt_lowp(SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_sin, SimdOut[i] = glm_vec4_sin(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_sin_lowp, SimdOut[i] = glm_vec4_sin_lowp(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_cos, SimdOut[i] = glm_vec4_cos(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_cos_lowp, SimdOut[i] = glm_vec4_cos_lowp(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_sincos, glm_vec4_sincos(SimdA[i], SimdOut[i], SimdOutB[i]))
+		GLM_PERF_LOOP(simd_vec4_sincos_lowp, glm_vec4_sincos_lowp(SimdA[i], SimdOut[i], SimdOutB[i]))
+		GLM_PERF_LOOP(simd_vec4_acos, SimdOut[i] = glm_vec4_acos(SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_acos_lowp, SimdOut[i] = glm_vec4_acos_lowp(SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_atan2, SimdOut[i] = glm_vec4_atan2(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_atan2_lowp, SimdOut[i] = glm_vec4_atan2_lowp(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_exp, SimdOut[i] = glm_vec4_exp(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_exp_lowp, SimdOut[i] = glm_vec4_exp_lowp(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_log, SimdOut[i] = glm_vec4_log(SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_log_lowp, SimdOut[i] = glm_vec4_log_lowp(SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_pow, SimdOut[i] = glm_vec4_pow(SimdB[i], SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_length, SimdOut[i] = glm_vec4_length(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_distance, SimdOut[i] = glm_vec4_distance(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_dot, SimdOut[i] = glm_vec4_dot(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec1_dot, SimdOut[i] = glm_vec1_dot(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_cross, SimdOut[i] = glm_vec4_cross(SimdA[i], SimdB[i]))
+		GLM_PERF_LOOP(simd_vec4_normalize, SimdOut[i] = glm_vec4_normalize(SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_faceforward, SimdOut[i] = glm_vec4_faceforward(SimdA[i], SimdB[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_reflect, SimdOut[i] = glm_vec4_reflect(SimdA[i], SimdC[i]))
+		GLM_PERF_LOOP(simd_vec4_refract, SimdOut[i] = glm_vec4_refract(SimdA[i], SimdC[i], _mm_set1_ps(0.9f)))
+		GLM_PERF_LOOP(simd_i128_interleave, SimdIntOut[i] = glm_i128_interleave(SimdInt[i]))
+		GLM_PERF_LOOP(simd_i128_interleave2, SimdIntOut[i] = glm_i128_interleave2(SimdInt[i], SimdInt[WorkingSet - 1 - i]))
+		GLM_PERF_LOOP(simd_mat4_add, glm_mat4_add(SimdMatA[i], SimdMatB[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_sub, glm_mat4_sub(SimdMatA[i], SimdMatB[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_mul, glm_mat4_mul(SimdMatA[i], SimdMatB[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_mul_vec4, SimdOut[i] = glm_mat4_mul_vec4(SimdMatA[i], SimdA[i]))
+		GLM_PERF_LOOP(simd_vec4_mul_mat4, SimdOut[i] = glm_vec4_mul_mat4(SimdA[i], SimdMatA[i]))
+		GLM_PERF_LOOP(simd_mat4_matrixCompMult, glm_mat4_matrixCompMult(SimdMatA[i], SimdMatB[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_outerProduct, glm_mat4_outerProduct(SimdA[i], SimdB[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_transpose, glm_mat4_transpose(SimdMatA[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_determinant, SimdOut[i] = glm_mat4_determinant(SimdMatA[i]))
+		GLM_PERF_LOOP(simd_mat4_determinant_highp, SimdOut[i] = glm_mat4_determinant_highp(SimdMatA[i]))
+		GLM_PERF_LOOP(simd_mat4_determinant_lowp, SimdOut[i] = glm_mat4_determinant_lowp(SimdMatA[i]))
+		GLM_PERF_LOOP(simd_mat4_inverse, glm_mat4_inverse(SimdMatA[i], SimdMatOut[i]))
+		GLM_PERF_LOOP(simd_mat4_inverse_lowp, glm_mat4_inverse_lowp(SimdMatA[i], SimdMatOut[i]))
+
+		// The 256-bit kernels do two elements per call, the loops count elements
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			std::size_t const WorkingSetX2 = WorkingSet / 2;
+
+#			define GLM_PERF_LOOP_X2(Name, Statement) \
+				void Name() \
+				{ \
+					for(std::size_t i = 0; i < WorkingSetX2; ++i) \
+						Statement; \
+				}
+
+			__m256 SimdX2A[WorkingSetX2], SimdX2B[WorkingSetX2], SimdX2C[WorkingSetX2], SimdX2Out[WorkingSetX2];
+			__m256 SimdMatX2A[WorkingSetX2][4], SimdMatX2B[WorkingSetX2][4], SimdMatX2Out[WorkingSetX2][4];
+			__m256d SimdDMat[WorkingSet][4], SimdDMatOut[WorkingSet][4], SimdDVecOut[WorkingSet];
+
+			void init_simd_x2()
+			{
+				for(std::size_t i = 0; i < WorkingSetX2; ++i)
+				{
+					SimdX2A[i] = _mm256_set_m128(SimdA[i * 2 + 1], SimdA[i * 2]);
+					SimdX2B[i] = _mm256_set_m128(SimdB[i * 2 + 1], SimdB[i * 2]);
+					SimdX2C[i] = _mm256_set_m128(SimdC[i * 2 + 1], SimdC[i * 2]);
+					for(int c = 0; c < 4; ++c)
+					{
+						SimdMatX2A[i][c] = _mm256_set_m128(SimdMatA[i * 2 + 1][c], SimdMatA[i * 2][c]);
+						SimdMatX2B[i][c] = _mm256_set_m128(SimdMatB[i * 2 + 1][c], SimdMatB[i * 2][c]);
+					}
+				}
+				for(std::size_t i = 0; i < WorkingSet; ++i)
+				for(int c = 0; c < 4; ++c)
+					SimdDMat[i][c] = _mm256_loadu_pd(&InDMat4A[i][c][0]);
+			}
+
+			GLM_PERF_LOOP_X2(simd_vec4x2_fma, SimdX2Out[i] = glm_vec4x2_fma(SimdX2A[i], SimdX2B[i], SimdX2C[i]))
+			GLM_PERF_LOOP_X2(simd_vec4x2_fms, SimdX2Out[i] = glm_vec4x2_fms(SimdX2A[i], SimdX2B[i], SimdX2C[i]))
+			GLM_PERF_LOOP_X2(simd_vec4x2_fnma, SimdX2Out[i] = glm_vec4x2_fnma(SimdX2A[i], SimdX2B[i], SimdX2C[i]))
+			GLM_PERF_LOOP_X2(simd_mat4_mul_vec4_x2, SimdX2Out[i] = glm_mat4_mul_vec4_x2(SimdMatX2A[i], SimdX2A[i]))
+			GLM_PERF_LOOP_X2(simd_mat4_mul_2vec4, SimdX2Out[i] = glm_mat4_mul_2vec4(SimdMatA[i * 2], SimdX2A[i]))
+			GLM_PERF_LOOP_X2(simd_mat4_mul_x2, glm_mat4_mul_x2(SimdMatX2A[i], SimdMatX2B[i], SimdMatX2Out[i]))
+			GLM_PERF_LOOP_X2(simd_mat4_inverse_x2, glm_mat4_inverse_x2(SimdMatX2A[i], SimdMatX2Out[i]))
+			GLM_PERF_LOOP(simd_dmat4_mul, glm_dmat4_mul(SimdDMat[i], &InDMat4B[i][0][0], SimdDMatOut[i]))
+			GLM_PERF_LOOP(simd_dmat4_mul_dvec4, SimdDVecOut[i] = glm_dmat4_mul_dvec4(SimdDMat[i], &InDVec4[i][0]))
+#		endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	struct benchmark
+	{
+		char const * Name;
+		void (*Run)();
+	};
+
+	// Not const, so that the compiler can't inline the loops into the timing code
+	benchmark Benchmarks[] =
+	{
+		{"core/vec4_add", core_vec4_add},
+		{"core/vec4_mul", core_vec4_mul},
+		{"core/vec4_div", core_vec4_div},
+		{"core/vec4_abs", core_vec4_abs},
+		{"core/ivec4_abs", core_ivec4_abs},
+		{"core/vec4_sign", core_vec4_sign},
+		{"core/vec4_floor", core_vec4_floor},
+		{"core/vec4_ceil", core_vec4_ceil},
+		{"core/vec4_round", core_vec4_round},
+		{"core/vec4_roundEven", core_vec4_roundEven},
+		{"core/vec4_trunc", core_vec4_trunc},
+		{"core/vec4_fract", core_vec4_fract},
+		{"core/vec4_mod", core_vec4_mod},
+		{"core/vec4_min", core_vec4_min},
+		{"core/vec4_max", core_vec4_max},
+		{"core/vec4_clamp", core_vec4_clamp},
+		{"core/vec4_mix", core_vec4_mix},
+		{"core/vec4_step", core_vec4_step},
+		{"core/vec4_smoothstep", core_vec4_smoothstep},
+		{"core/vec4_isnan", core_vec4_isnan},
+		{"core/vec4_isinf", core_vec4_isinf},
+		{"core/vec4_sqrt", core_vec4_sqrt},
+		{"core/vec4_inversesqrt", core_vec4_inversesqrt},
+		{"core/vec4_sin", core_vec4_sin},
+		{"core/vec4_cos", core_vec4_cos},
+		{"core/vec4_acos", core_vec4_acos},
+		{"core/vec4_atan2", core_vec4_atan2},
+		{"core/vec4_exp", core_vec4_exp},
+		{"core/vec4_log", core_vec4_log},
+		{"core/vec4_pow", core_vec4_pow},
+		{"core/lowp_vec4_sin", core_lowp_vec4_sin},
+		{"core/lowp_vec4_cos", core_lowp_vec4_cos},
+		{"core/lowp_vec4_acos", core_lowp_vec4_acos},
+		{"core/lowp_vec4_atan2", core_lowp_vec4_atan2},
+		{"core/lowp_vec4_exp", core_lowp_vec4_exp},
+		{"core/lowp_vec4_log", core_lowp_vec4_log},
+		{"core/vec4_dot", core_vec4_dot},
+		{"core/vec4_length", core_vec4_length},
+		{"core/vec4_distance", core_vec4_distance},
+		{"core/vec4_normalize", core_vec4_normalize},
+		{"core/vec4_reflect", core_vec4_reflect},
+		{"core/vec4_refract", core_vec4_refract},
+		{"core/vec4_faceforward", core_vec4_faceforward},
+		{"core/vec3_cross", core_vec3_cross},
+		{"core/mat4_add", core_mat4_add},
+		{"core/mat4_sub", core_mat4_sub},
+		{"core/mat4_mul", core_mat4_mul},
+		{"core/mat4_mul_vec4", core_mat4_mul_vec4},
+		{"core/vec4_mul_mat4", core_vec4_mul_mat4},
+		{"core/mat4_matrixCompMult", core_mat4_matrixCompMult},
+		{"core/mat4_outerProduct", core_mat4_outerProduct},
+		{"core/mat4_transpose", core_mat4_transpose},
+		{"core/mat4_determinant", core_mat4_determinant},
+		{"core/mat4_inverse", core_mat4_inverse},
+		{"core/dmat4_mul", core_dmat4_mul},
+		{"core/dmat4_mul_dvec4", core_dmat4_mul_dvec4},
+		{"core/quat_mul", core_quat_mul},
+		{"core/quat_mul_vec3", core_quat_mul_vec3},
+		{"core/quat_normalize", core_quat_normalize},
+		{"core/quat_slerp", core_quat_slerp},
+		{"core/quat_mat4_cast", core_quat_mat4_cast},
+		{"core/quat_cast", core_quat_cast},
+		{"core/packUnorm4x8", core_packUnorm4x8},
+		{"core/unpackUnorm4x8", core_unpackUnorm4x8},
+		{"core/packSnorm4x8", core_packSnorm4x8},
+		{"core/unpackSnorm4x8", core_unpackSnorm4x8},
+		{"core/packHalf4x16", core_packHalf4x16},
+		{"core/unpackHalf4x16", core_unpackHalf4x16},
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			{"simd/glm_vec4_add", simd_vec4_add},
+			{"simd/glm_vec1_add", simd_vec1_add},
+			{"simd/glm_vec4_sub", simd_vec4_sub},
+			{"simd/glm_vec1_sub", simd_vec1_sub},
+			{"simd/glm_vec4_mul", simd_vec4_mul},
+			{"simd/glm_vec1_mul", simd_vec1_mul},
+			{"simd/glm_vec4_div", simd_vec4_div},
+			{"simd/glm_vec1_div", simd_vec1_div},
+			{"simd/glm_vec4_div_lowp", simd_vec4_div_lowp},
+			{"simd/glm_vec4_swizzle_xyzw", simd_vec4_swizzle_xyzw},
+			{"simd/glm_vec1_fma", simd_vec1_fma},
+			{"simd/glm_vec4_fma", simd_vec4_fma},
+			{"simd/glm_vec4_fms", simd_vec4_fms},
+			{"simd/glm_vec4_fnma", simd_vec4_fnma},
+			{"simd/glm_vec4_abs", simd_vec4_abs},
+			{"simd/glm_ivec4_abs", simd_ivec4_abs},
+			{"simd/glm_vec4_inf", simd_vec4_inf},
+			{"simd/glm_vec4_nan", simd_vec4_nan},
+			{"simd/glm_vec4_sign", simd_vec4_sign},
+			{"simd/glm_vec4_round", simd_vec4_round},
+			{"simd/glm_vec4_floor", simd_vec4_floor},
+			{"simd/glm_vec4_roundEven", simd_vec4_roundEven},
+			{"simd/glm_vec4_ceil", simd_vec4_ceil},
+			{"simd/glm_vec4_fract", simd_vec4_fract},
+			{"simd/glm_vec4_mod", simd_vec4_mod},
+			{"simd/glm_vec4_clamp", simd_vec4_clamp},
+			{"simd/glm_vec4_mix", simd_vec4_mix},
+			{"simd/glm_vec4_step", simd_vec4_step},
+			{"simd/glm_vec4_smoothstep", simd_vec4_smoothstep},
+			{"simd/glm_vec1_sqrt_lowp", simd_vec1_sqrt_lowp},
+			{"simd/glm_vec4_sqrt_lowp", simd_vec4_sqrt_lowp},
+			{"simd/glm_vec4_sin", simd_vec4_sin},
+			{"simd/glm_vec4_sin_lowp", simd_vec4_sin_lowp},
+			{"simd/glm_vec4_cos", simd_vec4_cos},
+			{"simd/glm_vec4_cos_lowp", simd_vec4_cos_lowp},
+			{"simd/glm_vec4_sincos", simd_vec4_sincos},
+			{"simd/glm_vec4_sincos_lowp", simd_vec4_sincos_lowp},
+			{"simd/glm_vec4_acos", simd_vec4_acos},
+			{"simd/glm_vec4_acos_lowp", simd_vec4_acos_lowp},
+			{"simd/glm_vec4_atan2", simd_vec4_atan2},
+			{"simd/glm_vec4_atan2_lowp", simd_vec4_atan2_lowp},
+			{"simd/glm_vec4_exp", simd_vec4_exp},
+			{"simd/glm_vec4_exp_lowp", simd_vec4_exp_lowp},
+			{"simd/glm_vec4_log", simd_vec4_log},
+			{"simd/glm_vec4_log_lowp", simd_vec4_log_lowp},
+			{"simd/glm_vec4_pow", simd_vec4_pow},
+			{"simd/glm_vec4_length", simd_vec4_length},
+			{"simd/glm_vec4_distance", simd_vec4_distance},
+			{"simd/glm_vec4_dot", simd_vec4_dot},
+			{"simd/glm_vec1_dot", simd_vec1_dot},
+			{"simd/glm_vec4_cross", simd_vec4_cross},
+			{"simd/glm_vec4_normalize", simd_vec4_normalize},
+			{"simd/glm_vec4_faceforward", simd_vec4_faceforward},
+			{"simd/glm_vec4_reflect", simd_vec4_reflect},
+			{"simd/glm_vec4_refract", simd_vec4_refract},
+			{"simd/glm_i128_interleave", simd_i128_interleave},
+			{"simd/glm_i128_interleave2", simd_i128_interleave2},
+			{"simd/glm_mat4_add", simd_mat4_add},
+			{"simd/glm_mat4_sub", simd_mat4_sub},
+			{"simd/glm_mat4_mul", simd_mat4_mul},
+			{"simd/glm_mat4_mul_vec4", simd_mat4_mul_vec4},
+			{"simd/glm_vec4_mul_mat4", simd_vec4_mul_mat4},
+			{"simd/glm_mat4_matrixCompMult", simd_mat4_matrixCompMult},
+			{"simd/glm_mat4_outerProduct", simd_mat4_outerProduct},
+			{"simd/glm_mat4_transpose", simd_mat4_transpose},
+			{"simd/glm_mat4_determinant", simd_mat4_determinant},
+			{"simd/glm_mat4_determinant_highp", simd_mat4_determinant_highp},
+			{"simd/glm_mat4_determinant_lowp", simd_mat4_determinant_lowp},
+			{"simd/glm_mat4_inverse", simd_mat4_inverse},
+			{"simd/glm_mat4_inverse_lowp", simd_mat4_inverse_lowp},
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				{"simd/glm_vec4x2_fma", simd_vec4x2_fma},
+				{"simd/glm_vec4x2_fms", simd_vec4x2_fms},
+				{"simd/glm_vec4x2_fnma", simd_vec4x2_fnma},
+				{"simd/glm_mat4_mul_vec4_x2", simd_mat4_mul_vec4_x2},
+				{"simd/glm_mat4_mul_2vec4", simd_mat4_mul_2vec4},
+				{"simd/glm_mat4_mul_x2", simd_mat4_mul_x2},
+				{"simd/glm_mat4_inverse_x2", simd_mat4_inverse_x2},
+				{"simd/glm_dmat4_mul", simd_dmat4_mul},
+				{"simd/glm_dmat4_mul_dvec4", simd_dmat4_mul_dvec4},
+#			endif
+#		endif
+	};
+
+	char const * arch_name()
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return "avx2";
+#		elif GLM_ARCH & GLM_ARCH_AVX_BIT
+			return "avx";
+#		elif GLM_ARCH & GLM_ARCH_SSE42_BIT
+			return "sse42";
+#		elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return "sse41";
+#		elif GLM_ARCH & GLM_ARCH_SSSE3_BIT
+			return "ssse3";
+#		elif GLM_ARCH & GLM_ARCH_SSE3_BIT
+			return "sse3";
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return "sse2";
+#		elif GLM_ARCH & GLM_ARCH_NEON_BIT
+			return "neon";
+#		else
+			return "pure";
+#		endif
+	}
+
+	// Whether this CPU runs what the build was compiled for
+	bool arch_supported()
+	{
+#		if (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)) && (GLM_ARCH & GLM_ARCH_X86_BIT)
+			__builtin_cpu_init();
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#			elif GLM_ARCH & GLM_ARCH_AVX_BIT
+				return __builtin_cpu_supports("avx");
+#			elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+				return __builtin_cpu_supports("sse4.1");
+#			endif
+#		endif
+		return true;
+	}
+
+	// Best of many short samples, each repeating the loop for at least 2 milliseconds of CPU time:
+	// the shortest sample is the one least disturbed by the rest of the system
+	double measure(void (*Run)())
+	{
+		std::clock_t const MinClocks = CLOCKS_PER_SEC / 500;
+		int const Samples = 15;
+
+		Run();
+
+		std::size_t Passes = 1;
+		std::clock_t Best = 0;
+		for(;;)
+		{
+			std::clock_t const Start = std::clock();
+			for(std::size_t p = 0; p < Passes; ++p)
+				Run();
+			Best = std::clock() - Start;
+			if(Best >= MinClocks)
+				break;
+			Passes *= 2;
+		}
+
+		for(int s = 1; s < Samples; ++s)
+		{
+			std::clock_t const Start = std::clock();
+			for(std::size_t p = 0; p < Passes; ++p)
+				Run();
+			Best = glm::min(Best, std::clock() - Start);
+		}
+
+		return static_cast<double>(Best) * 1e9 / static_cast<double>(CLOCKS_PER_SEC) / static_cast<double>(Passes * WorkingSet);
+	}
+
+	struct baseline_entry
+	{
+		std::string Arch;
+		std::string Name;
+		double Nanoseconds;
+	};
+
+	// Lines of "arch name ns/op", '#' starts a comment
+	std::vector<baseline_entry> read_baseline(char const * Path)
+	{
+		std::vector<baseline_entry> Entries;
+		std::FILE * File = std::fopen(Path, "r");
+		if(!File)
+			return Entries;
+
+		char Line[256];
+		while(std::fgets(Line, sizeof(Line), File))
+		{
+			char Arch[64], Name[128];
+			double Nanoseconds = 0.0;
+			if(Line[0] == '#' || std::sscanf(Line, "%63s %127s %lf", Arch, Name, &Nanoseconds) != 3)
+				continue;
+			baseline_entry Entry;
+			Entry.Arch = Arch;
+			Entry.Name = Name;
+			Entry.Nanoseconds = Nanoseconds;
+			Entries.push_back(Entry);
+		}
+		std::fclose(File);
+		return Entries;
+	}
+
+	double find_baseline(std::vector<baseline_entry> const & Entries, char const * Arch, char const * Name)
+	{
+		for(std::size_t i = 0; i < Entries.size(); ++i)
+			if(Entries[i].Arch == Arch && Entries[i].Name == Name)
+				return Entries[i].Nanoseconds;
+		return 0.0;
+	}
+
+	bool write_baseline(char const * Path, std::vector<baseline_entry> const & Entries)
+	{
+		std::FILE * File = std::fopen(Path, "w");
+		if(!File)
+			return false;
+		std::fprintf(File, "# GLM microbenchmark baselines: instruction set, benchmark, ns/op\n");
+		std::fprintf(File, "# Written by perf-simd-<arch> --record, only meaningful on the machine that recorded them\n");
+		for(std::size_t i = 0; i < Entries.size(); ++i)
+			std::fprintf(File, "%s %s %.4f\n", Entries[i].Arch.c_str(), Entries[i].Name.c_str(), Entries[i].Nanoseconds);
+		std::fclose(File);
+		return true;
+	}
+}//namespace perf
+
+int main(int argc, char* argv[])
+{
+	using namespace perf;
+	char const * BaselinePath = NULL;
+	char const * RecordPath = NULL;
+	char const * Filter = NULL;
+	double Threshold = 1.5;
+
+	for(int i = 1; i < argc; ++i)
+	{
+		if(!std::strcmp(argv[i], "--baseline") && i + 1 < argc)
+			BaselinePath = argv[++i];
+		else if(!std::strcmp(argv[i], "--record") && i + 1 < argc)
+			RecordPath = argv[++i];
+		else if(!std::strcmp(argv[i], "--filter") && i + 1 < argc)
+			Filter = argv[++i];
+		else if(!std::strcmp(argv[i], "--threshold") && i + 1 < argc)
+			Threshold = std::atof(argv[++i]);
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--baseline FILE] [--threshold RATIO] [--record FILE] [--filter TEXT]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	char const * Arch = arch_name();
+	if(!arch_supported())
+	{
+		std::printf("GLM %s build: not supported by this CPU, skipped\n", Arch);
+		return 0;
+	}
+
+	init_core();
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		init_simd();
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			init_simd_x2();
+#		endif
+#	endif
+
+	std::vector<baseline_entry> const Baseline = BaselinePath ? read_baseline(BaselinePath) : std::vector<baseline_entry>();
+	std::vector<baseline_entry> Results;
+
+	std::printf("GLM %s build, %d elements per pass\n", Arch, static_cast<int>(WorkingSet));
+	std::printf("%-34s %10s %10s %10s %8s %8s\n", "benchmark", "ns/op", "Mop/s", "baseline", "ratio", "vs pure");
+
+	int Error = 0;
+	for(std::size_t b = 0; b < sizeof(Benchmarks) / sizeof(Benchmarks[0]); ++b)
+	{
+		benchmark const & Bench = Benchmarks[b];
+		if(Filter && !std::strstr(Bench.Name, Filter))
+			continue;
+
+		double const Base = find_baseline(Baseline, Arch, Bench.Name);
+
+		// A regression is measured again before it counts, a busy system can slow down a whole sample
+		double Nanoseconds = measure(Bench.Run);
+		for(int Retry = 0; Retry < 3 && Base > 0.0 && Nanoseconds > Base * Threshold; ++Retry)
+			Nanoseconds = glm::min(Nanoseconds, measure(Bench.Run));
+
+		baseline_entry Entry;
+		Entry.Arch = Arch;
+		Entry.Name = Bench.Name;
+		Entry.Nanoseconds = Nanoseconds;
+		Results.push_back(Entry);
+
+		std::printf("%-34s %10.3f %10.1f", Bench.Name, Nanoseconds, 1e3 / Nanoseconds);
+
+		if(Base > 0.0)
+			std::printf(" %10.3f %8.2f", Base, Nanoseconds / Base);
+		else
+			std::printf(" %10s %8s", "-", "-");
+
+		double const Pure = find_baseline(Baseline, "pure", Bench.Name);
+		if(Pure > 0.0)
+			std::printf(" %7.2fx", Pure / Nanoseconds);
+		else
+			std::printf(" %8s", "-");
+
+		if(Base > 0.0 && Nanoseconds > Base * Threshold)
+		{
+			std::printf("  REGRESSION");
+			++Error;
+		}
+		std::printf("\n");
+	}
+
+	if(Error)
+		std::printf("%d benchmarks slower than %.2f times their baseline\n", Error, Threshold);
+
+	if(RecordPath)
+	{
+		std::vector<baseline_entry> Merged;
+		std::vector<baseline_entry> const Previous = read_baseline(RecordPath);
+		for(std::size_t i = 0; i < Previous.size(); ++i)
+			if(Previous[i].Arch != Arch)
+				Merged.push_back(Previous[i]);
+		Merged.insert(Merged.end(), Results.begin(), Results.end());
+
+		if(!write_baseline(RecordPath, Merged))
+		{
+			std::fprintf(stderr, "Can't write %s\n", RecordPath);
+			++Error;
+		}
+	}
+
+	return Error;
+}